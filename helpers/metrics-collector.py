@@ -0,0 +1,61 @@
+# A stand-in for the time-series collector, to try the metrics export without InfluxDB or Telegraf:
+# it prints the lines of the line protocol received on UDP and TCP and how many arrive per second.
+#
+#   python3 metrics-collector.py [port]
+#
+# then set metrics_export_transport to udp or tcp, metrics_export_host to this computer and
+# metrics_export_port to the port (8094 by default). Stop it for a while to see the spool at work.
+
+import asyncio
+import sys
+import time
+
+port = int(sys.argv[1]) if len(sys.argv) > 1 else 8094
+count = 0
+
+
+def received(data, source):
+    global count
+    for line in data.decode("utf-8", "replace").splitlines():
+        if line:
+            count += 1
+            print(f"{source} {line}")
+
+
+class UdpCollector(asyncio.DatagramProtocol):
+    def datagram_received(self, data, addr):
+        received(data, f"udp {addr[0]}")
+
+
+async def tcp_client(reader, writer):
+    peer = writer.get_extra_info("peername")
+    print(f"tcp {peer[0]} connected")
+    while True:
+        line = await reader.readline()
+        if not line:
+            break
+        received(line, f"tcp {peer[0]}")
+    print(f"tcp {peer[0]} disconnected")
+    writer.close()
+
+
+async def rate():
+    global count
+    while True:
+        start = time.monotonic()
+        await asyncio.sleep(10)
+        if count:
+            print(f"{count / (time.monotonic() - start):.1f} lines/s")
+        count = 0
+
+
+async def main():
+    loop = asyncio.get_running_loop()
+    await loop.create_datagram_endpoint(UdpCollector, local_addr=("0.0.0.0", port))
+    server = await asyncio.start_server(tcp_client, "0.0.0.0", port)
+    print(f"listening on udp and tcp {port}")
+    async with server:
+        await asyncio.gather(server.serve_forever(), rate())
+
+
+asyncio.run(main())
@@ -11,6 +11,10 @@ ColumnLayout {
     property bool isOpen: false
     property string title: ""
     default property alias accordionContent: contentPlaceholder.data
+    // created the first time the element is opened, and then kept
+    property Component lazyContent: null
+    property bool wasOpened: false
+    onIsOpenChanged: if (isOpen) wasOpened = true
     spacing: 0
 
     function convertValue(val) {
@@ -81,5 +85,12 @@ ColumnLayout {
         id: contentPlaceholder
         visible: rootElement.isOpen
         Layout.fillWidth: true;
+
+        Loader {
+            Layout.fillWidth: true;
+            active: rootElement.lazyContent !== null && rootElement.wasOpened
+            sourceComponent: rootElement.lazyContent
+            visible: active
+        }
     }
 }
@@ -11,6 +11,10 @@ ColumnLayout {
     property alias textFontSize: accordionText.font.pixelSize
     property alias indicatRectColor: indicatRect.color
     default property alias accordionContent: contentPlaceholder.data
+    // created the first time the element is opened, and then kept
+    property Component lazyContent: null
+    property bool wasOpened: false
+    onIsOpenChanged: if (isOpen) wasOpened = true
     spacing: 0
 
     Layout.fillWidth: true;
@@ -64,5 +68,12 @@ ColumnLayout {
         id: contentPlaceholder
         visible: rootElement.isOpen
         Layout.fillWidth: true;
+
+        Loader {
+            Layout.fillWidth: true;
+            active: rootElement.lazyContent !== null && rootElement.wasOpened
+            sourceComponent: rootElement.lazyContent
+            visible: active
+        }
     }
 }
@@ -59,7 +59,8 @@ ColumnLayout {
                            filter+= "[%1%2]".arg(text[i].toUpperCase()).arg(text[i].toLowerCase())
                         filter+="*"
                         print(filter)
-                        folderModel.nameFilters = [filter + ".zwo", filter + ".xml"]
+                        // the programs with the text in the description or in the tags too
+                        folderModel.nameFilters = [filter + ".zwo", filter + ".xml"].concat(rootItem.searchTrainPrograms(text))
                     }
                     id: filterField
                     onTextChanged: updateFilter()
@@ -171,9 +172,10 @@ ColumnLayout {
                         console.log(fileUrl + ' selected');
                         trainprogram_preview(fileUrl)
                         powerSeries.clear();
-                        for(var i=0;i<rootItem.preview_workout_points;i+=10)
+                        var watt = rootItem.preview_workout_watt
+                        for(var i=0;i<watt.length;i++)
                         {
-                            powerSeries.append(i * 1000, rootItem.preview_workout_watt[i]);
+                            powerSeries.append(i * 10 * 1000, watt[i]);
                         }
                         rootItem.update_chart_power(powerChart);
                         //trainprogram_open_clicked(fileUrl);
@@ -189,7 +191,7 @@ ColumnLayout {
         ScrollView {
             anchors.top: parent.top
             ScrollBar.vertical.policy: ScrollBar.AlwaysOn
-            contentHeight: date.height + description.height + powerChart.height
+            contentHeight: date.height + description.height + summary.height + powerChart.height
             Layout.preferredHeight: parent.height
             Layout.fillWidth: true
             Layout.minimumWidth: 100
@@ -232,10 +234,23 @@ ColumnLayout {
                     anchors.horizontalCenter: parent.horizontalCenter
                 }
 
+                Text {
+                    anchors.top: description.bottom
+                    id: summary
+                    width: parent.width
+                    text: rootItem.previewWorkoutSummary
+                    font.pixelSize: 10
+                    wrapMode: Text.WordWrap
+                    color: "white"
+                    horizontalAlignment: Text.AlignHCenter
+                    verticalAlignment: Text.AlignVCenter
+                    anchors.horizontalCenter: parent.horizontalCenter
+                }
+
                 Item {
                     anchors.left: parent.left
                     anchors.right: parent.right
-                    anchors.top: description.bottom
+                    anchors.top: summary.bottom
                     anchors.bottom: parent.bottom
 
                     ChartView {
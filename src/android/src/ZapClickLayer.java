@@ -26,7 +26,6 @@ import com.che.zap.play.ZwiftPlayDevice;
 
 import org.jetbrains.annotations.Nullable;
 
-import com.google.protobuf.InvalidProtocolBufferException;
 
 import java.util.HashMap;
 import java.util.List;
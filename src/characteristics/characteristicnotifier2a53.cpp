@@ -1,5 +1,6 @@
 #include "characteristicnotifier2a53.h"
 #include "devices/treadmill.h"
+#include "latencymonitor.h"
 
 CharacteristicNotifier2A53::CharacteristicNotifier2A53(bluetoothdevice *Bike, QObject *parent)
     : CharacteristicNotifier(0x2a53, parent), Bike(Bike) {}
@@ -16,5 +17,6 @@ int CharacteristicNotifier2A53::notify(QByteArray &value) {
     value.append((char)((distance >> 8) & 0xFF));
     value.append((char)((distance >> 16) & 0xFF));
     value.append((char)((distance >> 24) & 0xFF));
+    latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
     return CN_OK;
 }
@@ -1,4 +1,5 @@
 #include "characteristicnotifier2a5b.h"
+#include "latencymonitor.h"
 #include <QSettings>
 
 CharacteristicNotifier2A5B::CharacteristicNotifier2A5B(bluetoothdevice *Bike, QObject *parent)
@@ -32,5 +33,6 @@ int CharacteristicNotifier2A5B::notify(QByteArray &value) {
     value.append((char)(((uint16_t)Bike->currentCrankRevolutions()) >> 8) & 0xFF); // revs count
     value.append((char)(Bike->lastCrankEventTime() & 0xff));                       // eventtime
     value.append((char)(Bike->lastCrankEventTime() >> 8) & 0xFF);                  // eventtime
+    latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
     return CN_OK;
 }
@@ -1,4 +1,5 @@
 #include "characteristicnotifier2a63.h"
+#include "latencymonitor.h"
 
 CharacteristicNotifier2A63::CharacteristicNotifier2A63(bluetoothdevice *Bike, QObject *parent)
     : CharacteristicNotifier(0x2a63, parent), Bike(Bike) {}
@@ -64,6 +65,7 @@ int CharacteristicNotifier2A63::notify(QByteArray &value) {
       value.append((char)(((uint16_t)Bike->currentCrankRevolutions()) >> 8) & 0xFF); // revs count
       value.append((char)(Bike->lastCrankEventTime() & 0xff));                       // eventtime
       value.append((char)(Bike->lastCrankEventTime() >> 8) & 0xFF);                  // eventtime
+      latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
       return CN_OK;
     } else
         return CN_INVALID;
@@ -1,5 +1,6 @@
 #include "characteristicnotifier2acd.h"
 #include "devices/treadmill.h"
+#include "latencymonitor.h"
 #include <qmath.h>
 
 CharacteristicNotifier2ACD::CharacteristicNotifier2ACD(bluetoothdevice *Bike, QObject *parent)
@@ -57,6 +58,7 @@ int CharacteristicNotifier2ACD::notify(QByteArray &value) {
         value.append(rampBytes); // ramp angle
 
         value.append(Bike->currentHeart().value()); // current heart rate
+        latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
         return CN_OK;
     } else
         return CN_INVALID;
@@ -2,12 +2,18 @@
 #include "devices/elliptical.h"
 #include "devices/rower.h"
 #include "devices/treadmill.h"
+#include "latencymonitor.h"
+#include "qzclock.h"
+#include "qztrace.h"
 #include <QSettings>
 
 CharacteristicNotifier2AD2::CharacteristicNotifier2AD2(bluetoothdevice *Bike, QObject *parent)
     : CharacteristicNotifier(0x2ad2, parent), Bike(Bike) {}
 
 int CharacteristicNotifier2AD2::notify(QByteArray &value) {
+    // age of the packet the values come from
+    QZ_TRACE(qztrace::VIRTUAL, "2ad2 notify", "age",
+             Bike->ingressNs() ? qzclock::nowMs() - Bike->ingressNs() / 1000000 : 0);
     bluetoothdevice::BLUETOOTH_TYPE dt = Bike->deviceType();
 
     QSettings settings;
@@ -43,6 +49,7 @@ int CharacteristicNotifier2AD2::notify(QByteArray &value) {
 
         value.append(char(Bike->currentHeart().value())); // Actual value.
         value.append((char)0);                            // Bkool FTMS protocol HRM offset 1280 fix
+        latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
         return CN_OK;
     } else if (dt == bluetoothdevice::TREADMILL || dt == bluetoothdevice::ELLIPTICAL || dt == bluetoothdevice::ROWING) {
         uint16_t normalizeSpeed = (uint16_t)qRound(Bike->currentSpeed().value() * 100);
@@ -71,6 +78,7 @@ int CharacteristicNotifier2AD2::notify(QByteArray &value) {
 
         value.append(char(Bike->currentHeart().value())); // Actual value.
         value.append((char)0);
+        latencymonitor::record(latencymonitor::NOTIFY, Bike->ingressNs());
         return CN_OK;
     } else
         return CN_INVALID;
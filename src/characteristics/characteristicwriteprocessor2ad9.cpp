@@ -1,6 +1,7 @@
 #include "characteristicwriteprocessor2ad9.h"
 #include "devices/elliptical.h"
 #include "devices/ftmsbike/ftmsbike.h"
+#include "qztrace.h"
 #include "treadmill.h"
 #include <QSettings>
 #include <QtMath>
@@ -12,6 +13,7 @@ CharacteristicWriteProcessor2AD9::CharacteristicWriteProcessor2AD9(double bikeRe
     : CharacteristicWriteProcessor(bikeResistanceGain, bikeResistanceOffset, bike, parent), notifier(notifier) {}
 
 int CharacteristicWriteProcessor2AD9::writeProcess(quint16 uuid, const QByteArray &data, QByteArray &reply) {
+    QZ_TRACE_PACKET(qztrace::VIRTUAL, "2ad9 write", data);
     if (data.size()) {
         bluetoothdevice::BLUETOOTH_TYPE dt = Bike->deviceType();
         if (dt == bluetoothdevice::BIKE) {
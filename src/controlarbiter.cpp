@@ -0,0 +1,173 @@
+#include "controlarbiter.h"
+#include <QtMath>
+
+static thread_local controlarbiter::SOURCE currentRequestSource = controlarbiter::EXTERNAL;
+
+controlarbiter::controlarbiter() {
+    for (int i = 0; i < TARGETS; i++)
+        group[i] = i;
+    // a training program changes its targets only at the start of a row, so it must hold them much longer than Zwift
+    // that repeats them every second
+    hold[EXTERNAL] = 3000;
+    hold[PROGRAM] = 30000;
+    hold[REMOTE] = 10000;
+    hold[USER] = 10000;
+    hold[INTERNAL] = 0;
+}
+
+void controlarbiter::apply(request &r, double value, double extra, qint64 nowMs) {
+    r.applied = true;
+    r.value = value;
+    r.extra = extra;
+    r.appliedMs = nowMs;
+    r.pending = false;
+    m_forwarded++;
+}
+
+controlarbiter::DECISION controlarbiter::submit(SOURCE source, TARGET target, double value, double extra,
+                                                qint64 nowMs) {
+    request &r = requests[target];
+    if (source == INTERNAL) {
+        apply(r, value, extra, nowMs);
+        return FORWARD;
+    }
+
+    ownership &o = owners[group[target]];
+    if (o.owned && o.source > source && nowMs - o.lastMs < hold[o.source]) {
+        // kept for when the owner lets the target go, unless a source with a higher priority is already waiting
+        if (!r.rejected || source >= r.rejectedSource) {
+            r.rejected = true;
+            r.rejectedValue = value;
+            r.rejectedExtra = extra;
+            r.rejectedSource = source;
+        }
+        m_rejected++;
+        return REJECT;
+    }
+    o.owned = true;
+    o.source = source;
+    o.lastMs = nowMs;
+    if (r.rejected && r.rejectedSource == source)
+        r.rejected = false;
+
+    bool unchanged = r.applied && qAbs(value - r.value) <= r.tolerance && qAbs(extra - r.extra) <= r.tolerance;
+    if (unchanged && nowMs - r.appliedMs < refresh) {
+        // it also cancels a pending request: the machine already has this target
+        r.pending = false;
+        m_dropped++;
+        return DROP;
+    }
+
+    if (r.applied && nowMs - r.appliedMs < r.minInterval) {
+        // last writer wins
+        r.pending = true;
+        r.pendingValue = value;
+        r.pendingExtra = extra;
+        r.pendingSource = source;
+        m_deferred++;
+        return DEFER;
+    }
+
+    apply(r, value, extra, nowMs);
+    return FORWARD;
+}
+
+bool controlarbiter::takeDue(TARGET target, qint64 nowMs, double *value, double *extra, SOURCE *source) {
+    request &r = requests[target];
+    if (r.pending && nowMs - r.appliedMs >= r.minInterval) {
+        *value = r.pendingValue;
+        *extra = r.pendingExtra;
+        *source = r.pendingSource;
+        apply(r, r.pendingValue, r.pendingExtra, nowMs);
+        return true;
+    }
+
+    if (!r.rejected || rejectedDueMs(target) > nowMs)
+        return false;
+    // submitted again now that the owner is gone: it can still be dropped or deferred like any other request
+    r.rejected = false;
+    if (submit(r.rejectedSource, target, r.rejectedValue, r.rejectedExtra, nowMs) != FORWARD)
+        return false;
+    *value = r.rejectedValue;
+    *extra = r.rejectedExtra;
+    *source = r.rejectedSource;
+    return true;
+}
+
+qint64 controlarbiter::rejectedDueMs(int target) const {
+    const request &r = requests[target];
+    const ownership &o = owners[group[target]];
+    if (!o.owned || o.source <= r.rejectedSource)
+        return 0;
+    return o.lastMs + hold[o.source];
+}
+
+qint64 controlarbiter::nextDueMs() const {
+    qint64 due = -1;
+    for (int i = 0; i < TARGETS; i++) {
+        const request &r = requests[i];
+        if (r.pending && (due < 0 || r.appliedMs + r.minInterval < due))
+            due = r.appliedMs + r.minInterval;
+        if (r.rejected && (due < 0 || rejectedDueMs(i) < due))
+            due = rejectedDueMs(i);
+    }
+    return due;
+}
+
+void controlarbiter::release(SOURCE source) {
+    for (int i = 0; i < TARGETS; i++) {
+        if (owners[i].owned && owners[i].source == source)
+            owners[i].owned = false;
+        if (requests[i].rejected && requests[i].rejectedSource == source)
+            requests[i].rejected = false;
+    }
+}
+
+controlarbiter::SOURCE controlarbiter::owner(TARGET target, qint64 nowMs) const {
+    const ownership &o = owners[group[target]];
+    if (o.owned && nowMs - o.lastMs < hold[o.source])
+        return o.source;
+    return EXTERNAL;
+}
+
+bool controlarbiter::allowed(SOURCE source, TARGET target, qint64 nowMs) const {
+    return source == INTERNAL || owner(target, nowMs) <= source;
+}
+
+QString controlarbiter::sourceName(SOURCE source) {
+    switch (source) {
+    case EXTERNAL:
+        return QStringLiteral("external");
+    case PROGRAM:
+        return QStringLiteral("program");
+    case REMOTE:
+        return QStringLiteral("remote");
+    case USER:
+        return QStringLiteral("user");
+    case INTERNAL:
+        return QStringLiteral("internal");
+    default:
+        return QString();
+    }
+}
+
+QString controlarbiter::targetName(TARGET target) {
+    switch (target) {
+    case RESISTANCE:
+        return QStringLiteral("resistance");
+    case POWER:
+        return QStringLiteral("power");
+    case INCLINATION:
+        return QStringLiteral("inclination");
+    case SPEED:
+        return QStringLiteral("speed");
+    default:
+        return QString();
+    }
+}
+
+controlarbiter::SOURCE controlarbiter::currentSource() { return currentRequestSource; }
+
+controlarbiter::scope::scope(SOURCE source) : previous(currentRequestSource) { currentRequestSource = source; }
+
+controlarbiter::scope::~scope() { currentRequestSource = previous; }
@@ -0,0 +1,134 @@
+#ifndef CONTROLARBITER_H
+#define CONTROLARBITER_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Decides which of the target requests sent to a machine really reach it. The same machine receives targets
+ * from Zwift (FTMS, DirCon, ANT+), the training program, the web and tcp templates and the buttons on the screen:
+ * - a source owns a target while it keeps writing it, and a source with a lower priority can't change it until the
+ *   owner has been silent for its hold time. Targets driving the same actuator (the brake of a bike) can share their
+ *   owner.
+ * - unchanged targets are dropped, and re-sent only after refreshTime.
+ * - the machine gets at most one target every minInterval: the requests in between are coalesced and the last one is
+ *   applied when the interval ends.
+ * - a rejected request isn't lost: the last one of the source with the highest priority waits for the hold of the
+ *   owner to expire and is applied then, since the training program sends its targets only at the start of a row.
+ * All the times are in milliseconds, from the same clock (qzclock).
+ */
+class controlarbiter {
+  public:
+    // in priority order. INTERNAL is the device re-applying a request (gears, difficulty): it's never filtered
+    enum SOURCE { EXTERNAL = 0, PROGRAM, REMOTE, USER, INTERNAL, SOURCES };
+    enum TARGET { RESISTANCE = 0, POWER, INCLINATION, SPEED, TARGETS };
+    enum DECISION { FORWARD = 0, DEFER, DROP, REJECT };
+
+    controlarbiter();
+
+    /**
+     * @brief submit Arbitrates a request.
+     * @return FORWARD when it must be applied now, DEFER when it will be returned by takeDue, DROP when the machine
+     * already has this target, REJECT when a source with a higher priority owns the target: takeDue returns it when
+     * the owner releases the target or its hold expires.
+     */
+    DECISION submit(SOURCE source, TARGET target, double value, double extra, qint64 nowMs);
+
+    /**
+     * @brief takeDue Gets the coalesced request of the target when its interval is over, or the rejected one when the
+     * owner has let the target go. The request is then considered applied.
+     */
+    bool takeDue(TARGET target, qint64 nowMs, double *value, double *extra, SOURCE *source);
+
+    // when the next deferred request is due, -1 if none
+    qint64 nextDueMs() const;
+
+    // forgets the ownership and the rejected requests of the source, for example when the training program ends
+    void release(SOURCE source);
+
+    // the target uses the owner of another one
+    void share(TARGET target, TARGET with) { group[target] = group[with]; }
+    void setMinInterval(TARGET target, qint64 ms) { requests[target].minInterval = ms; }
+    void setTolerance(TARGET target, double tolerance) { requests[target].tolerance = tolerance; }
+    void setHoldTime(SOURCE source, qint64 ms) { hold[source] = ms; }
+    void setRefreshTime(qint64 ms) { refresh = ms; }
+
+    SOURCE owner(TARGET target, qint64 nowMs) const;
+
+    /**
+     * @brief allowed Whether the source could change the target now, without submitting anything. For the requests
+     * that don't reach the machine (the Peloton resistance shown on the tiles): they follow the owner of the target
+     * but aren't deduplicated or coalesced.
+     */
+    bool allowed(SOURCE source, TARGET target, qint64 nowMs) const;
+
+    quint64 forwarded() const { return m_forwarded; }
+    quint64 deferred() const { return m_deferred; }
+    quint64 dropped() const { return m_dropped; }
+    quint64 rejected() const { return m_rejected; }
+
+    static QString sourceName(SOURCE source);
+    static QString targetName(TARGET target);
+
+    /**
+     * @brief currentSource The source of the requests made by this thread right now: EXTERNAL unless a scope says
+     * otherwise.
+     */
+    static SOURCE currentSource();
+
+    /**
+     * @brief Tags the requests made in its lifetime with a source. The requests reach the devices through direct
+     * signal/slot connections, so a scope around the emit of the signal is enough.
+     */
+    class scope {
+      public:
+        explicit scope(SOURCE source);
+        ~scope();
+
+      private:
+        SOURCE previous;
+        Q_DISABLE_COPY(scope)
+    };
+
+  private:
+    class request {
+      public:
+        qint64 minInterval = 250;
+        double tolerance = 0.01;
+        bool applied = false;
+        double value = 0;
+        double extra = 0;
+        qint64 appliedMs = 0;
+        bool pending = false;
+        double pendingValue = 0;
+        double pendingExtra = 0;
+        SOURCE pendingSource = EXTERNAL;
+        bool rejected = false;
+        double rejectedValue = 0;
+        double rejectedExtra = 0;
+        SOURCE rejectedSource = EXTERNAL;
+    };
+    class ownership {
+      public:
+        bool owned = false;
+        SOURCE source = EXTERNAL;
+        qint64 lastMs = 0;
+    };
+
+    void apply(request &r, double value, double extra, qint64 nowMs);
+    // when the rejected request of the target can be submitted again
+    qint64 rejectedDueMs(int target) const;
+
+    request requests[TARGETS];
+    ownership owners[TARGETS];
+    int group[TARGETS];
+    qint64 hold[SOURCES];
+    qint64 refresh = 5000;
+
+    quint64 m_forwarded = 0;
+    quint64 m_deferred = 0;
+    quint64 m_dropped = 0;
+    quint64 m_rejected = 0;
+};
+
+#endif // CONTROLARBITER_H
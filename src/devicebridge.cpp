@@ -0,0 +1,163 @@
+#include "devicebridge.h"
+#include "qzsettings.h"
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSettings>
+
+// the last octet of the mac address moved by offset, since the clients tell the machines apart by it
+static QString macWithOffset(const QString &mac, int offset) {
+    int last = mac.lastIndexOf(QLatin1Char(':'));
+    bool ok = false;
+    int octet = mac.mid(last + 1).toInt(&ok, 16);
+    if (last < 0 || !ok)
+        return mac;
+    return mac.left(last + 1) + QStringLiteral("%1").arg((octet + offset) & 0xFF, 2, 16, QLatin1Char('0')).toUpper();
+}
+
+QList<bridgemachine> bridgemachine::load(const QString &fileName) {
+    QList<bridgemachine> machines;
+    QFile input(fileName);
+    if (!input.open(QIODevice::ReadOnly)) {
+        qDebug() << QStringLiteral("devicebridge: unable to read") << fileName;
+        return machines;
+    }
+
+    QSettings settings;
+    uint16_t basePort =
+        settings.value(QZSettings::dircon_server_base_port, QZSettings::default_dircon_server_base_port).toUInt();
+    int baseId = settings.value(QZSettings::dircon_id, QZSettings::default_dircon_id).toInt();
+    QString mac = DirconManager::getMacAddress();
+
+    const QJsonArray list = QJsonDocument::fromJson(input.readAll()).object()[QStringLiteral("machines")].toArray();
+    for (int i = 0; i < list.count(); i++) {
+        QJsonObject json = list.at(i).toObject();
+        bridgemachine m;
+        m.device = json[QStringLiteral("device")].toString();
+        // the ports of the settings stay to the virtual device of a single machine; a machine takes up to 4 ports
+        m.dircon.basePort = json[QStringLiteral("dirconPort")].toInt(basePort + ((i + 1) * 10));
+        m.dircon.id = json[QStringLiteral("dirconId")].toInt(baseId + i + 1);
+        m.dircon.mac = json[QStringLiteral("mac")].toString(macWithOffset(mac, i + 1));
+        m.resistanceOffset = json[QStringLiteral("resistanceOffset")].toInt(m.resistanceOffset);
+        m.resistanceGain = json[QStringLiteral("resistanceGain")].toDouble(m.resistanceGain);
+        m.pollDeviceTime = json[QStringLiteral("pollDeviceTime")].toInt(m.pollDeviceTime);
+        m.noWriteResistance = json[QStringLiteral("noWriteResistance")].toBool(m.noWriteResistance);
+        m.noHeartService = json[QStringLiteral("noHeartService")].toBool(m.noHeartService);
+        if (m.device.isEmpty()) {
+            qDebug() << QStringLiteral("devicebridge: machine without a device name skipped") << i;
+            continue;
+        }
+        machines.append(m);
+    }
+    return machines;
+}
+
+devicebridge::devicebridge(const QList<bridgemachine> &machines, QObject *parent) : QObject(parent) {
+    for (const bridgemachine &m : machines) {
+        pipeline *p = new pipeline;
+        p->machine = m;
+        pipelines.append(p);
+    }
+
+    turnTimer.setSingleShot(true);
+    turnTimer.setInterval(discoveryTurnMs);
+    connect(&turnTimer, &QTimer::timeout, this, &devicebridge::nextTurn);
+}
+
+devicebridge::~devicebridge() {
+    for (pipeline *p : qAsConst(pipelines)) {
+        if (p->device)
+            disconnect(p->device, nullptr, this, nullptr);
+        delete p->dircon;
+        delete p->manager;
+        delete p;
+    }
+}
+
+bool devicebridge::start() {
+    // the devices start the virtual device of the settings, with its DirCon on the ports of the settings: every
+    // machine would advertise on the same adapter and listen on the same ports
+    QSettings settings;
+    if (settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool()) {
+        qDebug() << QStringLiteral("devicebridge: disable the virtual device to bridge the machines");
+        return false;
+    }
+
+    mdnsServer = new QMdnsEngine::Server(this);
+    for (pipeline *p : qAsConst(pipelines))
+        p->machine.dircon.mdnsServer = mdnsServer;
+    nextTurn();
+    return true;
+}
+
+void devicebridge::nextTurn() {
+    // the machines share the adapter: a discovery at a time, and the accessories of the settings are scanned by one
+    // manager at a time too
+    int count = pipelines.count();
+    for (int i = 1; i <= count; i++) {
+        int next = (turn + i) % count;
+        pipeline *p = pipelines.at(next);
+        if (p->device)
+            continue;
+
+        for (pipeline *other : qAsConst(pipelines)) {
+            if (other != p && other->manager && !other->device)
+                other->manager->stopDiscovery();
+        }
+        if (!p->manager) {
+            qDebug() << QStringLiteral("devicebridge: looking for") << p->machine.device
+                     << QStringLiteral("dircon port") << p->machine.dircon.basePort << QStringLiteral("id")
+                     << p->machine.dircon.id;
+            p->manager = new bluetooth(false, p->machine.device, p->machine.noWriteResistance,
+                                       p->machine.noHeartService, p->machine.pollDeviceTime, true, false,
+                                       p->machine.resistanceOffset, p->machine.resistanceGain);
+            connect(p->manager, &bluetooth::deviceConnected, this, [this, p]() { deviceConnected(p); });
+        } else {
+            // nothing if it is still discovering
+            p->manager->startDiscovery();
+        }
+        turn = next;
+        turnTimer.start();
+        return;
+    }
+    // every machine is connected
+    turnTimer.stop();
+}
+
+void devicebridge::deviceConnected(pipeline *p) {
+    bluetoothdevice *device = p->manager->device();
+    if (!device || device == p->device)
+        return;
+
+    delete p->dircon;
+    p->device = device;
+    p->dircon = new DirconManager(device, p->machine.resistanceOffset, p->machine.resistanceGain, this,
+                                  p->machine.dircon);
+    qDebug() << QStringLiteral("devicebridge:") << p->machine.device << QStringLiteral("connected, published on")
+             << p->machine.dircon.basePort << QStringLiteral("machines connected") << connectedCount();
+
+    // the manager deletes the device when it restarts the discovery, the endpoint must not outlive it
+    connect(device, &QObject::destroyed, this, [this, p]() {
+        delete p->dircon;
+        p->dircon = nullptr;
+        p->device = nullptr;
+        // the machine waits for its turn, unless no one is discovering
+        if (!turnTimer.isActive())
+            nextTurn();
+    });
+
+    // the turn goes to the next machine
+    if (pipelines.indexOf(p) == turn)
+        nextTurn();
+}
+
+int devicebridge::connectedCount() const {
+    int count = 0;
+    for (const pipeline *p : pipelines) {
+        if (p->dircon)
+            count++;
+    }
+    return count;
+}
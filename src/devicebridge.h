@@ -0,0 +1,68 @@
+#ifndef DEVICEBRIDGE_H
+#define DEVICEBRIDGE_H
+
+#include "devices/bluetooth.h"
+#include "devices/dircon/dirconmanager.h"
+#include <QList>
+#include <QObject>
+#include <QTimer>
+
+// a machine of the bridge, with the settings that are its own
+class bridgemachine {
+  public:
+    // the bluetooth name, as for -name
+    QString device;
+    DirconEndpoint dircon;
+    int8_t resistanceOffset = 4;
+    double resistanceGain = 1.0;
+    uint32_t pollDeviceTime = 200;
+    bool noWriteResistance = false;
+    bool noHeartService = true;
+
+    /**
+     * @brief load The machines of a json file, as {"machines": [{"device": "KICKR BIKE 1234", "dirconPort": 36876,
+     * "dirconId": 1, "resistanceOffset": 4, "resistanceGain": 1.0, "pollDeviceTime": 200}, ...]}. A machine without
+     * the port and the id gets the next ones after the settings, with its own mac address.
+     */
+    static QList<bridgemachine> load(const QString &fileName);
+};
+
+/**
+ * @brief Bridges several machines in one process, each to its own DirCon endpoint: every machine has its bluetooth
+ * discovery filtered on its name, and once connected its DirCon ports and mDNS name. The pipelines share the event
+ * loop and the mDNS responder, so a machine more is a discovery filter and a few sockets more. The machines not
+ * connected take turns to discover, one at a time. Started with -bridge in -no-gui mode.
+ */
+class devicebridge : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit devicebridge(const QList<bridgemachine> &machines, QObject *parent = nullptr);
+    ~devicebridge();
+
+    // false if the settings would start a virtual device for every machine
+    bool start();
+    int connectedCount() const;
+
+    // how long a machine discovers before the next one not connected
+    static const int discoveryTurnMs = 30000;
+
+  private:
+    class pipeline {
+      public:
+        bridgemachine machine;
+        bluetooth *manager = nullptr;
+        bluetoothdevice *device = nullptr;
+        DirconManager *dircon = nullptr;
+    };
+
+    void deviceConnected(pipeline *p);
+    void nextTurn();
+
+    QList<pipeline *> pipelines;
+    QMdnsEngine::Server *mdnsServer = nullptr;
+    QTimer turnTimer;
+    int turn = -1;
+};
+
+#endif // DEVICEBRIDGE_H
@@ -0,0 +1,243 @@
+#include "devicefleet.h"
+#include "characteristics/characteristicnotifier2acd.h"
+#include "characteristics/characteristicnotifier2ad2.h"
+#include "devices/fakebike/fakebike.h"
+#include "devices/fakeelliptical/fakeelliptical.h"
+#include "devices/fakerower/fakerower.h"
+#include "devices/faketreadmill/faketreadmill.h"
+#include "devices/ftmsbike/ftmsbike.h"
+#include "homeform.h"
+#include <QDebug>
+#include <QFile>
+#include <QJsonDocument>
+#include <QtMath>
+#include <cstdio>
+
+fleetclient::fleetclient(bluetoothdevice *device, int intervalMs, int controlIntervalMs, quint32 seed,
+                         QObject *parent)
+    : QObject(parent), device(device), random(seed), controlInterval(controlIntervalMs) {
+    bluetoothdevice::BLUETOOTH_TYPE dt = device->deviceType();
+    if (dt == bluetoothdevice::TREADMILL)
+        notifier = new CharacteristicNotifier2ACD(device, this);
+    else
+        notifier = new CharacteristicNotifier2AD2(device, this);
+    // the control point handles only bikes and treadmills
+    if (dt == bluetoothdevice::BIKE || dt == bluetoothdevice::TREADMILL)
+        writeProcessor = new CharacteristicWriteProcessor2AD9(1.0, 0, device, nullptr, this);
+
+    timer.setInterval(intervalMs);
+    timer.setTimerType(Qt::PreciseTimer);
+    connect(&timer, &QTimer::timeout, this, &fleetclient::tick);
+}
+
+void fleetclient::start() {
+    lastControlNs = qzclock::nowNs();
+    timer.start();
+}
+
+void fleetclient::stop() {
+    timer.stop();
+    if (controlSentNs)
+        controlsLost++;
+    controlSentNs = 0;
+}
+
+void fleetclient::tick() {
+    QByteArray value;
+    qint64 before = qzclock::nowNs();
+    int ret = notifier->notify(value);
+    qint64 after = qzclock::nowNs();
+    if (ret == CN_OK) {
+        notifications++;
+        encodeNs.record(after - before);
+        qint64 publishedNs = device->metricsPublishedNs();
+        if (publishedNs)
+            dataAgeUs.record((after - publishedNs) / 1000);
+    }
+
+    if (!writeProcessor)
+        return;
+    if (controlSentNs)
+        checkControl();
+    else if (after - lastControlNs >= (qint64)controlInterval * 1000000)
+        sendControl();
+}
+
+void fleetclient::sendControl() {
+    QByteArray data;
+    if (device->deviceType() == bluetoothdevice::BIKE) {
+        controlTarget = random.bounded(150, 251);
+        uint16_t power = (uint16_t)controlTarget;
+        data.append((char)FTMS_SET_TARGET_POWER);
+        data.append((char)(power & 0xFF));
+        data.append((char)(power >> 8));
+    } else {
+        controlTarget = random.bounded(80, 141) / 10.0;
+        uint16_t speed = (uint16_t)qRound(controlTarget * 100.0);
+        data.append((char)0x02); // set target speed
+        data.append((char)(speed & 0xFF));
+        data.append((char)(speed >> 8));
+    }
+
+    QByteArray reply;
+    controlSentNs = qzclock::nowNs();
+    lastControlNs = controlSentNs;
+    writeProcessor->writeProcess(0x2AD9, data, reply);
+    controlsSent++;
+}
+
+void fleetclient::checkControl() {
+    double current = device->deviceType() == bluetoothdevice::BIKE ? device->wattsMetric().value()
+                                                                    : device->currentSpeed().value();
+    // only an update after the request can show it applied
+    bool applied = device->metricsPublishedNs() > controlSentNs && fabs(current - controlTarget) < 0.5;
+    qint64 now = qzclock::nowNs();
+    if (applied) {
+        controlUs.record((now - controlSentNs) / 1000);
+        controlSentNs = 0;
+    } else if (now - controlSentNs > 5000000000LL) {
+        qDebug() << QStringLiteral("fleetclient: control request not applied") << controlTarget;
+        controlsLost++;
+        controlSentNs = 0;
+    }
+}
+
+devicefleet::devicefleet(const fleetconfig &config, QObject *parent) : QObject(parent), config(config) {
+    probeTimer.setInterval(probeInterval);
+    probeTimer.setTimerType(Qt::PreciseTimer);
+    connect(&probeTimer, &QTimer::timeout, this, &devicefleet::probe);
+    durationTimer.setSingleShot(true);
+    connect(&durationTimer, &QTimer::timeout, this, &devicefleet::stop);
+}
+
+devicefleet::~devicefleet() {
+    qDeleteAll(clients);
+    qDeleteAll(devices);
+    qDeleteAll(profiles);
+}
+
+bluetoothdevice *devicefleet::createDevice(const QString &type, telemetryprofile *profile) {
+    // no virtual device: the fleetclients take its place
+    if (type == QStringLiteral("treadmill")) {
+        faketreadmill *d = new faketreadmill(true, true, true);
+        d->simulate(profile, config.deviceInterval);
+        return d;
+    } else if (type == QStringLiteral("elliptical")) {
+        fakeelliptical *d = new fakeelliptical(true, true, true);
+        d->simulate(profile, config.deviceInterval);
+        return d;
+    } else if (type == QStringLiteral("rower")) {
+        fakerower *d = new fakerower(true, true, true);
+        d->simulate(profile, config.deviceInterval);
+        return d;
+    }
+    fakebike *d = new fakebike(true, true, true);
+    d->simulate(profile, config.deviceInterval);
+    return d;
+}
+
+void devicefleet::start() {
+    static const QStringList mixed = {QStringLiteral("bike"), QStringLiteral("treadmill"),
+                                      QStringLiteral("elliptical"), QStringLiteral("rower")};
+
+    qDebug() << QStringLiteral("devicefleet: starting") << config.devices << config.type << QStringLiteral("devices")
+             << config.clients << QStringLiteral("clients, profile") << telemetryprofile::name(config.profile);
+
+    for (int i = 0; i < config.devices; i++) {
+        telemetryprofile *p = new telemetryprofile(config.profile, config.seed + i);
+        p->setDropoutRate(config.dropoutsPerMinute);
+        // every rider is a bit different
+        p->setFtp(160 + ((config.seed + i) * 37) % 140);
+        profiles.append(p);
+        QString type = config.type == QStringLiteral("mixed") ? mixed.at(i % mixed.count()) : config.type;
+        devices.append(createDevice(type, p));
+    }
+    for (int i = 0; i < config.clients && !devices.isEmpty(); i++) {
+        fleetclient *c = new fleetclient(devices.at(i % devices.count()), config.clientInterval,
+                                         config.controlInterval, config.seed + 1000 + i);
+        clients.append(c);
+        c->start();
+    }
+
+    startNs = qzclock::nowNs();
+    lastProbeNs = startNs;
+    probeTimer.start();
+    durationTimer.start(config.duration * 1000);
+}
+
+void devicefleet::probe() {
+    qint64 now = qzclock::nowNs();
+    loopLagUs.record(qMax((qint64)0, ((now - lastProbeNs) / 1000) - (qint64)probeInterval * 1000));
+    lastProbeNs = now;
+}
+
+void devicefleet::stop() {
+    stopNs = qzclock::nowNs();
+    probeTimer.stop();
+    for (fleetclient *c : qAsConst(clients))
+        c->stop();
+
+    QJsonObject r = report();
+    QByteArray json = QJsonDocument(r).toJson();
+    qDebug() << QStringLiteral("devicefleet: report") << json;
+    fprintf(stdout, "%s\n", json.constData());
+    fflush(stdout);
+
+    QString filename = config.reportFile;
+    if (filename.isEmpty())
+        filename = homeform::getWritableAppDir() + QStringLiteral("QZ-fleet-") +
+                   QDateTime::currentDateTime().toString("yyyyMMddhhmmss") + QStringLiteral(".json");
+    QFile f(filename);
+    if (f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        f.write(json);
+        f.close();
+    } else {
+        qDebug() << QStringLiteral("devicefleet: unable to write") << filename << f.errorString();
+    }
+
+    emit finished();
+}
+
+QJsonObject devicefleet::report() const {
+    double seconds = (double)((stopNs ? stopNs : qzclock::nowNs()) - startNs) / 1e9;
+    if (seconds <= 0)
+        seconds = 1;
+
+    quint64 samples = 0, dropouts = 0;
+    for (telemetryprofile *p : profiles) {
+        samples += p->samples();
+        dropouts += p->dropouts();
+    }
+
+    quint64 notifications = 0, controlsSent = 0, controlsLost = 0;
+    latencyhistogram encodeNs, dataAgeUs, controlUs;
+    for (fleetclient *c : clients) {
+        notifications += c->notifications;
+        controlsSent += c->controlsSent;
+        controlsLost += c->controlsLost;
+        encodeNs.merge(c->encodeNs);
+        dataAgeUs.merge(c->dataAgeUs);
+        controlUs.merge(c->controlUs);
+    }
+
+    QJsonObject r;
+    r[QStringLiteral("devices")] = config.devices;
+    r[QStringLiteral("clients")] = config.clients;
+    r[QStringLiteral("type")] = config.type;
+    r[QStringLiteral("profile")] = telemetryprofile::name(config.profile);
+    r[QStringLiteral("seconds")] = seconds;
+    r[QStringLiteral("deviceIntervalMs")] = config.deviceInterval;
+    r[QStringLiteral("clientIntervalMs")] = config.clientInterval;
+    r[QStringLiteral("deviceUpdates")] = (double)samples;
+    r[QStringLiteral("deviceUpdatesPerSecond")] = samples / seconds;
+    r[QStringLiteral("dropouts")] = (double)dropouts;
+    r[QStringLiteral("notifications")] = (double)notifications;
+    r[QStringLiteral("notificationsPerSecond")] = notifications / seconds;
+    r[QStringLiteral("controlsSent")] = (double)controlsSent;
+    r[QStringLiteral("controlsLost")] = (double)controlsLost;
+    r[QStringLiteral("notifyEncodeUs")] = encodeNs.toJson(1000.0);
+    r[QStringLiteral("dataAgeMs")] = dataAgeUs.toJson(1000.0);
+    r[QStringLiteral("controlLatencyMs")] = controlUs.toJson(1000.0);
+    r[QStringLiteral("loopLagMs")] = loopLagUs.toJson(1000.0);
+    return r;
+}
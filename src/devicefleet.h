@@ -0,0 +1,111 @@
+#ifndef DEVICEFLEET_H
+#define DEVICEFLEET_H
+
+#include "characteristics/characteristicnotifier.h"
+#include "characteristics/characteristicwriteprocessor2ad9.h"
+#include "devices/bluetoothdevice.h"
+#include "latencymonitor.h"
+#include "telemetryprofile.h"
+#include <QJsonObject>
+#include <QList>
+#include <QObject>
+#include <QTimer>
+
+class fleetconfig {
+  public:
+    int devices = 1;
+    int clients = 1;
+    // bike, treadmill, elliptical, rower or mixed
+    QString type = QStringLiteral("bike");
+    telemetryprofile::PROFILE profile = telemetryprofile::STEADY;
+    double dropoutsPerMinute = 0;
+    // Units: milliseconds
+    int deviceInterval = 200;
+    int clientInterval = 1000;
+    int controlInterval = 5000;
+    // Units: seconds
+    int duration = 60;
+    quint32 seed = 1;
+    QString reportFile;
+};
+
+/**
+ * @brief Simulated virtual device client (for example Zwift connected to the virtual bike). It reads the device data
+ * through the same notifiers the BLE server uses and, on bikes and treadmills, sends FTMS control point requests,
+ * measuring how long the device takes to apply them.
+ */
+class fleetclient : public QObject {
+    Q_OBJECT
+
+  public:
+    fleetclient(bluetoothdevice *device, int intervalMs, int controlIntervalMs, quint32 seed,
+                QObject *parent = nullptr);
+    void start();
+    void stop();
+
+    quint64 notifications = 0;
+    quint64 controlsSent = 0;
+    quint64 controlsLost = 0;
+    latencyhistogram encodeNs;  // time to build a notification
+    latencyhistogram dataAgeUs; // age of the device data when the client reads it
+    latencyhistogram controlUs; // from the control point write to the device applying it
+
+  private slots:
+    void tick();
+
+  private:
+    void sendControl();
+    void checkControl();
+
+    bluetoothdevice *device;
+    CharacteristicNotifier *notifier = nullptr;
+    CharacteristicWriteProcessor2AD9 *writeProcessor = nullptr;
+    QTimer timer;
+    QRandomGenerator random;
+    int controlInterval;
+    qint64 lastControlNs = 0;
+    // pending request, 0 if none
+    qint64 controlSentNs = 0;
+    double controlTarget = 0;
+};
+
+/**
+ * @brief Headless load generator: runs N fake devices driven by a telemetryprofile and N fleetclients reading them,
+ * then reports throughput and latencies. Started with -simulate-devices in -no-gui mode.
+ */
+class devicefleet : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit devicefleet(const fleetconfig &config, QObject *parent = nullptr);
+    ~devicefleet();
+
+    void start();
+    QJsonObject report() const;
+
+  signals:
+    void finished();
+
+  private slots:
+    void probe();
+    void stop();
+
+  private:
+    bluetoothdevice *createDevice(const QString &type, telemetryprofile *profile);
+
+    fleetconfig config;
+    QList<bluetoothdevice *> devices;
+    QList<telemetryprofile *> profiles;
+    QList<fleetclient *> clients;
+    QTimer probeTimer;
+    QTimer durationTimer;
+    qint64 startNs = 0;
+    qint64 stopNs = 0;
+    qint64 lastProbeNs = 0;
+    // how late the event loop serves a timer, the first sign of saturation
+    latencyhistogram loopLagUs;
+
+    static const int probeInterval = 50;
+};
+
+#endif // DEVICEFLEET_H
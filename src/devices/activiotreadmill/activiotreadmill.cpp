@@ -51,7 +51,7 @@ void activiotreadmill::writeCharacteristic(const QLowEnergyCharacteristic charac
 
     if (gattCommunicationChannelService->state() != QLowEnergyService::ServiceState::ServiceDiscovered ||
         m_control->state() == QLowEnergyController::UnconnectedState) {
-        emit debug(QStringLiteral("writeCharacteristic error because the connection is closed"));
+        QZ_EMIT_DEBUG(QStringLiteral("writeCharacteristic error because the connection is closed"));
 
         return;
     }
@@ -64,14 +64,14 @@ void activiotreadmill::writeCharacteristic(const QLowEnergyCharacteristic charac
     gattCommunicationChannelService->writeCharacteristic(characteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -207,7 +207,7 @@ void activiotreadmill::update() {
         {
             if (requestSpeed != -1) {
                 if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                    emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                     forceSpeed(requestSpeed);
                 }
                 requestSpeed = -1;
@@ -217,13 +217,13 @@ void activiotreadmill::update() {
                     requestInclination = 0;
                 if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                     requestInclination <= 15) {
-                    emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                     forceIncline(requestInclination);
                 }
                 requestInclination = -100;
             }
             if (requestStart != -1) {
-                emit debug(QStringLiteral("starting..."));
+                QZ_EMIT_DEBUG(QStringLiteral("starting..."));
                 if (lastSpeed == 0.0) {
 
                     lastSpeed = 0.5;
@@ -248,7 +248,7 @@ void activiotreadmill::update() {
                 emit tapeStarted();
             }
             if (requestStop != -1) {
-                emit debug(QStringLiteral("stopping... ") + paused);
+                QZ_EMIT_DEBUG(QStringLiteral("stopping... ") + paused);
                 if (lastState == PAUSED) {
                     uint8_t pause[] = {0x05, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x07};
 
@@ -265,18 +265,18 @@ void activiotreadmill::update() {
                 requestStop = -1;
             }
             /*if (requestFanSpeed != -1) {
-                emit debug(QStringLiteral("changing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
 
                 sendChangeFanSpeed(requestFanSpeed);
                 requestFanSpeed = -1;
             }
             if (requestIncreaseFan != -1) {
-                emit debug(QStringLiteral("increasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
                 sendChangeFanSpeed(FanSpeed + 1);
                 requestIncreaseFan = -1;
             } else if (requestDecreaseFan != -1) {
-                emit debug(QStringLiteral("decreasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
                 sendChangeFanSpeed(FanSpeed - 1);
                 requestDecreaseFan = -1;
@@ -286,20 +286,21 @@ void activiotreadmill::update() {
 }
 
 void activiotreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void activiotreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
-    QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
     emit packetReceived();
 
     if (newValue.length() < 12)
@@ -339,21 +340,20 @@ void activiotreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
 
         Distance += ((speed / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastTimeCharacteristicChanged.msecsTo(now))));
-        lastTimeCharacteristicChanged = now;
+                     ((double)1000.0 / (double)(qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs))));
+        lastTimeCharacteristicChangedNs = nowNs;
     }
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
     // emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
     // emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -370,9 +370,9 @@ void activiotreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
     }
     Inclination = incline;
 
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
-    emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
     if (speed > 0) {
 
@@ -541,7 +541,7 @@ void activiotreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QBluetoothUuid _gattNotifyCharacteristicId(QStringLiteral("e54eaa56-371b-476c-99a3-74d267e3edae"));
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
 
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -578,7 +578,7 @@ void activiotreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void activiotreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -587,17 +587,17 @@ void activiotreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void activiotreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void activiotreadmill::serviceScanDone(void) {
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("e54eaa50-371b-476c-99a3-74d267e3edae"));
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     auto services_list = m_control->services();
-    emit debug("Services found:");
+    QZ_EMIT_DEBUG("Services found:");
     for (const QBluetoothUuid &s : qAsConst(services_list)) {
-        emit debug(s.toString());
+        QZ_EMIT_DEBUG(s.toString());
     }
 
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
@@ -606,22 +606,22 @@ void activiotreadmill::serviceScanDone(void) {
                 &activiotreadmill::stateChanged);
         gattCommunicationChannelService->discoverDetails();
     } else {
-        emit debug(QStringLiteral("error on find Service"));
+        QZ_EMIT_DEBUG(QStringLiteral("error on find Service"));
     }
 }
 
 void activiotreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("activiotreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("activiotreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void activiotreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("activiotreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("activiotreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void activiotreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -641,18 +641,18 @@ void activiotreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
@@ -41,7 +41,7 @@ void antbike::update() {
     qDebug() << QStringLiteral("Current Garmin Cadence: ") << QString::number(Cadence.value());
     if (settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
         Speed = metric::calculateSpeedFromPower(
-                                                m_watt.value(), 0, Speed.value(), fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0),
+                                                m_watt.value(), 0, Speed.value(), qzclock::secondsSince(Speed.lastChangedNs()),
                                                 speedLimit());
     } else {
         Speed = hh.getSpeed();
@@ -54,7 +54,7 @@ void antbike::update() {
     m_watt = QAndroidJniObject::callStaticMethod<jint>("org/cagnulen/qdomyoszwift/Garmin", "getPower", "()I");
     if (settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
         Speed = metric::calculateSpeedFromPower(
-            m_watt.value(), 0, Speed.value(), fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0),
+            m_watt.value(), 0, Speed.value(), qzclock::secondsSince(Speed.lastChangedNs()),
             speedLimit());
     } else {
         Speed = QAndroidJniObject::callStaticMethod<jdouble>("org/cagnulen/qdomyoszwift/Garmin", "getSpeed", "()D");
@@ -69,15 +69,15 @@ void antbike::update() {
 
     if (requestInclination != -100) {
         Inclination = requestInclination;
-        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
         requestInclination = -100;
     }
 
     update_metrics(false, watts());
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();    
+                 ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();    
 
     // ******************************************* virtual bike init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice() && !noVirtualDevice
@@ -103,7 +103,7 @@ void antbike::update() {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
             connect(virtualBike, &virtualbike::changeInclination, this, &antbike::changeInclinationRequested);
             connect(virtualBike, &virtualbike::ftmsCharacteristicChanged, this, &antbike::ftmsCharacteristicChanged);
@@ -154,7 +154,7 @@ void antbike::update() {
 
 void antbike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void antbike::changeInclinationRequested(double grade, double percentage) {
@@ -60,7 +60,7 @@ void apexbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStrin
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
                         QStringLiteral(" // ") + info;
     }
 
@@ -129,14 +129,16 @@ void apexbike::serviceDiscovered(const QBluetoothUuid &gatt) {
 }
 
 void apexbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
+    markIngress();
     QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << " << " + newValue.toHex(' ');
+    QZ_DEBUG << " << " + newValue.toHex(' ');
 
     lastPacket = newValue;
 
@@ -166,7 +168,7 @@ void apexbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             } else {
                 Speed = metric::calculateSpeedFromPower(
                     watts(), Inclination.value(), Speed.value(),
-                    fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                    qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
             }
             if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
                     .toString()
@@ -184,18 +186,17 @@ void apexbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                 ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
     if (Cadence.value() > 0) {
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool()) {
@@ -332,7 +333,7 @@ void apexbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void apexbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -340,7 +341,7 @@ void apexbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const Q
 
 void apexbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void apexbike::serviceScanDone(void) {
@@ -54,8 +54,8 @@ void bhfitnesselliptical::writeCharacteristic(uint8_t *data, uint8_t data_len, c
     gattFTMSService->writeCharacteristic(gattWriteCharControlPointId, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -105,14 +105,14 @@ void bhfitnesselliptical::update() {
             if (requestResistance != currentResistance().value()) {
                 virtualbike *virtualBike = dynamic_cast<virtualbike *>(this->VirtualDevice());
                 if (((virtualBike && !virtualBike->ftmsDeviceConnected()) || !virtualBike)) {
-                    emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                     forceResistance(requestResistance);
                 }
             }
             requestResistance = -1;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -120,7 +120,7 @@ void bhfitnesselliptical::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -128,11 +128,12 @@ void bhfitnesselliptical::update() {
 }
 
 void bhfitnesselliptical::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -141,12 +142,12 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
     bool disable_hr_frommachinery =
         settings.value(QZSettings::heart_ignore_builtin, QZSettings::default_heart_ignore_builtin).toBool();
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
-    QDateTime now = QDateTime::currentDateTime();
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
+    qint64 nowNs = qzclock::nowNs();
 
     if (characteristic.uuid() == QBluetoothUuid::HeartRate && newValue.length() > 1) {
         Heart = (uint8_t)newValue[1];
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
         return;
     }
 
@@ -192,11 +193,11 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
         } else {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0),
+                qzclock::secondsSince(Speed.lastChangedNs()),
                 0 /* not useful for elliptical*/);
         }
         index += 2;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
     }
 
     if (Flags.avgSpeed) {
@@ -205,7 +206,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
             ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index)))) /
             100.0;
         index += 2;
-        emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
     }
 
     if (Flags.instantCadence) {
@@ -222,7 +223,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
             }
         }
         index += 2;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
     }
 
     if (Flags.avgCadence) {
@@ -231,7 +232,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
             ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index)))) /
             2.0;
         index += 2;
-        emit debug(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
     }
 
     if (Flags.totDistance) {
@@ -242,17 +243,17 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
         index += 3;
     } else {
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
     }
 
-    emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
     if (Flags.resistanceLvl) {
         Resistance =
             ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
         // emit resistanceRead(Resistance.value());
         index += 2;
-        emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
     }
 
     if (Flags.instantPower) {
@@ -262,7 +263,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
             m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                (uint16_t)((uint8_t)newValue.at(index))));
         index += 2;
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
     }
 
     if (Flags.avgPower) {
@@ -270,7 +271,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
         avgPower =
             ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
         index += 2;
-        emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
     }
 
     if (Flags.expEnergy && newValue.length() > index + 1) {
@@ -288,12 +289,11 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
                 ((((0.048 * ((double)watts()) + 1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
     }
 
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -304,7 +304,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
         if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
             Heart = ((double)(((uint8_t)newValue.at(index))));
             // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-            emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
         } else {
             Flags.heartRate = false;
         }
@@ -327,7 +327,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
     if (heartRateBeltName.startsWith(QStringLiteral("Disabled")) &&
         (!Flags.heartRate || Heart.value() == 0 || disable_hr_frommachinery)) {
@@ -347,8 +347,8 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
 #endif
 #endif
 
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -357,7 +357,7 @@ void bhfitnesselliptical::characteristicChanged(const QLowEnergyCharacteristic &
 
 void bhfitnesselliptical::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -487,7 +487,7 @@ void bhfitnesselliptical::ftmsCharacteristicChanged(const QLowEnergyCharacterist
                                                     const QByteArray &newValue) {
     QByteArray b = newValue;
     if (gattWriteCharControlPointId.isValid()) {
-        qDebug() << "routing FTMS packet to the bike from virtualBike" << characteristic.uuid() << newValue.toHex(' ');
+        QZ_DEBUG << "routing FTMS packet to the bike from virtualBike" << characteristic.uuid() << newValue.toHex(' ');
 
         // handling reading current resistance
         if (b.at(0) == 0x11) {
@@ -505,29 +505,29 @@ void bhfitnesselliptical::ftmsCharacteristicChanged(const QLowEnergyCharacterist
 }
 
 void bhfitnesselliptical::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void bhfitnesselliptical::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void bhfitnesselliptical::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void bhfitnesselliptical::characteristicRead(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void bhfitnesselliptical::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
 #ifdef Q_OS_ANDROID
     QLowEnergyConnectionParameters c;
@@ -549,19 +549,19 @@ void bhfitnesselliptical::serviceScanDone(void) {
 
 void bhfitnesselliptical::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("bhfitnesselliptical::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bhfitnesselliptical::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bhfitnesselliptical::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("bhfitnesselliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bhfitnesselliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bhfitnesselliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -578,17 +578,17 @@ void bhfitnesselliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -1,13 +1,28 @@
 
 #include "devices/bike.h"
 #include "qdebugfixup.h"
+#include "qzclock.h"
+#include "qztrace.h"
 #include <QSettings>
 
-bike::bike() { elapsed.setType(metric::METRIC_ELAPSED); }
+bike::bike() {
+    elapsed.setType(metric::METRIC_ELAPSED);
+    // resistance, power and slope all drive the brake: only one source at a time
+    controlArbiter()->share(controlarbiter::POWER, controlarbiter::RESISTANCE);
+    controlArbiter()->share(controlarbiter::INCLINATION, controlarbiter::RESISTANCE);
+    controlArbiter()->setMinInterval(controlarbiter::POWER, 500);
+    controlArbiter()->setMinInterval(controlarbiter::INCLINATION, 500);
+    controlArbiter()->setTolerance(controlarbiter::POWER, 1);
+}
 
 virtualbike *bike::VirtualBike() { return dynamic_cast<virtualbike*>(this->VirtualDevice()); }
 
 void bike::changeResistance(resistance_t resistance) {
+    if (!arbitrateControl(controlarbiter::RESISTANCE, resistance))
+        return;
+    // a resistance chosen by somebody else ends the ERG emulation
+    if (controlarbiter::currentSource() != controlarbiter::INTERNAL)
+        m_erg.stop();
     QSettings settings;
     double zwift_erg_resistance_up =
         settings.value(QZSettings::zwift_erg_resistance_up, QZSettings::default_zwift_erg_resistance_up).toDouble();
@@ -15,6 +30,7 @@ void bike::changeResistance(resistance_t resistance) {
         settings.value(QZSettings::zwift_erg_resistance_down, QZSettings::default_zwift_erg_resistance_down).toDouble();
 
     qDebug() << QStringLiteral("bike::changeResistance") << autoResistanceEnable << resistance;
+    QZ_TRACE(qztrace::CONTROL, "changeResistance", "resistance", (double)resistance, "auto", autoResistanceEnable);
 
     lastRawRequestedResistanceValue = resistance;
     if (autoResistanceEnable) {
@@ -33,7 +49,10 @@ void bike::changeResistance(resistance_t resistance) {
 }
 
 void bike::changeInclination(double grade, double percentage) {
+    if (!arbitrateControl(controlarbiter::INCLINATION, grade, percentage))
+        return;
     qDebug() << QStringLiteral("bike::changeInclination") << autoResistanceEnable << grade << percentage;
+    QZ_TRACE(qztrace::CONTROL, "changeInclination", "grade", grade, "auto", autoResistanceEnable);
     lastRawRequestedInclinationValue = grade;
     if (autoResistanceEnable) {        
         requestInclination = grade;
@@ -50,10 +69,17 @@ uint16_t bike::powerFromResistanceRequest(resistance_t requestResistance) {
     return (requestResistance * cadence) / 9.5488;
 }
 
-void bike::changeRequestedPelotonResistance(int8_t resistance) { RequestedPelotonResistance = resistance; }
+void bike::changeRequestedPelotonResistance(int8_t resistance) {
+    if (!controlAllowed(controlarbiter::RESISTANCE))
+        return;
+    RequestedPelotonResistance = resistance;
+}
 void bike::changeCadence(int16_t cadence) { RequestedCadence = cadence; }
 void bike::changePower(int32_t power) {
+    if (!arbitrateControl(controlarbiter::POWER, power))
+        return;
 
+    QZ_TRACE(qztrace::CONTROL, "changePower", "power", power, "auto", autoResistanceEnable);
     RequestedPower = power; // in order to paint in any case the request power on the charts
 
     if (!autoResistanceEnable) {
@@ -76,13 +102,42 @@ void bike::changePower(int32_t power) {
     double deltaUp = ((double)power) - wattsMetric().value();
     qDebug() << QStringLiteral("filter  ") + QString::number(deltaUp) + " " + QString::number(deltaDown) + " " +
                     QString::number(erg_filter_upper) + " " + QString::number(erg_filter_lower);
-    if (!ergModeSupported && force_resistance /*&& erg_mode*/ &&
-        (deltaUp > erg_filter_upper || deltaDown > erg_filter_lower)) {
-        resistance_t r = (resistance_t)resistanceFromPowerRequest(power);
-        changeResistance(r); // resistance start from 1
+    if (!ergModeSupported && force_resistance /*&& erg_mode*/) {
+        m_erg.setTarget(power, Cadence.value(), qzclock::nowMs());
+        if (deltaUp > erg_filter_upper || deltaDown > erg_filter_lower) {
+            resistance_t r = (resistance_t)qRound(ergResistance(m_erg.demand()));
+            controlarbiter::scope internal(controlarbiter::INTERNAL);
+            changeResistance(r); // resistance start from 1
+        }
     }
 }
 
+double bike::ergResistance(double power) {
+    double r;
+    if (_ergTable.estimateResistance(Cadence.value(), power, &r)) {
+        // the table learns the resistance of the bike, changeResistance adds the difficulty and the gears
+        if (m_difficult > 0)
+            r = (r - gears()) / m_difficult;
+        return qMax(0.0, r);
+    }
+    return resistanceFromPowerRequest((uint16_t)qMax(0.0, power));
+}
+
+void bike::controlLoop() {
+    if (ergModeSupported || !autoResistanceEnable || !m_erg.active())
+        return;
+    if (!m_erg.update(Cadence.value(), wattsMetric().value(), qzclock::nowMs()))
+        return;
+    resistance_t r = (resistance_t)qRound(ergResistance(m_erg.demand()));
+    QZ_TRACE(qztrace::CONTROL, "erg", "target", m_erg.target(), "trim", m_erg.trim(), "resistance", (int)r);
+    if (r == lastRawRequestedResistanceValue)
+        return;
+    qDebug() << QStringLiteral("erg emulation: resistance") << r << QStringLiteral("for") << m_erg.target()
+             << QStringLiteral("W, trim") << m_erg.trim();
+    controlarbiter::scope internal(controlarbiter::INTERNAL);
+    changeResistance(r);
+}
+
 double bike::gears() {
     QSettings settings;
     bool gears_zwift_ratio = settings.value(QZSettings::gears_zwift_ratio, QZSettings::default_gears_zwift_ratio).toBool();
@@ -108,6 +163,7 @@ void bike::setGears(double gears) {
     m_gears = gears;
     settings.setValue(QZSettings::gears_current_value, m_gears);
     if (lastRawRequestedResistanceValue != -1) {
+        controlarbiter::scope internal(controlarbiter::INTERNAL);
         changeResistance(lastRawRequestedResistanceValue);
     }
 }
@@ -2,6 +2,7 @@
 #define BIKE_H
 
 #include "devices/bluetoothdevice.h"
+#include "ergemulator.h"
 #include "virtualdevices/virtualbike.h"
 #include <QObject>
 
@@ -80,6 +81,16 @@ class bike : public bluetoothdevice {
     void steeringAngleChanged(double angle);
 
   protected:
+    void controlLoop() override;
+
+    /**
+     * @brief ergResistance The resistance to request for a power at the current cadence: the learned ergTable when it
+     * knows this cadence, resistanceFromPowerRequest otherwise.
+     */
+    double ergResistance(double power);
+
+    ergemulator m_erg;
+
     metric RequestedResistance;
     metric RequestedPelotonResistance;
     metric RequestedCadence;
@@ -52,14 +52,16 @@ void bkoolbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStri
     gattCustomService->writeCharacteristic(gattWriteCharCustomId, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 }
 
 void bkoolbike::changePower(int32_t power) {
+    if (!arbitrateControl(controlarbiter::POWER, power))
+        return;
     RequestedPower = power;
     /*
         if (power < 0)
@@ -139,7 +141,7 @@ void bkoolbike::update() {
 
         if (requestResistance != -1) {
             if (requestResistance != currentResistance().value() || lastGearValue != gears()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                 auto virtualBike = this->VirtualBike();
                 if (((virtualBike && !virtualBike->ftmsDeviceConnected()) || !virtualBike) &&
                     (requestPower == 0 || requestPower == -1)) {
@@ -151,7 +153,7 @@ void bkoolbike::update() {
             requestResistance = -1;
         }
         if (requestInclination != -100) {
-            emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+            QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
             forceInclination(requestInclination + gears()); // since this bike doesn't have the concept of resistance,
                                                             // i'm using the gears in the inclination
             requestInclination = -100;
@@ -162,7 +164,7 @@ void bkoolbike::update() {
             requestPower = -1;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -170,7 +172,7 @@ void bkoolbike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -188,11 +190,13 @@ void bkoolbike::powerPacketReceived(const QByteArray &b) {
 }
 
 void bkoolbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
+    markIngress();
     QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -202,7 +206,7 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
         settings.value(QZSettings::tacx_neo2_peloton, QZSettings::default_tacx_neo2_peloton).toBool();
 
     qDebug() << QStringLiteral(" << char ") << characteristic.uuid();
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     if (characteristic.uuid() == QBluetoothUuid((quint16)0x2A5B)) {
         lastPacket = newValue;
@@ -210,16 +214,16 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
         uint8_t index = 1;
 
         if (newValue.at(0) == 0x02 && newValue.length() < 4) {
-            emit debug(QStringLiteral("Crank revolution data present with wrong bytes ") +
-                       QString::number(newValue.length()));
+            QZ_EMIT_DEBUG(QStringLiteral("Crank revolution data present with wrong bytes ") +
+                          QString::number(newValue.length()));
             return;
         } else if (newValue.at(0) == 0x01 && newValue.length() < 6) {
-            emit debug(QStringLiteral("Wheel revolution data present with wrong bytes ") +
-                       QString::number(newValue.length()));
+            QZ_EMIT_DEBUG(QStringLiteral("Wheel revolution data present with wrong bytes ") +
+                          QString::number(newValue.length()));
             return;
         } else if (newValue.at(0) == 0x00) {
-            emit debug(QStringLiteral("Cadence sensor notification without datas ") +
-                       QString::number(newValue.length()));
+            QZ_EMIT_DEBUG(QStringLiteral("Cadence sensor notification without datas ") +
+                          QString::number(newValue.length()));
             return;
         }
 
@@ -267,7 +271,7 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
                     .toDouble();
 
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
         // Resistance = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
         // (uint16_t)((uint8_t)newValue.at(index)))); debug("Current Resistance: " +
@@ -301,23 +305,22 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
                 ((((0.048 * ((double)watts()) + 1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
-        lastRefreshCharacteristicChanged = now;
-
-        emit debug(QStringLiteral("Current CrankRevsRead: ") + QString::number(CrankRevsRead));
-        emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        lastRefreshCharacteristicChangedNs = nowNs;
+
+        QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevsRead: ") + QString::number(CrankRevsRead));
+        QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
     } else if (characteristic.uuid() == QBluetoothUuid::HeartRateMeasurement) {
         if (newValue.length() > 1) {
             Heart = newValue[1];
         }
 
-        emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
     } else if (characteristic.uuid() == QBluetoothUuid::CyclingPowerMeasurement) {
         uint16_t flags = (((uint16_t)((uint8_t)newValue.at(1)) << 8) | (uint16_t)((uint8_t)newValue.at(0)));
         bool cadence_present = false;
@@ -330,7 +333,7 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
         }
 
         emit powerChanged(m_watt.value());
-        emit debug(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
 
         if ((flags & 0x1) == 0x01) // Pedal Power Balance Present
         {
@@ -391,7 +394,7 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
                 }
             }
 
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
             oldLastCrankEventTime = LastCrankEventTime;
             oldCrankRevs = CrankRevs;
@@ -404,13 +407,13 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
             } else {
                 Speed = metric::calculateSpeedFromPower(
                     watts(), Inclination.value(), Speed.value(),
-                    fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                    qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
             }
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
             // if we change this, also change the wattsFromResistance function. We can create a standard function in
             // order to have all the costants in one place (I WANT MORE TIME!!!)
@@ -456,10 +459,9 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
                     ((((0.048 * ((double)watts()) + 1.19) *
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
-                     (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                    now)))); //(( (0.048* Output in watts +1.19) * body weight
+                     (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight
                                                                       // in kg * 3.5) / 200 ) / 60
-            emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
         }
     }
 
@@ -490,8 +492,8 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
 #endif
 #endif
 
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
     if (m_control->error() != QLowEnergyController::NoError)
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -499,7 +501,7 @@ void bkoolbike::characteristicChanged(const QLowEnergyCharacteristic &characteri
 
 void bkoolbike::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -607,7 +609,7 @@ void bkoolbike::stateChanged(QLowEnergyService::ServiceState state) {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService, 4, 1);
             connect(virtualBike, &virtualbike::changeInclination, this, &bkoolbike::changeInclination);
             // connect(virtualBike, &virtualbike::powerPacketReceived, this, &bkoolbike::powerPacketReceived);
@@ -620,27 +622,27 @@ void bkoolbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void bkoolbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void bkoolbike::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void bkoolbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void bkoolbike::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void bkoolbike::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
 #ifdef Q_OS_ANDROID
     QLowEnergyConnectionParameters c;
@@ -661,19 +663,19 @@ void bkoolbike::serviceScanDone(void) {
 
 void bkoolbike::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("bkoolbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bkoolbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bkoolbike::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("bkoolbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bkoolbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bkoolbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -688,17 +690,17 @@ void bkoolbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
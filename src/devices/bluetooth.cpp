@@ -185,7 +185,7 @@ void bluetooth::finished() {
 
 void bluetooth::startDiscovery() {
 
-    if (!this->useDiscovery)
+    if (!this->useDiscovery || !this->discoveryAgent)
         return;
 
 #ifndef Q_OS_IOS
@@ -546,7 +546,7 @@ void bluetooth::deviceDiscovered(const QBluetoothDeviceInfo &device) {
     QVector<quint16> ids = device.manufacturerIds();
     qDebug() << "manufacturerData" << ids;
     foreach (quint16 id, ids) {
-        qDebug() << id << device.manufacturerData(id).toHex(' ');
+        QZ_DEBUG << id << device.manufacturerData(id).toHex(' ');
 
 #ifdef Q_OS_ANDROID
         // yesoul bike on android 13 doesn't send anymore the name
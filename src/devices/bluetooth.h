@@ -159,6 +159,16 @@ class bluetooth : public QObject, public SignalHandler {
     bool onlyDiscover = false;
     volatile bool homeformLoaded = false;
 
+    /**
+     * @brief Start the Bluetooth discovery agent.
+     */
+    void startDiscovery();
+
+    /**
+     * @brief Stop the Bluetooth discovery agent.
+     */
+    void stopDiscovery();
+
   private:
     bool useDiscovery = false;
     QFile *debugCommsLog = nullptr;
@@ -286,16 +296,6 @@ class bluetooth : public QObject, public SignalHandler {
     double bikeResistanceGain = 1.0;
     bool forceHeartBeltOffForTimeout = false;
 
-    /**
-     * @brief Start the Bluetooth discovery agent.
-     */
-    void startDiscovery();
-
-    /**
-     * @brief Stop the Bluetooth discovery agent.
-     */
-    void stopDiscovery();
-
     bool handleSignal(int signal) override;
     bool deviceHasService(const QBluetoothDeviceInfo &device, QBluetoothUuid service);
     void stateFileUpdate();
@@ -1,4 +1,7 @@
 #include "devices/bluetoothdevice.h"
+#include "latencymonitor.h"
+#include "qzclock.h"
+#include "qztrace.h"
 
 #include <QFile>
 #include <QSettings>
@@ -11,7 +14,10 @@
 #include "ios/lockscreen.h"
 #endif
 
-bluetoothdevice::bluetoothdevice() {}
+bluetoothdevice::bluetoothdevice() {
+    m_controlTimer.setSingleShot(true);
+    connect(&m_controlTimer, &QTimer::timeout, this, &bluetoothdevice::flushControl);
+}
 
 bluetoothdevice::~bluetoothdevice() {
     if(this->virtualDevice) {
@@ -171,8 +177,9 @@ void bluetoothdevice::setVirtualDevice(virtualdevice *virtualDevice, VIRTUAL_DEV
 // keiser m3i has a separate management of this, so please check it
 void bluetoothdevice::update_metrics(bool watt_calc, const double watts, const bool from_accessory) {
 
-    QDateTime current = QDateTime::currentDateTime();
-    double deltaTime = (((double)_lastTimeUpdate.msecsTo(current)) / ((double)1000.0));
+    qint64 currentNs = qzclock::nowNs();
+    // monotonic: a wall clock change (NTP, DST) must not add or remove elapsed time, distance and energy
+    double deltaTime = ((double)(currentNs - _lastTimeUpdateNs)) / 1e9;
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
@@ -227,8 +234,108 @@ void bluetoothdevice::update_metrics(bool watt_calc, const double watts, const b
     if (currentInclination().value() > 0)
         elevationAcc += (currentSpeed().value() / 3600.0) * 1000.0 * (currentInclination().value() / 100.0) * deltaTime;
 
-    _lastTimeUpdate = current;
+    _lastTimeUpdateNs = currentNs;
     _firstUpdate = false;
+
+    publishMetrics();
+    controlLoop();
+}
+
+void bluetoothdevice::publishMetrics() {
+    m_publishedNs = qzclock::nowNs();
+    latencymonitor::record(latencymonitor::METRICS, ingressNs());
+    QZ_TRACE_COUNTER(qztrace::DEVICE, "metrics", "speed", currentSpeed().value(), "cadence", currentCadence().value(),
+                     "watt", wattsMetric().value(), "heart", currentHeart().value());
+
+    pushFusion(sensorfusion::SPEED, currentSpeed());
+    pushFusion(sensorfusion::CADENCE, currentCadence());
+    pushFusion(sensorfusion::POWER, wattsMetric());
+    pushFusion(sensorfusion::HEART, currentHeart());
+    pushFusion(sensorfusion::RESISTANCE, currentResistance());
+    pushFusion(sensorfusion::INCLINATION, currentInclination());
+}
+
+void bluetoothdevice::markIngress() {
+    m_ingressNs.store(qzclock::nowNs(), std::memory_order_relaxed);
+    latencymonitor::ingress();
+}
+
+bool bluetoothdevice::arbitrateControl(controlarbiter::TARGET target, double value, double extra) {
+    if (m_applyingControl)
+        return true;
+    controlarbiter::SOURCE source = controlarbiter::currentSource();
+    qint64 now = qzclock::nowMs();
+    controlarbiter::DECISION d = m_arbiter.submit(source, target, value, extra, now);
+    QZ_TRACE(qztrace::CONTROL, "arbiter", "target", (int)target, "source", (int)source, "value", value, "decision",
+             (int)d);
+    switch (d) {
+    case controlarbiter::FORWARD:
+        return true;
+    case controlarbiter::DEFER:
+        scheduleControl(now);
+        return false;
+    case controlarbiter::REJECT:
+        qDebug() << QStringLiteral("control request postponed:") << controlarbiter::targetName(target) << value
+                 << QStringLiteral("from") << controlarbiter::sourceName(source)
+                 << QStringLiteral("because it's owned by")
+                 << controlarbiter::sourceName(m_arbiter.owner(target, now));
+        // applied by flushControl when the owner lets the target go
+        scheduleControl(now);
+        return false;
+    default:
+        return false;
+    }
+}
+
+bool bluetoothdevice::controlAllowed(controlarbiter::TARGET target) {
+    return m_applyingControl || m_arbiter.allowed(controlarbiter::currentSource(), target, qzclock::nowMs());
+}
+
+void bluetoothdevice::applyControl(controlarbiter::TARGET target, double value, double extra) {
+    switch (target) {
+    case controlarbiter::RESISTANCE:
+        changeResistance((resistance_t)value);
+        break;
+    case controlarbiter::POWER:
+        changePower((int32_t)value);
+        break;
+    case controlarbiter::INCLINATION:
+        changeInclination(value, extra);
+        break;
+    default:
+        break;
+    }
+}
+
+void bluetoothdevice::flushControl() {
+    qint64 now = qzclock::nowMs();
+    for (int t = 0; t < controlarbiter::TARGETS; t++) {
+        double value, extra;
+        controlarbiter::SOURCE source;
+        if (m_arbiter.takeDue((controlarbiter::TARGET)t, now, &value, &extra, &source)) {
+            controlarbiter::scope s(source);
+            m_applyingControl = true;
+            applyControl((controlarbiter::TARGET)t, value, extra);
+            m_applyingControl = false;
+        }
+    }
+    scheduleControl(now);
+}
+
+void bluetoothdevice::scheduleControl(qint64 nowMs) {
+    qint64 due = m_arbiter.nextDueMs();
+    if (due < 0)
+        return;
+    // a rejected request waits for a whole hold time, the deferred ones that come after it can't wait for it
+    qint64 wait = qMax((qint64)0, due - nowMs);
+    if (!m_controlTimer.isActive() || m_controlTimer.remainingTime() > wait)
+        m_controlTimer.start((int)wait);
+}
+
+void bluetoothdevice::pushFusion(sensorfusion::CHANNEL channel, metric m) {
+    // lastChanged is stamped by setValue, so it's the arrival time even for the accessories (belt, power meter)
+    // updating the metric between two notifications of the device
+    m_fusion.push(channel, m.value(), m.lastChangedNs() / 1000000);
 }
 
 void bluetoothdevice::update_hr_from_external() {
@@ -285,6 +392,18 @@ void bluetoothdevice::clearStats() {
     for(int i=0; i<maxHeartZone(); i++) {
         hrZonesSeconds[i].clear(false);
     }    
+    m_fusion.clear();
+}
+
+void bluetoothdevice::restoreStats(double elapsedSeconds, double movingSeconds, double distance, double distance1s,
+                                   double kcal, double elevation, double jouls) {
+    elapsed.restore(elapsedSeconds);
+    moving.restore(movingSeconds >= 0 ? movingSeconds : elapsedSeconds);
+    Distance.restore(distance);
+    Distance1s.restore(distance1s);
+    KCal.restore(kcal);
+    elevationAcc.restore(elevation);
+    m_jouls.restore(jouls);
 }
 
 void bluetoothdevice::setPaused(bool p) {
@@ -1,8 +1,11 @@
 #ifndef BLUETOOTHDEVICE_H
 #define BLUETOOTHDEVICE_H
 
+#include "controlarbiter.h"
 #include "definitions.h"
 #include "metric.h"
+#include "qztrace.h"
+#include "sensorfusion.h"
 #include "qzsettings.h"
 #include "ergtable.h"
 
@@ -232,6 +235,49 @@ class bluetoothdevice : public QObject {
      */
     virtual void clearStats();
 
+    /**
+     * @brief publishMetrics Records the latency and the trace counters of the values just updated, and feeds them to
+     * the sensor fusion. Called at the end of every update of the device.
+     */
+    void publishMetrics();
+
+    /**
+     * @brief metricsPublishedNs The qzclock time of the last publishMetrics(), 0 before the first one.
+     * Units: nanoseconds
+     */
+    qint64 metricsPublishedNs() const { return m_publishedNs; }
+
+    /**
+     * @brief ingressNs The qzclock time when the last packet of the device was received, 0 if the driver doesn't tag
+     * its packets. Units: nanoseconds
+     */
+    qint64 ingressNs() const { return m_ingressNs.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief controlArbiter Filters the targets requested to the machine: priorities of the sources, deduplication
+     * and rate limiting.
+     */
+    controlarbiter *controlArbiter() { return &m_arbiter; }
+
+    /**
+     * @brief sensorFusion The samples of the main metrics stamped with their arrival time, used to record the session
+     * on a regular time grid.
+     */
+    sensorfusion *sensorFusion() { return &m_fusion; }
+
+    /**
+     * @brief restoreStats Restores the session accumulators, used to resume a workout after a crash.
+     * @param elapsedSeconds The elapsed time. Units: seconds
+     * @param movingSeconds The time spent moving, the elapsed time if negative. Units: seconds
+     * @param distance The distance. Units: km
+     * @param distance1s The distance used for the FIT file. Units: km
+     * @param kcal The calories. Units: kcal
+     * @param elevation The elevation gain. Units: meters
+     * @param jouls The energy. Units: joules
+     */
+    void restoreStats(double elapsedSeconds, double movingSeconds, double distance, double distance1s, double kcal,
+                      double elevation, double jouls);
+
     /**
      * @brief bluetoothDevice The bluetooth device information.
      */
@@ -684,9 +730,9 @@ class bluetoothdevice : public QObject {
     bool autoResistanceEnable = true;
 
     /**
-     * @brief _lastTimeUpdate The time the (client was last updated / last update was received from the device) ???
+     * @brief _lastTimeUpdateNs The time of the last update_metrics on the monotonic clock (qzclock). Units: nanoseconds
      */
-    QDateTime _lastTimeUpdate;
+    qint64 _lastTimeUpdateNs = 0;
 
     /**
      * @brief _firstUpdate Indicates if this is the first update.
@@ -732,7 +778,50 @@ class bluetoothdevice : public QObject {
     VIRTUAL_DEVICE_MODE virtualDeviceMode = VIRTUAL_DEVICE_MODE::NONE;
     virtualdevice *virtualDevice = nullptr;
 
+    qint64 m_publishedNs = 0;
+    std::atomic<qint64> m_ingressNs{0};
+    controlarbiter m_arbiter;
+    QTimer m_controlTimer;
+    bool m_applyingControl = false;
+    sensorfusion m_fusion;
+
+    void pushFusion(sensorfusion::CHANNEL channel, metric m);
+    // starts the timer of flushControl for the next request due in the controlarbiter
+    void scheduleControl(qint64 nowMs);
+
+  private slots:
+    void flushControl();
+
   protected:
+    /**
+     * @brief markIngress Tags the packet just received, the start of the latencies measured by latencymonitor. Called
+     * first thing in characteristicChanged.
+     */
+    void markIngress();
+
+    /**
+     * @brief arbitrateControl Submits a target to the controlarbiter on behalf of the current source. Called first
+     * thing in the change* slots.
+     * @return true if the request must be applied now. Deferred requests are applied later through applyControl.
+     */
+    bool arbitrateControl(controlarbiter::TARGET target, double value, double extra = 0);
+
+    /**
+     * @brief controlAllowed Whether the current source may change the target, for the requests that only update the
+     * requested value shown on the tiles.
+     */
+    bool controlAllowed(controlarbiter::TARGET target);
+
+    /**
+     * @brief applyControl Applies a deferred request, calling the change* slot of the target.
+     */
+    virtual void applyControl(controlarbiter::TARGET target, double value, double extra);
+
+    /**
+     * @brief controlLoop Called after every update of the metrics, it runs the control loops emulated in software.
+     */
+    virtual void controlLoop() {}
+
     // useful to understand if a power sensor device for treadmill, it's a real one like the stryd or it's a dumb one like the runpod from Zwift
     bool powerReceivedFromPowerSensor = false;
 };
@@ -56,7 +56,7 @@ class bowflext216treadmill : public treadmill {
     uint8_t sec1Update = 0;
     uint8_t firstInit = 0;
     QByteArray lastPacket;
-    QDateTime lastTimeCharacteristicChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
 
     QTimer *refresh;
@@ -61,8 +61,8 @@ void bowflextreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, cons
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     // packets sent from the characChanged event, i don't want to block everything
@@ -70,7 +70,7 @@ void bowflextreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, cons
         loop.exec();
 
         if (timeout.isActive() == false)
-            emit debug(QStringLiteral(" exit for timeout"));
+            QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -102,7 +102,7 @@ void bowflextreadmill::update() {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, noHeartService);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &bowflextreadmill::debug);
                 this->setVirtualDevice(virtualTreadMill, VIRTUAL_DEVICE_MODE::PRIMARY);
@@ -121,7 +121,7 @@ void bowflextreadmill::update() {
 
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 // double inc = Inclination.value(); // NOTE: clang-analyzer-deadcode.DeadStores
                 if (requestInclination != -100) {
                     //                        inc = requestInclination;
@@ -136,7 +136,7 @@ void bowflextreadmill::update() {
                 requestInclination = 0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 // double speed = currentSpeed().value(); // NOTE: clang-analyzer-deadcode.DeadStores
                 if (requestSpeed != -1) {
                     // speed = requestSpeed;
@@ -148,7 +148,7 @@ void bowflextreadmill::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
                 lastSpeed = 0.5;
             }
@@ -156,7 +156,7 @@ void bowflextreadmill::update() {
             emit tapeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape", false, true);
             requestStop = -1;
         }
@@ -164,11 +164,12 @@ void bowflextreadmill::update() {
 }
 
 void bowflextreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void bowflextreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -176,7 +177,7 @@ void bowflextreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     emit packetReceived();
 
@@ -197,9 +198,9 @@ void bowflextreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         /*if(heartRateBeltName.startsWith("Disabled"))
         Heart = value.at(18);*/
     }
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(kcal));
     // debug("Current Distance: " + QString::number(distance));
 
     if (Speed.value() != speed) {
@@ -226,23 +227,22 @@ void bowflextreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
 
         Distance += ((Speed.value() / 3600.0) /
-                     (1000.0 / (lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
+                     (1000.0 / (qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
     }
 
     cadenceFromAppleWatch();
 
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
     }
 
-    lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+    lastTimeCharacteristicChangedNs = qzclock::nowNs();
     firstCharacteristicChanged = false;
 }
 
@@ -281,7 +281,7 @@ void bowflextreadmill::btinit(bool startTape) {
 
 void bowflextreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
         QBluetoothUuid _gattWriteCharacteristicId(QStringLiteral("1717b3c0-9803-11e3-90e1-0002a5d5c51b"));
         QBluetoothUuid _gattNotify1CharacteristicId(QStringLiteral("35ddd0a0-9803-11e3-9a8b-0002a5d5c51b"));
@@ -333,7 +333,7 @@ void bowflextreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void bowflextreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -342,11 +342,11 @@ void bowflextreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void bowflextreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void bowflextreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("edff9e80-cad7-11e5-ab63-0002a5d5c51b"));
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
@@ -356,19 +356,19 @@ void bowflextreadmill::serviceScanDone(void) {
 
 void bowflextreadmill::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("bowflextreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bowflextreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bowflextreadmill::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("bowflextreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("bowflextreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void bowflextreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
         m_control = QLowEnergyController::createCentral(bluetoothDevice, this);
@@ -384,17 +384,17 @@ void bowflextreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
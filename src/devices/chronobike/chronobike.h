@@ -52,7 +52,7 @@ class chronobike : public bike {
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
 
     bool noWriteResistance = false;
@@ -749,7 +749,7 @@ int Computrainer::readMessage() {
     }
 
 #ifdef Q_OS_ANDROID
-    qDebug() << cleanFrame << QByteArray((const char *)buf, 7).toHex(' ');
+    QZ_DEBUG << cleanFrame << QByteArray((const char *)buf, 7).toHex(' ');
 
     if (!cleanFrame)
         return 0;
@@ -889,7 +889,7 @@ int Computrainer::openPort() {
 
 int Computrainer::rawWrite(uint8_t *bytes, int size) // unix!!
 {
-    qDebug() << size << QByteArray((const char *)bytes, size).toHex(' ');
+    QZ_DEBUG << size << QByteArray((const char *)bytes, size).toHex(' ');
 
     int rc = 0;
 
@@ -941,7 +941,7 @@ int Computrainer::rawRead(uint8_t bytes[], int size) {
         bufRX.removeFirst();
         qDebug() << "byte popped from rxBuf";
         if (fullLen >= size) {
-            qDebug() << size << QByteArray((const char *)bytes, size).toHex(' ');
+            QZ_DEBUG << size << QByteArray((const char *)bytes, size).toHex(' ');
             return size;
         }
     }
@@ -968,18 +968,18 @@ int Computrainer::rawRead(uint8_t bytes[], int size) {
                 bufRX.append(bb);
                 tmpDebug.append(bb);
             }
-            qDebug() << len + fullLen - size << "bytes to the rxBuf" << tmpDebug.toHex(' ');
-            qDebug() << size << QByteArray((const char *)b, size).toHex(' ');
+            QZ_DEBUG << len + fullLen - size << "bytes to the rxBuf" << tmpDebug.toHex(' ');
+            QZ_DEBUG << size << QByteArray((const char *)b, size).toHex(' ');
             return size;
         }
         for (int i = fullLen; i < len + fullLen; i++) {
             bytes[i] = b[i - fullLen];
         }
-        qDebug() << len << QByteArray((const char *)b, len).toHex(' ');
+        QZ_DEBUG << len << QByteArray((const char *)b, len).toHex(' ');
         fullLen += len;
     }
 
-    qDebug() << "FULL BUFFER RX: << " << fullLen << QByteArray((const char *)bytes, size).toHex(' ');
+    QZ_DEBUG << "FULL BUFFER RX: << " << fullLen << QByteArray((const char *)bytes, size).toHex(' ');
     cleanFrame = true;
 
     return fullLen;
@@ -63,7 +63,7 @@ computrainerbike::computrainerbike(bool noWriteResistance, bool noHeartService,
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService, bikeResistanceOffset, bikeResistanceGain);
             // connect(virtualBike,&virtualbike::debug ,this,& computrainerbike::debug);
             connect(virtualBike, &virtualbike::changeInclination, this, &computrainerbike::changeInclination);
@@ -192,7 +192,7 @@ void computrainerbike::innerWriteResistance() {
         }
 
         if (requestResistance != currentResistance().value()) {
-            emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+            QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
             if (((virtualBike && !virtualBike->ftmsDeviceConnected()) || !virtualBike) &&
                 (requestPower == 0 || requestPower == -1)) {
                 forceResistance(requestResistance);
@@ -209,7 +209,7 @@ void computrainerbike::innerWriteResistance() {
     }
 
     if (requestInclination != -100) {
-        emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+        QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
         forceResistance(requestInclination + gears()); // since this bike doesn't have the concept of resistance,
                                                        // i'm using the gears in the inclination
         requestInclination = -100;
@@ -238,30 +238,29 @@ void computrainerbike::update() {
         myComputrainer->getTelemetry(Power, HeartRate, cadence, speed, RRC, calibration, Buttons, ss, Status);
 
         Speed = speed;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
-        emit debug("Current Distance: " + QString::number(Distance.value()));
+                     ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
+        QZ_EMIT_DEBUG("Current Distance: " + QString::number(Distance.value()));
         Cadence = cadence;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
         }
 
         m_watt = Power;
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
 
         Inclination = Gradient;
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Gradient));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Gradient));
 
         if (watts())
             KCal += ((((0.048 * ((double)watts()) + 1.19) *
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in kg
+                      ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                             //* 3.5) / 200 ) / 60
         /*
                                                                   Resistance = resistance;
@@ -270,10 +269,10 @@ void computrainerbike::update() {
 
         if (!disable_hr_frommachinery) {
             Heart = HeartRate;
-            emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
         }
 
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -300,10 +299,10 @@ void computrainerbike::update() {
 #endif
 
         /*
-    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
+    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
 
         update_metrics(false, watts());
 
@@ -316,7 +315,7 @@ void computrainerbike::update() {
         innerWriteResistance();
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -324,7 +323,7 @@ void computrainerbike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -397,7 +396,7 @@ resistance_t computrainerbike::pelotonToBikeResistance(int pelotonResistance) {
 void computrainerbike::btinit() { initDone = true; }
 
 void computrainerbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
 }
 
 bool computrainerbike::connected() { return true; }
@@ -61,7 +61,7 @@ class computrainerbike : public bike {
 
     uint8_t sec1Update = 0;
     QString lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
     metric target_watts;
 
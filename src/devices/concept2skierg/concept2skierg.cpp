@@ -50,8 +50,8 @@ void concept2skierg::writeCharacteristic(uint8_t *data, uint8_t data_len, const
     gattFTMSService->writeCharacteristic(gattWriteCharControlPointId, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -103,14 +103,14 @@ void concept2skierg::update() {
             }
 
             if (requestResistance != currentResistance().value()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
 
                 forceResistance(requestResistance);
             }
             requestResistance = -1;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -118,7 +118,7 @@ void concept2skierg::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
 
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
@@ -127,11 +127,12 @@ void concept2skierg::update() {
 }
 
 void concept2skierg::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
 
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
@@ -139,7 +140,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << QStringLiteral(" << ") << characteristic.uuid() << " " << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral(" << ") << characteristic.uuid() << " " << newValue.toHex(' ');
 
     lastPacket = newValue;
     // PM5 protocol: https://www.concept2.com/files/pdf/us/monitors/PM5_BluetoothSmartInterfaceDefinition.pdf
@@ -156,7 +157,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                     ((((uint32_t)newValue.at(6)) << 16) | ((uint32_t)((uint16_t)newValue.at(5)) << 8) |
                      (uint32_t)((uint8_t)newValue.at(4)));
                 Distance = distance_dm / 10000.0;
-                emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
                 uint8_t rowing_state = newValue.at(10);
                 isActive = (rowing_state != 0);
@@ -180,8 +181,8 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                 if (isActive) {
                     Speed = speed_ms * 0.0036;
                     Cadence = stroke_rate;
-                    emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-                    emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
                 }
 
                 uint8_t heart_rate = newValue.at(7);
@@ -194,7 +195,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                 {
                     if (heart_rate != 0xFF)
                         Heart = heart_rate;
-                    emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
                 }
             }
             break;
@@ -204,7 +205,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                 uint16_t total_calories =
                     (((uint16_t)((uint16_t)newValue.at(6)) << 8) | (uint16_t)((uint8_t)newValue.at(5)));
                 KCal = total_calories;
-                emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
             }
             break;
         case 0x35:
@@ -213,7 +214,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                 uint16_t stroke_count =
                     (((uint16_t)((uint16_t)newValue.at(18)) << 8) | (uint16_t)((uint8_t)newValue.at(17)));
                 StrokesCount = stroke_count;
-                emit debug(QStringLiteral("Strokes Count: ") + QString::number(StrokesCount.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Strokes Count: ") + QString::number(StrokesCount.value()));
             }
             break;
         case 0x36:
@@ -223,12 +224,12 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
                     (((uint16_t)((uint16_t)newValue.at(5)) << 8) | (uint16_t)((uint8_t)newValue.at(4)));
                 if (isActive) {
                     m_watt = stroke_power;
-                    emit debug(QStringLiteral("Current Watts: ") + QString::number(m_watt.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Watts: ") + QString::number(m_watt.value()));
                 }
             }
             break;
         default:
-            qDebug() << "Unhandled: " << newValue.toHex(' ');
+            QZ_DEBUG << "Unhandled: " << newValue.toHex(' ');
             break;
         }
     }
@@ -239,7 +240,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
     if (heartRateBeltName.startsWith(QStringLiteral("Disabled"))) {
         update_hr_from_external();
@@ -258,8 +259,8 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
 #endif
 #endif
 
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -269,7 +270,7 @@ void concept2skierg::characteristicChanged(const QLowEnergyCharacteristic &chara
 void concept2skierg::stateChanged(QLowEnergyService::ServiceState state) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -384,7 +385,7 @@ void concept2skierg::stateChanged(QLowEnergyService::ServiceState state) {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
 
             auto virtualTreadmill = new virtualtreadmill(this, noHeartService);
             connect(virtualTreadmill, &virtualtreadmill::debug, this, &concept2skierg::debug);
@@ -398,28 +399,28 @@ void concept2skierg::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void concept2skierg::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void concept2skierg::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void concept2skierg::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
 
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void concept2skierg::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void concept2skierg::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
 #ifdef Q_OS_ANDROID
     QLowEnergyConnectionParameters c;
@@ -441,20 +442,20 @@ void concept2skierg::serviceScanDone(void) {
 void concept2skierg::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("concept2skierg::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("concept2skierg::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void concept2skierg::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("concept2skierg::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("concept2skierg::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void concept2skierg::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -471,17 +472,17 @@ void concept2skierg::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -54,7 +54,7 @@ class concept2skierg : public rower {
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
 
     bool initDone = false;
@@ -60,8 +60,8 @@ void crossrope::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStri
     }
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
            // packets sent from the characChanged event, i don't want to block everything
@@ -69,7 +69,7 @@ void crossrope::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStri
         loop.exec();
 
         if (timeout.isActive() == false)
-            emit debug(QStringLiteral(" exit for timeout"));
+            QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -100,11 +100,11 @@ void crossrope::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             requestStart = -1;
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape", false, true);
             requestStop = -1;
         }
@@ -112,21 +112,22 @@ void crossrope::update() {
 }
 
 void crossrope::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void crossrope::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
-    QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     double weight = settings.value(QZSettings::weight, QZSettings::default_weight).toFloat();
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     emit packetReceived();
 
@@ -135,14 +136,14 @@ void crossrope::characteristicChanged(const QLowEnergyCharacteristic &characteri
 
     double steps = (double)(uint16_t)((newValue.at(1) << 8) | ((uint8_t)newValue.at(2)));
     if(steps != JumpsCount.value()) {
-        CadenceRaw = (steps - JumpsCount.value()) / fabs(JumpsCount.valueChanged().msecsTo(now)) * 60000.0;
+        CadenceRaw = (steps - JumpsCount.value()) / fabs((qzclock::nowNs() - JumpsCount.valueChangedNs()) / 1e6) * 60000.0;
         JumpsSequence = JumpsSequence.value() + 1;
         Cadence = CadenceRaw.average20s();
         JumpsCount = steps;
         Speed = Cadence.value() * 0.15; // (speed emulated)
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastTimeCharacteristicChanged.msecsTo(now)));
-    } else if(abs(Cadence.lastChanged().secsTo(now)) > 2) {
+                     ((double)qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs)));
+    } else if(qzclock::secondsSince(Cadence.lastChangedNs()) > 2) {
         CadenceRaw = 0;
         Cadence = 0;
         JumpsSequence = 0;
@@ -154,8 +155,7 @@ void crossrope::characteristicChanged(const QLowEnergyCharacteristic &characteri
             ((((0.048 * ((double)watts(weight)) + 1.19) *
                weight * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                      //* 3.5) / 200 ) / 60
 
 
@@ -169,19 +169,19 @@ void crossrope::characteristicChanged(const QLowEnergyCharacteristic &characteri
             update_hr_from_external();
         }
     }
-    emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
-    emit debug(QStringLiteral("Current Jumps Count: ") + QString::number(JumpsCount.value()));
-    emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Jumps Count: ") + QString::number(JumpsCount.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
     // debug("Current Distance: " + QString::number(distance));
 
 
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
     }
 
-    lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+    lastTimeCharacteristicChangedNs = qzclock::nowNs();
     firstCharacteristicChanged = false;
 }
 
@@ -196,7 +196,7 @@ void crossrope::btinit(bool startTape) {
 
 void crossrope::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
 
         QBluetoothUuid _gattWriteCharacteristicId(QStringLiteral("8aab96c2-db98-4ae9-8f41-3896039c95a8"));
@@ -229,7 +229,7 @@ void crossrope::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void crossrope::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -238,11 +238,11 @@ void crossrope::descriptorWritten(const QLowEnergyDescriptor &descriptor, const
 void crossrope::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void crossrope::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("07eb19be-1e89-4ee5-99a4-1aa7d52dea6b"));
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
@@ -252,19 +252,19 @@ void crossrope::serviceScanDone(void) {
 
 void crossrope::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("crossrope::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("crossrope::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void crossrope::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("crossrope::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("crossrope::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void crossrope::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
         m_control = QLowEnergyController::createCentral(bluetoothDevice, this);
@@ -280,17 +280,17 @@ void crossrope::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
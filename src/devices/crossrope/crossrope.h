@@ -48,7 +48,7 @@ class crossrope : public jumprope {
     uint8_t sec1Update = 0;
     uint8_t firstInit = 0;
     QByteArray lastPacket;
-    QDateTime lastTimeCharacteristicChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
 
     QTimer *refresh;
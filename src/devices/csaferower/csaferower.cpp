@@ -83,11 +83,11 @@ void csaferowerThread::run() {
         command << "CSAFE_GETHRCUR_CMD";
         QByteArray ret = aa->write(command);
 
-        qDebug() << " >> " << ret.toHex(' ');
+        QZ_DEBUG << " >> " << ret.toHex(' ');
         rawWrite((uint8_t *)ret.data(), ret.length());
         static uint8_t rx[100];
         rawRead(rx, 100);
-        qDebug() << " << " << QByteArray::fromRawData((const char *)rx, 64).toHex(' ');
+        QZ_DEBUG << " << " << QByteArray::fromRawData((const char *)rx, 64).toHex(' ');
 
         QVector<quint8> v;
         for (int i = 0; i < 64; i++)
@@ -192,7 +192,7 @@ int csaferowerThread::openPort() {
 
 int csaferowerThread::rawWrite(uint8_t *bytes, int size) // unix!!
 {
-    qDebug() << size << QByteArray((const char *)bytes, size).toHex(' ');
+    QZ_DEBUG << size << QByteArray((const char *)bytes, size).toHex(' ');
 
     int rc = 0;
 
@@ -248,7 +248,7 @@ int csaferowerThread::rawRead(uint8_t bytes[], int size) {
             for (int i = 0; i < len; i++) {
                 bytes[i] = b[i];
             }
-            qDebug() << len << QByteArray((const char *)b, len).toHex(' ');
+            QZ_DEBUG << len << QByteArray((const char *)b, len).toHex(' ');
         }
     } while (len == 0 && start + 2000 > QDateTime::currentMSecsSinceEpoch());
 
@@ -308,8 +308,8 @@ void csaferower::update() {
     }
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+                 ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     // ******************************************* virtual bike/rower init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice()
@@ -398,13 +398,13 @@ void csaferower::update() {
 
 void csaferower::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 bool csaferower::connected() { return true; }
 
 void csaferower::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
 }
 
 void csaferower::newPacket(QByteArray p) {}
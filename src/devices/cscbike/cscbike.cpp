@@ -72,7 +72,7 @@ void cscbike::update() {
     }
 
     m_watt = wattFromHR(false);
-    emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
 
     if (m_control->state() == QLowEnergyController::UnconnectedState) {
         emit disconnected();
@@ -114,13 +114,13 @@ void cscbike::update() {
             }
 
             if (requestResistance != currentResistance().value()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                 // forceResistance(requestResistance);
             }
             requestResistance = -1;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -128,7 +128,7 @@ void cscbike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -136,11 +136,13 @@ void cscbike::update() {
 }
 
 void cscbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
+    markIngress();
     QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -178,21 +180,21 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
         _WheelRevs =
             (((uint32_t)((uint8_t)newValue.at(index + 3)) << 24) | ((uint32_t)((uint8_t)newValue.at(index + 2)) << 16) |
              ((uint32_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint32_t)((uint8_t)newValue.at(index)));
-        emit debug(QStringLiteral("Current Wheel Revs: ") + QString::number(_WheelRevs));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Wheel Revs: ") + QString::number(_WheelRevs));
         index += 4;
 
         _LastWheelEventTime =
             (((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index)));
-        emit debug(QStringLiteral("Current Wheel Event Time: ") + QString::number(_LastWheelEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Wheel Event Time: ") + QString::number(_LastWheelEventTime));
         index += 2;
     }
     if (CrankPresent) {
         _CrankRevs = (((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index)));
-        emit debug(QStringLiteral("Current Crank Revs: ") + QString::number(_CrankRevs));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Crank Revs: ") + QString::number(_CrankRevs));
         index += 2;
         _LastCrankEventTime =
             (((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index)));
-        emit debug(QStringLiteral("Current Crank Event Time: ") + QString::number(_LastCrankEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Crank Event Time: ") + QString::number(_LastCrankEventTime));
     }
 
     if ((!CrankPresent || _CrankRevs == 0) && WheelPresent) {
@@ -217,7 +219,7 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
         Cadence = 0;
     }
     emit cadenceChanged(Cadence.value());
-    emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
     oldLastCrankEventTime = LastCrankEventTime;
     oldCrankRevs = CrankRevs;
@@ -229,13 +231,13 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
     } else {
         Speed = metric::calculateSpeedFromPower(
             watts(), Inclination.value(), Speed.value(),
-            fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
     }
-    emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-    emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                 ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
     double ac = 0.01243107769;
     double bc = 1.145964912;
@@ -266,17 +268,16 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
     if (Cadence.value() > 0) {
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
     if (!noVirtualDevice) {
 #ifdef Q_OS_IOS
@@ -293,8 +294,8 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
 #endif
     }
 
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -303,7 +304,7 @@ void cscbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
 
 void cscbike::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     QBluetoothUuid CyclingSpeedAndCadence(QBluetoothUuid::CyclingSpeedAndCadence);
     QBluetoothUuid Battery(QBluetoothUuid::BatteryService);
@@ -424,7 +425,7 @@ void cscbike::stateChanged(QLowEnergyService::ServiceState state) {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
             connect(virtualBike, &virtualbike::changeInclination, this, &cscbike::changeInclination);
             // connect(virtualBike,&virtualbike::debug ,this,&cscbike::debug);
@@ -436,29 +437,29 @@ void cscbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void cscbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void cscbike::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void cscbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void cscbike::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 
     characteristicChanged(characteristic, newValue);
 }
 
 void cscbike::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
 #ifdef Q_OS_ANDROID
     QLowEnergyConnectionParameters c;
@@ -486,19 +487,19 @@ void cscbike::serviceScanDone(void) {
 
 void cscbike::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("cscbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("cscbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void cscbike::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("cscbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("cscbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void cscbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -515,17 +516,17 @@ void cscbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
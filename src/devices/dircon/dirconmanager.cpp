@@ -1,4 +1,5 @@
 #include "devices/dircon/dirconmanager.h"
+#include "latencymonitor.h"
 #include <QNetworkInterface>
 #include <QSettings>
 #include <chrono>
@@ -106,8 +107,7 @@ enum { DM_SERV_OP(DM_SERV_ENUMI_OP, 0, 0, 0) DM_SERV_I_NUM };
             }                                                                                                          \
         }                                                                                                              \
         if (P2.size()) {                                                                                               \
-            QString dircon_id = QString("%1").arg(settings.value(QZSettings::dircon_id,                                \
-            QZSettings::default_dircon_id).toInt(), 4, 10, QChar('0'));                                                \
+            QString dircon_id = QString("%1").arg(dirconId, 4, 10, QChar('0'));                                        \
             DirconProcessor *processor = new DirconProcessor(                                                          \
                 P2,                                                                                                    \
                 QString(QStringLiteral(NAME))                                                                          \
@@ -118,6 +118,7 @@ enum { DM_SERV_OP(DM_SERV_ENUMI_OP, 0, 0, 0) DM_SERV_I_NUM };
             foreach (DirconProcessorService *s, P2) { servdesc += *s + QStringLiteral(","); }                          \
             qDebug() << "Initializing dircon for" << QString(QStringLiteral(NAME)) << "with serv" << servdesc;         \
             processors.append(processor);                                                                              \
+            processor->setMdnsServer(endpoint.mdnsServer);                                                             \
             if (!processor->init()) {                                                                                  \
                 qDebug() << "Error initializing" << QString(QStringLiteral(NAME));                                     \
             }                                                                                                          \
@@ -145,8 +146,8 @@ QString DirconManager::getMacAddress() {
 #define DM_CHAR_NOTIF_BUILD_OP(UUID, P1, P2, P3) notif##UUID = new CharacteristicNotifier##UUID(P1, this);
 
 DirconManager::DirconManager(bluetoothdevice *Bike, int8_t bikeResistanceOffset, double bikeResistanceGain,
-                             QObject *parent)
-    : QObject(parent) {
+                             QObject *parent, const DirconEndpoint &endpoint)
+    : QObject(parent), device(Bike) {
     QSettings settings;
     DirconProcessorService *service;
     QList<DirconProcessorService *> services, proc_services;
@@ -155,7 +156,11 @@ DirconManager::DirconManager(bluetoothdevice *Bike, int8_t bikeResistanceOffset,
                                                                                          : DM_MACHINE_TYPE_BIKE;
     qDebug() << "Building Dircom Manager";
     uint16_t server_base_port =
-        settings.value(QZSettings::dircon_server_base_port, QZSettings::default_dircon_server_base_port).toUInt();
+        endpoint.basePort
+            ? endpoint.basePort
+            : settings.value(QZSettings::dircon_server_base_port, QZSettings::default_dircon_server_base_port).toUInt();
+    int dirconId =
+        endpoint.id >= 0 ? endpoint.id : settings.value(QZSettings::dircon_id, QZSettings::default_dircon_id).toInt();
     bool bike_wheel_revs = settings.value(QZSettings::bike_wheel_revs, QZSettings::default_bike_wheel_revs).toBool();
     DM_CHAR_NOTIF_OP(DM_CHAR_NOTIF_BUILD_OP, Bike, 0, 0)
     writeP2AD9 = new CharacteristicWriteProcessor2AD9(bikeResistanceGain, bikeResistanceOffset, Bike, notif2AD9, this);
@@ -168,7 +173,7 @@ DirconManager::DirconManager(bluetoothdevice *Bike, int8_t bikeResistanceOffset,
     connect(writePE005, SIGNAL(ftmsCharacteristicChanged(QLowEnergyCharacteristic, QByteArray)), this,
             SIGNAL(ftmsCharacteristicChanged(QLowEnergyCharacteristic, QByteArray)));
     QObject::connect(&bikeTimer, &QTimer::timeout, this, &DirconManager::bikeProvider);
-    QString mac = getMacAddress();
+    QString mac = endpoint.mac.isEmpty() ? getMacAddress() : endpoint.mac;
     DM_MACHINE_OP(DM_MACHINE_INIT_OP, services, proc_services, type)
     if (settings.value(QZSettings::race_mode, QZSettings::default_race_mode).toBool())
         bikeTimer.start(100ms);
@@ -187,4 +192,6 @@ DirconManager::DirconManager(bluetoothdevice *Bike, int8_t bikeResistanceOffset,
 void DirconManager::bikeProvider() {
     DM_CHAR_NOTIF_OP(DM_CHAR_NOTIF_NOTIF1_OP, 0, 0, 0)
     foreach (DirconProcessor *processor, processors) { DM_CHAR_NOTIF_OP(DM_CHAR_NOTIF_NOTIF2_OP, processor, 0, 0) }
+    if (!processors.isEmpty())
+        latencymonitor::record(latencymonitor::DIRCON, device->ingressNs());
 }
@@ -24,18 +24,29 @@
 
 #define DM_CHAR_NOTIF_DEFINE_OP(UUID, P1, P2, P3) CharacteristicNotifier##UUID *notif##UUID = 0;
 
+// where a machine is published; what is not set comes from the settings
+class DirconEndpoint {
+  public:
+    uint16_t basePort = 0;
+    int id = -1;
+    QString mac;
+    // the mDNS responder of the machines published together, owned by who publishes them
+    QMdnsEngine::Server *mdnsServer = nullptr;
+};
+
 class DirconManager : public QObject {
     Q_OBJECT
     QTimer bikeTimer;
+    bluetoothdevice *device;
     CharacteristicWriteProcessor2AD9 *writeP2AD9 = 0;
     CharacteristicWriteProcessorE005 *writePE005 = 0;
     DM_CHAR_NOTIF_OP(DM_CHAR_NOTIF_DEFINE_OP, 0, 0, 0)
     QList<DirconProcessor *> processors;
-    static QString getMacAddress();
 
   public:
     explicit DirconManager(bluetoothdevice *t, int8_t bikeResistanceOffset = 4, double bikeResistanceGain = 1.0,
-                           QObject *parent = nullptr);
+                           QObject *parent = nullptr, const DirconEndpoint &endpoint = DirconEndpoint());
+    static QString getMacAddress();
   private slots:
     void bikeProvider();
   signals:
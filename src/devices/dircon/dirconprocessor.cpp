@@ -14,6 +14,11 @@ DirconProcessor::DirconProcessor(const QList<DirconProcessorService *> &my_servi
 
 DirconProcessor::~DirconProcessor() {}
 
+void DirconProcessor::setMdnsServer(QMdnsEngine::Server *server) {
+    if (!mdnsProvider)
+        mdnsServer = server;
+}
+
 bool DirconProcessor::initServer() {
     qDebug() << "Initializing dircon tcp server for" << serverName;
     if (!server) {
@@ -43,9 +48,10 @@ void DirconProcessor::initAdvertising() {
             connect(zeroConf, SIGNAL(servicePublished()), this, SLOT(advOK()));
             connect(zeroConf, SIGNAL(error(QZeroConf::error_t)), this, SLOT(advError(QZeroConf::error_t)));
         }*/
-    if (!mdnsServer) {
+    if (!mdnsProvider) {
         qDebug() << "Dircon Adv init for" << serverName;
-        mdnsServer = new QMdnsEngine::Server(this);
+        if (!mdnsServer)
+            mdnsServer = new QMdnsEngine::Server(this);
         mdnsHostname = new QMdnsEngine::Hostname(mdnsServer, serverName.toUtf8() + QByteArrayLiteral("H"), this);
         mdnsProvider = new QMdnsEngine::Provider(mdnsServer, mdnsHostname, this);
         QMdnsEngine::Service mdnsService;
@@ -214,7 +220,7 @@ bool DirconProcessor::sendCharacteristicNotification(quint16 uuid, const QByteAr
             rvs = socket->write(pkt.encode(0)) < 0;
             if (rvs)
                 rv = false;
-            qDebug() << serverName << "sending to" << socket->peerAddress().toString() << ":" << socket->peerPort()
+            QZ_DEBUG << serverName << "sending to" << socket->peerAddress().toString() << ":" << socket->peerPort()
                      << " notification for uuid = " << QString(QStringLiteral("%1")).arg(uuid, 4, 16, QLatin1Char('0'))
                      << "rv=" << (!rvs) << data.toHex(' ');
         }
@@ -226,7 +232,7 @@ void DirconProcessor::tcpDataAvailable() {
     QTcpSocket *socket = qobject_cast<QTcpSocket *>(sender());
     DirconProcessorClient *client = clientsMap.value(socket);
     QByteArray data = socket->readAll();
-    qDebug() << "Data available for uuid " << serverName << ":" << data.toHex();
+    QZ_DEBUG << "Data available for uuid " << serverName << ":" << data.toHex();
     if (client) {
         int buflimit, rembuf;
         client->buffer.append(data);
@@ -242,7 +248,7 @@ void DirconProcessor::tcpDataAvailable() {
                     client->seq += 1;
             } else if (buflimit < DPKT_PARSE_ERROR) {
                 rembuf = -buflimit - DPKT_PARSE_ERROR;
-                qDebug() << "Unexpected packet" << client->buffer.mid(0, rembuf).toHex();
+                QZ_DEBUG << "Unexpected packet" << client->buffer.mid(0, rembuf).toHex();
             } else
                 rembuf = -1;
             if (rembuf >= 0)
@@ -90,6 +90,8 @@ class DirconProcessor : public QObject {
     explicit DirconProcessor(const QList<DirconProcessorService *> &services, const QString &serv_name,
                              quint16 serv_port, const QString &serv_sn, const QString &mac, QObject *parent = nullptr);
     bool sendCharacteristicNotification(quint16 uuid, const QByteArray &data);
+    // a responder shared with other processors, owned by the caller; without it the processor has its own
+    void setMdnsServer(QMdnsEngine::Server *server);
     bool init();
   private slots:
     void tcpDataAvailable();
@@ -59,7 +59,7 @@ void domyosbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStr
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
                         QStringLiteral(" // ") + info;
     }
 
@@ -283,7 +283,8 @@ void domyosbike::serviceDiscovered(const QBluetoothUuid &gatt) {
 }
 
 void domyosbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -291,7 +292,7 @@ void domyosbike::characteristicChanged(const QLowEnergyCharacteristic &character
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     QByteArray value = newValue;
 
-    qDebug() << QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' ');
+    QZ_DEBUG << QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' ');
 
     // for the init packets, the length is always less than 20
     // for the display and status packets, the length is always grater then 20 and there are 2 cases:
@@ -362,8 +363,7 @@ void domyosbike::characteristicChanged(const QLowEnergyCharacteristic &character
                 KCal.value() + ((((0.048 * ((double)watts()) + 1.19) *
                                     settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                                     200.0) /
-                                (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                                now)))); //(( (0.048* Output in watts +1.19) * body
+                                (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body
                                                                             // weight in kg * 3.5) / 200 ) / 60
         else
             kcal = KCal.value();
@@ -415,7 +415,7 @@ void domyosbike::characteristicChanged(const QLowEnergyCharacteristic &character
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_IOS
 #ifndef IO_UNDER_QT
@@ -448,7 +448,7 @@ void domyosbike::characteristicChanged(const QLowEnergyCharacteristic &character
     } else {
         Speed = metric::calculateSpeedFromPower(
             watts(), Inclination.value(), Speed.value(),
-            fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
     }
     KCal = kcal;
     Distance = distance;
@@ -575,7 +575,7 @@ void domyosbike::stateChanged(QLowEnergyService::ServiceState state) {
 void domyosbike::searchingStop() { searchStopped = true; }
 
 void domyosbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -583,7 +583,7 @@ void domyosbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const
 
 void domyosbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void domyosbike::serviceScanDone(void) {
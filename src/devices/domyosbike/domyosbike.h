@@ -79,7 +79,7 @@ class domyosbike : public bike {
     bool searchStopped = false;
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     enum _BIKE_TYPE {
         CHANG_YOW,
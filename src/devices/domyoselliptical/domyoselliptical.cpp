@@ -54,14 +54,14 @@ void domyoselliptical::writeCharacteristic(uint8_t *data, uint8_t data_len, cons
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -214,7 +214,7 @@ void domyoselliptical::update() {
             }
 
             if (requestResistance != currentResistance().value()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
 
                 forceResistance(requestResistance);
             }
@@ -227,14 +227,14 @@ void domyoselliptical::update() {
             }
 
             if (requestInclination != currentInclination().value()) {
-                emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
 
                 forceInclination(requestInclination);
             }
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // if(bike_type == CHANG_YOW)
             btinit_changyow(true);
@@ -245,7 +245,7 @@ void domyoselliptical::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), QStringLiteral("stop tape"));
 
             requestStop = -1;
@@ -260,18 +260,19 @@ void domyoselliptical::changeInclinationRequested(double grade, double percentag
 }
 
 void domyoselliptical::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void domyoselliptical::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     lastPacket = newValue;
     if (newValue.length() != 26) {
@@ -279,11 +280,11 @@ void domyoselliptical::characteristicChanged(const QLowEnergyCharacteristic &cha
     }
 
     if (newValue.at(22) == 0x06) {
-        emit debug(QStringLiteral("inclination up button pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("inclination up button pressed!"));
 
         // requestStart = 1;
     } else if (newValue.at(22) == 0x07) {
-        emit debug(QStringLiteral("inclination down button pressed!")); // i guess it should be the inclination down
+        QZ_EMIT_DEBUG(QStringLiteral("inclination down button pressed!")); // i guess it should be the inclination down
 
         // requestStop = 1;
     }
@@ -317,13 +318,13 @@ void domyoselliptical::characteristicChanged(const QLowEnergyCharacteristic &cha
     Resistance = newValue.at(14);
     Inclination = newValue.at(21);
     if (Resistance.value() < 1) {
-        emit debug(QStringLiteral("invalid resistance value ") + QString::number(Resistance.value()) +
-                   QStringLiteral(" putting to default"));
+        QZ_EMIT_DEBUG(QStringLiteral("invalid resistance value ") + QString::number(Resistance.value()) +
+                      QStringLiteral(" putting to default"));
         Resistance = 1;
     }
     if (Inclination.value() < 0 || Inclination.value() > 15) {
-        emit debug(QStringLiteral("invalid inclination value ") + QString::number(Inclination.value()) +
-                   QStringLiteral(" putting to default"));
+        QZ_EMIT_DEBUG(QStringLiteral("invalid inclination value ") + QString::number(Inclination.value()) +
+                      QStringLiteral(" putting to default"));
         Inclination.setValue(0);
     }
 
@@ -343,16 +344,16 @@ void domyoselliptical::characteristicChanged(const QLowEnergyCharacteristic &cha
     CrankRevs++;
     LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
-    emit debug(QStringLiteral("Current resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current inclination: ") + QString::number(Inclination.value()));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
-    emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
-    emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current inclination: ") + QString::number(Inclination.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(kcal));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(distance));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -361,8 +362,8 @@ void domyoselliptical::characteristicChanged(const QLowEnergyCharacteristic &cha
     Speed = speed;
     KCal = kcal;
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+                 ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 }
 
 double domyoselliptical::GetSpeedFromPacket(const QByteArray &packet) {
@@ -461,7 +462,7 @@ void domyoselliptical::stateChanged(QLowEnergyService::ServiceState state) {
     QBluetoothUuid _gattNotifyCharacteristicId(QStringLiteral("49535343-1e4d-4bd9-ba61-23c647249616"));
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if (state == QLowEnergyService::ServiceDiscovered) {
 
@@ -494,7 +495,7 @@ void domyoselliptical::stateChanged(QLowEnergyService::ServiceState state) {
 void domyoselliptical::searchingStop() { searchStopped = true; }
 
 void domyoselliptical::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -503,11 +504,11 @@ void domyoselliptical::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void domyoselliptical::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void domyoselliptical::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("49535343-fe7d-4ae5-8fa9-9fafd205e455"));
 
@@ -519,30 +520,30 @@ void domyoselliptical::serviceScanDone(void) {
 void domyoselliptical::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("domyoselliptical::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyoselliptical::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyoselliptical::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("domyoselliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyoselliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyoselliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     if (device.name().startsWith(QStringLiteral("Domyos-EL")) &&
         !device.name().startsWith(QStringLiteral("DomyosBridge"))) {
         bluetoothDevice = device;
 
         if (device.address().toString().startsWith(QStringLiteral("57"))) {
-            emit debug(QStringLiteral("domyos telink bike found"));
+            QZ_EMIT_DEBUG(QStringLiteral("domyos telink bike found"));
 
             bike_type = TELINK;
         } else {
-            emit debug(QStringLiteral("domyos changyow bike found"));
+            QZ_EMIT_DEBUG(QStringLiteral("domyos changyow bike found"));
 
             bike_type = CHANG_YOW;
         }
@@ -560,18 +561,18 @@ void domyoselliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
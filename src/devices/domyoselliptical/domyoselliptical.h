@@ -69,7 +69,7 @@ class domyoselliptical : public elliptical {
     bool searchStopped = false;
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     enum _BIKE_TYPE {
         CHANG_YOW,
@@ -61,13 +61,13 @@ void domyosrower::writeCharacteristic(uint8_t *data, uint8_t data_len, const QSt
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -248,7 +248,7 @@ void domyosrower::update() {
             }
 
             if (requestResistance != currentResistance().value()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
 
                 forceResistance(requestResistance);
             }
@@ -261,14 +261,14 @@ void domyosrower::update() {
             }
 
             if (requestInclination != currentInclination().value()) {
-                emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
 
                 forceInclination(requestInclination);
             }
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // if(bike_type == CHANG_YOW)
             btinit_changyow(true);
@@ -279,7 +279,7 @@ void domyosrower::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), QStringLiteral("stop tape"));
 
             requestStop = -1;
@@ -294,11 +294,13 @@ void domyosrower::changeInclinationRequested(double grade, double percentage) {
 }
 
 void domyosrower::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
+    markIngress();
     QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -314,11 +316,11 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
         }
 
         if (newValue.at(22) == 0x06) {
-            emit debug(QStringLiteral("inclination up button pressed!"));
+            QZ_EMIT_DEBUG(QStringLiteral("inclination up button pressed!"));
 
             // requestStart = 1;
         } else if (newValue.at(22) == 0x07) {
-            emit debug(QStringLiteral("inclination down button pressed!")); // i guess it should be the inclination down
+            QZ_EMIT_DEBUG(QStringLiteral("inclination down button pressed!")); // i guess it should be the inclination down
 
             // requestStop = 1;
         }
@@ -344,13 +346,13 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
         Resistance = newValue.at(14);
         Inclination = newValue.at(21);
         if (Resistance.value() < 1) {
-            emit debug(QStringLiteral("invalid resistance value ") + QString::number(Resistance.value()) +
-                       QStringLiteral(" putting to default"));
+            QZ_EMIT_DEBUG(QStringLiteral("invalid resistance value ") + QString::number(Resistance.value()) +
+                          QStringLiteral(" putting to default"));
             Resistance = 1;
         }
         if (Inclination.value() < 0 || Inclination.value() > 15) {
-            emit debug(QStringLiteral("invalid inclination value ") + QString::number(Inclination.value()) +
-                       QStringLiteral(" putting to default"));
+            QZ_EMIT_DEBUG(QStringLiteral("invalid inclination value ") + QString::number(Inclination.value()) +
+                          QStringLiteral(" putting to default"));
             Inclination.setValue(0);
         }
 
@@ -368,16 +370,16 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
 
-        emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-        emit debug(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
-        emit debug(QStringLiteral("Current resistance: ") + QString::number(Resistance.value()));
-        emit debug(QStringLiteral("Current inclination: ") + QString::number(Inclination.value()));
-        emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-        emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-        emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+        QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(kcal));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(distance));
+        QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+        QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
 
         if (m_control->error() != QLowEnergyController::NoError) {
             qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -386,8 +388,8 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
         Speed = speed;
         KCal = kcal;
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-        lastRefreshCharacteristicChanged = now;
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+        lastRefreshCharacteristicChangedNs = nowNs;
     } else {
         union flags {
             struct {
@@ -448,9 +450,9 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             if (!Flags.instantPace) {
                 // eredited by echelon rower, probably we need to change this
                 Speed = (0.37497622 * ((double)Cadence.value())) / 2.0;
-                emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
             }*/
-            emit debug(QStringLiteral("Strokes Count: ") + QString::number(StrokesCount.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Strokes Count: ") + QString::number(StrokesCount.value()));
         }
 
         if (Flags.avgStroke) {
@@ -462,7 +464,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             }            
             avgStroke = ((double)(uint16_t)((uint8_t)newValue.at(index))) / cadence_divider;
             index += 1;
-            emit debug(QStringLiteral("Current Average Stroke: ") + QString::number(avgStroke));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Stroke: ") + QString::number(avgStroke));
         }
 
         if (Flags.totDistance) {
@@ -477,10 +479,10 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             index += 3;
         } else {
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.instantPace) {
 
@@ -493,11 +495,11 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             instantPace =
                 ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Pace: ") + QString::number(instantPace));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Pace: ") + QString::number(instantPace));
 
             Speed = (60.0 / instantPace) *
                 30.0; // translating pace (min/500m) to km/h in order to match the pace function in the rower.cpp
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgPace) {
@@ -511,7 +513,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             avgPace =
                 ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Average Pace: ") + QString::number(avgPace));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Pace: ") + QString::number(avgPace));
         }
 
         if (Flags.instantPower) {
@@ -524,7 +526,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
                 ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
             m_watt = watt;
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
         }
 
         if (Flags.avgPower) {
@@ -537,7 +539,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             avgPower =
                 ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
         }
 
         if (Flags.resistanceLvl) {
@@ -549,7 +551,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
                 ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) | (uint16_t)((uint8_t)newValue.at(index))));
             emit resistanceRead(Resistance.value());
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         }
 
         if (Flags.expEnergy && index + 1 < newValue.length()) {
@@ -567,12 +569,11 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
                     ((((0.048 * ((double)watts()) + 1.19) *
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
-                     (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                    now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                     (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                       // kg * 3.5) / 200 ) / 60
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
     #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -584,9 +585,9 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
                 if (index < newValue.length()) {
                     Heart = ((double)(((uint8_t)newValue.at(index))));
                     // index += 1; //NOTE: clang-analyzer-deadcode.DeadStores
-                    emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
                 } else
-                    emit debug(QStringLiteral("Error on parsing heart"));
+                    QZ_EMIT_DEBUG(QStringLiteral("Error on parsing heart"));
             }
         }
 
@@ -611,7 +612,7 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
         }
 
-        lastRefreshCharacteristicChanged = now;
+        lastRefreshCharacteristicChangedNs = nowNs;
 
         if (heartRateBeltName.startsWith(QStringLiteral("Disabled"))) {
             update_hr_from_external();
@@ -630,8 +631,8 @@ void domyosrower::characteristicChanged(const QLowEnergyCharacteristic &characte
     #endif
     #endif
 
-        emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-        emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+        QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
         if (m_control->error() != QLowEnergyController::NoError) {
             qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -737,7 +738,7 @@ void domyosrower::stateChanged(QLowEnergyService::ServiceState state) {
         QBluetoothUuid _gattNotifyCharacteristicId(QStringLiteral("49535343-1e4d-4bd9-ba61-23c647249616"));
 
         QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-        emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+        QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
         if (state == QLowEnergyService::ServiceDiscovered) {
 
@@ -767,7 +768,7 @@ void domyosrower::stateChanged(QLowEnergyService::ServiceState state) {
         }
     } else {
         QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-        emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+        QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
         for (QLowEnergyService *s : qAsConst(gattCommunicationChannelServiceArray)) {
             qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -852,17 +853,17 @@ void domyosrower::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void domyosrower::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void domyosrower::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void domyosrower::searchingStop() { searchStopped = true; }
 
 void domyosrower::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -870,11 +871,11 @@ void domyosrower::descriptorWritten(const QLowEnergyDescriptor &descriptor, cons
 
 void domyosrower::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void domyosrower::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("49535343-fe7d-4ae5-8fa9-9fafd205e455"));
 
@@ -897,29 +898,29 @@ void domyosrower::serviceScanDone(void) {
 void domyosrower::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("domyosrower::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyosrower::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyosrower::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("domyosrower::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyosrower::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyosrower::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
         if (device.address().toString().startsWith(QStringLiteral("57"))) {
-            emit debug(QStringLiteral("domyos telink bike found"));
+            QZ_EMIT_DEBUG(QStringLiteral("domyos telink bike found"));
 
             bike_type = TELINK;
         } else {
-            emit debug(QStringLiteral("domyos changyow bike found"));
+            QZ_EMIT_DEBUG(QStringLiteral("domyos changyow bike found"));
 
             bike_type = CHANG_YOW;
         }
@@ -937,18 +938,18 @@ void domyosrower::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
@@ -77,7 +77,7 @@ class domyosrower : public rower {
     bool searchStopped = false;
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     QDateTime lastStroke = QDateTime::currentDateTime();
     double lastStrokesCount = 0;
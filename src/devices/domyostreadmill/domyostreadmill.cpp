@@ -108,7 +108,7 @@ void domyostreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, const
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ')
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ')
                  << QStringLiteral(" // ") + info;
     }
 
@@ -324,7 +324,7 @@ void domyostreadmill::update() {
         if (incompletePackets == false) {
             if (requestSpeed != -1) {
                 if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                    emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
 
                     double inc = Inclination.value();
                     if (requestInclination != -100 && lastInclinationChanged.secsTo(QDateTime::currentDateTime()) > inclination_delay_seconds) {
@@ -346,7 +346,7 @@ void domyostreadmill::update() {
                 requestInclination = qRound(requestInclination * 2.0) / 2.0;
                 if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                     requestInclination <= 20) {
-                    emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
 
                     double speed = currentSpeed().value();
                     if (requestSpeed != -1) {
@@ -359,7 +359,7 @@ void domyostreadmill::update() {
                 requestInclination = -100;
             }
             if (requestStart != -1) {
-                emit debug(QStringLiteral("starting..."));
+                QZ_EMIT_DEBUG(QStringLiteral("starting..."));
                 if (lastSpeed == 0.0) {
 
                     lastSpeed = 0.5;
@@ -369,24 +369,24 @@ void domyostreadmill::update() {
                 emit tapeStarted();
             }
             if (requestStop != -1) {
-                emit debug(QStringLiteral("stopping..."));
+                QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                 writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), QStringLiteral("stop tape"), false,
                                     true);
                 requestStop = -1;
             }
             if (requestFanSpeed != -1) {
-                emit debug(QStringLiteral("changing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
 
                 sendChangeFanSpeed(requestFanSpeed);
                 requestFanSpeed = -1;
             }
             if (requestIncreaseFan != -1) {
-                emit debug(QStringLiteral("increasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
                 sendChangeFanSpeed(FanSpeed + 1);
                 requestIncreaseFan = -1;
             } else if (requestDecreaseFan != -1) {
-                emit debug(QStringLiteral("decreasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
                 sendChangeFanSpeed(FanSpeed - 1);
                 requestDecreaseFan = -1;
@@ -396,11 +396,12 @@ void domyostreadmill::update() {
 }
 
 void domyostreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                             const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -411,7 +412,7 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     // for the init packets, the length is always less than 20
     // for the display and status packets, the length is always grater then 20 and there are 2 cases:
@@ -421,7 +422,7 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
     //         and the second one with the remained byte
     // so this simply condition will match all the cases, excluding the 20byte packet of the T900.
     if (newValue.length() != 20) {
-        emit debug(QStringLiteral("packetReceived!"));
+        QZ_EMIT_DEBUG(QStringLiteral("packetReceived!"));
 
         emit packetReceived();
     }
@@ -439,7 +440,7 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
         (lastPacket.length() == 20 && lastPacket.startsWith(startBytes2) && value.length() == 7)) {
 
         incompletePackets = false;
-        emit debug(QStringLiteral("...final bytes received"));
+        QZ_EMIT_DEBUG(QStringLiteral("...final bytes received"));
         lastPacket.append(value);
         value = lastPacket;
     }
@@ -450,51 +451,51 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
 
         // semaphore for any writing packets (for example, update display)
         if (value.length() == 20 && (value.startsWith(startBytes) || value.startsWith(startBytes2))) {
-            emit debug(QStringLiteral("waiting for other bytes..."));
+            QZ_EMIT_DEBUG(QStringLiteral("waiting for other bytes..."));
 
             incompletePackets = true;
         }
 
-        emit debug(QStringLiteral("packet ignored"));
+        QZ_EMIT_DEBUG(QStringLiteral("packet ignored"));
         return;
     }
 
     if (value.at(22) == 0x06) {
-        emit debug(QStringLiteral("start button pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("start button pressed!"));
 
         requestStart = 1;
     } else if (value.at(22) == 0x07) {
-        emit debug(QStringLiteral("stop button pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("stop button pressed!"));
 
         requestStop = 1;
     } else if (value.at(22) == 0x0b) {
-        emit debug(QStringLiteral("increase speed fan pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("increase speed fan pressed!"));
 
         requestIncreaseFan = 1;
     } else if (value.at(22) == 0x0a) {
-        emit debug(QStringLiteral("decrease speed fan pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("decrease speed fan pressed!"));
 
         requestDecreaseFan = 1;
     } else if (value.at(22) == 0x08) {
-        emit debug(QStringLiteral("increase speed button on console pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("increase speed button on console pressed!"));
         if (domyos_treadmill_buttons) {
 
             changeSpeed(currentSpeed().value() + 0.2);
         }
     } else if (value.at(22) == 0x09) {
-        emit debug(QStringLiteral("decrease speed button on console pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("decrease speed button on console pressed!"));
         if (domyos_treadmill_buttons) {
 
             changeSpeed(currentSpeed().value() - 0.2);
         }
     } else if (value.at(22) == 0x0c) {
-        emit debug(QStringLiteral("increase inclination button on console pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("increase inclination button on console pressed!"));
         if (domyos_treadmill_buttons) {
 
             changeInclination(currentInclination().value() + 0.5, currentInclination().value() + 0.5);
         }
     } else if (value.at(22) == 0x0d) {
-        emit debug(QStringLiteral("decrease inclination button on console pressed!"));
+        QZ_EMIT_DEBUG(QStringLiteral("decrease inclination button on console pressed!"));
         if (domyos_treadmill_buttons) {
 
             changeInclination(currentInclination().value() - 0.5, currentInclination().value() - 0.5);
@@ -502,136 +503,136 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
     } else if (value.at(22) == 0x11) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("10km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("10km/h speed button pressed!"));
                 changeSpeed(10.0);
             } else {
-                emit debug(QStringLiteral("22km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("22km/h speed button pressed!"));
                 changeSpeed(settings.value(QZSettings::domyos_treadmill_button_22kmh, QZSettings::default_domyos_treadmill_button_22kmh).toDouble());
             }            
         }
     } else if (value.at(22) == 0x10) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("8km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("8km/h speed button pressed!"));
                 changeSpeed(8.0);
             } else {
-                emit debug(QStringLiteral("16km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("16km/h speed button pressed!"));
                 changeSpeed(settings.value(QZSettings::domyos_treadmill_button_16kmh, QZSettings::default_domyos_treadmill_button_16kmh).toDouble());
             }            
         }
     } else if (value.at(22) == 0x0f) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("6km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("6km/h speed button pressed!"));
                 changeSpeed(6.0);
             } else {
-                emit debug(QStringLiteral("10km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("10km/h speed button pressed!"));
                 changeSpeed(settings.value(QZSettings::domyos_treadmill_button_10kmh, QZSettings::default_domyos_treadmill_button_10kmh).toDouble());
             }            
         }
     } else if (value.at(22) == 0x0e) {        
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("4km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("4km/h speed button pressed!"));
                 changeSpeed(4.0);
             } else {
-                emit debug(QStringLiteral("5km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("5km/h speed button pressed!"));
                 changeSpeed(settings.value(QZSettings::domyos_treadmill_button_5kmh, QZSettings::default_domyos_treadmill_button_5kmh).toDouble());
             }            
         }
     } else if (value.at(22) == 0x15) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("3% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("3% inclination button on console pressed!"));
                 changeInclination(3.0, 3.0);
             } else {
-                emit debug(QStringLiteral("15% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("15% inclination button on console pressed!"));
                 changeInclination(15.0, 15.0);
             }            
         }        
     } else if (value.at(22) == 0x14) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("2% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("2% inclination button on console pressed!"));
                 changeInclination(2.0, 2.0);
             } else {
-                emit debug(QStringLiteral("10% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("10% inclination button on console pressed!"));
                 changeInclination(10.0, 10.0);
             }            
         }        
     } else if (value.at(22) == 0x13) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("1% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("1% inclination button on console pressed!"));
                 changeInclination(1.0, 1.0);
             } else {
-                emit debug(QStringLiteral("5% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("5% inclination button on console pressed!"));
                 changeInclination(5.0, 5.0);
             }            
         }        
     } else if (value.at(22) == 0x12) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("0% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("0% inclination button on console pressed!"));
                 changeInclination(0.0, 0.0);
             } else {
-                emit debug(QStringLiteral("0% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("0% inclination button on console pressed!"));
                 changeInclination(0.0, 0.0);
             }            
         }        
     } else if (value.at(22) == 0x17) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("14km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("14km/h speed button pressed!"));
                 changeSpeed(14.0);
             }            
         }        
     } else if (value.at(22) == 0x18) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("16km/h speed button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("16km/h speed button on console pressed!"));
                 changeSpeed(16.0);
             }            
         }        
     } else if (value.at(22) == 0x19) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("18km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("18km/h speed button pressed!"));
                 changeSpeed(18.0);
             }            
         }        
     } else if (value.at(22) == 0x16) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("12km/h speed button pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("12km/h speed button pressed!"));
                 changeSpeed(12.0);
             }            
         }        
     } else if (value.at(22) == 0x1a) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("4% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("4% inclination button on console pressed!"));
                 changeInclination(4.0, 4.0);
             }            
         }        
     } else if (value.at(22) == 0x1b) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("6% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("6% inclination button on console pressed!"));
                 changeInclination(6.0, 6.0);
             }            
         }        
     } else if (value.at(22) == 0x1c) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("8% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("8% inclination button on console pressed!"));
                 changeInclination(8.0, 8.0);
             }            
         }        
     } else if (value.at(22) == 0x1d) {
         if (domyos_treadmill_buttons) {
             if(domyos_treadmill_t900a) {
-                emit debug(QStringLiteral("10% inclination button on console pressed!"));
+                QZ_EMIT_DEBUG(QStringLiteral("10% inclination button on console pressed!"));
                 changeInclination(10.0, 10.0);
             }            
         }        
@@ -675,21 +676,20 @@ void domyostreadmill::characteristicChanged(const QLowEnergyCharacteristic &char
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         Distance += ((speed / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-        lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+                     ((double)1000.0 / (double)(qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
+        lastTimeCharacteristicChangedNs = qzclock::nowNs();
     }
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-    emit debug(QStringLiteral("Current KCal from the machine: ") + QString::number(kcal));
-    emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal from the machine: ") + QString::number(kcal));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(distance));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -781,7 +781,7 @@ void domyostreadmill::btinit(bool startTape) {
 void domyostreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
 
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -811,7 +811,7 @@ void domyostreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void domyostreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -820,33 +820,33 @@ void domyostreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void domyostreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                             const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void domyostreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
     if (gattCommunicationChannelService) {
         connect(gattCommunicationChannelService, &QLowEnergyService::stateChanged, this, &domyostreadmill::stateChanged);
         gattCommunicationChannelService->discoverDetails();
     } else {
-        emit debug(QStringLiteral("error on find Service"));
+        QZ_EMIT_DEBUG(QStringLiteral("error on find Service"));
     }    
 }
 
 void domyostreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("domyostreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyostreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyostreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("domyostreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("domyostreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void domyostreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -866,18 +866,18 @@ void domyostreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
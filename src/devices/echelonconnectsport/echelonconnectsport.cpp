@@ -69,7 +69,7 @@ void echelonconnectsport::writeCharacteristic(uint8_t *data, uint8_t data_len, c
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
                         QStringLiteral(" // ") + info;
     }
 
@@ -201,13 +201,14 @@ double echelonconnectsport::bikeResistanceToPeloton(double resistance) {
 
 void echelonconnectsport::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << " << " + newValue.toHex(' ');
+    QZ_DEBUG << " << " + newValue.toHex(' ');
 
     lastPacket = newValue;
 
@@ -261,25 +262,24 @@ void echelonconnectsport::characteristicChanged(const QLowEnergyCharacteristic &
     } else {
         Speed = metric::calculateSpeedFromPower(
             watts(), Inclination.value(), Speed.value(),
-            fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
     }
     if (watts())
         KCal +=
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                 ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
     if (Cadence.value() > 0) {
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool()) {
@@ -450,7 +450,7 @@ void echelonconnectsport::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void echelonconnectsport::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -459,7 +459,7 @@ void echelonconnectsport::descriptorWritten(const QLowEnergyDescriptor &descript
 void echelonconnectsport::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void echelonconnectsport::serviceScanDone(void) {
@@ -70,7 +70,7 @@ void echelonrower::writeCharacteristic(uint8_t *data, uint8_t data_len, const QS
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
                         QStringLiteral(" // ") + info;
     }
 
@@ -194,17 +194,18 @@ double echelonrower::bikeResistanceToPeloton(double resistance) {
 }
 
 void echelonrower::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newvalue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << QStringLiteral(" << ") + newvalue.toHex(' ');
+    QZ_DEBUG << QStringLiteral(" << ") + newvalue.toHex(' ');
 
     if (lastPacket.count() > 0 && lastPacket.count() + newvalue.count() == 21 && ((unsigned char)lastPacket.at(0)) == 0xf0) {
         lastPacket = lastPacket.append(newvalue);
-        qDebug() << QStringLiteral(" << concatenated ") + lastPacket.toHex(' ');
+        QZ_DEBUG << QStringLiteral(" << concatenated ") + lastPacket.toHex(' ');
     } else {
         lastPacket = newvalue;
     }
@@ -234,7 +235,7 @@ void echelonrower::characteristicChanged(const QLowEnergyCharacteristic &charact
             .startsWith(QStringLiteral("Disabled"))) {
         Cadence = ((uint8_t)lastPacket.at(11));
         StrokesCount += (Cadence.value()) *
-                        ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())) / 60000;
+                        ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)) / 60000;
     }
     // instant pace to km/h
     if ((((uint8_t)lastPacket.at(14)) > 0 || ((uint8_t)lastPacket.at(13)) > 0) && Cadence.value() > 0) {
@@ -253,18 +254,17 @@ void echelonrower::characteristicChanged(const QLowEnergyCharacteristic &charact
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                 ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
     if (Cadence.value() > 0) {
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -433,7 +433,7 @@ void echelonrower::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void echelonrower::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -441,7 +441,7 @@ void echelonrower::descriptorWritten(const QLowEnergyDescriptor &descriptor, con
 
 void echelonrower::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void echelonrower::serviceScanDone(void) {
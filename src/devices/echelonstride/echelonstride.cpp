@@ -49,7 +49,7 @@ void echelonstride::writeCharacteristic(uint8_t *data, uint8_t data_len, const Q
 
     if (gattCommunicationChannelService->state() != QLowEnergyService::ServiceState::ServiceDiscovered ||
         m_control->state() == QLowEnergyController::UnconnectedState) {
-        emit debug(QStringLiteral("writeCharacteristic error because the connection is closed"));
+        QZ_EMIT_DEBUG(QStringLiteral("writeCharacteristic error because the connection is closed"));
         return;
     }
 
@@ -61,14 +61,14 @@ void echelonstride::writeCharacteristic(uint8_t *data, uint8_t data_len, const Q
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -173,7 +173,7 @@ void echelonstride::update() {
 
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 forceSpeed(requestSpeed);
             }
             requestSpeed = -1;
@@ -183,13 +183,13 @@ void echelonstride::update() {
                 requestInclination = 0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 forceIncline(requestInclination);
             }
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
                 lastSpeed = 0.5;
             }
@@ -217,23 +217,23 @@ void echelonstride::update() {
             emit tapeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             uint8_t initData3[] = {0xf0, 0xb0, 0x01, 0x00, 0xa1};
             writeCharacteristic(initData3, sizeof(initData3), QStringLiteral("stop"), false, true);
             requestStop = -1;
             lastStop = QDateTime::currentMSecsSinceEpoch();
         }
         if (requestFanSpeed != -1) {
-            emit debug(QStringLiteral("changing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
             // sendChangeFanSpeed(requestFanSpeed);
             requestFanSpeed = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
         }
@@ -241,13 +241,14 @@ void echelonstride::update() {
 }
 
 void echelonstride::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 double echelonstride::minStepInclination() { return 1.0; }
 
 void echelonstride::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -255,7 +256,7 @@ void echelonstride::characteristicChanged(const QLowEnergyCharacteristic &charac
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    qDebug() << QStringLiteral(" << ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral(" << ") + newValue.toHex(' ');
 
     lastPacket = newValue;
 
@@ -336,11 +337,10 @@ void echelonstride::characteristicChanged(const QLowEnergyCharacteristic &charac
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         Distance += ((Speed.value() / 3600.0) /
-                     (1000.0 / (lastTimeCharacteristicChanged.msecsTo(now))));
+                     (1000.0 / (qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs))));
     }
 
     if ((uint8_t)newValue.at(1) == 0xD1 && newValue.length() > 11)
@@ -371,7 +371,7 @@ void echelonstride::characteristicChanged(const QLowEnergyCharacteristic &charac
     if (m_control->error() != QLowEnergyController::NoError)
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
 
-    lastTimeCharacteristicChanged = now;
+    lastTimeCharacteristicChangedNs = nowNs;
     firstCharacteristicChanged = false;
 }
 
@@ -444,7 +444,7 @@ void echelonstride::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void echelonstride::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -452,7 +452,7 @@ void echelonstride::descriptorWritten(const QLowEnergyDescriptor &descriptor, co
 
 void echelonstride::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void echelonstride::serviceScanDone(void) {
@@ -467,14 +467,14 @@ void echelonstride::serviceScanDone(void) {
 
 void echelonstride::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("echelonstride::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("echelonstride::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void echelonstride::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("echelonstride::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("echelonstride::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void echelonstride::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -497,17 +497,17 @@ void echelonstride::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
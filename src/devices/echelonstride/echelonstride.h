@@ -65,7 +65,7 @@ class echelonstride : public treadmill {
     uint8_t firstInit = 0;
     uint8_t counterPoll = 1;
     QByteArray lastPacket;
-    QDateTime lastTimeCharacteristicChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
 
     QTimer *refresh;
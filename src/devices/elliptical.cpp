@@ -2,12 +2,22 @@
 #include "devices/elliptical.h"
 #include <QSettings>
 
-elliptical::elliptical() {}
+elliptical::elliptical() {
+    // the power requests are applied as resistance
+    controlArbiter()->share(controlarbiter::POWER, controlarbiter::RESISTANCE);
+    controlArbiter()->setMinInterval(controlarbiter::POWER, 500);
+    controlArbiter()->setMinInterval(controlarbiter::INCLINATION, 1000);
+    controlArbiter()->setMinInterval(controlarbiter::SPEED, 500);
+    controlArbiter()->setTolerance(controlarbiter::POWER, 1);
+    controlArbiter()->setTolerance(controlarbiter::INCLINATION, 0.05);
+    controlArbiter()->setTolerance(controlarbiter::SPEED, 0.05);
+}
 
 void elliptical::update_metrics(bool watt_calc, const double watts) {
 
-    QDateTime current = QDateTime::currentDateTime();
-    double deltaTime = (((double)_lastTimeUpdate.msecsTo(current)) / ((double)1000.0));
+    qint64 currentNs = qzclock::nowNs();
+    // monotonic: a wall clock change (NTP, DST) must not add or remove elapsed time, distance and energy
+    double deltaTime = ((double)(currentNs - _lastTimeUpdateNs)) / 1e9;
     QSettings settings;
     if (!_firstUpdate && !paused) {
         if (currentSpeed().value() > 0.0 || settings.value(QZSettings::continuous_moving, true).toBool()) {
@@ -34,13 +44,17 @@ void elliptical::update_metrics(bool watt_calc, const double watts) {
     if (currentInclination().value() > 0)
         elevationAcc += (currentSpeed().value() / 3600.0) * 1000.0 * (currentInclination().value() / 100.0) * deltaTime;
 
-    _lastTimeUpdate = current;
+    _lastTimeUpdateNs = currentNs;
     _firstUpdate = false;
+
+    publishMetrics();
 }
 
 resistance_t elliptical::resistanceFromPowerRequest(uint16_t power) { return power / 10; } // in order to have something
 
 void elliptical::changePower(int32_t power) {
+    if (!arbitrateControl(controlarbiter::POWER, power))
+        return;
 
     RequestedPower = power; // in order to paint in any case the request power on the charts
 
@@ -67,6 +81,8 @@ void elliptical::changePower(int32_t power) {
     if (/*!ergModeSupported &&*/ force_resistance /*&& erg_mode*/ &&
         (deltaUp > erg_filter_upper || deltaDown > erg_filter_lower)) {
         resistance_t r = (resistance_t)resistanceFromPowerRequest(power);
+        // the resistance is the way this request is applied, not a new request
+        controlarbiter::scope internal(controlarbiter::INTERNAL);
         changeResistance(r); // resistance start from 1
     }
 }
@@ -108,6 +124,8 @@ double elliptical::speedFromWatts() {
 }
 
 void elliptical::changeResistance(resistance_t resistance) {
+    if (!arbitrateControl(controlarbiter::RESISTANCE, resistance))
+        return;
     qDebug() << "changeResistance" << resistance;
     lastRawRequestedResistanceValue = resistance;
     requestResistance = resistance + gears();
@@ -120,10 +138,13 @@ void elliptical::setGears(double gears) {
     m_gears = gears;
     settings.setValue(QZSettings::gears_current_value, m_gears);
     if (lastRawRequestedResistanceValue != -1) {
+        controlarbiter::scope internal(controlarbiter::INTERNAL);
         changeResistance(lastRawRequestedResistanceValue);
     }
 }
 void elliptical::changeInclination(double grade, double inclination) {
+    if (!arbitrateControl(controlarbiter::INCLINATION, grade, inclination))
+        return;
     qDebug() << "changeInclination" << grade << inclination;
     if (autoResistanceEnable) {
         requestInclination = inclination;
@@ -197,9 +218,15 @@ void elliptical::setLap() {
 
 int elliptical::pelotonToEllipticalResistance(int pelotonResistance) { return pelotonResistance; }
 void elliptical::changeCadence(int16_t cadence) { RequestedCadence = cadence; }
-void elliptical::changeRequestedPelotonResistance(int8_t resistance) { RequestedPelotonResistance = resistance; }
+void elliptical::changeRequestedPelotonResistance(int8_t resistance) {
+    if (!controlAllowed(controlarbiter::RESISTANCE))
+        return;
+    RequestedPelotonResistance = resistance;
+}
 double elliptical::requestedSpeed() { return requestSpeed; }
 void elliptical::changeSpeed(double speed) {
+    if (!arbitrateControl(controlarbiter::SPEED, speed))
+        return;
     RequestedSpeed = speed;
     if (autoResistanceEnable)
         requestSpeed = speed;
@@ -210,3 +237,10 @@ metric elliptical::lastRequestedPelotonResistance() { return RequestedPelotonRes
 metric elliptical::lastRequestedResistance() { return RequestedResistance; }
 bool elliptical::inclinationAvailableByHardware() { return true; }
 bool elliptical::inclinationSeparatedFromResistance() { return false; }
+
+void elliptical::applyControl(controlarbiter::TARGET target, double value, double extra) {
+    if (target == controlarbiter::SPEED)
+        changeSpeed(value);
+    else
+        bluetoothdevice::applyControl(target, value, extra);
+}
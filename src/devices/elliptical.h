@@ -47,6 +47,8 @@ class elliptical : public bluetoothdevice {
     void bikeStarted();
 
   protected:
+    void applyControl(controlarbiter::TARGET target, double value, double extra) override;
+
     metric RequestedResistance;
     metric RequestedCadence;
     metric RequestedSpeed;
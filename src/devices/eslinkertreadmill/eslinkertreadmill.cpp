@@ -52,8 +52,8 @@ void eslinkertreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, con
                                                          QLowEnergyService::WriteWithoutResponse);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     // packets sent from the characChanged event, i don't want to block everything
@@ -61,7 +61,7 @@ void eslinkertreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, con
         loop.exec();
 
         if (timeout.isActive() == false)
-            emit debug(QStringLiteral(" exit for timeout"));
+            QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -153,7 +153,7 @@ void eslinkertreadmill::update() {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, noHeartService);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &eslinkertreadmill::debug);
                 this->setVirtualDevice(virtualTreadMill, VIRTUAL_DEVICE_MODE::PRIMARY);
@@ -175,7 +175,7 @@ void eslinkertreadmill::update() {
 
             if (requestSpeed != -1) {
                 if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                    emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                     // double inc = Inclination.value(); // NOTE: clang-analyzer-deadcode.DeadStores
                     if (requestInclination != -100) {
                         //                        inc = requestInclination;
@@ -190,7 +190,7 @@ void eslinkertreadmill::update() {
                     requestInclination = 0;
                 if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                     requestInclination <= 15) {
-                    emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                     // double speed = currentSpeed().value(); // NOTE: clang-analyzer-deadcode.DeadStores
                     if (requestSpeed != -1) {
                         // speed = requestSpeed;
@@ -244,7 +244,7 @@ void eslinkertreadmill::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
                 lastSpeed = 0.5;
             }
@@ -258,7 +258,7 @@ void eslinkertreadmill::update() {
         }
         if (requestStop != -1) {
             requestSpeed = 0;
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape", false, true);
             requestStop = -1;
         }
@@ -266,7 +266,7 @@ void eslinkertreadmill::update() {
 }
 
 void eslinkertreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 
     if(gatt == QBluetoothUuid((quint16)0x1826)) {
         QSettings settings;
@@ -279,6 +279,7 @@ void eslinkertreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
 
 void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -286,7 +287,7 @@ void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     emit packetReceived();
 
@@ -363,7 +364,7 @@ void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
                 if (heartRateBeltName.startsWith("Disabled"))
                     Heart = heart;
             }
-            emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
         }
     }
 
@@ -387,9 +388,9 @@ void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
             /*if(heartRateBeltName.startsWith("Disabled"))
             Heart = value.at(18);*/
         }
-        emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-        emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+        QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(kcal));
         // debug("Current Distance: " + QString::number(distance));
 
         if (Speed.value() != speed) {
@@ -418,7 +419,7 @@ void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
         else
             Speed = (double)((uint8_t)newValue.at(3)) / 10.0 * miles;
         Inclination = 0; // this treadmill doesn't have inclination
-        emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
     }
 
     if (!firstCharacteristicChanged) {
@@ -428,23 +429,22 @@ void eslinkertreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
 
         Distance += ((Speed.value() / 3600.0) /
-                     (1000.0 / (lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
+                     (1000.0 / (qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
     }
 
     cadenceFromAppleWatch();
 
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
     }
 
-    lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+    lastTimeCharacteristicChangedNs = qzclock::nowNs();
     firstCharacteristicChanged = false;
 }
 
@@ -604,7 +604,7 @@ void eslinkertreadmill::btinit(bool startTape) {
 
 void eslinkertreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
         QBluetoothUuid _gattWriteCharacteristicId((quint16)0xfff2);
         QBluetoothUuid _gattNotifyCharacteristicId((quint16)0xfff1);
@@ -636,7 +636,7 @@ void eslinkertreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void eslinkertreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -645,11 +645,11 @@ void eslinkertreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor
 void eslinkertreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void eslinkertreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId((quint16)0xfff0);
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
@@ -659,19 +659,19 @@ void eslinkertreadmill::serviceScanDone(void) {
 
 void eslinkertreadmill::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("eslinkertreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("eslinkertreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void eslinkertreadmill::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("eslinkertreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("eslinkertreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void eslinkertreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
         m_control = QLowEnergyController::createCentral(bluetoothDevice, this);
@@ -687,17 +687,17 @@ void eslinkertreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -28,10 +28,33 @@ fakebike::fakebike(bool noWriteResistance, bool noHeartService, bool noVirtualDe
     refresh->start(200ms);
 }
 
+void fakebike::simulate(telemetryprofile *profile, int intervalMs) {
+    this->profile = profile;
+    refresh->start(intervalMs);
+}
+
 void fakebike::update() {
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
+
+    if (profile) {
+        telemetrysample s = profile->next();
+        if (s.dropout) {
+            // the trainer didn't notify anything this time
+            return;
+        }
+        markIngress();
+        if (requestPower != -1) {
+            simulatedTargetPower = requestPower;
+            requestPower = -1;
+        }
+        m_watt = simulatedTargetPower > 0 ? simulatedTargetPower : s.watt;
+        Cadence = s.cadence;
+        Heart = s.heart;
+        Speed = metric::calculateSpeedFromPower(m_watt.value(), 0, Speed.value(),
+                                                qzclock::secondsSince(Speed.lastChangedNs()), speedLimit());
+    }
     /*
     static int updcou = 0;
     updcou++;
@@ -43,22 +66,22 @@ void fakebike::update() {
     else if (updcou > 6000)
         w = 80;
     Speed = metric::calculateSpeedFromPower(w, Inclination.value(),
-    Speed.value(),fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), speedLimit());
+    Speed.value(),qzclock::secondsSince(Speed.lastChangedNs()), speedLimit());
     */
 
     if (requestPower != -1) {
         // bepo70: don't know if this conversion is really needed, i would do it anyway.
         m_watt = (double)requestPower;
         Cadence = requestPower;
-        emit debug(QStringLiteral("writing power ") + QString::number(requestPower));
+        QZ_EMIT_DEBUG(QStringLiteral("writing power ") + QString::number(requestPower));
         requestPower = -1;
         // bepo70: Disregard the current inclination for calculating speed. When the video
         //         has a high inclination you have to give many power to get the desired playback speed,
         //         if inclination is very low little more power gives a quite high speed jump.
         // Speed = metric::calculateSpeedFromPower(m_watt.value(), Inclination.value(),
-        // Speed.value(),fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), speedLimit());
+        // Speed.value(),qzclock::secondsSince(Speed.lastChangedNs()), speedLimit());
         Speed = metric::calculateSpeedFromPower(
-            m_watt.value(), 0, Speed.value(), fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0),
+            m_watt.value(), 0, Speed.value(), qzclock::secondsSince(Speed.lastChangedNs()),
             speedLimit());
     }
     
@@ -69,15 +92,15 @@ void fakebike::update() {
 
     if (requestInclination != -100) {
         Inclination = requestInclination;
-        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
         requestInclination = -100;
     }
 
     update_metrics(false, watts());
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();    
+                 ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();    
 
     // ******************************************* virtual bike init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice() && !noVirtualDevice
@@ -103,7 +126,7 @@ void fakebike::update() {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
             connect(virtualBike, &virtualbike::changeInclination, this, &fakebike::changeInclinationRequested);
             connect(virtualBike, &virtualbike::ftmsCharacteristicChanged, this, &fakebike::ftmsCharacteristicChanged);
@@ -154,7 +177,7 @@ void fakebike::update() {
 
 void fakebike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void fakebike::changeInclinationRequested(double grade, double percentage) {
@@ -29,6 +29,7 @@
 
 #include "devices/bike.h"
 #include "ergtable.h"
+#include "telemetryprofile.h"
 
 #ifdef Q_OS_IOS
 #include "ios/lockscreen.h"
@@ -42,13 +43,21 @@ class fakebike : public bike {
     uint16_t watts() override;
     resistance_t maxResistance() override { return 100; }
     resistance_t resistanceFromPowerRequest(uint16_t power) override;
-    
+    /**
+     * @brief simulate Drives the device with a rider model instead of the requests only, refreshing it every
+     * intervalMs (see devicefleet).
+     */
+    void simulate(telemetryprofile *profile, int intervalMs);
+
   private:
     QTimer *refresh;
+    telemetryprofile *profile = nullptr;
+    // ERG target received while simulating: the trainer holds it whatever the rider does
+    double simulatedTargetPower = 0;
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
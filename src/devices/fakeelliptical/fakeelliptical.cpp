@@ -27,11 +27,28 @@ fakeelliptical::fakeelliptical(bool noWriteResistance, bool noHeartService, bool
     refresh->start(200ms);
 }
 
+void fakeelliptical::simulate(telemetryprofile *profile, int intervalMs) {
+    this->profile = profile;
+    refresh->start(intervalMs);
+}
+
 void fakeelliptical::update() {
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
+    if (profile) {
+        telemetrysample s = profile->next();
+        if (s.dropout)
+            return;
+        markIngress();
+        // the watts are calculated from the speed by update_metrics
+        Speed = s.speed * 0.8;
+        Cadence = s.cadence * 0.7;
+        Inclination = s.inclination;
+        Heart = s.heart;
+    }
+
     update_metrics(true, watts());
 
     if (Cadence.value() > 0) {
@@ -40,8 +57,8 @@ void fakeelliptical::update() {
     }
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+                 ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     // ******************************************* virtual bike init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice() && !noVirtualDevice
@@ -68,7 +85,7 @@ void fakeelliptical::update() {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
             connect(virtualBike, &virtualbike::changeInclination, this, &fakeelliptical::changeInclinationRequested);
             connect(virtualBike, &virtualbike::ftmsCharacteristicChanged, this,
@@ -121,7 +138,7 @@ void fakeelliptical::update() {
 void fakeelliptical::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void fakeelliptical::changeInclinationRequested(double grade, double percentage) {
@@ -29,16 +29,32 @@ fakerower::fakerower(bool noWriteResistance, bool noHeartService, bool noVirtual
     refresh->start(200ms);
 }
 
+void fakerower::simulate(telemetryprofile *profile, int intervalMs) {
+    this->profile = profile;
+    refresh->start(intervalMs);
+}
+
 void fakerower::update() {
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
+    if (profile) {
+        telemetrysample s = profile->next();
+        if (s.dropout)
+            return;
+        markIngress();
+        m_watt = s.watt;
+        Speed = s.speed;
+        Cadence = s.cadence * 0.3; // strokes per minute
+        Heart = s.heart;
+    }
+
     update_metrics(false, watts());
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+                 ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     // ******************************************* virtual bike init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice() && !noVirtualDevice
@@ -124,7 +140,7 @@ void fakerower::update() {
 
 void fakerower::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void fakerower::changeInclinationRequested(double grade, double percentage) {
@@ -27,6 +27,7 @@
 #include <QString>
 
 #include "devices/rower.h"
+#include "telemetryprofile.h"
 
 #ifdef Q_OS_IOS
 #include "ios/lockscreen.h"
@@ -37,13 +38,15 @@ class fakerower : public rower {
   public:
     fakerower(bool noWriteResistance, bool noHeartService, bool noVirtualDevice);
     bool connected() override;
+    void simulate(telemetryprofile *profile, int intervalMs);
 
   private:
     QTimer *refresh;
+    telemetryprofile *profile = nullptr;
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
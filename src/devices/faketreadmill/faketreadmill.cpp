@@ -28,24 +28,46 @@ faketreadmill::faketreadmill(bool noWriteResistance, bool noHeartService, bool n
     refresh->start(200ms);
 }
 
+void faketreadmill::simulate(telemetryprofile *profile, int intervalMs) {
+    this->profile = profile;
+    refresh->start(intervalMs);
+}
+
 void faketreadmill::update() {
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
-    QDateTime now = QDateTime::currentDateTime();
+
+    if (profile) {
+        telemetrysample s = profile->next();
+        if (s.dropout)
+            return;
+        markIngress();
+        if (requestSpeed != -1) {
+            simulatedTargetSpeed = requestSpeed;
+            requestSpeed = -1;
+        }
+        Speed = simulatedTargetSpeed > 0 ? simulatedTargetSpeed : s.speed;
+        if (requestInclination == -100)
+            Inclination = s.inclination;
+        Cadence = s.cadence * 1.8; // steps per minute
+        Heart = s.heart;
+    }
+
+    qint64 nowNs = qzclock::nowNs();
     float _watts = watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat());
 
     update_metrics(true, _watts);
 
     if (requestSpeed != -1) {
         Speed = requestSpeed;
-        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
         requestSpeed = -1;
     }
 
     if (requestInclination != -100) {
         Inclination = requestInclination;
-        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
         requestInclination = -100;
     }
 
@@ -54,8 +76,8 @@ void faketreadmill::update() {
     cadenceFromAppleWatch();
 
     Distance += ((Speed.value() / (double)3600.0) /
-                 ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(now))));
-    lastRefreshCharacteristicChanged = now;
+                 ((double)1000.0 / (double)(qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs))));
+    lastRefreshCharacteristicChangedNs = nowNs;
 
     // ******************************************* virtual treadmill init *************************************
     if (!firstStateChanged && !this->hasVirtualDevice()) {
@@ -121,7 +143,7 @@ void faketreadmill::update() {
 void faketreadmill::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
     QByteArray b = newValue;
-    qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void faketreadmill::changeInclinationRequested(double grade, double percentage) {
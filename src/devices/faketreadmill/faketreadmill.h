@@ -27,6 +27,7 @@
 #include <QString>
 
 #include "devices/treadmill.h"
+#include "telemetryprofile.h"
 #include "virtualdevices/virtualbike.h"
 #include "virtualdevices/virtualtreadmill.h"
 
@@ -41,13 +42,17 @@ class faketreadmill : public treadmill {
     bool connected() override;
     double minStepSpeed() override { return 0.1; }
     double minStepInclination() override { return 0.1; }
+    void simulate(telemetryprofile *profile, int intervalMs);
 
   private:
     QTimer *refresh;
+    telemetryprofile *profile = nullptr;
+    // speed requested while simulating: the belt holds it whatever the runner does
+    double simulatedTargetSpeed = -1;
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
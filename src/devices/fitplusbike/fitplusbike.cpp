@@ -80,7 +80,7 @@ void fitplusbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QSt
     }
 
     if (!disable_log)
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info;
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info;
 
     loop.exec();
 }
@@ -401,14 +401,15 @@ void fitplusbike::serviceDiscovered(const QBluetoothUuid &gatt) {
 }
 
 void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << QStringLiteral(" << ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral(" << ") + newValue.toHex(' ');
 
     lastPacket = newValue;
 
@@ -454,7 +455,7 @@ void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characte
             } else {
                 Speed = metric::calculateSpeedFromPower(
                     watts(), Inclination.value(), Speed.value(),
-                    fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                    qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
             }
             index += 2;
             qDebug() << QStringLiteral("Current Speed: ") + QString::number(Speed.value());
@@ -550,8 +551,7 @@ void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characte
                            settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                           200.0) /
                          (60000.0 /
-                          ((double)lastRefreshCharacteristicChanged.msecsTo(
-                              now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                          ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                 // kg * 3.5) / 200 ) / 60
         }
 
@@ -646,7 +646,7 @@ void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characte
             else*/
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
 
         } else if (newValue.length() == 13) {
 
@@ -674,7 +674,7 @@ void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characte
         else
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
     }
 
     if (watts())
@@ -682,18 +682,17 @@ void fitplusbike::characteristicChanged(const QLowEnergyCharacteristic &characte
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                 ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
     if (Cadence.value() > 0) {
         CrankRevs++;
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -931,7 +930,7 @@ void fitplusbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void fitplusbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -939,7 +938,7 @@ void fitplusbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, cons
 
 void fitplusbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void fitplusbike::serviceScanDone(void) {
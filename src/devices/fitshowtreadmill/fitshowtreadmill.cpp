@@ -73,7 +73,7 @@ void fitshowtreadmill::writeCharacteristic(const uint8_t *data, uint8_t data_len
     writeBuffer = new QByteArray((const char *)data, data_len);
 
     if (!info.isEmpty()) {
-        emit debug(QStringLiteral(" >>") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >>") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     if (gattWriteCharacteristic.properties() & QLowEnergyCharacteristic::WriteNoResponse) {
@@ -86,7 +86,7 @@ void fitshowtreadmill::writeCharacteristic(const uint8_t *data, uint8_t data_len
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -172,7 +172,7 @@ void fitshowtreadmill::update() {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, noHeartService);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &fitshowtreadmill::debug);
                 connect(virtualTreadMill, &virtualtreadmill::changeInclination, this,
@@ -183,13 +183,13 @@ void fitshowtreadmill::update() {
         }
         // ********************************************************************************************************
 
-        emit debug(QStringLiteral("fitshow Treadmill RSSI ") + QString::number(bluetoothDevice.rssi()));
+        QZ_EMIT_DEBUG(QStringLiteral("fitshow Treadmill RSSI ") + QString::number(bluetoothDevice.rssi()));
 
         update_metrics(true, watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat()));
 
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value()) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 double inc = rawInclination.value();
                 if (requestInclination != -100) {
                     // only 0.5 or 1 changes otherwise it beeps forever
@@ -208,7 +208,7 @@ void fitshowtreadmill::update() {
             double a = 1.0 / minStepInclination();
             requestInclination = qRound(treadmillInclinationOverrideReverse(requestInclination) * a) / a;
             if (requestInclination != inc) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 inc = requestInclination;
                 double speed = currentSpeed().value();
                 if (requestSpeed != -1) {
@@ -220,7 +220,7 @@ void fitshowtreadmill::update() {
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
                 lastSpeed = 0.5;
             }
@@ -248,11 +248,11 @@ void fitshowtreadmill::update() {
             if (paused) {
                 lastStop = QDateTime::currentMSecsSinceEpoch();
                 uint8_t pauseTape[] = {FITSHOW_SYS_CONTROL, FITSHOW_CONTROL_PAUSE}; // to verify
-                emit debug(QStringLiteral("pausing..."));
+                QZ_EMIT_DEBUG(QStringLiteral("pausing..."));
                 scheduleWrite(pauseTape, sizeof(pauseTape), QStringLiteral("pause tape"));
             } else {
                 uint8_t stopTape[] = {FITSHOW_SYS_CONTROL, FITSHOW_CONTROL_STOP};
-                emit debug(QStringLiteral("stopping..."));
+                QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                 lastStop = QDateTime::currentMSecsSinceEpoch();
                 scheduleWrite(stopTape, sizeof(stopTape), QStringLiteral("stop tape"));
             }
@@ -260,11 +260,11 @@ void fitshowtreadmill::update() {
         }
 
         if (retrySend >= 6) { // 3 retries
-            emit debug(QStringLiteral("WARNING: answer not received for command "
-                                      "%1 / %2 (%3)")
-                           .arg(((uint8_t)bufferWrite.at(1)), 2, 16, QChar('0'))
-                           .arg(((uint8_t)bufferWrite.at(2)), 2, 16, QChar('0'))
-                           .arg(debugMsgs.at(0)));
+            QZ_EMIT_DEBUG(QStringLiteral("WARNING: answer not received for command "
+                                         "%1 / %2 (%3)")
+                              .arg(((uint8_t)bufferWrite.at(1)), 2, 16, QChar('0'))
+                              .arg(((uint8_t)bufferWrite.at(2)), 2, 16, QChar('0'))
+                              .arg(debugMsgs.at(0)));
             removeFromBuffer();
         }
         if (!bufferWrite.isEmpty()) {
@@ -293,8 +293,8 @@ void fitshowtreadmill::removeFromBuffer() {
 void fitshowtreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
     uint32_t servRepr = gatt.toUInt32();
     QBluetoothUuid nobleproconnect(QStringLiteral("0000ae00-0000-1000-8000-00805f9b34fb"));
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString() + QStringLiteral(" ") +
-               QString::number(servRepr));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString() + QStringLiteral(" ") +
+                  QString::number(servRepr));
     if ((gatt == nobleproconnect && serviceId.isNull()) || servRepr == 0xfff0 || (servRepr == 0xffe0 && serviceId.isNull())) {
         qDebug() << "adding" << gatt.toString() << "as the default service";
         serviceId = gatt; // NOTE: clazy-rule-of-tow
@@ -317,6 +317,7 @@ void fitshowtreadmill::sendSportData() {
 
 void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -326,23 +327,23 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
-    emit debug(QStringLiteral("packetReceived!"));
+    QZ_EMIT_DEBUG(QStringLiteral("packetReceived!"));
     emit packetReceived();
 
     lastPacket = value;
 
     if(characteristic.uuid() == QBluetoothUuid((quint16)0x2a53) && value.length() >= 4) {
         Cadence = value.at(3);
-        emit debug(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
         return;
     }
 
     const uint8_t *full_array = (uint8_t *)value.constData();
     uint8_t full_len = value.length();
     if (!checkIncomingPacket(full_array, full_len)) {
-        emit debug(QStringLiteral("Invalid packet"));
+        QZ_EMIT_DEBUG(QStringLiteral("Invalid packet"));
         return;
     }
     const uint8_t *array = full_array + 1;
@@ -359,8 +360,8 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             if (full_len > 6) {
                 MAX_SPEED = full_array[3];
                 MIN_SPEED = full_array[4];
-                emit debug(QStringLiteral("Speed between ") + QString::number(MIN_SPEED) + QStringLiteral(" and ") +
-                           QString::number(MAX_SPEED));
+                QZ_EMIT_DEBUG(QStringLiteral("Speed between ") + QString::number(MIN_SPEED) + QStringLiteral(" and ") +
+                              QString::number(MAX_SPEED));
                 if (full_len > 7) {
                     UNIT = full_array[5];
                 }
@@ -377,15 +378,15 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         } else if (par == FITSHOW_INFO_INCLINE) {
             if (full_len < 7) {
                 MAX_INCLINE = 0;
-                emit debug(QStringLiteral("Incline not supported"));
+                QZ_EMIT_DEBUG(QStringLiteral("Incline not supported"));
             } else {
                 MAX_INCLINE = full_array[3];
                 MIN_INCLINE = full_array[4];
                 if (full_len > 7 && (full_array[5] & 0x2) != 0x0) {
                     IS_PAUSE = true;
                 }
-                emit debug(QStringLiteral("Incline between ") + QString::number(MIN_INCLINE) + QStringLiteral(" and ") +
-                           QString::number(MAX_INCLINE));
+                QZ_EMIT_DEBUG(QStringLiteral("Incline between ") + QString::number(MIN_INCLINE) + QStringLiteral(" and ") +
+                              QString::number(MAX_INCLINE));
             }
         } else if (par == FITSHOW_INFO_MODEL) {
             if (full_len > 7) {
@@ -393,26 +394,26 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 DEVICE_ID_NAME = QStringLiteral("%1-%2")
                                      .arg(full_array[3], 2, 16, QLatin1Char('0'))
                                      .arg(second, 4, 16, QLatin1Char('0'));
-                emit debug(QStringLiteral("DEVICE ") + DEVICE_ID_NAME);
+                QZ_EMIT_DEBUG(QStringLiteral("DEVICE ") + DEVICE_ID_NAME);
             }
         } else if (par == FITSHOW_INFO_TOTAL) {
             if (full_len > 8) {
                 TOTAL = (full_array[6] << 24 | full_array[5] << 16 | full_array[4] << 8 | full_array[3]);
-                emit debug(QStringLiteral("TOTAL ") + QString::number(TOTAL));
+                QZ_EMIT_DEBUG(QStringLiteral("TOTAL ") + QString::number(TOTAL));
             } else {
                 TOTAL = -1;
             }
         } else if (par == FITSHOW_INFO_DATE) {
             if (full_len > 7) {
                 FACTORY_DATE = QDate(full_array[3] + 2000, full_array[4], full_array[5]);
-                emit debug(QStringLiteral("DATE ") + FACTORY_DATE.toString());
+                QZ_EMIT_DEBUG(QStringLiteral("DATE ") + FACTORY_DATE.toString());
             } else {
                 FACTORY_DATE = QDate();
             }
         }
     } else if (cmd == FITSHOW_SYS_CONTROL) {
         SYS_CONTROL_CMD = par;
-        emit debug(QStringLiteral("SYS_CONTROL received ok: par ") + QString::number(par));
+        QZ_EMIT_DEBUG(QStringLiteral("SYS_CONTROL received ok: par ") + QString::number(par));
         if (par == FITSHOW_CONTROL_TARGET_OR_RUN) {
             QString dbg;
             if (full_len > 5) {
@@ -421,16 +422,16 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     dbg += QStringLiteral("; actual incline: ") + QString::number(full_array[4]);
                 }
             }
-            emit debug(dbg);
+            QZ_EMIT_DEBUG(dbg);
         }
     }
     if (cmd == FITSHOW_SYS_STATUS) {
         CURRENT_STATUS = par;
-        emit debug(QStringLiteral("STATUS ") + QString::number(par));
+        QZ_EMIT_DEBUG(QStringLiteral("STATUS ") + QString::number(par));
         if (par == FITSHOW_STATUS_START) {
             if (len > 2) {
                 COUNTDOWN_VALUE = array[2];
-                emit debug(QStringLiteral("CONTDOWN ") + QString::number(COUNTDOWN_VALUE));
+                QZ_EMIT_DEBUG(QStringLiteral("CONTDOWN ") + QString::number(COUNTDOWN_VALUE));
             }
         } else if (par == FITSHOW_STATUS_RUNNING || par == FITSHOW_STATUS_STOP || par == FITSHOW_STATUS_PAUSED ||
                    par == FITSHOW_STATUS_END) {
@@ -467,25 +468,24 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                               200.0) /
                              (60000.0 /
-                              ((double)lastTimeCharacteristicChanged.msecsTo(
-                                  QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                              ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                     // kg * 3.5) / 200 ) / 60
                     DistanceCalculated +=
                         ((speed / 3600.0) /
-                         (1000.0 / (lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-                    lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+                         (1000.0 / (qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
+                    lastTimeCharacteristicChangedNs = qzclock::nowNs();
                 }
 
                 StepCount = step_count;
 
-                emit debug(QStringLiteral("Current elapsed from treadmill: ") + QString::number(seconds_elapsed));
-                emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-                emit debug(QStringLiteral("Current heart: ") + QString::number(heart));
-                emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-                emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(DistanceCalculated));
-                emit debug(QStringLiteral("Current KCal from the Machine: ") + QString::number(kcal));
-                emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-                emit debug(QStringLiteral("Current step countl: ") + QString::number(step_count));
+                QZ_EMIT_DEBUG(QStringLiteral("Current elapsed from treadmill: ") + QString::number(seconds_elapsed));
+                QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+                QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(heart));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(distance));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(DistanceCalculated));
+                QZ_EMIT_DEBUG(QStringLiteral("Current KCal from the Machine: ") + QString::number(kcal));
+                QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current step countl: ") + QString::number(step_count));
 
                 if (m_control->error() != QLowEnergyController::NoError) {
                     qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -521,7 +521,7 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 if (Inclination.value() != incline) {
                     emit inclinationChanged(0, incline);
                 }
-                emit debug(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
 
                 if (truetimer)
                     elapsed = seconds_elapsed;
@@ -602,14 +602,14 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 } else {
                     INDOORRUN_MODE = 0;
                 }
-                emit debug(QStringLiteral("USER_ID = %1").arg(USER_ID));
-                emit debug(QStringLiteral("SPORT_ID = %1").arg(SPORT_ID));
-                emit debug(QStringLiteral("RUN_WAY = %1").arg(RUN_WAY));
-                emit debug(QStringLiteral("INDOORRUN_MODE = %1").arg(INDOORRUN_MODE));
-                emit debug(QStringLiteral("INDOORRUN_TIME_DATA = %1").arg(INDOORRUN_TIME_DATA));
-                emit debug(QStringLiteral("INDOORRUN_PARAM_NUM = %1").arg(INDOORRUN_PARAM_NUM));
-                emit debug(QStringLiteral("INDOORRUN_CALORIE_DATA = %1").arg(INDOORRUN_CALORIE_DATA));
-                emit debug(QStringLiteral("INDOORRUN_DISTANCE_DATA = %1").arg(INDOORRUN_DISTANCE_DATA));
+                QZ_EMIT_DEBUG(QStringLiteral("USER_ID = %1").arg(USER_ID));
+                QZ_EMIT_DEBUG(QStringLiteral("SPORT_ID = %1").arg(SPORT_ID));
+                QZ_EMIT_DEBUG(QStringLiteral("RUN_WAY = %1").arg(RUN_WAY));
+                QZ_EMIT_DEBUG(QStringLiteral("INDOORRUN_MODE = %1").arg(INDOORRUN_MODE));
+                QZ_EMIT_DEBUG(QStringLiteral("INDOORRUN_TIME_DATA = %1").arg(INDOORRUN_TIME_DATA));
+                QZ_EMIT_DEBUG(QStringLiteral("INDOORRUN_PARAM_NUM = %1").arg(INDOORRUN_PARAM_NUM));
+                QZ_EMIT_DEBUG(QStringLiteral("INDOORRUN_CALORIE_DATA = %1").arg(INDOORRUN_CALORIE_DATA));
+                QZ_EMIT_DEBUG(QStringLiteral("INDOORRUN_DISTANCE_DATA = %1").arg(INDOORRUN_DISTANCE_DATA));
             }
         } else if (par == FITSHOW_DATA_SPORT) {
             if (len > 9) {
@@ -620,10 +620,10 @@ void fitshowtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
 
                 StepCount = step_count;
 
-                emit debug(QStringLiteral("Current elapsed from treadmill: ") + QString::number(seconds_elapsed));
-                emit debug(QStringLiteral("Current step countl: ") + QString::number(step_count));
-                emit debug(QStringLiteral("Current KCal from the machine: ") + QString::number(kcal));
-                emit debug(QStringLiteral("Current Distance from the machine: ") + QString::number(distance));
+                QZ_EMIT_DEBUG(QStringLiteral("Current elapsed from treadmill: ") + QString::number(seconds_elapsed));
+                QZ_EMIT_DEBUG(QStringLiteral("Current step countl: ") + QString::number(step_count));
+                QZ_EMIT_DEBUG(QStringLiteral("Current KCal from the machine: ") + QString::number(kcal));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Distance from the machine: ") + QString::number(distance));
                 // KCal = kcal;
                 if (truetimer)
                     elapsed = seconds_elapsed;
@@ -696,7 +696,7 @@ void fitshowtreadmill::btinit(bool startTape) {
 
 void fitshowtreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if(gattCommunicationRSCService != nullptr && (gattCommunicationRSCService->state() != QLowEnergyService::ServiceDiscovered ||
         gattCommunicationChannelService->state() != QLowEnergyService::ServiceDiscovered)) {
@@ -780,7 +780,7 @@ void fitshowtreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void fitshowtreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -789,11 +789,11 @@ void fitshowtreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void fitshowtreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void fitshowtreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     gattCommunicationChannelService = m_control->createServiceObject(serviceId);
     if (!gattCommunicationChannelService) {
@@ -825,19 +825,19 @@ void fitshowtreadmill::serviceScanDone(void) {
 
 void fitshowtreadmill::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("fitshowtreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("fitshowtreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void fitshowtreadmill::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("fitshowtreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("fitshowtreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void fitshowtreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     if (device.name().toUpper().startsWith(QStringLiteral("FS-"))) {
         qDebug() << "FS FIX!";
         fs_connected = true;
@@ -862,18 +862,18 @@ void fitshowtreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
@@ -107,7 +107,7 @@ class fitshowtreadmill : public treadmill {
     uint8_t firstInit = 0;
     double DistanceCalculated = 0;
     QByteArray lastPacket;
-    QDateTime lastTimeCharacteristicChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
     int MAX_INCLINE = 30;
     int COUNTDOWN_VALUE = 0;
@@ -1,5 +1,6 @@
 #include "ftmsbike.h"
 #include "homeform.h"
+#include "qztrace.h"
 #include "virtualdevices/virtualbike.h"
 #include <QBluetoothLocalDevice>
 #include <QDateTime>
@@ -59,6 +60,7 @@ void ftmsbike::writeCharacteristicZwiftPlay(uint8_t *data, uint8_t data_len, con
         delete writeBuffer;
     }
     writeBuffer = new QByteArray((const char *)data, data_len);
+    QZ_TRACE_PACKET(qztrace::BLE_TX, "ftmsbike write", *writeBuffer);
 
     if (zwiftPlayWriteChar.properties() & QLowEnergyCharacteristic::WriteNoResponse) {
         zwiftPlayService->writeCharacteristic(zwiftPlayWriteChar, *writeBuffer,
@@ -68,7 +70,7 @@ void ftmsbike::writeCharacteristicZwiftPlay(uint8_t *data, uint8_t data_len, con
     }
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -96,6 +98,7 @@ void ftmsbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStrin
         delete writeBuffer;
     }
     writeBuffer = new QByteArray((const char *)data, data_len);
+    QZ_TRACE_PACKET(qztrace::BLE_TX, "ftmsbike write", *writeBuffer);
 
     if (gattWriteCharControlPointId.properties() & QLowEnergyCharacteristic::WriteNoResponse) {
         gattFTMSService->writeCharacteristic(gattWriteCharControlPointId, *writeBuffer,
@@ -105,7 +108,7 @@ void ftmsbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QStrin
     }
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -271,7 +274,7 @@ void ftmsbike::update() {
             }
 
             if (requestResistance != currentResistance().value() || lastGearValue != gears()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                 // if the FTMS is connected, the ftmsCharacteristicChanged event will do all the stuff because it's a
                 // FTMS bike. This condition handles the peloton requests                
                 if (((virtualBike && !virtualBike->ftmsDeviceConnected()) || !virtualBike) &&
@@ -283,7 +286,7 @@ void ftmsbike::update() {
             requestResistance = -1;
         }
         if((virtualBike && virtualBike->ftmsDeviceConnected()) && lastGearValue != gears() && lastRawRequestedInclinationValue != -100 && lastPacketFromFTMS.length() >= 7) {
-            qDebug() << "injecting fake ftms frame in order to send the new gear value ASAP" << lastPacketFromFTMS.toHex(' ');
+            QZ_DEBUG << "injecting fake ftms frame in order to send the new gear value ASAP" << lastPacketFromFTMS.toHex(' ');
             ftmsCharacteristicChanged(QLowEnergyCharacteristic(), lastPacketFromFTMS);
         }
 
@@ -398,7 +401,7 @@ void ftmsbike::update() {
             requestPower = -1;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -406,7 +409,7 @@ void ftmsbike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
 
@@ -421,11 +424,12 @@ void ftmsbike::update() {
 }
 
 void ftmsbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -435,7 +439,8 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
         settings.value(QZSettings::heart_ignore_builtin, QZSettings::default_heart_ignore_builtin).toBool();
     bool heart = false;
 
-    qDebug() << characteristic.uuid() << newValue.length() << QStringLiteral(" << ") << newValue.toHex(' ');
+    QZ_DEBUG << characteristic.uuid() << newValue.length() << QStringLiteral(" << ") << newValue.toHex(' ');
+    QZ_TRACE_PACKET(qztrace::BLE_RX, "ftmsbike notify", newValue);
 
     lastPacket = newValue;
 
@@ -443,7 +448,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
         resistance_received = true;
         Resistance = (double)(newValue.at(5));
         emit resistanceRead(Resistance.value());
-        emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         return;
     }
 
@@ -494,10 +499,10 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             } else {
                 Speed = metric::calculateSpeedFromPower(
                     watts(), Inclination.value(), Speed.value(),
-                    fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                    qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
             }
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed) {
@@ -506,7 +511,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.instantCadence) {
@@ -518,7 +523,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                           2.0;
             }
             index += 2;
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         }
 
         if (Flags.avgCadence) {
@@ -527,7 +532,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                                    (uint16_t)((uint8_t)newValue.at(index)))) /
                          2.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
         }
 
         if (Flags.totDistance) {
@@ -543,16 +548,16 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
         }
 
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged2AD2.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChanged2AD2Ns, nowNs)));
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.resistanceLvl) {
             Resistance = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             emit resistanceRead(Resistance.value());
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
             resistance_received = true;
         }
             double ac = 0.01243107769;
@@ -575,7 +580,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                 if (!resistance_received && !DU30_bike) {
                     Resistance = m_pelotonResistance;
                     emit resistanceRead(Resistance.value());
-                    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
                 }
             }
    
@@ -590,11 +595,11 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                 m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
         } else if(DOMYOS) {
             // doesn't send power at all and the resistance either
             m_watt = wattFromHR(true);
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
         }
 
         if (Flags.avgPower && newValue.length() > index + 1) {
@@ -602,7 +607,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             avgPower = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                  (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
         }
 
         if (Flags.expEnergy && newValue.length() > index + 1) {
@@ -622,11 +627,10 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged2AD2.msecsTo(
-                          now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsBetween(lastRefreshCharacteristicChanged2AD2Ns, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -637,7 +641,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
                 Heart = ((double)(((uint8_t)newValue.at(index))));
                 // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
             } else {
                 Flags.heartRate = false;
             }
@@ -656,7 +660,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             // todo
         }
 
-        lastRefreshCharacteristicChanged2AD2 = now;
+        lastRefreshCharacteristicChanged2AD2Ns = nowNs;
     } else if (characteristic.uuid() == QBluetoothUuid((quint16)0x2ACE)) {
         union flags {
             struct {
@@ -695,9 +699,9 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             } else {
                 Speed = metric::calculateSpeedFromPower(
                     watts(), Inclination.value(), Speed.value(),
-                    fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                    qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
             }
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
             index += 2;
         }
 
@@ -707,7 +711,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totDistance) {
@@ -718,10 +722,10 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             index += 3;
         } else {
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged2ACE.msecsTo(now)));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChanged2ACENs, nowNs)));
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.stepCount) {
             if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
@@ -730,7 +734,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                 Cadence = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                     (uint16_t)((uint8_t)newValue.at(index))));
             }
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
             index += 2;
             index += 2;
@@ -755,7 +759,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                                    (uint16_t)((uint8_t)newValue.at(index))));
             emit resistanceRead(Resistance.value());
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         } else if(!DU30_bike) {
             double ac = 0.01243107769;
             double bc = 1.145964912;
@@ -785,7 +789,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                     .startsWith(QStringLiteral("Disabled")))
                 m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
             index += 2;
         }
 
@@ -793,7 +797,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             double avgPower;
             avgPower = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                  (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
             index += 2;
         }
 
@@ -813,12 +817,11 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
                            settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                           200.0) /
                          (60000.0 /
-                          ((double)lastRefreshCharacteristicChanged2ACE.msecsTo(
-                              now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                          ((double)qzclock::msecsBetween(lastRefreshCharacteristicChanged2ACENs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                 // kg * 3.5) / 200 ) / 60
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -829,7 +832,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
                 Heart = ((double)(((uint8_t)newValue.at(index))));
                 // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
             } else {
                 Flags.heartRate = false;
             }
@@ -848,7 +851,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
             // todo
         }
 
-        lastRefreshCharacteristicChanged2ACE = now;
+        lastRefreshCharacteristicChanged2ACENs = nowNs;
     } else {
         return;
     }
@@ -875,8 +878,8 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
 #endif
 #endif
 
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -886,7 +889,7 @@ void ftmsbike::characteristicChanged(const QLowEnergyCharacteristic &characteris
 void ftmsbike::stateChanged(QLowEnergyService::ServiceState state) {
     QSettings settings;
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -1022,7 +1025,7 @@ void ftmsbike::stateChanged(QLowEnergyService::ServiceState state) {
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike =
                 new virtualbike(this, noWriteResistance, noHeartService, bikeResistanceOffset, bikeResistanceGain);
             // connect(virtualBike,&virtualbike::debug ,this,&ftmsbike::debug);
@@ -1038,7 +1041,7 @@ void ftmsbike::stateChanged(QLowEnergyService::ServiceState state) {
 void ftmsbike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
 
     if (!autoResistance()) {
-        qDebug() << "ignoring routing FTMS packet to the bike from virtualbike because of auto resistance OFF"
+        QZ_DEBUG << "ignoring routing FTMS packet to the bike from virtualbike because of auto resistance OFF"
                  << characteristic.uuid() << newValue.toHex(' ');
         return;
     }
@@ -1048,14 +1051,14 @@ void ftmsbike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &charact
     bool gears_zwift_ratio = settings.value(QZSettings::gears_zwift_ratio, QZSettings::default_gears_zwift_ratio).toBool();
 
     if (gattWriteCharControlPointId.isValid()) {
-        qDebug() << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
+        QZ_DEBUG << "routing FTMS packet to the bike from virtualbike" << characteristic.uuid() << newValue.toHex(' ');
 
         // handling gears
         if (b.at(0) == FTMS_SET_INDOOR_BIKE_SIMULATION_PARAMS && ((zwiftPlayService == nullptr && gears_zwift_ratio) || !gears_zwift_ratio)) {
             lastPacketFromFTMS.clear();
             for(int i=0; i<b.length(); i++)
                 lastPacketFromFTMS.append(b.at(i));
-            qDebug() << "lastPacketFromFTMS" << lastPacketFromFTMS.toHex(' ');
+            QZ_DEBUG << "lastPacketFromFTMS" << lastPacketFromFTMS.toHex(' ');
             int16_t slope = (((uint8_t)b.at(3)) + (b.at(4) << 8));
             if (gears() != 0) {
                 slope += (gears() * 50);
@@ -1077,7 +1080,7 @@ void ftmsbike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &charact
             lastPacketFromFTMS.clear();
             for(int i=0; i<b.length(); i++)
                 lastPacketFromFTMS.append(b.at(i));
-            qDebug() << "lastPacketFromFTMS" << lastPacketFromFTMS.toHex(' ');
+            QZ_DEBUG << "lastPacketFromFTMS" << lastPacketFromFTMS.toHex(' ');
             int16_t power = (((uint8_t)b.at(1)) + (b.at(2) << 8));
             if (gears() != 0) {
                 power += (gears() * 10);
@@ -1092,27 +1095,27 @@ void ftmsbike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &charact
 }
 
 void ftmsbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void ftmsbike::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void ftmsbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void ftmsbike::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void ftmsbike::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
 #ifdef Q_OS_ANDROID
     QLowEnergyConnectionParameters c;
@@ -1138,14 +1141,14 @@ void ftmsbike::serviceScanDone(void) {
 
 void ftmsbike::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("ftmsbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("ftmsbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void ftmsbike::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("ftmsbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("ftmsbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 resistance_t ftmsbike::pelotonToBikeResistance(int pelotonResistance) {
@@ -1153,8 +1156,8 @@ resistance_t ftmsbike::pelotonToBikeResistance(int pelotonResistance) {
 }
 
 void ftmsbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
         if (bluetoothDevice.name().toUpper().startsWith("SUITO")) {
@@ -1191,17 +1194,17 @@ void ftmsbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -99,8 +99,8 @@ class ftmsbike : public bike {
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
     QByteArray lastPacketFromFTMS;
-    QDateTime lastRefreshCharacteristicChanged2AD2 = QDateTime::currentDateTime();
-    QDateTime lastRefreshCharacteristicChanged2ACE = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChanged2AD2Ns = qzclock::nowNs();
+    qint64 lastRefreshCharacteristicChanged2ACENs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
     int8_t bikeResistanceOffset = 4;
     double bikeResistanceGain = 1.0;
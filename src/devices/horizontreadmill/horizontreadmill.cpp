@@ -64,7 +64,7 @@ void horizontreadmill::writeCharacteristic(QLowEnergyService *service, QLowEnerg
     service->writeCharacteristic(characteristic, *writeBuffer);
 
     if (!disable_log)
-        qDebug() << " >> " << writeBuffer->toHex(' ') << " // " << info;
+        QZ_DEBUG << " >> " << writeBuffer->toHex(' ') << " // " << info;
 
     loop.exec();
 }
@@ -834,19 +834,18 @@ void horizontreadmill::update() {
         update_metrics(!powerReceivedFromPowerSensor, watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat()));
 
         if (firstDistanceCalculated) {
-            QDateTime now = QDateTime::currentDateTime();
+            qint64 nowNs = qzclock::nowNs();
             KCal +=
                 ((((0.048 * ((double)watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat())) +
             1.19) *
             settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
             200.0) /
-            (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                        now)))); //(( (0.048* Output in watts +1.19) * body weight in
+            (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60    
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
-            lastRefreshCharacteristicChanged = now;
+            lastRefreshCharacteristicChangedNs = nowNs;
         }
 
         // updating the treadmill console every second
@@ -869,7 +868,7 @@ void horizontreadmill::update() {
                      << float_one_point_round(currentSpeed().value());
             if (requestSpeed != currentSpeed().value() && minSpeed && requestSpeed >= 0 && requestSpeed <= 22 &&
                 forceSpeedNeed) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 forceSpeed(requestSpeed);
             }
             requestSpeed = -1;
@@ -898,13 +897,13 @@ void horizontreadmill::update() {
             if (requestInclination != currentInclination().value() && requestInclination >= minInclination &&
                 requestInclination <= 15) {
                
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 forceIncline(requestInclination);
             }
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
 
                 lastSpeed = 0.5;
@@ -979,7 +978,7 @@ void horizontreadmill::update() {
             lastStart = QDateTime::currentMSecsSinceEpoch();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
 
             if (gattCustomService) {
                 if (!horizon_paragon_x) {
@@ -1054,12 +1053,12 @@ void horizontreadmill::update() {
             requestStop = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
@@ -1365,11 +1364,12 @@ void horizontreadmill::forceIncline(double requestIncline) {
 }
 
 void horizontreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     double heart = 0; // NOTE : Should be initialized with a value to shut clang-analyzer's
                       // UndefinedBinaryOperatorResult
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
@@ -1383,11 +1383,11 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     double weight = settings.value(QZSettings::weight, QZSettings::default_weight).toFloat();
 
-    emit debug(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
-               " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
+                  " " + newValue.toHex(' '));
 
     if (characteristic.uuid() == QBluetoothUuid((quint16)0xFFF4)) {
         if (newValue.at(0) == 0x55 && newValue.length() > 7) {
@@ -1399,7 +1399,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         lastPacketComplete.append(newValue);
         customRecv -= newValue.length();
         if (customRecv <= 0) {
-            emit debug(QStringLiteral(" << FULL ") + " " + lastPacketComplete.toHex(' '));
+            QZ_EMIT_DEBUG(QStringLiteral(" << FULL ") + " " + lastPacketComplete.toHex(' '));
             qDebug() << "full custom packet received";
             initPacketRecv = true;
             customRecv = 0;
@@ -1421,10 +1421,10 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                            (uint16_t)((uint8_t)lastPacketComplete.at(24)))) /
                  100.0) *
                 1.60934); // miles/h
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
         Inclination = treadmillInclinationOverride((double)((uint8_t)lastPacketComplete.at(30)) / 10.0);
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
 
         if (firstDistanceCalculated && watts(weight))
             KCal +=
@@ -1432,25 +1432,24 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    weight * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
         if (firstDistanceCalculated)
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
         distanceEval = true;
     } else if (characteristic.uuid() == QBluetoothUuid((quint16)0xFFF4) && newValue.length() > 70 &&
                newValue.at(0) == 0x55 && newValue.at(5) == 0x12) {
         parseSpeed((((double)(((uint16_t)((uint8_t)newValue.at(62)) << 8) | (uint16_t)((uint8_t)newValue.at(61)))) / 1000.0) *
                        1.60934); // miles/h
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
         Inclination = treadmillInclinationOverride((double)((uint8_t)newValue.at(63)) / 10.0);
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
 
         if (firstDistanceCalculated && watts(weight))
             KCal +=
@@ -1458,21 +1457,20 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    weight * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
         if (firstDistanceCalculated)
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
         distanceEval = true;
     } else if (characteristic.uuid() == QBluetoothUuid((quint16)0xFFF4) && newValue.length() == 29 &&
                newValue.at(0) == 0x55) {
         parseSpeed(((double)(((uint16_t)((uint8_t)newValue.at(15)) << 8) | (uint16_t)((uint8_t)newValue.at(14)))) / 10.0);
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
         // Inclination = (double)((uint8_t)newValue.at(3)) / 10.0;
         // emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
@@ -1482,16 +1480,15 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    weight * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
         // kg * 3.5) / 200 ) / 60
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
         if (firstDistanceCalculated)
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
         distanceEval = true;
     } else if (characteristic.uuid() == QBluetoothUuid((quint16)0xFFF4) && newValue.length() > 10 &&
                (uint8_t)newValue.at(0) == 0x55 && (uint8_t)newValue.at(1) == 0xAA && (uint8_t)newValue.at(2) == 0x00 &&
@@ -1534,7 +1531,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                   (uint16_t)((uint8_t)newValue.at(index)))) /
                         100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed) {
@@ -1543,7 +1540,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.instantCadence) {
@@ -1555,7 +1552,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                           2.0;
             }
             index += 2;
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         }
 
         if (Flags.avgCadence) {
@@ -1564,7 +1561,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                    (uint16_t)((uint8_t)newValue.at(index)))) /
                          2.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Cadence: ") + QString::number(avgCadence));
         }
 
         if (Flags.totDistance) {
@@ -1580,15 +1577,15 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         }
 
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.resistanceLvl) {
             Resistance = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         }
 
         if (Flags.instantPower) {
@@ -1598,7 +1595,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
         }
 
         if (Flags.avgPower && newValue.length() > index + 1) {
@@ -1606,7 +1603,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             avgPower = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                  (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
         }
 
         if (Flags.expEnergy && newValue.length() > index + 1) {
@@ -1625,12 +1622,11 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                            weight * 3.5) /
                           200.0) /
                          (60000.0 /
-                          ((double)lastRefreshCharacteristicChanged.msecsTo(
-                              now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                          ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                        // kg * 3.5) / 200 ) / 60
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -1641,7 +1637,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
                 Heart = ((double)(((uint8_t)newValue.at(index))));
                 // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
             } else {
                 Flags.heartRate = false;
             }
@@ -1697,7 +1693,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                     100.0);
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed) {
@@ -1706,7 +1702,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totalDistance) {
@@ -1719,11 +1715,11 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         {
             if (firstDistanceCalculated)
                 Distance += ((Speed.value() / 3600000.0) *
-                             ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                             ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.inclination) {
             if(!tunturi_t60_treadmill && !ICONCEPT_FTMS_treadmill)
@@ -1772,7 +1768,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 }
             }
             index += 4; // the ramo value is useless
-            emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
         }
 
         if (Flags.elevation) {
@@ -1807,13 +1803,12 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -1825,9 +1820,9 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 if (index < newValue.length()) {
 
                     heart = ((double)(((uint8_t)newValue.at(index))));
-                    emit debug(QStringLiteral("Current Heart: ") + QString::number(heart));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(heart));
                 } else {
-                    emit debug(QStringLiteral("Error on parsing heart!"));
+                    QZ_EMIT_DEBUG(QStringLiteral("Error on parsing heart!"));
                 }
                 // index += 1; //NOTE: clang-analyzer-deadcode.DeadStores
             }
@@ -1882,7 +1877,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             parseSpeed(((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0);
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
             index += 2;
         }
 
@@ -1892,7 +1887,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totDistance && newValue.length() > index + 2) {
@@ -1904,11 +1899,11 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         } else {
             if (firstDistanceCalculated)
                 Distance += ((Speed.value() / 3600000.0) *
-                             ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                             ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.stepCount && newValue.length() > index + 1) {
             if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
@@ -1917,7 +1912,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 Cadence = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                     (uint16_t)((uint8_t)newValue.at(index))));
             }
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
             index += 2;
             index += 2;
@@ -1941,14 +1936,14 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             Resistance = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         }
 
         if (Flags.instantPower && newValue.length() > index + 1) {
             if (!powerReceivedFromPowerSensor)
                 m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
             index += 2;
         }
 
@@ -1956,7 +1951,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             double avgPower;
             avgPower = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                  (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
             index += 2;
         }
 
@@ -1980,13 +1975,12 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -1997,7 +1991,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
                 Heart = ((double)(((uint8_t)newValue.at(index))));
                 // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
             } else {
                 Flags.heartRate = false;
             }
@@ -2050,7 +2044,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
 
         Cadence = cadence;
         emit cadenceChanged(cadence);
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(cadence));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(cadence));
     }
 
     if (heartRateBeltName.startsWith(QStringLiteral("Disabled"))) {
@@ -2072,7 +2066,7 @@ void horizontreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
 
     if (distanceEval) {
         firstDistanceCalculated = true;
-        lastRefreshCharacteristicChanged = now;
+        lastRefreshCharacteristicChangedNs = nowNs;
     }
 
     if (m_control->error() != QLowEnergyController::NoError) {
@@ -2089,7 +2083,7 @@ void horizontreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QBluetoothUuid _gattCrossTrainerDataId((quint16)0x2ACE);
     QBluetoothUuid _gattInclinationSupported((quint16)0x2AD5);
     QBluetoothUuid _DomyosServiceId(QStringLiteral("49535343-fe7d-4ae5-8fa9-9fafd205e455"));
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -2236,7 +2230,7 @@ void horizontreadmill::changeInclinationRequested(double grade, double percentag
 }
 
 void horizontreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     if (notificationSubscribed)
         notificationSubscribed--;
@@ -2248,17 +2242,17 @@ void horizontreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 }
 
 void horizontreadmill::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void horizontreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void horizontreadmill::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
     QBluetoothUuid _gattInclinationSupported((quint16)0x2AD5);
     if(characteristic.uuid() == _gattInclinationSupported && newValue.length() > 2) {
         minInclination = ((double)(
@@ -2273,7 +2267,7 @@ void horizontreadmill::characteristicRead(const QLowEnergyCharacteristic &charac
 }
 
 void horizontreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     initRequest = false;
     firstStateChanged = 0;
@@ -2291,15 +2285,15 @@ void horizontreadmill::serviceScanDone(void) {
 void horizontreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("horizontreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("horizontreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void horizontreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("horizontreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("horizontreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void horizontreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -2309,8 +2303,8 @@ void horizontreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
     // devices
     // ***************************************************************************************************************
 
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -2383,17 +2377,17 @@ void horizontreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -20,8 +20,8 @@ iconceptbike::iconceptbike() {
 }
 
 void iconceptbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     //if (device.name().toUpper().startsWith(QStringLiteral("BH DUALKIT")))
     {
         if (device.name().toUpper().startsWith(QStringLiteral("BH-"))) {
@@ -51,9 +51,9 @@ void iconceptbike::serviceFinished() {
         socket->setPreferredSecurityFlags(QBluetooth::NoSecurity);
 #endif
 
-        emit debug(QStringLiteral("Create socket"));
+        QZ_EMIT_DEBUG(QStringLiteral("Create socket"));
         socket->connectToService(serialPortService);
-        emit debug(QStringLiteral("ConnectToService done"));
+        QZ_EMIT_DEBUG(QStringLiteral("ConnectToService done"));
     }
 }
 
@@ -67,14 +67,14 @@ void iconceptbike::serviceDiscovered(const QBluetoothServiceInfo &service) {
 
     qDebug() << QStringLiteral("iconceptbike::serviceDiscovered") << service;
     if (service.device().address() == bluetoothDevice.address()) {
-        emit debug(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
-                   service.serviceUuid().toString() + ')');
+        QZ_EMIT_DEBUG(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
+                      service.serviceUuid().toString() + ')');
 
         if ((service.serviceName().startsWith(QStringLiteral("SerialPort")) ||
              service.serviceName().startsWith(QStringLiteral("Serial Port"))) &&
             // android 13 workaround
             service.serviceUuid() == QBluetoothUuid(QStringLiteral("00001101-0000-1000-8000-00805f9b34fb"))) {
-            emit debug(QStringLiteral("Serial port service found"));
+            QZ_EMIT_DEBUG(QStringLiteral("Serial port service found"));
             // discoveryAgent->stop(); // could lead to a crash?
 
             serialPortService = service;
@@ -101,7 +101,7 @@ void iconceptbike::update() {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual bike interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
                 auto virtualBike = new virtualbike(this, true);
                 connect(virtualBike, &virtualbike::changeInclination, this, &iconceptbike::changeInclination);
                 this->setVirtualDevice(virtualBike, VIRTUAL_DEVICE_MODE::PRIMARY);
@@ -120,15 +120,15 @@ void iconceptbike::update() {
             char resValues[] = {0x08, 0x0a, 0x0b, 0x0d, 0x0e, 0x10, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18};
             char res[] = {0x55, 0x11, 0x01, 0x12};
             res[3] = resValues[requestResistance - 1];
-            qDebug() << QStringLiteral(">>") << QByteArray(res, sizeof(res)).toHex(' ');
+            QZ_DEBUG << QStringLiteral(">>") << QByteArray(res, sizeof(res)).toHex(' ');
             socket->write(res, sizeof(res));
             Resistance = requestResistance;
             requestResistance = -1;
         } else {
             const char poll[] = {0x55, 0x17, 0x01, 0x01};
-            qDebug() << QStringLiteral(">>") << QByteArray(poll, sizeof(poll)).toHex(' ');
+            QZ_DEBUG << QStringLiteral(">>") << QByteArray(poll, sizeof(poll)).toHex(' ');
             socket->write(poll, sizeof(poll));
-            emit debug(QStringLiteral("write poll"));
+            QZ_EMIT_DEBUG(QStringLiteral("write poll"));
         }
 
         update_metrics(false, watts());
@@ -136,7 +136,7 @@ void iconceptbike::update() {
 }
 
 void iconceptbike::rfCommConnected() {
-    emit debug(QStringLiteral("connected ") + socket->peerName());
+    QZ_EMIT_DEBUG(QStringLiteral("connected ") + socket->peerName());
 
     if(i_Nexor) {
         const uint8_t init01[] = {0x55, 0x0c, 0x01, 0xff, 0x55, 0xbb, 0x01, 0xff, 0x55, 0x24, 0x01, 0xff, 0x55, 0x25, 0x01,
@@ -253,7 +253,7 @@ void iconceptbike::readSocket() {
 
     while (socket->bytesAvailable()) {
         QByteArray line = socket->readAll();
-        qDebug() << QStringLiteral(" << ") + line.toHex(' ');
+        QZ_DEBUG << QStringLiteral(" << ") + line.toHex(' ');
 
         if (line.length() == 16) {
             QSettings settings;
@@ -263,8 +263,9 @@ void iconceptbike::readSocket() {
                 settings.value(QZSettings::bh_spada_2_watt, QZSettings::default_bh_spada_2_watt).toBool();
             elapsed = GetElapsedTimeFromPacket(line);
             //Distance = GetDistanceFromPacket(line);
-            QDateTime now = QDateTime::currentDateTime();
-            Distance += ((Speed.value() / 3600000.0) * ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+            qint64 nowNs = qzclock::nowNs();
+            Distance += ((Speed.value() / 3600000.0) *
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
             KCal = GetCaloriesFromPacket(line);
             if (bh_spada_2_watt) {
                 m_watt = GetWattFromPacket(line);
@@ -273,7 +274,7 @@ void iconceptbike::readSocket() {
                 } else {
                     Speed = metric::calculateSpeedFromPower(
                         watts(), Inclination.value(), Speed.value(),
-                        fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                        qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
                 }
                 if (watts())
                     KCal +=
@@ -281,8 +282,7 @@ void iconceptbike::readSocket() {
                            settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                           200.0) /
                          (60000.0 /
-                          ((double)lastRefreshCharacteristicChanged.msecsTo(
-                              now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+                          ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                                 //* 3.5) / 200 ) / 60
             } else {
                 Speed = GetSpeedFromPacket(line);
@@ -295,7 +295,7 @@ void iconceptbike::readSocket() {
                 LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
             }
 
-            lastRefreshCharacteristicChanged = now;
+            lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_ANDROID
             if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool()) {
@@ -326,11 +326,11 @@ void iconceptbike::readSocket() {
             Resistance = Resistance.value();
             m_pelotonResistance = m_pelotonResistance.value();
 
-            emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
-            emit debug(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
             // emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-            emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
             qDebug() << QStringLiteral("Current Watt: ") + QString::number(watts());
         }
     }
@@ -362,7 +362,7 @@ uint16_t iconceptbike::GetElapsedTimeFromPacket(const QByteArray &packet) {
 }
 
 void iconceptbike::onSocketErrorOccurred(QBluetoothSocket::SocketError error) {
-    emit debug(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
+    QZ_EMIT_DEBUG(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
 }
 
 uint16_t iconceptbike::watts() {
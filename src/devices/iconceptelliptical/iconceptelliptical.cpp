@@ -24,8 +24,8 @@ iconceptelliptical::iconceptelliptical(bool noWriteResistance, bool noHeartServi
 }
 
 void iconceptelliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -49,9 +49,9 @@ void iconceptelliptical::serviceFinished() {
         socket->setPreferredSecurityFlags(QBluetooth::NoSecurity);
 #endif
 
-        emit debug(QStringLiteral("Create socket"));
+        QZ_EMIT_DEBUG(QStringLiteral("Create socket"));
         socket->connectToService(serialPortService);
-        emit debug(QStringLiteral("ConnectToService done"));
+        QZ_EMIT_DEBUG(QStringLiteral("ConnectToService done"));
     }
 }
 
@@ -65,14 +65,14 @@ void iconceptelliptical::serviceDiscovered(const QBluetoothServiceInfo &service)
 
     qDebug() << QStringLiteral("iconceptelliptical::serviceDiscovered") << service;
     /*if (service.device().address() == bluetoothDevice.address())*/ {
-        emit debug(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
-                   service.serviceUuid().toString() + ')');
+        QZ_EMIT_DEBUG(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
+                      service.serviceUuid().toString() + ')');
 
         if (service.serviceName().startsWith(QStringLiteral("SerialPort")) ||
             service.serviceName().startsWith(QStringLiteral("Serial Port")) ||
             service.serviceUuid() == QBluetoothUuid(QStringLiteral("00001101-0000-1000-8000-00805f9b34fb"))) {
 
-            emit debug(QStringLiteral("Serial port service found"));
+            QZ_EMIT_DEBUG(QStringLiteral("Serial port service found"));
             // discoveryAgent->stop(); // could lead to a crash?
 
             serialPortService = service;
@@ -130,15 +130,15 @@ void iconceptelliptical::update() {
             char resValues[] = {0x08, 0x0a, 0x0b, 0x0d, 0x0e, 0x10, 0x11, 0x13, 0x14, 0x16, 0x17, 0x18};
             char res[] = {0x55, 0x11, 0x01, 0x12};
             res[3] = resValues[requestResistance - 1];
-            qDebug() << QStringLiteral(">>") << QByteArray(res, sizeof(res)).toHex(' ');
+            QZ_DEBUG << QStringLiteral(">>") << QByteArray(res, sizeof(res)).toHex(' ');
             socket->write(res, sizeof(res));
             Resistance = requestResistance;
             requestResistance = -1;
         } else {
             const char poll[] = {0x55, 0x17, 0x01, 0x01};
-            qDebug() << QStringLiteral(">>") << QByteArray(poll, sizeof(poll)).toHex(' ');
+            QZ_DEBUG << QStringLiteral(">>") << QByteArray(poll, sizeof(poll)).toHex(' ');
             socket->write(poll, sizeof(poll));
-            emit debug(QStringLiteral("write poll"));
+            QZ_EMIT_DEBUG(QStringLiteral("write poll"));
         }
 
         update_metrics(false, watts());
@@ -146,7 +146,7 @@ void iconceptelliptical::update() {
 }
 
 void iconceptelliptical::rfCommConnected() {
-    emit debug(QStringLiteral("connected ") + socket->peerName());
+    QZ_EMIT_DEBUG(QStringLiteral("connected ") + socket->peerName());
 
     const uint8_t init1[] = {
         0x55, 0x0c, 0x01, 0xff, 0x55, 0xbb, 0x01, 0xff, 0x55, 0x24, 0x01, 0xff, 0x55, 0x25, 0x01, 0xff, 0x55, 0x26,
@@ -213,7 +213,7 @@ void iconceptelliptical::readSocket() {
 
     while (socket->bytesAvailable()) {
         QByteArray line = socket->readAll();
-        qDebug() << QStringLiteral(" << ") + line.toHex(' ');
+        QZ_DEBUG << QStringLiteral(" << ") + line.toHex(' ');
 
         if (line.length() == 16) {
             QSettings settings;
@@ -226,7 +226,7 @@ void iconceptelliptical::readSocket() {
             Cadence = (uint8_t)line.at(13);
             // Heart = GetHeartRateFromPacket(line);
 
-            lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+            lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
             if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool()) {
@@ -253,11 +253,11 @@ void iconceptelliptical::readSocket() {
 #endif
 #endif
 
-            emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
-            emit debug(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(Cadence.value()));
             // emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-            emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
             qDebug() << QStringLiteral("Current Watt: ") + QString::number(watts());
         }
     }
@@ -284,7 +284,7 @@ uint16_t iconceptelliptical::GetElapsedTimeFromPacket(const QByteArray &packet)
 }
 
 void iconceptelliptical::onSocketErrorOccurred(QBluetoothSocket::SocketError error) {
-    emit debug(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
+    QZ_EMIT_DEBUG(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
 }
 
 uint16_t iconceptelliptical::watts() {
@@ -50,7 +50,7 @@ void kingsmithr1protreadmill::writeCharacteristic(uint8_t *data, uint8_t data_le
 
     if (gattCommunicationChannelService->state() != QLowEnergyService::ServiceState::ServiceDiscovered ||
         m_control->state() == QLowEnergyController::UnconnectedState) {
-        emit debug(QStringLiteral("writeCharacteristic error because the connection is closed"));
+        QZ_EMIT_DEBUG(QStringLiteral("writeCharacteristic error because the connection is closed"));
 
         return;
     }
@@ -67,14 +67,14 @@ void kingsmithr1protreadmill::writeCharacteristic(uint8_t *data, uint8_t data_le
                                                              QLowEnergyService::WriteWithoutResponse);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info + " " + gattWriteCharacteristic.properties());
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info + " " + gattWriteCharacteristic.properties());
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -155,7 +155,7 @@ void kingsmithr1protreadmill::update() {
         // byte 17    = inclination
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
 
                 double inc = Inclination.value();
                 if (requestInclination != -100) {
@@ -176,7 +176,7 @@ void kingsmithr1protreadmill::update() {
             requestInclination = qRound(requestInclination * 2.0) / 2.0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
 
                 double speed = currentSpeed().value();
                 if (requestSpeed != -1) {
@@ -194,7 +194,7 @@ void kingsmithr1protreadmill::update() {
             requestUnlock = false;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
 
                 lastSpeed = 0.5;
@@ -206,7 +206,7 @@ void kingsmithr1protreadmill::update() {
             lastStart = QDateTime::currentMSecsSinceEpoch();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
 
             if (Speed.value() != 0)
                 writeCharacteristic(start_pause, sizeof(start_pause), QStringLiteral("pause"), false, true);
@@ -216,18 +216,18 @@ void kingsmithr1protreadmill::update() {
             requestStop = -1;
         }
         if (requestFanSpeed != -1) {
-            emit debug(QStringLiteral("changing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
 
             // sendChangeFanSpeed(requestFanSpeed);
             requestFanSpeed = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
@@ -236,11 +236,12 @@ void kingsmithr1protreadmill::update() {
 }
 
 void kingsmithr1protreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void kingsmithr1protreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                     const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -248,19 +249,19 @@ void kingsmithr1protreadmill::characteristicChanged(const QLowEnergyCharacterist
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
     emit packetReceived();
 
     lastPacket = value;
 
     if (newValue.length() != 20 || ignoreFirstPackage) {
         ignoreFirstPackage = false;
-        emit debug(QStringLiteral("packet ignored"));
+        QZ_EMIT_DEBUG(QStringLiteral("packet ignored"));
         return;
     }
 
     if (newValue.at(2) == 0x05) {
-        emit debug(QStringLiteral("lock byte found, asking to unlock the treadmill"));
+        QZ_EMIT_DEBUG(QStringLiteral("lock byte found, asking to unlock the treadmill"));
         requestUnlock = true;
     }
 
@@ -273,26 +274,26 @@ void kingsmithr1protreadmill::characteristicChanged(const QLowEnergyCharacterist
         double t = GetTargetSpeedFromPacket(value);
         if (t == lastTargetSpeed) {
             targetSpeed = speed;
-            emit debug(QStringLiteral("ignoring target speed"));
+            QZ_EMIT_DEBUG(QStringLiteral("ignoring target speed"));
         } else {
             // if the user changes the speed from the remote, the treadmill doesn't update the target speed
             // https://github.com/cagnulein/qdomyos-zwift/issues/470#issuecomment-965525224
             if (speed == t) {
                 targetSpeedMatchesSpeed = true;
                 lastTargetSpeedMatchesSpeed = speed;
-                emit debug(QStringLiteral("target speed matches the current speed"));
+                QZ_EMIT_DEBUG(QStringLiteral("target speed matches the current speed"));
             }
             if (targetSpeedMatchesSpeed && t != lastTargetSpeedMatchesSpeed) {
                 targetSpeedMatchesSpeed = false;
                 lastTargetSpeedMatchesSpeed = -1;
-                emit debug(QStringLiteral("target speed changes"));
+                QZ_EMIT_DEBUG(QStringLiteral("target speed changes"));
             }
 
             if (targetSpeedMatchesSpeed == false) {
                 targetSpeed = t;
-                emit debug(QStringLiteral("using target speed from TM"));
+                QZ_EMIT_DEBUG(QStringLiteral("using target speed from TM"));
             } else {
-                emit debug(QStringLiteral("using current speed as target speed"));
+                QZ_EMIT_DEBUG(QStringLiteral("using current speed as target speed"));
                 targetSpeed = speed;
             }
 
@@ -331,13 +332,12 @@ void kingsmithr1protreadmill::characteristicChanged(const QLowEnergyCharacterist
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
         // kg * 3.5) / 200 ) / 60
 
         Distance += ((speed / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-        lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+                     ((double)1000.0 / (double)(qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
+        lastTimeCharacteristicChangedNs = qzclock::nowNs();
     }
 
     bool disable_hr_frommachinery =
@@ -350,24 +350,25 @@ void kingsmithr1protreadmill::characteristicChanged(const QLowEnergyCharacterist
         double sc = GetStepsFromPacket(value);
         StepCount = sc;
         if(lastStepCount < StepCount.value()) {
-            double c = (StepCount.value() - lastStepCount) / (lastTimeStepCountChanged.msecsTo(QDateTime::currentDateTime()) / 60000.0);
+            double c =
+                (StepCount.value() - lastStepCount) / (qzclock::msecsSince(lastTimeStepCountChangedNs) / 60000.0);
             if(c < 255)
                 cadenceRaw = c;
             Cadence = cadenceRaw.average5s();
-            lastTimeStepCountChanged = QDateTime::currentDateTime();
+            lastTimeStepCountChangedNs = qzclock::nowNs();
         }
         lastStepCount = sc;
     }    
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current target speed: ") + QString::number(targetSpeed));
-    emit debug(QStringLiteral("Current StepCount: ") + QString::number(StepCount.value()));
-    emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current target speed: ") + QString::number(targetSpeed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current StepCount: ") + QString::number(StepCount.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
     // emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
     // emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -434,7 +435,7 @@ void kingsmithr1protreadmill::stateChanged(QLowEnergyService::ServiceState state
     QBluetoothUuid _gattWriteCharacteristicId((quint16)0xFE02);
     QBluetoothUuid _gattNotifyCharacteristicId((quint16)0xFE01);
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
 
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -464,7 +465,7 @@ void kingsmithr1protreadmill::stateChanged(QLowEnergyService::ServiceState state
 }
 
 void kingsmithr1protreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -473,12 +474,12 @@ void kingsmithr1protreadmill::descriptorWritten(const QLowEnergyDescriptor &desc
 void kingsmithr1protreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                     const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void kingsmithr1protreadmill::serviceScanDone(void) {
     QBluetoothUuid _gattCommunicationChannelServiceId((quint16)0xFE00);
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     ignoreFirstPackage = true;
 
@@ -491,15 +492,15 @@ void kingsmithr1protreadmill::serviceScanDone(void) {
 void kingsmithr1protreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("kingsmithr1protreadmill::errorService ") +
-               QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("kingsmithr1protreadmill::errorService ") +
+                  QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
 }
 
 void kingsmithr1protreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("kingsmithr1protreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("kingsmithr1protreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void kingsmithr1protreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -527,18 +528,18 @@ void kingsmithr1protreadmill::deviceDiscovered(const QBluetoothDeviceInfo &devic
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
@@ -69,8 +69,8 @@ class kingsmithr1protreadmill : public treadmill {
     uint8_t firstInit = 0;
     double lastStepCount = 0;
     QByteArray lastPacket;
-    QDateTime lastTimeCharacteristicChanged;
-    QDateTime lastTimeStepCountChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
+    qint64 lastTimeStepCountChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
     metric cadenceRaw;
 
@@ -49,7 +49,7 @@ void kingsmithr2treadmill::writeCharacteristic(const QString &data, const QStrin
 
     if (gattCommunicationChannelService->state() != QLowEnergyService::ServiceState::ServiceDiscovered ||
         m_control->state() == QLowEnergyController::UnconnectedState) {
-        emit debug(QStringLiteral("writeCharacteristic error because the connection is closed"));
+        QZ_EMIT_DEBUG(QStringLiteral("writeCharacteristic error because the connection is closed"));
 
         return;
     }
@@ -75,9 +75,9 @@ void kingsmithr2treadmill::writeCharacteristic(const QString &data, const QStrin
             encrypted.append(ENCRYPT_TABLE[idx]);
     }
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> plain: ") + data + QStringLiteral(" // ") + info);
-        emit debug(QStringLiteral(" >> base64: ") + QString(input) + QStringLiteral(" // ") + info);
-        emit debug(QStringLiteral(" >> encrypted: ") + QString(encrypted) + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> plain: ") + data + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> base64: ") + QString(input) + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> encrypted: ") + QString(encrypted) + QStringLiteral(" // ") + info);
     }
     encrypted.append('\x0d');
     for (int i = 0; i < encrypted.length(); i += 16) {
@@ -87,13 +87,13 @@ void kingsmithr2treadmill::writeCharacteristic(const QString &data, const QStrin
     }
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + encrypted.toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + encrypted.toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -170,7 +170,7 @@ void kingsmithr2treadmill::update() {
         // byte 17    = inclination
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
 
                 double inc = Inclination.value();
                 if (requestInclination != -100) {
@@ -191,7 +191,7 @@ void kingsmithr2treadmill::update() {
             requestInclination = qRound(requestInclination * 2.0) / 2.0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
 
                 double speed = currentSpeed().value();
                 if (requestSpeed != -1) {
@@ -204,7 +204,7 @@ void kingsmithr2treadmill::update() {
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
 
                 lastSpeed = 0.5;
@@ -214,22 +214,22 @@ void kingsmithr2treadmill::update() {
             emit tapeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             requestStop = -1;
         }
         if (requestFanSpeed != -1) {
-            emit debug(QStringLiteral("changing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
 
             // sendChangeFanSpeed(requestFanSpeed);
             requestFanSpeed = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
@@ -238,11 +238,12 @@ void kingsmithr2treadmill::update() {
 }
 
 void kingsmithr2treadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                  const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -250,11 +251,11 @@ void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     buffer.append(value);
     if (value.back() != '\x0d') {
-        emit debug(QStringLiteral("packet not finished"));
+        QZ_EMIT_DEBUG(QStringLiteral("packet not finished"));
         return;
     }
     QByteArray decrypted;
@@ -287,7 +288,7 @@ void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic
     emit packetReceived();
 
     QString data = QString(lastValue);
-    emit debug(QStringLiteral(" << decrypted: ") + QString(data));
+    QZ_EMIT_DEBUG(QStringLiteral(" << decrypted: ") + QString(data));
 
     if (!data.startsWith("props")) {
         // TODO
@@ -306,7 +307,7 @@ void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic
             return;
         }
         QString value = _props.at(i + 1);
-        emit debug(key + ": " + value);
+        QZ_EMIT_DEBUG(key + ": " + value);
         props[key] = value.toDouble();
     }
 
@@ -344,21 +345,20 @@ void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
         // kg * 3.5) / 200 ) / 60
 
         Distance += ((speed / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
-        lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+                     ((double)1000.0 / (double)(qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
+        lastTimeCharacteristicChangedNs = qzclock::nowNs();
     }
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
     // emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
     // emit debug(QStringLiteral("Current Distance: ") + QString::number(distance));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -380,7 +380,7 @@ void kingsmithr2treadmill::characteristicChanged(const QLowEnergyCharacteristic
 }
 
 void kingsmithr2treadmill::btinit(bool startTape) {
-    emit debug(QStringLiteral("btinit"));
+    QZ_EMIT_DEBUG(QStringLiteral("btinit"));
 
     writeCharacteristic(QStringLiteral(""), QStringLiteral("init"), false, true);
     // format error
@@ -421,7 +421,7 @@ void kingsmithr2treadmill::stateChanged(QLowEnergyService::ServiceState state) {
     }
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::DiscoveringServices) {
     }
     if (state == QLowEnergyService::ServiceDiscovered) {
@@ -453,7 +453,7 @@ void kingsmithr2treadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void kingsmithr2treadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -462,12 +462,12 @@ void kingsmithr2treadmill::descriptorWritten(const QLowEnergyDescriptor &descrip
 void kingsmithr2treadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                  const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void kingsmithr2treadmill::serviceScanDone(void) {
     QBluetoothUuid _gattCommunicationChannelServiceId((quint16)0x1234);
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     if (KS_NACH_X21C)
         _gattCommunicationChannelServiceId = QBluetoothUuid(QStringLiteral("00021234-0000-1000-8000-00805f9b34fb"));
@@ -483,15 +483,15 @@ void kingsmithr2treadmill::serviceScanDone(void) {
 void kingsmithr2treadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("kingsmithr2treadmill::errorService ") +
-               QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("kingsmithr2treadmill::errorService ") +
+                  QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
 }
 
 void kingsmithr2treadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("kingsmithr2treadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("kingsmithr2treadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void kingsmithr2treadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -522,18 +522,18 @@ void kingsmithr2treadmill::deviceDiscovered(const QBluetoothDeviceInfo &device)
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     searchStopped = false;
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             searchStopped = false;
             emit disconnected();
         });
@@ -79,7 +79,7 @@ class kingsmithr2treadmill : public treadmill {
     QMap<QString, double> props;
     QByteArray buffer;
     QByteArray lastValue;
-    QDateTime lastTimeCharacteristicChanged;
+    qint64 lastTimeCharacteristicChangedNs = qzclock::nowNs();
     bool firstCharacteristicChanged = true;
 
     QTimer *refresh;
@@ -68,7 +68,7 @@ void lifefitnesstreadmill::writeCharacteristic(QLowEnergyService *service, QLowE
         service->writeCharacteristic(characteristic, *writeBuffer);
 
     if (!disable_log)
-        qDebug() << " >> " << writeBuffer->toHex(' ') << " // " << info;
+        QZ_DEBUG << " >> " << writeBuffer->toHex(' ') << " // " << info;
 
     loop.exec();
 }
@@ -167,7 +167,7 @@ void lifefitnesstreadmill::update() {
             if (requestSpeed != currentSpeed().value() &&
                 fabs(requestSpeed - currentSpeed().value()) > minStepSpeed() && requestSpeed >= 0 &&
                 requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 forceSpeed(requestSpeed);
             }
             requestSpeed = -1;
@@ -182,13 +182,13 @@ void lifefitnesstreadmill::update() {
             }
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 forceIncline(requestInclination);
             }
             requestInclination = -100;
         }
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
 
                 lastSpeed = 0.5;
@@ -199,19 +199,19 @@ void lifefitnesstreadmill::update() {
             lastStart = QDateTime::currentMSecsSinceEpoch();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
 
             lastStop = QDateTime::currentMSecsSinceEpoch();
 
             requestStop = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
@@ -259,11 +259,12 @@ void lifefitnesstreadmill::forceIncline(double requestIncline) {
 }
 
 void lifefitnesstreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                  const QByteArray &newValue) {
+    markIngress();
     double heart = 0; // NOTE : Should be initialized with a value to shut clang-analyzer's
                       // UndefinedBinaryOperatorResult
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
@@ -277,8 +278,8 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    emit debug(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
-               " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
+                  " " + newValue.toHex(' '));
 
     if (characteristic.uuid() == QBluetoothUuid((quint16)0x2ACD)) {
         lastPacket = newValue;
@@ -317,7 +318,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                     100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed && newValue.length() > index + 1) {
@@ -326,7 +327,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totalDistance && newValue.length() > index + 2) {
@@ -339,18 +340,18 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
         {
             if (firstDistanceCalculated)
                 Distance += ((Speed.value() / 3600000.0) *
-                             ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                             ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.inclination && newValue.length() > index + 1) {
             Inclination = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                     (uint16_t)((uint8_t)newValue.at(index)))) /
                           10.0;
             index += 4; // the ramo value is useless
-            emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
         }
 
         if (Flags.elevation && newValue.length() > index + 3) {
@@ -385,13 +386,12 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -403,9 +403,9 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                 if (index < newValue.length()) {
 
                     heart = ((double)(((uint8_t)newValue.at(index))));
-                    emit debug(QStringLiteral("Current Heart: ") + QString::number(heart));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(heart));
                 } else {
-                    emit debug(QStringLiteral("Error on parsing heart!"));
+                    QZ_EMIT_DEBUG(QStringLiteral("Error on parsing heart!"));
                 }
                 // index += 1; //NOTE: clang-analyzer-deadcode.DeadStores
             }
@@ -460,7 +460,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
             Speed = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                     100.0;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
             index += 2;
         }
 
@@ -470,7 +470,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totDistance && newValue.length() > index + 2) {
@@ -482,11 +482,11 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
         } else {
             if (firstDistanceCalculated)
                 Distance += ((Speed.value() / 3600000.0) *
-                             ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                             ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.stepCount && newValue.length() > index + 1) {
             if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
@@ -495,7 +495,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                 Cadence = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                     (uint16_t)((uint8_t)newValue.at(index))));
             }
-            emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
             index += 2;
             index += 2;
@@ -521,7 +521,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
             Resistance = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
             index += 2;
-            emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
         }
 
         if (Flags.instantPower && newValue.length() > index + 1) {
@@ -530,7 +530,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                     .startsWith(QStringLiteral("Disabled")))
                 m_watt = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                    (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(m_watt.value()));
             index += 2;
         }
 
@@ -538,7 +538,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
             double avgPower;
             avgPower = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                  (uint16_t)((uint8_t)newValue.at(index))));
-            emit debug(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Watt: ") + QString::number(avgPower));
             index += 2;
         }
 
@@ -562,13 +562,12 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
             distanceEval = true;
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -579,7 +578,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
             if (Flags.heartRate && !disable_hr_frommachinery && newValue.length() > index) {
                 Heart = ((double)(((uint8_t)newValue.at(index))));
                 // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
             } else {
                 Flags.heartRate = false;
             }
@@ -615,7 +614,7 @@ void lifefitnesstreadmill::characteristicChanged(const QLowEnergyCharacteristic
 
     if (distanceEval) {
         firstDistanceCalculated = true;
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     }
 
     if (m_control->error() != QLowEnergyController::NoError) {
@@ -632,7 +631,7 @@ void lifefitnesstreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QBluetoothUuid _gattWriteCharControlPointId((quint16)0x2AD9);
     QBluetoothUuid _gattTreadmillDataId((quint16)0x2ACD);
     QBluetoothUuid _gattCrossTrainerDataId((quint16)0x2ACE);
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -747,26 +746,26 @@ void lifefitnesstreadmill::changeInclinationRequested(double grade, double perce
 }
 
 void lifefitnesstreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 }
 
 void lifefitnesstreadmill::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void lifefitnesstreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                  const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void lifefitnesstreadmill::characteristicRead(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void lifefitnesstreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     initRequest = false;
     firstStateChanged = 0;
@@ -782,15 +781,15 @@ void lifefitnesstreadmill::serviceScanDone(void) {
 void lifefitnesstreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("lifefitnesstreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("lifefitnesstreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void lifefitnesstreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("lifefitnesstreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("lifefitnesstreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void lifefitnesstreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -799,8 +798,8 @@ void lifefitnesstreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device)
     // horizon treadmill and F80 treadmill, so if we want to add inclination support we have to separate the 2
     // devices
     // ***************************************************************************************************************
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -817,17 +816,17 @@ void lifefitnesstreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device)
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -273,7 +273,7 @@ m3ibike::m3ibike(bool noWriteResistance, bool noHeartService) {
     connect(detectDisc, &QTimer::timeout, this, [this]() {
         Q_UNUSED(this);
         emit disconnected();
-        emit debug(QStringLiteral("M3i detected disconnection"));
+        QZ_EMIT_DEBUG(QStringLiteral("M3i detected disconnection"));
         initDone = false;
         detectDisc->stop();
         elapsedTimer->stop();
@@ -351,7 +351,7 @@ void m3ibike::disconnectBluetooth() {
         discoveryAgent->stop();
     }
     emit disconnected();
-    emit debug(QStringLiteral("M3i detected disconnection"));
+    QZ_EMIT_DEBUG(QStringLiteral("M3i detected disconnection"));
     initDone = false;
 }
 
@@ -513,12 +513,12 @@ void m3ibike::initScan() {
 
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 12, 0))
 void m3ibike::deviceUpdatedPriv(const QBluetoothDeviceInfo &device, QBluetoothDeviceInfo::Fields updateFields) {
-    emit debug(QStringLiteral("deviceUpdated ") + device.name() + " " + updateFields);
+    QZ_EMIT_DEBUG(QStringLiteral("deviceUpdated ") + device.name() + " " + updateFields);
 }
 
 void m3ibike::deviceDiscoveredPriv(const QBluetoothDeviceInfo &device) {
     if (SAME_BLUETOOTH_DEVICE(device, bluetoothDevice)) {
-        emit debug(QStringLiteral("NEW ADV ") + bluetoothDevice.name());
+        QZ_EMIT_DEBUG(QStringLiteral("NEW ADV ") + bluetoothDevice.name());
         QHash<quint16, QByteArray> datas = device.manufacturerData();
         QHashIterator<quint16, QByteArray> i(datas);
         while (i.hasNext()) {
@@ -608,7 +608,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
     if (disconnecting) {
         return;
     }
-    emit debug(QStringLiteral(" << ") + data.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + data.toHex(' '));
     if (parse_data(data, &k3)) {
         QSettings settings;
         detectDisc->start(M3i_DISCONNECT_THRESHOLD);
@@ -630,7 +630,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
                 } else
 #endif
                     if (virtual_device_enabled) {
-                    emit debug(QStringLiteral("creating virtual bike interface..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
                     auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
                     // connect(virtualBike, &virtualbike::debug, this, &m3ibike::debug);
                     connect(virtualBike, &virtualbike::changeInclination, this, &m3ibike::changeInclination);
@@ -648,7 +648,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
             }
             emit connectedAndDiscovered();
             emit bikeStarted();
-            emit debug(QStringLiteral("M3i (re)connected"));
+            QZ_EMIT_DEBUG(QStringLiteral("M3i (re)connected"));
         }
         int oldtime = k3.time;
         bool not_in_pause = k3s.inner_step(&k3);
@@ -678,7 +678,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
         if (!settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
             Speed = k3.speed;
         } else {
-            Speed = metric::calculateSpeedFromPower(watts(),  Inclination.value(), Speed.value(),fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            Speed = metric::calculateSpeedFromPower(watts(),  Inclination.value(), Speed.value(),qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
         if (settings.value(QZSettings::m3i_bike_kcal, QZSettings::default_m3i_bike_kcal).toBool()) {
             KCal = k3.calorie;
@@ -687,7 +687,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
                 KCal += ((((0.048 * ((double)watts()) + 1.19) *
                            settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                           200.0) /
-                         (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
+                         (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
         }
         Distance = k3.distance;
         if (!not_in_pause || k3.time_orig <= 10) {
@@ -710,7 +710,7 @@ void m3ibike::processAdvertising(const QByteArray &data) {
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
         }
 
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
         if (antHeart)
@@ -734,16 +734,19 @@ void m3ibike::processAdvertising(const QByteArray &data) {
         }
 #endif
 
-        emit debug(QStringLiteral("Current Elapsed: ") + QString::number(elapsed.value()));
-        emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-        emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(k3.distanceR));
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
-        emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-        emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        // the m3i doesn't go through update_metrics
+        publishMetrics();
+
+        QZ_EMIT_DEBUG(QStringLiteral("Current Elapsed: ") + QString::number(elapsed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(k3.distanceR));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+        QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
     }
 }
 
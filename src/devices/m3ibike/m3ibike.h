@@ -165,7 +165,7 @@ class m3ibike : public bike {
     keiser_m3i_out_t k3;
     qint64 lastTimerRestart = -1;
     int lastTimerRestartOffset = 0;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     bool firstUpdate = true;
 
@@ -67,7 +67,7 @@ void mcfbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const QString
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        qDebug() << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+        QZ_DEBUG << QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
                         QStringLiteral(" // ") + info;
     }
 
@@ -177,14 +177,15 @@ double mcfbike::bikeResistanceToPeloton(double resistance) {
 }
 
 void mcfbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     QString heartRateBeltName =
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
 
-    qDebug() << " << " + newValue.toHex(' ');
+    QZ_DEBUG << " << " + newValue.toHex(' ');
 
     lastPacket = newValue;
 
@@ -211,11 +212,11 @@ void mcfbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
         } else {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
 
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
         m_watt = (((uint16_t)newValue.at(9) << 8) | (uint16_t)((uint8_t)newValue.at(10)));
 
@@ -223,14 +224,14 @@ void mcfbike::characteristicChanged(const QLowEnergyCharacteristic &characterist
             KCal += ((((0.048 * ((double)watts()) + 1.19) *
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
-                     (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(now))));
+                     (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs))));
 
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
         }
 
-        lastRefreshCharacteristicChanged = now;
+        lastRefreshCharacteristicChangedNs = nowNs;
 
         qDebug() << QStringLiteral("Current Speed: ") + QString::number(Speed.value());
         qDebug() << QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value());
@@ -379,7 +380,7 @@ void mcfbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void mcfbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' ');
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -387,7 +388,7 @@ void mcfbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QB
 
 void mcfbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    qDebug() << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicWritten ") + newValue.toHex(' ');
 }
 
 void mcfbike::serviceScanDone(void) {
@@ -65,7 +65,7 @@ class nautiluselliptical : public elliptical {
     bool searchStopped = false;
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     uint8_t bt_variant =
         0; // with the same bluetooth name there are different bluetooth controller with different UUIDs
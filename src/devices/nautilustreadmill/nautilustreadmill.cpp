@@ -59,8 +59,8 @@ void nautilustreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, con
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     // packets sent from the characChanged event, i don't want to block everything
@@ -68,7 +68,7 @@ void nautilustreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, con
         loop.exec();
 
         if (timeout.isActive() == false)
-            emit debug(QStringLiteral(" exit for timeout"));
+            QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -100,7 +100,7 @@ void nautilustreadmill::update() {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, noHeartService);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &nautilustreadmill::debug);
                 this->setVirtualDevice(virtualTreadMill, VIRTUAL_DEVICE_MODE::PRIMARY);
@@ -119,7 +119,7 @@ void nautilustreadmill::update() {
 
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 // double inc = Inclination.value(); // NOTE: clang-analyzer-deadcode.DeadStores
                 if (requestInclination != -100) {
                     //                        inc = requestInclination;
@@ -132,13 +132,13 @@ void nautilustreadmill::update() {
         if (requestInclination != -100) {
             if(T628) {
                 Inclination = requestInclination;
-                emit debug(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
             }
             if (requestInclination < 0)
                 requestInclination = 0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 // double speed = currentSpeed().value(); // NOTE: clang-analyzer-deadcode.DeadStores
                 if (requestSpeed != -1) {
                     // speed = requestSpeed;
@@ -150,7 +150,7 @@ void nautilustreadmill::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
                 lastSpeed = 0.5;
             }
@@ -158,7 +158,7 @@ void nautilustreadmill::update() {
             emit tapeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape", false, true);
             requestStop = -1;
         }
@@ -166,11 +166,12 @@ void nautilustreadmill::update() {
 }
 
 void nautilustreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void nautilustreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -178,7 +179,7 @@ void nautilustreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
     Q_UNUSED(characteristic);
     QByteArray value = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(value.length()) + QStringLiteral(" ") + value.toHex(' '));
 
     emit packetReceived();
 
@@ -197,7 +198,7 @@ void nautilustreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
             }
         }
 
-        emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
         // debug("Current Distance: " + QString::number(distance));
 
         if (Speed.value() != speed) {
@@ -209,7 +210,7 @@ void nautilustreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
                 emit inclinationChanged(0.0, incline);
             }
             Inclination = incline;
-            emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
         }
 
         // KCal = kcal;
@@ -224,24 +225,23 @@ void nautilustreadmill::characteristicChanged(const QLowEnergyCharacteristic &ch
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastTimeCharacteristicChanged.msecsTo(
-                          QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsSince(lastTimeCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
 
             Distance += ((Speed.value() / 3600.0) /
-                         (1000.0 / (lastTimeCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
+                         (1000.0 / (qzclock::msecsSince(lastTimeCharacteristicChangedNs))));
         }
 
         cadenceFromAppleWatch();
 
-        emit debug(QStringLiteral("Current KCal Calculated: ") + QString::number(KCal.value()));
-        emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal Calculated: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
         if (m_control->error() != QLowEnergyController::NoError) {
             qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
         }
 
-        lastTimeCharacteristicChanged = QDateTime::currentDateTime();
+        lastTimeCharacteristicChangedNs = qzclock::nowNs();
         firstCharacteristicChanged = false;
 
         if (Speed.value() > 0) {
@@ -276,7 +276,7 @@ void nautilustreadmill::btinit(bool startTape) {
 
 void nautilustreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
         QBluetoothUuid _gattWriteCharacteristicId(QStringLiteral("1717b3c0-9803-11e3-90e1-0002a5d5c51b"));
         QBluetoothUuid _gattNotify1CharacteristicId(QStringLiteral("a46a4a80-9803-11e3-8f3c-0002a5d5c51b"));
@@ -320,7 +320,7 @@ void nautilustreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void nautilustreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + " " + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -329,11 +329,11 @@ void nautilustreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor
 void nautilustreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void nautilustreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId =
         QBluetoothUuid(QStringLiteral("89e14b5e-a841-48ad-b580-935f4545fffc"));
@@ -357,19 +357,19 @@ void nautilustreadmill::serviceScanDone(void) {
 
 void nautilustreadmill::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("nautilustreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("nautilustreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void nautilustreadmill::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("nautilustreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("nautilustreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void nautilustreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         if(device.name().toUpper().startsWith(QStringLiteral("NAUTILUS T628"))) {
             qDebug() << "NAUTILUS T628 workaround";
@@ -389,17 +389,17 @@ void nautilustreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -51,8 +51,8 @@ void nordictrackelliptical::writeCharacteristic(uint8_t *data, uint8_t data_len,
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -642,7 +642,7 @@ void nordictrackelliptical::update() {
                         requestResistance = 0;
                     if (requestResistance != currentResistance().value() && requestResistance >= 0 &&
                         requestResistance <= max_resistance) {
-                        emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                         forceResistance(requestResistance);
                     }
                     requestResistance = -1;
@@ -652,7 +652,7 @@ void nordictrackelliptical::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= max_inclination) {
-                        emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -1;
@@ -700,7 +700,7 @@ void nordictrackelliptical::update() {
                         requestResistance = 0;
                     if (requestResistance != currentResistance().value() && requestResistance >= 0 &&
                         requestResistance <= max_resistance) {
-                        emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
                         forceResistance(requestResistance);
                     }
                     requestResistance = -1;
@@ -720,7 +720,7 @@ void nordictrackelliptical::update() {
         }
         /*
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
         // btinit();
 
@@ -728,7 +728,7 @@ void nordictrackelliptical::update() {
         emit tapeStarted();
     }*/
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -742,7 +742,7 @@ void nordictrackelliptical::changeInclinationRequested(double grade, double perc
 }
 
 void nordictrackelliptical::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 double nordictrackelliptical::GetInclinationFromPacket(QByteArray packet) {
@@ -936,6 +936,7 @@ double nordictrackelliptical::GetResistanceFromPacket(QByteArray packet) {
 
 void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                   const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -954,7 +955,7 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
             .toBool();
     uint8_t heart = 0;
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     lastPacket = newValue;
 
@@ -965,7 +966,7 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
             Cadence = (c * cadence_gain) + cadence_offset;
         else
             Cadence = 0;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
@@ -976,18 +977,18 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
     if (!nordictrack_elliptical_c7_5 && newValue.length() == 20 && newValue.at(0) == 0x01 && newValue.at(1) == 0x12 &&
         initDone == true) {
         Speed = (double)(((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t)newValue.at(14))) / 100.0;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         lastSpeedChanged = QDateTime::currentDateTime();
 
         if (proform_hybrid_trainer_xt && !disable_hr_frommachinery) {
             heart = newValue.at(3);
             Heart = heart;
-            emit debug(QStringLiteral("Current Heart from machinery: ") + QString::number(heart));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Heart from machinery: ") + QString::number(heart));
         }
 
     } else if (QDateTime::currentDateTime().secsTo(lastSpeedChanged) > 3) {
         Speed = 0;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
     }
 
     if (nordictrack_elliptical_c7_5 && newValue.length() == 20 && newValue.at(0) == 0x01 && newValue.at(1) == 0x12 &&
@@ -996,13 +997,13 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
           ((uint8_t)newValue.at(7)) == 0xFF && ((uint8_t)newValue.at(8)) == 0xFF && ((uint8_t)newValue.at(9)) == 0xFF &&
           ((uint8_t)newValue.at(12)) == 0xFF && ((uint8_t)newValue.at(11)) == 0xFF)) {
         Speed = (double)(((uint16_t)((uint8_t)newValue.at(13)) << 8) + (uint16_t)((uint8_t)newValue.at(12))) / 100.0;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         lastSpeedChanged = QDateTime::currentDateTime();
 
         if (!disable_hr_frommachinery) {
             heart = newValue.at(5);
             Heart = heart;
-            emit debug(QStringLiteral("Current Heart from machinery: ") + QString::number(heart));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Heart from machinery: ") + QString::number(heart));
         }
 
         uint8_t c = newValue.at(2);
@@ -1010,7 +1011,7 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
             Cadence = (c * cadence_gain) + cadence_offset;
         else
             Cadence = 0;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
@@ -1018,7 +1019,7 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
 
     } else if (QDateTime::currentDateTime().secsTo(lastSpeedChanged) > 3) {
         Speed = 0;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
     }
 
     if (newValue.length() != 20 || (newValue.at(0) != 0x00 && newValue.at(0) != 0x01) || newValue.at(1) != 0x12 ||
@@ -1039,7 +1040,7 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
             Cadence = (c * cadence_gain) + cadence_offset;
         else
             Cadence = 0;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
@@ -1062,14 +1063,13 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
 
     if (watts())
         KCal += ((((0.048 * ((double)watts()) + 1.19) * weight * 3.5) / 200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
     // KCal = (((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t) newValue.at(14)));
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                 ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     if (disable_hr_frommachinery) {
 #ifdef Q_OS_ANDROID
@@ -1084,13 +1084,13 @@ void nordictrackelliptical::characteristicChanged(const QLowEnergyCharacteristic
         }
     }
 
-    emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
-    emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
-    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
     // debug("Current Distance: " + QString::number(distance));
-    emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
-    emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -1328,7 +1328,7 @@ void nordictrackelliptical::stateChanged(QLowEnergyService::ServiceState state)
     QBluetoothUuid _gattNotify1CharacteristicId(QStringLiteral("00001535-1412-efde-1523-785feabcd123"));
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if (state == QLowEnergyService::ServiceDiscovered) {
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -1387,7 +1387,7 @@ void nordictrackelliptical::stateChanged(QLowEnergyService::ServiceState state)
 }
 
 void nordictrackelliptical::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -1396,11 +1396,11 @@ void nordictrackelliptical::descriptorWritten(const QLowEnergyDescriptor &descri
 void nordictrackelliptical::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                   const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void nordictrackelliptical::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("00001533-1412-efde-1523-785feabcd123"));
 
@@ -1412,18 +1412,18 @@ void nordictrackelliptical::serviceScanDone(void) {
 
 void nordictrackelliptical::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("nordictrackelliptical::errorService") +
-               QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("nordictrackelliptical::errorService") +
+                  QString::fromLocal8Bit(metaEnum.valueToKey(err)) + m_control->errorString());
 }
 
 void nordictrackelliptical::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("nordictrackelliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("nordictrackelliptical::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void nordictrackelliptical::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
     // if (device.name().startsWith(QStringLiteral("I_TL")))
     {
         bluetoothDevice = device;
@@ -1441,17 +1441,17 @@ void nordictrackelliptical::deviceDiscovered(const QBluetoothDeviceInfo &device)
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
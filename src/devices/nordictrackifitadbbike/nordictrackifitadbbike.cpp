@@ -34,15 +34,15 @@ void nordictrackifitadbbikeLogcatAdbThread::run() {
 QString nordictrackifitadbbikeLogcatAdbThread::runAdbCommand(QString command) {
 #ifdef Q_OS_WINDOWS
     QProcess process;
-    emit debug("adb >> " + command);
+    QZ_EMIT_DEBUG("adb >> " + command);
     process.start("adb/adb.exe", QStringList(command.split(' ')));
     process.waitForFinished(-1); // will wait forever until finished
 
     QString out = process.readAllStandardOutput();
     QString err = process.readAllStandardError();
 
-    emit debug("adb << OUT " + out);
-    emit debug("adb << ERR" + err);
+    QZ_EMIT_DEBUG("adb << OUT " + out);
+    QZ_EMIT_DEBUG("adb << ERR" + err);
 #else
     QString out;
 #endif
@@ -68,17 +68,17 @@ void nordictrackifitadbbikeLogcatAdbThread::runAdbTailCommand(QString command) {
         bool hrmFound = false;
         foreach (QString line, lines) {
             if (line.contains("Changed KPH")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 speed = line.split(' ').last().toDouble();
             } else if (line.contains("Changed Grade")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 inclination = line.split(' ').last().toDouble();
             } else if (line.contains("Changed Watts")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 watt = line.split(' ').last().toDouble();
                 wattFound = true;
             } else if (line.contains("HeartRateDataUpdate")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 QStringList splitted = line.split(' ', Qt::SkipEmptyParts);
                 if (splitted.length() > 14) {
                     hrm = splitted[14].toInt();
@@ -100,9 +100,9 @@ void nordictrackifitadbbikeLogcatAdbThread::runAdbTailCommand(QString command) {
     });
     QObject::connect(process, &QProcess::readyReadStandardError, [process, this]() {
         auto output = process->readAllStandardError();
-        emit debug("adbLogCat ERROR << " + output);
+        QZ_EMIT_DEBUG("adbLogCat ERROR << " + output);
     });
-    emit debug("adbLogCat >> " + command);
+    QZ_EMIT_DEBUG("adbLogCat >> " + command);
     process->start("adb/adb.exe", QStringList(command.split(' ')));
     process->waitForFinished(-1);
 #endif
@@ -290,7 +290,7 @@ void nordictrackifitadbbike::processPendingDatagrams() {
         if (settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
 
         bool proform_studio_NTEX71021 =
@@ -430,19 +430,18 @@ void nordictrackifitadbbike::processPendingDatagrams() {
         if (watts())
             KCal +=
                 ((((0.048 * ((double)watts()) + 1.19) * weight * 3.5) / 200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         // KCal = (((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t) newValue.at(14)));
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                     ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
         if (Cadence.value() > 0) {
             CrankRevs++;
             LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
         }
 
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -468,13 +467,13 @@ void nordictrackifitadbbike::processPendingDatagrams() {
 #endif
 #endif
 
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
-        emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-        emit debug(QStringLiteral("Current Gear: ") + QString::number(gear));
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
-        emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Gear: ") + QString::number(gear));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
         // debug("Current Distance: " + QString::number(distance));
     }
 }
@@ -493,7 +492,7 @@ void nordictrackifitadbbike::onHRM(int hrm) {
         heartRateBeltName.startsWith(QStringLiteral("Disabled")) && !disable_hr_frommachinery) {
 
         Heart = hrm;
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
     }
 }
 
@@ -568,14 +567,14 @@ void nordictrackifitadbbike::update() {
     }
 
     if (requestStart != -1) {
-        emit debug(QStringLiteral("starting..."));
+        QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
         // btinit();
 
         requestStart = -1;
     }
     if (requestStop != -1) {
-        emit debug(QStringLiteral("stopping..."));
+        QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
         // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
         requestStop = -1;
     }
@@ -39,15 +39,15 @@ void nordictrackifitadbtreadmillLogcatAdbThread::run() {
 QString nordictrackifitadbtreadmillLogcatAdbThread::runAdbCommand(QString command) {
 #ifdef Q_OS_WINDOWS
     QProcess process;
-    emit debug("adb >> " + command);
+    QZ_EMIT_DEBUG("adb >> " + command);
     process.start("adb/adb.exe", QStringList(command.split(' ')));
     process.waitForFinished(-1); // will wait forever until finished
 
     QString out = process.readAllStandardOutput();
     QString err = process.readAllStandardError();
 
-    emit debug("adb << OUT " + out);
-    emit debug("adb << ERR" + err);
+    QZ_EMIT_DEBUG("adb << OUT " + out);
+    QZ_EMIT_DEBUG("adb << ERR" + err);
 #else
     QString out;
 #endif
@@ -76,13 +76,13 @@ void nordictrackifitadbtreadmillLogcatAdbThread::runAdbTailCommand(QString comma
         bool wattFound = false;
         foreach (QString line, lines) {
             if (line.contains("Changed KPH")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 speed = line.split(' ').last().toDouble();
             } else if (line.contains("Changed Grade")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 inclination = line.split(' ').last().toDouble();
             } else if (line.contains("Changed Watts")) {
-                emit debug(line);
+                QZ_EMIT_DEBUG(line);
                 watt = line.split(' ').last().toDouble();
                 wattFound = true;
             }
@@ -99,9 +99,9 @@ void nordictrackifitadbtreadmillLogcatAdbThread::runAdbTailCommand(QString comma
     });
     QObject::connect(process, &QProcess::readyReadStandardError, [process, this]() {
         auto output = process->readAllStandardError();
-        emit debug("adbLogCat ERROR << " + output);
+        QZ_EMIT_DEBUG("adbLogCat ERROR << " + output);
     });
-    emit debug("adbLogCat >> " + command);
+    QZ_EMIT_DEBUG("adbLogCat >> " + command);
     process->start("adb/adb.exe", QStringList(command.split(' ')));
     process->waitForFinished(-1);
 #endif
@@ -374,14 +374,13 @@ void nordictrackifitadbtreadmill::processPendingDatagrams() {
         if (watts(weight))
             KCal +=
                 ((((0.048 * ((double)watts(weight)) + 1.19) * weight * 3.5) / 200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         // KCal = (((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t) newValue.at(14)));
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                     ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -396,12 +395,12 @@ void nordictrackifitadbtreadmill::processPendingDatagrams() {
 
         cadenceFromAppleWatch();
 
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-        emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
         // debug("Current Distance: " + QString::number(distance));
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
     }
 }
 
@@ -419,8 +418,8 @@ disable_log, bool wait_for_response) { QEventLoop loop; QTimer timeout; if (wait
                                                          QByteArray((const char *)data, data_len));
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -447,14 +446,13 @@ void nordictrackifitadbtreadmill::onSpeedInclination(double speed, double inclin
 
     if (watts(weight))
         KCal += ((((0.048 * ((double)watts(weight)) + 1.19) * weight * 3.5) / 200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
     // KCal = (((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t) newValue.at(14)));
     Distance += ((Speed.value() / 3600000.0) *
-                 ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                 ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -467,11 +465,11 @@ void nordictrackifitadbtreadmill::onSpeedInclination(double speed, double inclin
         }
     }
 
-    emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
-    emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
     // debug("Current Distance: " + QString::number(distance));
-    emit debug(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
 }
 
 void nordictrackifitadbtreadmill::update() {
@@ -495,7 +493,7 @@ void nordictrackifitadbtreadmill::update() {
     }
 
     if (requestStart != -1) {
-        emit debug(QStringLiteral("starting..."));
+        QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
         // btinit();
 
@@ -503,7 +501,7 @@ void nordictrackifitadbtreadmill::update() {
         emit tapeStarted();
     }
     if (requestStop != -1) {
-        emit debug(QStringLiteral("stopping..."));
+        QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
         // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
         requestStop = -1;
     }
@@ -65,7 +65,7 @@ class proformellipticaltrainer : public elliptical {
     const resistance_t max_resistance = 24;
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
     uint16_t m_watts = 0;
 
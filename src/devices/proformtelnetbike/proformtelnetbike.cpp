@@ -62,7 +62,7 @@ proformtelnetbike::proformtelnetbike(bool noWriteResistance, bool noHeartService
 #endif
 #endif
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual bike interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
                 auto virtualBike =
                     new virtualbike(this, noWriteResistance, noHeartService, bikeResistanceOffset, bikeResistanceGain);
                 // connect(virtualBike,&virtualbike::debug ,this,& proformtelnetbike::debug);
@@ -102,8 +102,8 @@ void proformtelnetbike::writeCharacteristic(uint8_t *data, uint8_t data_len, con
                                                       QByteArray((const char *)data, data_len));
 
  if (!disable_log) {
-     emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                QStringLiteral(" // ") + info);
+     QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                   QStringLiteral(" // ") + info);
  }
 
  loop.exec();
@@ -131,7 +131,7 @@ void proformtelnetbike::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                    // btinit();
 
@@ -139,7 +139,7 @@ void proformtelnetbike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -201,10 +201,11 @@ resistance_t proformtelnetbike::pelotonToBikeResistance(int pelotonResistance) {
 }
 
 void proformtelnetbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void proformtelnetbike::characteristicChanged(const char *buff, int len) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -214,10 +215,10 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
     bool erg_mode = settings.value(QZSettings::zwift_erg, QZSettings::default_zwift_erg).toBool();
 
     QByteArray newValue = QByteArray::fromRawData(buff, len);
-    emit debug(QStringLiteral(" << ") + newValue);
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue);
 
     if(newValue.contains("Shared Memory Management Utility")) {
-        emit debug(QStringLiteral("Ready to start the poll"));
+        QZ_EMIT_DEBUG(QStringLiteral("Ready to start the poll"));
         sendFrame("2\n"); // current watt
     } else if(newValue.contains("Enter New Value")) {
         if(poolIndex >= 4) {
@@ -303,11 +304,11 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
                 .toString()
                 .startsWith(QStringLiteral("Disabled")))
             m_watt = watt;
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
     } else if (newValue.contains("Cur RPM")) {
         double RPM = packet[3].toDouble();
         Cadence = RPM;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
         if (Cadence.value() > 0) {
             CrankRevs++;
@@ -317,11 +318,11 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
         if (!settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
             double kph = packet[3].toDouble() / 10.0;
             Speed = kph;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         } else {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
     }
 
@@ -330,11 +331,10 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
         Distance += ((Speed.value() / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()))));
+                     ((double)1000.0 / (double)(qzclock::msecsSince(lastRefreshCharacteristicChangedNs))));
     }
     /*
         Resistance = resistance;
@@ -345,7 +345,7 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
     if (!disable_hr_frommachinery && !values[QStringLiteral("Chest Pulse")].isUndefined()) {
         Heart = values[QStringLiteral("Chest Pulse")].toString().toDouble();
         // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
     }*/
 
 #ifdef Q_OS_ANDROID
@@ -359,7 +359,7 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
         }
     }
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_IOS
 #ifndef IO_UNDER_QT
@@ -374,16 +374,16 @@ void proformtelnetbike::characteristicChanged(const char *buff, int len) {
 #endif
 
     /*
-    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */    
+    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */    
 }
 
 void proformtelnetbike::btinit() { initDone = true; }
 
 void proformtelnetbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
 }
 
 bool proformtelnetbike::connected() { return telnet.isConnected(); }
@@ -46,7 +46,7 @@ void proformtreadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, cons
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -150,14 +150,14 @@ void proformtreadmill::update() {
                 if (requestInclination != -100) {
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -196,7 +196,7 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= -3 &&
                         requestInclination <= (proform_treadmill_z1300i ? 12 : 15)) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
@@ -204,7 +204,7 @@ void proformtreadmill::update() {
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 &&
                         requestSpeed <= (proform_treadmill_z1300i ? 19.3 : 22)) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -219,7 +219,7 @@ void proformtreadmill::update() {
             case 5:
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"), false, true);
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -245,7 +245,7 @@ void proformtreadmill::update() {
                     writeCharacteristic(stop1, sizeof(stop1), QStringLiteral("stop1"));
                     writeCharacteristic(stop2, sizeof(stop2), QStringLiteral("stop2"));
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -284,14 +284,14 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -304,7 +304,7 @@ void proformtreadmill::update() {
             case 5:
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -324,7 +324,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -361,14 +361,14 @@ void proformtreadmill::update() {
                             ((requestInclination >= -3 && proform_2000_treadmill) || 
                             (requestInclination >= 0 && !proform_2000_treadmill)) &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -383,12 +383,12 @@ void proformtreadmill::update() {
             case 5:
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
                     requestStart = -1;
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -428,14 +428,14 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -448,7 +448,7 @@ void proformtreadmill::update() {
             case 5:
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -456,7 +456,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -493,14 +493,14 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -516,7 +516,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09, 0x00, 0x00, 0x40, 0x02, 0x18, 0x40, 0x00, 0x00, 0x80, 0xca};
@@ -535,7 +535,7 @@ void proformtreadmill::update() {
                 if (requestStop != -1 || requestPause != -1) {
                     forceSpeed(0);
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -567,14 +567,14 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -590,7 +590,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -598,7 +598,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -634,14 +634,14 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -657,7 +657,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -665,7 +665,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -710,21 +710,21 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -746,7 +746,7 @@ void proformtreadmill::update() {
                 if (requestStop != -1 || requestPause != -1) {
                     forceSpeed(0);
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -788,21 +788,21 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -824,7 +824,7 @@ void proformtreadmill::update() {
                 if (requestStop != -1 || requestPause != -1) {
                     forceSpeed(0);
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -865,21 +865,21 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -901,7 +901,7 @@ void proformtreadmill::update() {
                 if (requestStop != -1 || requestPause != -1) {
                     forceSpeed(0);
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -942,21 +942,21 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     uint8_t start1[] = {0xfe, 0x02, 0x20, 0x03};
                     uint8_t start2[] = {0x00, 0x12, 0x02, 0x04, 0x02, 0x1c, 0x04, 0x1c, 0x02, 0x09,
@@ -978,7 +978,7 @@ void proformtreadmill::update() {
                 if (requestStop != -1 || requestPause != -1) {
                     forceSpeed(0);
 
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     requestStop = -1;
                     requestPause = -1;
                 }
@@ -1017,14 +1017,14 @@ void proformtreadmill::update() {
                         requestInclination = -3;
                     if (requestInclination != currentInclination().value() && requestInclination >= -3 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -1040,7 +1040,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1048,7 +1048,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1090,14 +1090,14 @@ void proformtreadmill::update() {
                         requestInclination = -3;
                     if (requestInclination != currentInclination().value() && requestInclination >= -3 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -1113,7 +1113,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1121,7 +1121,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1157,14 +1157,14 @@ void proformtreadmill::update() {
                         requestInclination = -3;
                     if (requestInclination != currentInclination().value() && requestInclination >= -3 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
@@ -1180,7 +1180,7 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData6, sizeof(noOpData6), QStringLiteral("noOp"));
 
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1188,7 +1188,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1233,20 +1233,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1254,7 +1254,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1290,13 +1290,13 @@ void proformtreadmill::update() {
                 writeCharacteristic(noOpData4, sizeof(noOpData4), QStringLiteral("noOp"), true);
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1304,7 +1304,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1349,20 +1349,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1370,7 +1370,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1385,20 +1385,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1406,7 +1406,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1449,20 +1449,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1470,7 +1470,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1511,20 +1511,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1532,7 +1532,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1573,20 +1573,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1594,7 +1594,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1635,20 +1635,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                            // btinit();
 
@@ -1656,7 +1656,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1697,20 +1697,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                            // btinit();
 
@@ -1718,7 +1718,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1759,20 +1759,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1780,7 +1780,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1821,20 +1821,20 @@ void proformtreadmill::update() {
                         requestInclination = 0;
                     if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                         requestInclination <= 15) {
-                        emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                         forceIncline(requestInclination);
                     }
                     requestInclination = -100;
                 }
                 if (requestSpeed != -1) {
                     if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                        emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                        QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                         forceSpeed(requestSpeed);
                     }
                     requestSpeed = -1;
                 }
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1842,7 +1842,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1887,7 +1887,7 @@ void proformtreadmill::update() {
             case 6:
                 writeCharacteristic(noOpData7, sizeof(noOpData7), QStringLiteral("noOp"));
                 if (requestStart != -1) {
-                    emit debug(QStringLiteral("starting..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
                     // btinit();
 
@@ -1895,7 +1895,7 @@ void proformtreadmill::update() {
                     emit tapeStarted();
                 }
                 if (requestStop != -1) {
-                    emit debug(QStringLiteral("stopping..."));
+                    QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                     // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
                     requestStop = -1;
                 }
@@ -1922,11 +1922,12 @@ void proformtreadmill::changeInclinationRequested(double grade, double percentag
 }
 
 void proformtreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void proformtreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -1934,7 +1935,7 @@ void proformtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     double weight = settings.value(QZSettings::weight, QZSettings::default_weight).toFloat();
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     lastPacket = newValue;
 
@@ -1978,14 +1979,13 @@ void proformtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         if (watts(weight))
             KCal +=
                 ((((0.048 * ((double)watts(weight)) + 1.19) * weight * 3.5) / 200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         // KCal = (((uint16_t)((uint8_t)newValue.at(15)) << 8) + (uint16_t)((uint8_t) newValue.at(14)));
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                     ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
 
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -2000,11 +2000,11 @@ void proformtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
 
         cadenceFromAppleWatch();
 
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
-        emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
         // debug("Current Distance: " + QString::number(distance));
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts(weight)));
 
         if (m_control->error() != QLowEnergyController::NoError) {
             qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -4644,7 +4644,7 @@ void proformtreadmill::stateChanged(QLowEnergyService::ServiceState state) {
     QBluetoothUuid _gattNotify1CharacteristicId(QStringLiteral("00001535-1412-efde-1523-785feabcd123"));
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if (state == QLowEnergyService::ServiceDiscovered) {
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -4675,14 +4675,14 @@ void proformtreadmill::stateChanged(QLowEnergyService::ServiceState state) {
                     .toBool();
             if (virtual_device_enabled) {
                 if (!virtual_device_force_bike) {
-                    emit debug("creating virtual treadmill interface...");
+                    QZ_EMIT_DEBUG("creating virtual treadmill interface...");
                     auto virtualTreadmill = new virtualtreadmill(this, noHeartService);
                     connect(virtualTreadmill, &virtualtreadmill::debug, this, &proformtreadmill::debug);
                     connect(virtualTreadmill, &virtualtreadmill::changeInclination, this,
                             &proformtreadmill::changeInclinationRequested);
                     this->setVirtualDevice(virtualTreadmill, VIRTUAL_DEVICE_MODE::PRIMARY);
                 } else {
-                    emit debug("creating virtual bike interface...");
+                    QZ_EMIT_DEBUG("creating virtual bike interface...");
                     auto virtualBike = new virtualbike(this);
                     connect(virtualBike, &virtualbike::changeInclination, this,
                             &proformtreadmill::changeInclinationRequested);
@@ -4702,7 +4702,7 @@ void proformtreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void proformtreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -4711,11 +4711,11 @@ void proformtreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor,
 void proformtreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void proformtreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("00001533-1412-efde-1523-785feabcd123"));
 
@@ -4726,18 +4726,18 @@ void proformtreadmill::serviceScanDone(void) {
 
 void proformtreadmill::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("proformtreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("proformtreadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void proformtreadmill::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("proformtreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("proformtreadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void proformtreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
     // if (device.name().startsWith(QStringLiteral("I_TL")))
     {
         bluetoothDevice = device;
@@ -4755,17 +4755,17 @@ void proformtreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
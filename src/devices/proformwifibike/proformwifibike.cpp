@@ -34,7 +34,7 @@ proformwifibike::proformwifibike(bool noWriteResistance, bool noHeartService, in
     ok = connect(&websocket, &QWebSocket::connected, [&]() { qDebug() << "connected!"; });
     ok = connect(&websocket, &QWebSocket::disconnected, [&]() {
         qDebug() << "disconnected!";
-        lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+        lastRefreshCharacteristicChangedNs = qzclock::nowNs();
         connectToDevice();
     });
 
@@ -69,7 +69,7 @@ proformwifibike::proformwifibike(bool noWriteResistance, bool noHeartService, in
 #endif
 #endif
             if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual bike interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
             auto virtualBike =
                 new virtualbike(this, noWriteResistance, noHeartService, bikeResistanceOffset, bikeResistanceGain);
             // connect(virtualBike,&virtualbike::debug ,this,& proformwifibike::debug);
@@ -106,8 +106,8 @@ void proformwifibike::writeCharacteristic(uint8_t *data, uint8_t data_len, const
                                                          QByteArray((const char *)data, data_len));
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
-                   QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') +
+                      QStringLiteral(" // ") + info);
     }
 
     loop.exec();
@@ -261,7 +261,7 @@ void proformwifibike::innerWriteResistance() {
         }
 
         if (requestResistance != currentResistance().value()) {
-            emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+            QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
             auto virtualBike = this->VirtualBike();
             if (((virtualBike && !virtualBike->ftmsDeviceConnected()) || !virtualBike) &&
                 (requestPower == 0 || requestPower == -1)) {
@@ -301,7 +301,7 @@ void proformwifibike::innerWriteResistance() {
             last_mode = "MANUAL";
             setWorkoutType(last_mode);
         }
-        emit debug(QStringLiteral("writing inclination ") + QString::number(requestInclination));
+        QZ_EMIT_DEBUG(QStringLiteral("writing inclination ") + QString::number(requestInclination));
         forceResistance(requestInclination + gears()); // since this bike doesn't have the concept of resistance,
                                                        // i'm using the gears in the inclination
         requestInclination = -100;
@@ -324,7 +324,7 @@ void proformwifibike::update() {
             // updateDisplay(elapsed);
         }
 
-        if(lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime()) > 10000) {
+        if(qzclock::msecsSince(lastRefreshCharacteristicChangedNs) > 10000) {
 
             Speed = 0;
             m_watt = 0;
@@ -338,7 +338,7 @@ void proformwifibike::update() {
         innerWriteResistance();
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
@@ -346,7 +346,7 @@ void proformwifibike::update() {
             emit bikeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -408,13 +408,14 @@ resistance_t proformwifibike::pelotonToBikeResistance(int pelotonResistance) {
 }
 
 void proformwifibike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void proformwifibike::binaryMessageReceived(const QByteArray &message) { characteristicChanged(message); }
 
 void proformwifibike::characteristicChanged(const QString &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -422,7 +423,7 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
     bool disable_hr_frommachinery =
         settings.value(QZSettings::heart_ignore_builtin, QZSettings::default_heart_ignore_builtin).toBool();
 
-    emit debug(QStringLiteral(" << ") + newValue);
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue);
 
     lastPacket = newValue;
 
@@ -443,36 +444,36 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
         if (!values[QStringLiteral("Current KPH")].isUndefined()) {
             double kph = values[QStringLiteral("Current KPH")].toString().toDouble();
             Speed = kph;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         } else if (!values[QStringLiteral("KPH")].isUndefined()) {
             double kph = values[QStringLiteral("KPH")].toString().toDouble();
             Speed = kph;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (!values[QStringLiteral("Kilometers")].isUndefined()) {
             double odometer = values[QStringLiteral("Kilometers")].toString().toDouble();
             Distance = odometer;
-            emit debug("Current Distance: " + QString::number(odometer));
+            QZ_EMIT_DEBUG("Current Distance: " + QString::number(odometer));
         } else if (!values[QStringLiteral("Chilometri")].isUndefined()) {
             double odometer = values[QStringLiteral("Chilometri")].toString().toDouble();
             Distance = odometer;
-            emit debug("Current Distance: " + QString::number(odometer));
+            QZ_EMIT_DEBUG("Current Distance: " + QString::number(odometer));
         }
 
     } else {
         Speed = metric::calculateSpeedFromPower(
             watts(), Inclination.value(), Speed.value(),
-            fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
 
         Distance += ((Speed.value() / 3600000.0) *
-                    ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                    ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
     }
 
     if (!values[QStringLiteral("RPM")].isUndefined()) {
         double rpm = values[QStringLiteral("RPM")].toString().toDouble();
         Cadence = rpm;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
         if (Cadence.value() > 0) {
             CrankRevs++;
@@ -488,11 +489,11 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
                     .toString()
                     .startsWith(QStringLiteral("Disabled")))
                 m_watt = watt;
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
         } else if (!values[QStringLiteral("Watt attuali")].isUndefined()) {
             double watt = values[QStringLiteral("Watt attuali")].toString().toDouble();
             m_watt = watt;
-            emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
         }
     }
 
@@ -505,7 +506,7 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
         if(inclinationAvailableByHardware() && !erg_mode)
             incline = incline - gears();
         Inclination = incline;
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(incline));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(incline));
     } else if (!values[QStringLiteral("Incline")].isUndefined()) {
         bool erg_mode = settings.value(QZSettings::zwift_erg, QZSettings::default_zwift_erg).toBool();
         double incline = values[QStringLiteral("Incline")].toString().toDouble();
@@ -515,23 +516,23 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
         if(inclinationAvailableByHardware() && !erg_mode)
             incline = incline - gears();
         Inclination = incline;
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(incline));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(incline));
     }
 
     if (!values[QStringLiteral("Target Watts")].isUndefined()) {
         double watt = values[QStringLiteral("Target Watts")].toString().toDouble();
         target_watts = watt;
-        emit debug(QStringLiteral("Target Watts: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Target Watts: ") + QString::number(watts()));
     }
 
     if (!values[QStringLiteral("Resistance")].isUndefined()) {
         Resistance = values[QStringLiteral("Resistance")].toString().toDouble();
-        emit debug(QStringLiteral("Resistance: ") + QString::number(Resistance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Resistance: ") + QString::number(Resistance.value()));
     }
 
     if (!values[QStringLiteral("Maximum Incline")].isUndefined()) {
         max_incline_supported = values[QStringLiteral("Maximum Incline")].toString().toDouble();
-        emit debug(QStringLiteral("Maximum Incline Supported: ") + QString::number(max_incline_supported));
+        QZ_EMIT_DEBUG(QStringLiteral("Maximum Incline Supported: ") + QString::number(max_incline_supported));
     }
 
     if (settings.value(QZSettings::gears_from_bike, QZSettings::default_gears_from_bike).toBool()) {
@@ -589,8 +590,7 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
                                                               /*
                                                                   Resistance = resistance;
@@ -600,7 +600,7 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
     if (!disable_hr_frommachinery && !values[QStringLiteral("Chest Pulse")].isUndefined()) {
         Heart = values[QStringLiteral("Chest Pulse")].toString().toDouble();
         // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
     }
 
 #ifdef Q_OS_ANDROID
@@ -614,7 +614,7 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
         }
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_IOS
 #ifndef IO_UNDER_QT
@@ -629,16 +629,16 @@ void proformwifibike::characteristicChanged(const QString &newValue) {
 #endif
 
     /*
-    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
+    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
 }
 
 void proformwifibike::btinit() { initDone = true; }
 
 void proformwifibike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
 }
 
 bool proformwifibike::connected() { return websocket.state() == QAbstractSocket::ConnectedState; }
@@ -110,7 +110,7 @@ void proformwifitreadmill::update() {
 
         if (requestSpeed != -1 && waitStatePkg == false) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 forceSpeed(requestSpeed);
             }
             requestSpeed = -1;
@@ -122,7 +122,7 @@ void proformwifitreadmill::update() {
             requestInclination = qRound(requestInclination * 2.0) / 2.0;
             if (requestInclination != currentInclination().value() && requestInclination >= min_incline_supported &&
                 requestInclination <= max_incline_supported) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
 
                 forceIncline(requestInclination);
             }
@@ -136,14 +136,14 @@ void proformwifitreadmill::update() {
         }
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
 
             // btinit();
 
             requestStart = -1;
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
             // writeCharacteristic(initDataF0C800B8, sizeof(initDataF0C800B8), "stop tape");
             requestStop = -1;
         }
@@ -151,12 +151,13 @@ void proformwifitreadmill::update() {
 }
 
 void proformwifitreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void proformwifitreadmill::binaryMessageReceived(const QByteArray &message) { characteristicChanged(message); }
 
 void proformwifitreadmill::characteristicChanged(const QString &newValue) {
+    markIngress();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -164,7 +165,7 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
     bool disable_hr_frommachinery =
         settings.value(QZSettings::heart_ignore_builtin, QZSettings::default_heart_ignore_builtin).toBool();
 
-    emit debug(QStringLiteral(" << ") + newValue);
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue);
 
     lastPacket = newValue;
 
@@ -180,7 +181,7 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
         double kph = values[QStringLiteral("Current KPH")].toString().toDouble();
         if(kph <= maximum_kph) {
             Speed = kph;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         } else {
             qDebug() << "filtering speed due to firmware bug";
         }
@@ -188,7 +189,7 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
         double kph = values[QStringLiteral("KPH")].toString().toDouble();
         if(kph <= maximum_kph) {
             Speed = kph;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         } else {
             qDebug() << "filtering speed due to firmware bug";
         }
@@ -197,17 +198,17 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
     if (!values[QStringLiteral("Kilometers")].isUndefined()) {
         double odometer = values[QStringLiteral("Kilometers")].toString().toDouble();
         Distance = odometer;
-        emit debug("Current Distance: " + QString::number(odometer));
+        QZ_EMIT_DEBUG("Current Distance: " + QString::number(odometer));
     } else if (!values[QStringLiteral("Chilometri")].isUndefined()) {
         double odometer = values[QStringLiteral("Chilometri")].toString().toDouble();
         Distance = odometer;
-        emit debug("Current Distance: " + QString::number(odometer));
+        QZ_EMIT_DEBUG("Current Distance: " + QString::number(odometer));
     }
 
     if (!values[QStringLiteral("RPM")].isUndefined()) {
         double rpm = values[QStringLiteral("RPM")].toString().toDouble();
         Cadence = rpm;
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
         if (Cadence.value() > 0) {
         }
@@ -216,38 +217,38 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
     if (!values[QStringLiteral("Current Watts")].isUndefined()) {
         double watt = values[QStringLiteral("Current Watts")].toString().toDouble();
         m_watts = watt;
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
     } else if (!values[QStringLiteral("Watt attuali")].isUndefined()) {
         double watt = values[QStringLiteral("Watt attuali")].toString().toDouble();
         m_watts = watt;
-        emit debug(QStringLiteral("Current Watt: ") + QString::number(watts()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Watt: ") + QString::number(watts()));
     }
 
     if (!values[QStringLiteral("Actual Incline")].isUndefined()) {
         double incline = values[QStringLiteral("Actual Incline")].toString().toDouble();
         Inclination = incline;
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(incline));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(incline));
     }
 
     if (!values[QStringLiteral("Incline")].isUndefined()) {
         double incline = values[QStringLiteral("Incline")].toString().toDouble();
         Inclination = incline;
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(incline));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(incline));
     }
 
     if (!values[QStringLiteral("Maximum Incline")].isUndefined()) {
         max_incline_supported = values[QStringLiteral("Maximum Incline")].toString().toDouble();
-        emit debug(QStringLiteral("Maximum Incline Supported: ") + QString::number(max_incline_supported));
+        QZ_EMIT_DEBUG(QStringLiteral("Maximum Incline Supported: ") + QString::number(max_incline_supported));
     }
 
     if (!values[QStringLiteral("Minimum Incline")].isUndefined()) {
         min_incline_supported = values[QStringLiteral("Minimum Incline")].toString().toDouble();
-        emit debug(QStringLiteral("Minimum Incline Supported: ") + QString::number(min_incline_supported));
+        QZ_EMIT_DEBUG(QStringLiteral("Minimum Incline Supported: ") + QString::number(min_incline_supported));
     }    
 
     if (!values[QStringLiteral("Maximum KPH")].isUndefined()) {
         maximum_kph = values[QStringLiteral("Maximum KPH")].toString().toDouble();
-        emit debug(QStringLiteral("Maximum KPH: ") + QString::number(maximum_kph));
+        QZ_EMIT_DEBUG(QStringLiteral("Maximum KPH: ") + QString::number(maximum_kph));
     }
 
     waitStatePkg = false;
@@ -257,8 +258,7 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     /*
                                                                   Resistance = resistance;
@@ -268,10 +268,10 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
     if (!disable_hr_frommachinery && !values[QStringLiteral("Chest Pulse")].isUndefined()) {
         Heart = values[QStringLiteral("Chest Pulse")].toString().toDouble();
         // index += 1; // NOTE: clang-analyzer-deadcode.DeadStores
-        emit debug(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(Heart.value()));
     }
 
-    lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -297,16 +297,16 @@ void proformwifitreadmill::characteristicChanged(const QString &newValue) {
 #endif
 
     /*
-    emit debug(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
-    emit debug(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
-    emit debug(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
-    emit debug(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
+    QZ_EMIT_DEBUG(QStringLiteral("Current Resistance: ") + QString::number(Resistance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Calculate Distance: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current CrankRevs: ") + QString::number(CrankRevs));
+    QZ_EMIT_DEBUG(QStringLiteral("Last CrankEventTime: ") + QString::number(LastCrankEventTime));    */
 }
 
 void proformwifitreadmill::btinit() { initDone = true; }
 
 void proformwifitreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + " (" + device.address().toString() + ')');
 }
 
 bool proformwifitreadmill::connected() { return websocket.state() == QAbstractSocket::ConnectedState; }
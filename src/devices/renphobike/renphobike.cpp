@@ -175,7 +175,8 @@ void renphobike::update() {
 void renphobike::serviceDiscovered(const QBluetoothUuid &gatt) { debug("serviceDiscovered " + gatt.toString()); }
 
 void renphobike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -226,7 +227,7 @@ void renphobike::characteristicChanged(const QLowEnergyCharacteristic &character
         else
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         index += 2;
         debug("Current Speed: " + QString::number(Speed.value()));
     }
@@ -268,7 +269,7 @@ void renphobike::characteristicChanged(const QLowEnergyCharacteristic &character
         index += 3;
     } else {
         Distance += ((Speed.value() / 3600000.0) *
-                     ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
     }
 
     debug("Current Distance: " + QString::number(Distance.value()));
@@ -320,8 +321,7 @@ void renphobike::characteristicChanged(const QLowEnergyCharacteristic &character
                 ((((0.048 * ((double)watts()) + 1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
     }
 
@@ -357,7 +357,7 @@ void renphobike::characteristicChanged(const QLowEnergyCharacteristic &character
         LastCrankEventTime += (uint16_t)(1024.0 / (((double)(Cadence.value())) / 60.0));
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
     if (heartRateBeltName.startsWith("Disabled")) {
         update_hr_from_external();
@@ -553,7 +553,7 @@ void renphobike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &chara
         lastFTMSPacketReceived.append(newValue.at(i));
 
     if (gattWriteCharControlPointId.isValid()) {
-        qDebug() << QStringLiteral("routing FTMS packet to the bike from virtualbike") << characteristic.uuid()
+        QZ_DEBUG << QStringLiteral("routing FTMS packet to the bike from virtualbike") << characteristic.uuid()
                  << newValue.toHex(' ') << lastFTMSPacketReceived.toHex(' ');
 
         // handling watt gain for erg
@@ -572,7 +572,7 @@ void renphobike::ftmsCharacteristicChanged(const QLowEnergyCharacteristic &chara
             lastFTMSPacketReceived.append(FTMS_SET_TARGET_POWER);
             lastFTMSPacketReceived.append(r & 0xFF);
             lastFTMSPacketReceived.append(((r & 0xFF00) >> 8) & 0x00FF);
-            qDebug() << QStringLiteral("sending") << lastFTMSPacketReceived.toHex(' ');
+            QZ_DEBUG << QStringLiteral("sending") << lastFTMSPacketReceived.toHex(' ');
         // handling gears
         } else if (lastFTMSPacketReceived.at(0) == FTMS_SET_INDOOR_BIKE_SIMULATION_PARAMS) {
             qDebug() << "applying gears mod" << gears();
@@ -601,7 +601,7 @@ void renphobike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const
 }
 
 void renphobike::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << "descriptorRead " << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "descriptorRead " << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void renphobike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
@@ -610,7 +610,7 @@ void renphobike::characteristicWritten(const QLowEnergyCharacteristic &character
 }
 
 void renphobike::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << "characteristicRead " << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << "characteristicRead " << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void renphobike::serviceScanDone(void) {
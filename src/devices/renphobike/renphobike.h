@@ -59,7 +59,7 @@ class renphobike : public bike {
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     uint8_t firstStateChanged = 0;
     QByteArray lastFTMSPacketReceived;
     resistance_t lastRequestResistance = -1;
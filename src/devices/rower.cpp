@@ -3,15 +3,27 @@
 #include "qdebugfixup.h"
 #include <QSettings>
 
-rower::rower() {}
+rower::rower() {
+    // speed, power and resistance all end up on the resistance of the rower
+    controlArbiter()->share(controlarbiter::SPEED, controlarbiter::RESISTANCE);
+    controlArbiter()->share(controlarbiter::POWER, controlarbiter::RESISTANCE);
+    controlArbiter()->setMinInterval(controlarbiter::SPEED, 500);
+    controlArbiter()->setMinInterval(controlarbiter::POWER, 500);
+    controlArbiter()->setTolerance(controlarbiter::SPEED, 0.05);
+    controlArbiter()->setTolerance(controlarbiter::POWER, 1);
+}
 
 void rower::changeSpeed(double speed) {
+    if (!arbitrateControl(controlarbiter::SPEED, speed))
+        return;
     qDebug() << "changeSpeed" << speed;
     RequestedSpeed = speed;
     if (autoResistanceEnable)
         requestSpeed = speed;
 }
 void rower::changeResistance(resistance_t resistance) {
+    if (!arbitrateControl(controlarbiter::RESISTANCE, resistance))
+        return;
     lastRawRequestedResistanceValue = resistance;
     if (autoResistanceEnable) {
         requestResistance = (resistance * m_difficult) + gears();;
@@ -27,13 +39,20 @@ void rower::setGears(double gears) {
     m_gears = gears;
     settings.setValue(QZSettings::gears_current_value, m_gears);
     if (lastRawRequestedResistanceValue != -1) {
+        controlarbiter::scope internal(controlarbiter::INTERNAL);
         changeResistance(lastRawRequestedResistanceValue);
     }
 }
 
-void rower::changeRequestedPelotonResistance(int8_t resistance) { RequestedPelotonResistance = resistance; }
+void rower::changeRequestedPelotonResistance(int8_t resistance) {
+    if (!controlAllowed(controlarbiter::RESISTANCE))
+        return;
+    RequestedPelotonResistance = resistance;
+}
 void rower::changeCadence(int16_t cadence) { RequestedCadence = cadence; }
 void rower::changePower(int32_t power) {
+    if (!arbitrateControl(controlarbiter::POWER, power))
+        return;
     RequestedPower = power;
     qDebug() << "rower::changePower" << power;
 }
@@ -58,6 +77,13 @@ double rower::requestedSpeed() { return requestSpeed; }
 
 bluetoothdevice::BLUETOOTH_TYPE rower::deviceType() { return bluetoothdevice::ROWING; }
 
+void rower::applyControl(controlarbiter::TARGET target, double value, double extra) {
+    if (target == controlarbiter::SPEED)
+        changeSpeed(value);
+    else
+        bluetoothdevice::applyControl(target, value, extra);
+}
+
 void rower::clearStats() {
 
     moving.clear(true);
@@ -54,6 +54,8 @@ class rower : public bluetoothdevice {
     void resistanceRead(resistance_t resistance);
 
   protected:
+    void applyControl(controlarbiter::TARGET target, double value, double extra) override;
+
     metric Resistance;
     metric RequestedResistance;
     metric RequestedPelotonResistance;
@@ -81,7 +81,7 @@ void solef80treadmill::writeCharacteristic(uint8_t *data, uint8_t data_len, QStr
     }
 
     if (!disable_log)
-        qDebug() << " >> " << writeBuffer->toHex(' ') << " // " << info;
+        QZ_DEBUG << " >> " << writeBuffer->toHex(' ') << " // " << info;
 
     loop.exec();
 }
@@ -320,7 +320,7 @@ void solef80treadmill::update() {
         do {
             if (requestSpeed != -1) {
                 if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                    emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed) + " " + QString::number(max_speed_loop));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed) + " " + QString::number(max_speed_loop));
                     forceSpeed(requestSpeed);
                 }
                 // i have to do the reset on when the speed is equal to the current
@@ -339,7 +339,7 @@ void solef80treadmill::update() {
                 // this treadmill has only 1% step inclination
                 if ((int)requestInclination != (int)currentInclination().value() && requestInclination >= 0 &&
                     requestInclination <= 15) {
-                    emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination) + " " + QString::number(max_inclination_loop));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination) + " " + QString::number(max_inclination_loop));
                     forceIncline(requestInclination);
                 } else if ((int)requestInclination == (int)currentInclination().value()) {
                     qDebug() << "int inclination match the current one" << requestInclination
@@ -352,7 +352,7 @@ void solef80treadmill::update() {
         } while (requestInclination != -100 && sole_treadmill_inclination_fast && max_inclination_loop);
 
         if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             if (lastSpeed == 0.0) {
 
                 lastSpeed = 0.5;
@@ -371,7 +371,7 @@ void solef80treadmill::update() {
             emit tapeStarted();
         }
         if (requestStop != -1) {
-            emit debug(QStringLiteral("stopping..."));
+            QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
 
             if(treadmill_type == F63) {
                 uint8_t stop[] = {0x5b, 0x02, 0xf1, 0x06, 0x5d};
@@ -404,12 +404,12 @@ void solef80treadmill::update() {
             requestStop = -1;
         }
         if (requestIncreaseFan != -1) {
-            emit debug(QStringLiteral("increasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed + 1);
             requestIncreaseFan = -1;
         } else if (requestDecreaseFan != -1) {
-            emit debug(QStringLiteral("decreasing fan speed..."));
+            QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
 
             // sendChangeFanSpeed(FanSpeed - 1);
             requestDecreaseFan = -1;
@@ -481,11 +481,12 @@ void solef80treadmill::forceIncline(double requestIncline) {
 }
 
 void solef80treadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
+    markIngress();
     double heart = 0; // NOTE : Should be initialized with a value to shut clang-analyzer's
                       // UndefinedBinaryOperatorResult
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
@@ -499,8 +500,8 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
     bool f63 = settings.value(QZSettings::sole_treadmill_f63, QZSettings::default_sole_treadmill_f63).toBool();
     bool tt8 = settings.value(QZSettings::sole_treadmill_tt8, QZSettings::default_sole_treadmill_tt8).toBool();
 
-    emit debug(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
-               " " + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + characteristic.uuid().toString() + " " + QString::number(newValue.length()) +
+                  " " + newValue.toHex(' '));
 
     if (characteristic.uuid() == _gattNotifyCharId) {
         emit packetReceived();
@@ -509,7 +510,7 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         if (paused) {
             qDebug() << "solef80treadmill inclination mode paused on, resetting timer...";
             Speed = 0;
-            lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+            lastRefreshCharacteristicChangedNs = qzclock::nowNs();
         }
     }
 
@@ -521,19 +522,21 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             miles = 1.60934;
 
         QDateTime now = QDateTime::currentDateTime();
+        qint64 nowNs = qzclock::nowNs();
 
         Speed = ((double)((uint8_t)newValue.at(10)) / 10.0) * miles;
-        emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
 
         Inclination = (double)((uint8_t)newValue.at(11));
-        emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
 
         if (!disable_hr_frommachinery) {
             heart = (double)((uint8_t)newValue.at(9));
-            emit debug(QStringLiteral("Current Heart: ") + QString::number(heart));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(heart));
         }
 
-        Distance += ((Speed.value() / 3600000.0) * ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+        Distance += ((Speed.value() / 3600000.0) *
+                     ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
 
         if (watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat()))
             KCal +=
@@ -541,12 +544,11 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                          // kg * 3.5) / 200 ) / 60
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
-        lastRefreshCharacteristicChanged = now;
+        lastRefreshCharacteristicChangedNs = nowNs;
 
     } else if ((characteristic.uuid() == _gattNotifyCharId && newValue.length() == 5 && newValue.at(0) == 0x5b &&
                 newValue.at(1) == 0x02 && newValue.at(2) == 0x03) &&
@@ -592,7 +594,7 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                     100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed) {
@@ -601,10 +603,10 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
-        QDateTime now = QDateTime::currentDateTime();
+        qint64 nowNs = qzclock::nowNs();
         if (Flags.totalDistance) {
             // ignoring the distance, because it's a total life odometer
             // Distance = ((double)((((uint32_t)((uint8_t)newValue.at(index + 2)) << 16) |
@@ -614,17 +616,17 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
         // else
         {
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCharacteristicChanged.msecsTo(now)));
+                         ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)));
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.inclination) {
             Inclination = ((double)(((uint16_t)((uint8_t)newValue.at(index + 1)) << 8) |
                                     (uint16_t)((uint8_t)newValue.at(index)))) /
                           10.0;
             index += 4; // the ramo value is useless
-            emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
         }
 
         if (Flags.elevation) {
@@ -658,12 +660,11 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                             // kg * 3.5) / 200 ) / 60
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
 #ifdef Q_OS_ANDROID
         if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -675,9 +676,9 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 if (index < newValue.length()) {
 
                     heart = ((double)(((uint8_t)newValue.at(index))));
-                    emit debug(QStringLiteral("Current Heart: ") + QString::number(heart));
+                    QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(heart));
                 } else {
-                    emit debug(QStringLiteral("Error on parsing heart!"));
+                    QZ_EMIT_DEBUG(QStringLiteral("Error on parsing heart!"));
                 }
                 // index += 1; //NOTE: clang-analyzer-deadcode.DeadStores
             }
@@ -699,7 +700,7 @@ void solef80treadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
             // todo
         }
 
-        lastRefreshCharacteristicChanged = now;
+        lastRefreshCharacteristicChangedNs = nowNs;
     }
 
     if (heartRateBeltName.startsWith(QStringLiteral("Disabled"))) {
@@ -725,7 +726,7 @@ void solef80treadmill::stateChanged(QLowEnergyService::ServiceState state) {
         settings.value(QZSettings::sole_treadmill_inclination, QZSettings::default_sole_treadmill_inclination).toBool();
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -815,7 +816,7 @@ void solef80treadmill::stateChanged(QLowEnergyService::ServiceState state) {
         bool virtual_device_enabled =
             settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
         if (virtual_device_enabled) {
-            emit debug(QStringLiteral("creating virtual treadmill interface..."));
+            QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
 
             auto virtualTreadmill = new virtualtreadmill(this, noHeartService);
             connect(virtualTreadmill, &virtualtreadmill::debug, this, &solef80treadmill::debug);
@@ -835,28 +836,28 @@ void solef80treadmill::changeInclinationRequested(double grade, double percentag
 }
 
 void solef80treadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void solef80treadmill::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void solef80treadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void solef80treadmill::characteristicRead(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void solef80treadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     initRequest = false;
     firstStateChanged = 0;
@@ -872,21 +873,21 @@ void solef80treadmill::serviceScanDone(void) {
 void solef80treadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("solef80treadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("solef80treadmill::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void solef80treadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("solef80treadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("solef80treadmill::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void solef80treadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
     QSettings settings;
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -911,17 +912,17 @@ void solef80treadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
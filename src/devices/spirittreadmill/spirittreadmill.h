@@ -52,7 +52,7 @@ class spirittreadmill : public treadmill {
 
     uint8_t firstVirtualTreadmill = 0;
     bool firstCharChanged = true;
-    QTime lastTimeCharChanged;
+    qint64 lastTimeCharChangedNs = qzclock::nowNs();
     uint8_t sec1update = 0;
     QByteArray lastPacket;
     uint8_t counterPoll = 0;
@@ -46,13 +46,13 @@ void sportsplusbike::writeCharacteristic(uint8_t *data, uint8_t data_len, const
     gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + " // " + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + " // " + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
@@ -116,11 +116,12 @@ void sportsplusbike::update() {
 }
 
 void sportsplusbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
@@ -129,7 +130,7 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     emit packetReceived();
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     lastPacket = newValue;
     if (newValue.length() != 12) {
@@ -144,15 +145,15 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
         if (newValue.at(1) == 0x20) {
             double speed = GetSpeedFromPacket(newValue);
             if (!firstCharChanged) {
-                Distance += ((speed / 3600.0) / (1000.0 / (lastTimeCharChanged.msecsTo(now))));
+                Distance += ((speed / 3600.0) / (1000.0 / (qzclock::msecsBetween(lastTimeCharChangedNs, nowNs))));
             }            
             cadence = (speed * 10.0) + 12.0;
             cadence_eval = true;
 
-            lastTimeCharChanged = now;
+            lastTimeCharChangedNs = nowNs;
         } else if (newValue.at(1) == 0x30) {
             double watt = GetWattFromPacket(newValue);
-            emit debug(QStringLiteral("Current watt: ") + QString::number(watt));
+            QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(watt));
 
             if (settings.value(QZSettings::power_sensor_name, QZSettings::default_power_sensor_name)
                     .toString()
@@ -160,8 +161,8 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
                 m_watt = watt;
             Speed = metric::calculateSpeedFromPower(
                 watt, Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
-            emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
+            QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
             // lastTimeWattChanged = QTime::currentTime();
         }
 
@@ -173,7 +174,7 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
                 .startsWith(QStringLiteral("Disabled"))) {
             m_watt = wattsFromResistance(currentResistance().value());
         }
-        emit debug(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
 
         if (newValue.at(1) == 0x30) {
             if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
@@ -194,22 +195,21 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
         } else {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
-        emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
 
         if (!firstCharChanged) {
             Distance +=
-                ((Speed.value() / 3600.0) / (1000.0 / (lastTimeCharChanged.msecsTo(now))));
+                ((Speed.value() / 3600.0) / (1000.0 / (qzclock::msecsBetween(lastTimeCharChangedNs, nowNs))));
         }
 
-        lastTimeCharChanged = now;
+        lastTimeCharChangedNs = nowNs;
         kcal +=
             ((((0.048 * ((double)watts()) + 1.19) *
                settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
               200.0) /
-             (60000.0 / ((double)lastRefreshCharacteristicChanged.msecsTo(
-                            now)))); //(( (0.048* Output in watts +1.19) * body weight in kg
+             (60000.0 / ((double)qzclock::msecsBetween(lastRefreshCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in kg
                                                               //* 3.5) / 200 ) / 60
     } else {
         if (settings.value(QZSettings::power_sensor_name, QZSettings::default_power_sensor_name)
@@ -220,28 +220,28 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
             watt += (((hexint & 0xF0) >> 4) * 10) + (hexint & 0x0F);
             m_watt = watt;
         }
-        emit debug(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
 
         double speed = GetSpeedFromPacket(newValue);
         cadence = speed * 2.685185;
         cadence_eval = true;
         if (!firstCharChanged) {
-            Distance += ((speed / 3600.0) / (1000.0 / (lastTimeCharChanged.msecsTo(now))));
+            Distance += ((speed / 3600.0) / (1000.0 / (qzclock::msecsBetween(lastTimeCharChangedNs, nowNs))));
         }
-        emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
+        QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
 
         if (!settings.value(QZSettings::speed_power_based, QZSettings::default_speed_power_based).toBool()) {
             Speed = speed;
         } else {
             Speed = metric::calculateSpeedFromPower(
                 watts(), Inclination.value(), Speed.value(),
-                fabs(now.msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+                qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
         }
-        lastTimeCharChanged = now;
+        lastTimeCharChangedNs = nowNs;
         kcal = GetKcalFromPacket(newValue);
     }
 
-    lastRefreshCharacteristicChanged = now;
+    lastRefreshCharacteristicChangedNs = nowNs;
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -255,11 +255,11 @@ void sportsplusbike::characteristicChanged(const QLowEnergyCharacteristic &chara
     }
     FanSpeed = 0;
 
-    emit debug(QStringLiteral("Current cadence: ") + QString::number(cadence));
+    QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(cadence));
     // emit debug(QStringLiteral("Current resistance: ") + QString::number(resistance));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(kcal));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(kcal));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -335,12 +335,12 @@ void sportsplusbike::btinit(bool startTape) {
 
 void sportsplusbike::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if (state == QLowEnergyService::ServiceDiscovered) {
         auto characteristics_list = gattCommunicationChannelService->characteristics();
         for (const QLowEnergyCharacteristic &c : qAsConst(characteristics_list)) {
-            emit debug(QStringLiteral("characteristic ") + c.uuid().toString());
+            QZ_EMIT_DEBUG(QStringLiteral("characteristic ") + c.uuid().toString());
         }
 
         //        QString uuidWrite = "0000fff2-0000-1000-8000-00805f9b34fb";
@@ -378,7 +378,7 @@ void sportsplusbike::stateChanged(QLowEnergyService::ServiceState state) {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual bike interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
                 auto virtualBike = new virtualbike(this, noWriteResistance, noHeartService);
                 // connect(virtualBike,&virtualbike::debug ,this,&sportsplusbike::debug);
                 connect(virtualBike, &virtualbike::changeInclination, this, &sportsplusbike::changeInclination);
@@ -413,7 +413,7 @@ void sportsplusbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void sportsplusbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -421,11 +421,11 @@ void sportsplusbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, c
 
 void sportsplusbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void sportsplusbike::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     // QString uuid = "0000fff0-0000-1000-8000-00805f9b34fb";
 
@@ -443,19 +443,19 @@ void sportsplusbike::serviceScanDone(void) {
 
 void sportsplusbike::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("sportsplusbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("sportsplusbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void sportsplusbike::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("sportsplusbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("sportsplusbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void sportsplusbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
         if ((bluetoothDevice.name().toUpper().contains(QStringLiteral("CARE")) &&
@@ -477,17 +477,17 @@ void sportsplusbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
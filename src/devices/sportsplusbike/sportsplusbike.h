@@ -52,14 +52,14 @@ class sportsplusbike : public bike {
 
     QTimer *refresh;
 
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
 
     bool noWriteResistance = false;
     bool noHeartService = false;
 
     uint8_t firstVirtualBike = 0;
     bool firstCharChanged = true;
-    QDateTime lastTimeCharChanged;
+    qint64 lastTimeCharChangedNs = qzclock::nowNs();
     uint8_t sec1update = 0;
     QByteArray lastPacket;
 
@@ -62,7 +62,7 @@ class sportstechelliptical : public elliptical {
 
     uint8_t firstVirtualelliptical = 0;
     bool firstCharChanged = true;
-    QTime lastTimeCharChanged;
+    qint64 lastTimeCharChangedNs = qzclock::nowNs();
     uint8_t sec1update = 0;
     QByteArray lastPacket;
 
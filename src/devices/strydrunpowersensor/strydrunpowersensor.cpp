@@ -95,12 +95,13 @@ void strydrunpowersensor::update() {
 }
 
 void strydrunpowersensor::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
-    qDebug() << "<<" << characteristic.uuid() << newValue.toHex(' ') << newValue.length();
+    markIngress();
+    QZ_DEBUG << "<<" << characteristic.uuid() << newValue.toHex(' ') << newValue.length();
     Q_UNUSED(characteristic);
     QSettings settings;
     bool power_as_treadmill =
@@ -125,7 +126,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
         }
 
         emit powerChanged(m_watt.value());
-        emit debug(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
 
         if ((flags & 0x1) == 0x01) // Pedal Power Balance Present
         {
@@ -156,16 +157,16 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
             KCal += ((((0.048 * ((double)watts()) + 1.19) *
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
-                     (60000.0 / ((double)lastRefreshPowerChanged.msecsTo(QDateTime::currentDateTime()))));
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-        lastRefreshPowerChanged = QDateTime::currentDateTime();
+                     (60000.0 / ((double)qzclock::msecsSince(lastRefreshPowerChangedNs))));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        lastRefreshPowerChangedNs = qzclock::nowNs();
     } else if (characteristic.uuid() == QBluetoothUuid::HeartRateMeasurement) {
         if (newValue.length() > 1) {
             Heart = (uint8_t)newValue[1];
             emit onHeartRate((uint8_t)Heart.value());
         }
 
-        emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
     } else if (characteristic.uuid() == QBluetoothUuid((quint16)0x2ACD)) {
         lastPacket = newValue;
 
@@ -203,7 +204,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
                               (uint16_t)((uint8_t)newValue.at(index)))) /
                     100.0;*/
             index += 2;
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
 
         if (Flags.avgSpeed) {
@@ -212,7 +213,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
                                  (uint16_t)((uint8_t)newValue.at(index)))) /
                        100.0;
             index += 2;
-            emit debug(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Average Speed: ") + QString::number(avgSpeed));
         }
 
         if (Flags.totalDistance) {
@@ -226,11 +227,11 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
             /*
             if (firstDistanceCalculated)
                 Distance += ((Speed.value() / 3600000.0) *
-                             ((double)lastRefreshCharacteristicChanged.msecsTo(QDateTime::currentDateTime())));
+                             ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)));
             distanceEval = true;*/
         }
 
-        emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
 
         if (Flags.inclination) {
             double inc =
@@ -240,7 +241,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
             inc = qRound(inc * 2.0) / 2.0;
             Inclination = treadmillInclinationOverride(inc);
             index += 4; // the ramo value is useless
-            emit debug(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Inclination: ") + QString::number(Inclination.value()));
         }
 
         if (Flags.elevation) {
@@ -276,22 +277,21 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
                        settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                       200.0) /
                      (60000.0 /
-                      ((double)lastRefreshCharacteristicChanged.msecsTo(
-                          QDateTime::currentDateTime())))); //(( (0.048* Output in watts +1.19) * body weight in
+                      ((double)qzclock::msecsSince(lastRefreshCharacteristicChangedNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                     // kg * 3.5) / 200 ) / 60
             distanceEval = true;
 */
         }
 
-        emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
 
         if (Flags.heartRate) {
             if (index < newValue.length()) {
 
                 double heart = ((double)(((uint8_t)newValue.at(index))));
-                emit debug(QStringLiteral("Current Heart: ") + QString::number(heart));
+                QZ_EMIT_DEBUG(QStringLiteral("Current Heart: ") + QString::number(heart));
             } else {
-                emit debug(QStringLiteral("Error on parsing heart!"));
+                QZ_EMIT_DEBUG(QStringLiteral("Error on parsing heart!"));
             }
             // index += 1; //NOTE: clang-analyzer-deadcode.DeadStores
         }
@@ -354,17 +354,17 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
 
             emit speedChanged(speed);
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCadenceChanged.msecsTo(QDateTime::currentDateTime())));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(speed));
+                         ((double)qzclock::msecsSince(lastRefreshCadenceChangedNs)));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(speed));
             if (powerReceived == false) {
                 m_watt = wattsCalc(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat(),
                                    Speed.value(), Inclination.value());
-                emit debug(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
+                QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(m_watt.value()));
             }
         }
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(cadence));
-        lastRefreshCadenceChanged = QDateTime::currentDateTime();
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(cadence));
+        lastRefreshCadenceChangedNs = qzclock::nowNs();
     } else if (characteristic.uuid() == QBluetoothUuid::CSCMeasurement) {
         uint8_t index = 1;
         if (newValue.at(0) == 0x02) {
@@ -400,7 +400,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
             Cadence = 0;
         }
         emit cadenceChanged(Cadence.value());
-        emit debug(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
+        QZ_EMIT_DEBUG(QStringLiteral("Current Cadence: ") + QString::number(Cadence.value()));
 
         oldLastCrankEventTime = LastCrankEventTime;
         oldCrankRevs = CrankRevs;
@@ -412,11 +412,11 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
 
             emit speedChanged(Speed.value());
             Distance += ((Speed.value() / 3600000.0) *
-                         ((double)lastRefreshCadenceChanged.msecsTo(QDateTime::currentDateTime())));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
-            emit debug(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
+                         ((double)qzclock::msecsSince(lastRefreshCadenceChangedNs)));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Speed: ") + QString::number(Speed.value()));
         }
-        lastRefreshCadenceChanged = QDateTime::currentDateTime();
+        lastRefreshCadenceChangedNs = qzclock::nowNs();
 
     } else if (characteristic.uuid() == QBluetoothUuid(QStringLiteral("0000ff00-0000-1000-8000-00805f9b34fb"))) {
         if (newValue.length() == 5 && newValue.at(0) == 0x0f) {
@@ -474,7 +474,7 @@ void strydrunpowersensor::characteristicChanged(const QLowEnergyCharacteristic &
 
 void strydrunpowersensor::stateChanged(QLowEnergyService::ServiceState state) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     for (QLowEnergyService *s : qAsConst(gattCommunicationChannelService)) {
         qDebug() << QStringLiteral("stateChanged") << s->serviceUuid() << s->state();
@@ -592,29 +592,29 @@ void strydrunpowersensor::changeInclinationRequested(double grade, double percen
 }
 
 void strydrunpowersensor::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
 }
 
 void strydrunpowersensor::descriptorRead(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    qDebug() << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("descriptorRead ") << descriptor.name() << descriptor.uuid() << newValue.toHex(' ');
 }
 
 void strydrunpowersensor::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                                 const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void strydrunpowersensor::characteristicRead(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
+    QZ_DEBUG << QStringLiteral("characteristicRead ") << characteristic.uuid() << newValue.toHex(' ');
 }
 
 void strydrunpowersensor::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     auto services_list = m_control->services();
     for (const QBluetoothUuid &s : qAsConst(services_list)) {
@@ -627,19 +627,19 @@ void strydrunpowersensor::serviceScanDone(void) {
 
 void strydrunpowersensor::errorService(QLowEnergyService::ServiceError err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("strydrunpowersensor::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("strydrunpowersensor::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void strydrunpowersensor::error(QLowEnergyController::Error err) {
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("strydrunpowersensor::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("strydrunpowersensor::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void strydrunpowersensor::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     {
         bluetoothDevice = device;
 
@@ -656,17 +656,17 @@ void strydrunpowersensor::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
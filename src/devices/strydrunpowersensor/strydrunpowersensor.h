@@ -52,8 +52,8 @@ class strydrunpowersensor : public treadmill {
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCadenceChanged = QDateTime::currentDateTime();
-    QDateTime lastRefreshPowerChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCadenceChangedNs = qzclock::nowNs();
+    qint64 lastRefreshPowerChangedNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
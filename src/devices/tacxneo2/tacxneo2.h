@@ -61,9 +61,9 @@ class tacxneo2 : public bike {
 
     uint8_t sec1Update = 0;
     QByteArray lastPacket;
-    QDateTime lastRefreshCharacteristicChanged2A5B = QDateTime::currentDateTime();
-    QDateTime lastRefreshCharacteristicChanged2AD2 = QDateTime::currentDateTime();
-    QDateTime lastRefreshCharacteristicChangedPower = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChanged2A5BNs = qzclock::nowNs();
+    qint64 lastRefreshCharacteristicChanged2AD2Ns = qzclock::nowNs();
+    qint64 lastRefreshCharacteristicChangedPowerNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
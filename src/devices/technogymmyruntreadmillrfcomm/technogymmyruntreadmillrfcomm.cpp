@@ -18,8 +18,8 @@ technogymmyruntreadmillrfcomm::technogymmyruntreadmillrfcomm() {
 }
 
 void technogymmyruntreadmillrfcomm::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     // if (device.name().startsWith(QStringLiteral("TRX ROUTE KEY")))
     {
         bluetoothDevice = device;
@@ -60,14 +60,14 @@ void technogymmyruntreadmillrfcomm::serviceFinished(void) {
         socket->setPreferredSecurityFlags(QBluetooth::NoSecurity);
 #endif
 
-        emit debug(QStringLiteral("Create socket"));
+        QZ_EMIT_DEBUG(QStringLiteral("Create socket"));
         if(!found) {
             qDebug() << QStringLiteral("technogymmyruntreadmillrfcomm::serviceFinished, no service found, trying workaround");
             socket->connectToService(bluetoothDevice.address(), QBluetoothUuid(QBluetoothUuid::SerialPort));
         } else {
             socket->connectToService(serialPortService);
         }
-        emit debug(QStringLiteral("ConnectToService done"));
+        QZ_EMIT_DEBUG(QStringLiteral("ConnectToService done"));
     }
 }
 
@@ -85,14 +85,14 @@ void technogymmyruntreadmillrfcomm::serviceDiscovered(const QBluetoothServiceInf
 
     qDebug() << QStringLiteral("technogymmyruntreadmillrfcomm::serviceDiscovered") << service;
     if (service.device().address() == bluetoothDevice.address()) {
-        emit debug(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
-                   service.serviceUuid().toString() + ')');
+        QZ_EMIT_DEBUG(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
+                      service.serviceUuid().toString() + ')');
 
         if (service.serviceName().startsWith(QStringLiteral("SerialPort")) ||
             service.serviceName().startsWith(QStringLiteral("Serial Port"))) {
             serialPortService = service;
             found = true;
-            emit debug(QStringLiteral("Serial port service found"));
+            QZ_EMIT_DEBUG(QStringLiteral("Serial port service found"));
             //discoveryAgent->stop();
         }
     }
@@ -113,7 +113,7 @@ void technogymmyruntreadmillrfcomm::update() {
             QSettings settings;
             bool virtual_device_enabled = settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, true);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &technogymmyruntreadmillrfcomm::debug);
                 connect(virtualTreadMill, &virtualtreadmill::changeInclination, this,
@@ -127,7 +127,7 @@ void technogymmyruntreadmillrfcomm::update() {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 20) {
                 QString force =
                     QStringLiteral("!DEV,024,") + QString::number(requestSpeed) + QStringLiteral(",1.8#").toLocal8Bit();
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed) + " " + force);
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed) + " " + force);
                 socket->write(force.toLocal8Bit());
             }
             requestSpeed = -1;
@@ -138,12 +138,12 @@ void technogymmyruntreadmillrfcomm::update() {
                 requestInclination <= 12) {
                 QString force = QStringLiteral("!DEV,025,") + QString::number(requestInclination) +
                                 QStringLiteral("#").toLocal8Bit();
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination) + " " + force);
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination) + " " + force);
                 socket->write(force.toLocal8Bit());
             }
             requestInclination = -100;
         } else if (requestStart != -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             /*
             const uint8_t start[] = {0x55, 0x17, 0x01, 0x01, 0x55, 0xb5, 0x01, 0xff};
             socket->write((char *)start, sizeof(start));
@@ -154,7 +154,7 @@ void technogymmyruntreadmillrfcomm::update() {
             /*
             const char poll[] = {0x55, 0x17, 0x01, 0x01};
             socket->write(poll, sizeof(poll));
-            emit debug(QStringLiteral("write poll"));
+            QZ_EMIT_DEBUG(QStringLiteral("write poll"));
             */
         }
 
@@ -163,7 +163,7 @@ void technogymmyruntreadmillrfcomm::update() {
 }
 
 void technogymmyruntreadmillrfcomm::rfCommConnected() {
-    emit debug(QStringLiteral("connected ") + socket->peerName());
+    QZ_EMIT_DEBUG(QStringLiteral("connected ") + socket->peerName());
 
     socket->write(QStringLiteral("@FWVER#").toLocal8Bit());
     qDebug() << QStringLiteral(" init1 write");
@@ -224,12 +224,12 @@ void technogymmyruntreadmillrfcomm::readSocket() {
             Inclination = values.at(3).toDouble();
 
             qDebug() << values;
-            emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
-            emit debug(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
         }
     }
 }
 
 void technogymmyruntreadmillrfcomm::onSocketErrorOccurred(QBluetoothSocket::SocketError error) {
-    emit debug(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
+    QZ_EMIT_DEBUG(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
 }
@@ -18,8 +18,8 @@ toorxtreadmill::toorxtreadmill() {
 }
 
 void toorxtreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     /*if (device.name().startsWith(QStringLiteral("TRX ROUTE KEY")) ||
         device.name().toUpper().startsWith(QStringLiteral("BH-TR-")))*/ {
         bluetoothDevice = device;
@@ -46,12 +46,12 @@ void toorxtreadmill::serviceDiscovered(const QBluetoothServiceInfo &service) {
 
     qDebug() << QStringLiteral("toorxtreadmill::serviceDiscovered") << service;
     if (service.device().address() == bluetoothDevice.address()) {
-        emit debug(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
-                   service.serviceUuid().toString() + ')');
+        QZ_EMIT_DEBUG(QStringLiteral("Found new service: ") + service.serviceName() + '(' +
+                      service.serviceUuid().toString() + ')');
 
         if (service.serviceName().startsWith(QStringLiteral("SerialPort")) ||
             service.serviceName().startsWith(QStringLiteral("Serial Port"))) {
-            emit debug(QStringLiteral("Serial port service found"));
+            QZ_EMIT_DEBUG(QStringLiteral("Serial port service found"));
             discoveryAgent->stop();
 
             serialPortService = service;
@@ -67,9 +67,9 @@ void toorxtreadmill::serviceDiscovered(const QBluetoothServiceInfo &service) {
             socket->setPreferredSecurityFlags(QBluetooth::NoSecurity);
 #endif
 
-            emit debug(QStringLiteral("Create socket"));
+            QZ_EMIT_DEBUG(QStringLiteral("Create socket"));
             socket->connectToService(serialPortService);
-            emit debug(QStringLiteral("ConnectToService done"));
+            QZ_EMIT_DEBUG(QStringLiteral("ConnectToService done"));
         }
     }
 }
@@ -85,7 +85,7 @@ void toorxtreadmill::update() {
             QSettings settings;
             bool virtual_device_enabled = settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual treadmill interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual treadmill interface..."));
                 auto virtualTreadMill = new virtualtreadmill(this, true);
                 connect(virtualTreadMill, &virtualtreadmill::debug, this, &toorxtreadmill::debug);
                 this->setVirtualDevice(virtualTreadMill, VIRTUAL_DEVICE_MODE::PRIMARY);
@@ -95,7 +95,7 @@ void toorxtreadmill::update() {
 
         if (requestSpeed != -1) {
             if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 char speed[] = {0x55, 0x0f, 0x02, 0x01, 0x00};
                 speed[3] = (uint8_t)(requestSpeed);
                 speed[4] = (uint8_t)((requestSpeed - (double)((uint8_t)(requestSpeed))) * 100.0);
@@ -107,14 +107,14 @@ void toorxtreadmill::update() {
                 requestInclination = 0;
             if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                 requestInclination <= 15) {
-                emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 uint8_t incline[] = {0x55, 0x0a, 0x01, 0x01};
                 incline[3] = requestInclination;
                 socket->write((char *)incline, sizeof(incline));
             }
             requestInclination = -100;
         } else if (requestStart != -1 && start_phase == -1) {
-            emit debug(QStringLiteral("starting..."));
+            QZ_EMIT_DEBUG(QStringLiteral("starting..."));
             const uint8_t start[] = {0x55, 0x17, 0x01, 0x01, 0x55, 0xb5, 0x01, 0xff};
             socket->write((char *)start, sizeof(start));
             start_phase = 0;
@@ -258,7 +258,7 @@ void toorxtreadmill::update() {
         } else {
             const char poll[] = {0x55, 0x17, 0x01, 0x01};
             socket->write(poll, sizeof(poll));
-            emit debug(QStringLiteral("write poll"));
+            QZ_EMIT_DEBUG(QStringLiteral("write poll"));
         }
 
         update_metrics(true, watts(settings.value(QZSettings::weight, QZSettings::default_weight).toFloat()));
@@ -266,7 +266,7 @@ void toorxtreadmill::update() {
 }
 
 void toorxtreadmill::rfCommConnected() {
-    emit debug(QStringLiteral("connected ") + socket->peerName());
+    QZ_EMIT_DEBUG(QStringLiteral("connected ") + socket->peerName());
 
     const uint8_t init1[] = {0x55, 0x0c, 0x01, 0xff, 0x55, 0xbb, 0x01, 0xff, 0x55, 0x24, 0x01, 0xff};
     const uint8_t init2[] = {0x55, 0x25, 0x01, 0xff, 0x55, 0x26, 0x01, 0xff, 0x55, 0x27, 0x01, 0xff, 0x55, 0x02,
@@ -292,7 +292,7 @@ void toorxtreadmill::readSocket() {
 
     while (socket->bytesAvailable()) {
         QByteArray line = socket->readAll();
-        qDebug() << QStringLiteral(" << ") + line.toHex(' ');
+        QZ_DEBUG << QStringLiteral(" << ") + line.toHex(' ');
 
         if (line.length() == 17) {
             elapsed = GetElapsedTimeFromPacket(line);
@@ -302,11 +302,11 @@ void toorxtreadmill::readSocket() {
             Inclination = GetInclinationFromPacket(line);
             Heart = GetHeartRateFromPacket(line);
 
-            emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
-            emit debug(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
-            emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-            emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-            emit debug(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(Inclination.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+            QZ_EMIT_DEBUG(QStringLiteral("Current Distance: ") + QString::number(Distance.value()));
         }
     }
 }
@@ -336,5 +336,5 @@ uint16_t toorxtreadmill::GetElapsedTimeFromPacket(const QByteArray &packet) {
 }
 
 void toorxtreadmill::onSocketErrorOccurred(QBluetoothSocket::SocketError error) {
-    emit debug(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
+    QZ_EMIT_DEBUG(QStringLiteral("onSocketErrorOccurred ") + QString::number(error));
 }
@@ -5,11 +5,23 @@
 #ifdef Q_OS_IOS
 #include "ios/lockscreen.h"
 #endif
+#include "qztrace.h"
 #include <QSettings>
 
-treadmill::treadmill() {}
+treadmill::treadmill() {
+    // power is applied through the speed. The motors need time to reach a target, don't queue them one behind the other
+    controlArbiter()->share(controlarbiter::POWER, controlarbiter::SPEED);
+    controlArbiter()->setMinInterval(controlarbiter::SPEED, 500);
+    controlArbiter()->setMinInterval(controlarbiter::INCLINATION, 1000);
+    controlArbiter()->setMinInterval(controlarbiter::POWER, 1000);
+    controlArbiter()->setTolerance(controlarbiter::SPEED, 0.05);
+    controlArbiter()->setTolerance(controlarbiter::INCLINATION, 0.05);
+    controlArbiter()->setTolerance(controlarbiter::POWER, 1);
+}
 
 void treadmill::changeSpeed(double speed) {
+    if (!arbitrateControl(controlarbiter::SPEED, speed))
+        return;
     QSettings settings;
     bool stryd_speed_instead_treadmill = settings.value(QZSettings::stryd_speed_instead_treadmill, QZSettings::default_stryd_speed_instead_treadmill).toBool();
     m_lastRawSpeedRequested = speed;
@@ -21,11 +33,14 @@ void treadmill::changeSpeed(double speed) {
         speed -= delta;
     }
     qDebug() << "changeSpeed" << speed << autoResistanceEnable << m_difficult << m_difficult_offset << m_lastRawSpeedRequested;
+    QZ_TRACE(qztrace::CONTROL, "changeSpeed", "speed", speed, "auto", autoResistanceEnable);
     RequestedSpeed = (speed * m_difficult) + m_difficult_offset;
     if (autoResistanceEnable)
         requestSpeed = (speed * m_difficult) + m_difficult_offset;
 }
 void treadmill::changeInclination(double grade, double inclination) {
+    if (!arbitrateControl(controlarbiter::INCLINATION, grade, inclination))
+        return;
     QSettings settings;
     double treadmill_incline_min = settings.value(QZSettings::treadmill_incline_min, QZSettings::default_treadmill_incline_min).toDouble();
     double treadmill_incline_max = settings.value(QZSettings::treadmill_incline_max, QZSettings::default_treadmill_incline_max).toDouble();
@@ -42,6 +57,7 @@ void treadmill::changeInclination(double grade, double inclination) {
     Q_UNUSED(inclination);
     qDebug() << "changeInclination" << grade << autoResistanceEnable << m_inclination_difficult
              << m_inclination_difficult_offset;
+    QZ_TRACE(qztrace::CONTROL, "changeInclination", "grade", grade, "auto", autoResistanceEnable);
     RequestedInclination = (grade * m_inclination_difficult) + m_inclination_difficult_offset;
     if (autoResistanceEnable) {
         requestInclination = (grade * m_inclination_difficult) + m_inclination_difficult_offset;
@@ -60,8 +76,9 @@ double treadmill::minStepSpeed() { return 0.5; }
 
 void treadmill::update_metrics(bool watt_calc, const double watts) {
 
-    QDateTime current = QDateTime::currentDateTime();
-    double deltaTime = (((double)_lastTimeUpdate.msecsTo(current)) / ((double)1000.0));
+    qint64 currentNs = qzclock::nowNs();
+    // monotonic: a wall clock change (NTP, DST) must not add or remove elapsed time, distance and energy
+    double deltaTime = ((double)(currentNs - _lastTimeUpdateNs)) / 1e9;
     QSettings settings;
     bool power_as_treadmill =
         settings.value(QZSettings::power_sensor_as_treadmill, QZSettings::default_power_sensor_as_treadmill).toBool();
@@ -104,8 +121,10 @@ void treadmill::update_metrics(bool watt_calc, const double watts) {
     if (currentInclination().value() > 0)
         elevationAcc += (currentSpeed().value() / 3600.0) * 1000.0 * (currentInclination().value() / 100.0) * deltaTime;
 
-    _lastTimeUpdate = current;
+    _lastTimeUpdateNs = currentNs;
     _firstUpdate = false;
+
+    publishMetrics();
 }
 
 uint16_t treadmill::wattsCalc(double weight, double speed, double inclination) {
@@ -410,7 +429,7 @@ double treadmill::treadmillInclinationOverride(double Inclination) {
 }
 
 void treadmill::evaluateStepCount() {
-    StepCount += (Cadence.lastChanged().msecsTo(QDateTime::currentDateTime())) * (Cadence.value() / 60000);
+    StepCount += ((qzclock::nowNs() - Cadence.lastChangedNs()) / 1e6) * (Cadence.value() / 60000);
 }
 
 void treadmill::cadenceFromAppleWatch() {
@@ -510,7 +529,10 @@ double treadmill::runningStressScore() {
 }
 
 void treadmill::changePower(int32_t power) {
+    if (!arbitrateControl(controlarbiter::POWER, power))
+        return;
 
+    QZ_TRACE(qztrace::CONTROL, "changePower", "power", power, "auto", autoResistanceEnable);
     RequestedPower = power; // in order to paint in any case the request power on the charts
 
     if (!autoResistanceEnable) {
@@ -520,6 +542,8 @@ void treadmill::changePower(int32_t power) {
 
     requestPower = power; // used by some bikes that have ERG mode builtin
     QSettings settings;
+    // the speed is the way this request is applied, not a new request
+    controlarbiter::scope internal(controlarbiter::INTERNAL);
     /*
     double erg_filter_upper =
         settings.value(QZSettings::zwift_erg_filter, QZSettings::default_zwift_erg_filter).toDouble();
@@ -587,3 +611,10 @@ void treadmill::changePower(int32_t power) {
 
 metric treadmill::lastRequestedPower() { return RequestedPower; }
 
+void treadmill::applyControl(controlarbiter::TARGET target, double value, double extra) {
+    if (target == controlarbiter::SPEED)
+        changeSpeed(value);
+    else
+        bluetoothdevice::applyControl(target, value, extra);
+}
+
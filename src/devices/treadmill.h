@@ -65,6 +65,8 @@ class treadmill : public bluetoothdevice {
     void tapeStarted();
 
   protected:
+    void applyControl(controlarbiter::TARGET target, double value, double extra) override;
+
     volatile double requestSpeed = -1;
     double targetSpeed = -1;
     double requestInclination = -100;
@@ -91,7 +91,7 @@ void truetreadmill::update() {
         {
             if (requestSpeed != -1) {
                 if (requestSpeed != currentSpeed().value() && requestSpeed >= 0 && requestSpeed <= 22) {
-                    emit debug(QStringLiteral("writing speed ") + QString::number(requestSpeed));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing speed ") + QString::number(requestSpeed));
                 }
                 requestSpeed = -1;
             }
@@ -102,12 +102,12 @@ void truetreadmill::update() {
                 requestInclination = qRound(requestInclination * 2.0) / 2.0;
                 if (requestInclination != currentInclination().value() && requestInclination >= 0 &&
                     requestInclination <= 15) {
-                    emit debug(QStringLiteral("writing incline ") + QString::number(requestInclination));
+                    QZ_EMIT_DEBUG(QStringLiteral("writing incline ") + QString::number(requestInclination));
                 }
                 requestInclination = -100;
             }
             if (requestStart != -1) {
-                emit debug(QStringLiteral("starting..."));
+                QZ_EMIT_DEBUG(QStringLiteral("starting..."));
                 if (lastSpeed == 0.0) {
 
                     lastSpeed = 0.5;
@@ -116,18 +116,18 @@ void truetreadmill::update() {
                 emit tapeStarted();
             }
             if (requestStop != -1) {
-                emit debug(QStringLiteral("stopping..."));
+                QZ_EMIT_DEBUG(QStringLiteral("stopping..."));
                 requestStop = -1;
             }
             if (requestFanSpeed != -1) {
-                emit debug(QStringLiteral("changing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("changing fan speed..."));
                 requestFanSpeed = -1;
             }
             if (requestIncreaseFan != -1) {
-                emit debug(QStringLiteral("increasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("increasing fan speed..."));
                 requestIncreaseFan = -1;
             } else if (requestDecreaseFan != -1) {
-                emit debug(QStringLiteral("decreasing fan speed..."));
+                QZ_EMIT_DEBUG(QStringLiteral("decreasing fan speed..."));
                 requestDecreaseFan = -1;
             }
         }
@@ -135,11 +135,12 @@ void truetreadmill::update() {
 }
 
 void truetreadmill::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
-    QDateTime now = QDateTime::currentDateTime();
+    markIngress();
+    qint64 nowNs = qzclock::nowNs();
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     QSettings settings;
     QString heartRateBeltName =
@@ -149,7 +150,7 @@ void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &charac
     Q_UNUSED(characteristic);
     QByteArray avalue = newValue;
 
-    emit debug(QStringLiteral(" << ") + QString::number(newValue.length()) + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + QString::number(newValue.length()) + QStringLiteral(" ") + newValue.toHex(' '));
 
 #ifdef Q_OS_ANDROID
     if (settings.value(QZSettings::ant_heart, QZSettings::default_ant_heart).toBool())
@@ -184,7 +185,7 @@ void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &charac
                 emit inclinationChanged(0, incline);
             }
             Inclination = incline;
-            emit debug(QStringLiteral("Current incline: ") + QString::number(incline));            
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));            
         } else {
             return;
         }
@@ -206,7 +207,7 @@ void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &charac
                 emit inclinationChanged(0, incline);
             }
             Inclination = incline;
-            emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
 
         } else if (avalue.length() == 19) {
             uint16_t convertedData = (avalue.at(8) << 8) | ((uint8_t)avalue.at(7));
@@ -218,7 +219,7 @@ void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &charac
                 emit inclinationChanged(0, incline);
             }
             Inclination = incline;
-            emit debug(QStringLiteral("Current incline: ") + QString::number(incline));
+            QZ_EMIT_DEBUG(QStringLiteral("Current incline: ") + QString::number(incline));
             return;
         }
     }
@@ -230,18 +231,17 @@ void truetreadmill::characteristicChanged(const QLowEnergyCharacteristic &charac
                     1.19) *
                    settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                   200.0) /
-                 (60000.0 / ((double)lastTimeCharacteristicChanged.msecsTo(
-                                now)))); //(( (0.048* Output in watts +1.19) * body weight in
+                 (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body weight in
                                                                   // kg * 3.5) / 200 ) / 60
         Distance += ((speed / (double)3600.0) /
-                     ((double)1000.0 / (double)(lastTimeCharacteristicChanged.msecsTo(now))));
-        lastTimeCharacteristicChanged = now;
+                     ((double)1000.0 / (double)(qzclock::msecsBetween(lastTimeCharacteristicChangedNs, nowNs))));
+        lastTimeCharacteristicChangedNs = nowNs;
     }
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(speed));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(speed));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
 
     if (m_control->error() != QLowEnergyController::NoError) {
         qDebug() << QStringLiteral("QLowEnergyController ERROR!!") << m_control->errorString();
@@ -266,7 +266,7 @@ void truetreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 
     QBluetoothUuid _gattNotifyCharacteristicId(QStringLiteral("a026e01d-0a7d-4ab3-97fa-f1500f9feb8b"));
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
     if (state == QLowEnergyService::ServiceDiscovered) {
 
         // qDebug() << gattCommunicationChannelService->characteristics();
@@ -294,7 +294,7 @@ void truetreadmill::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void truetreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -302,11 +302,11 @@ void truetreadmill::descriptorWritten(const QLowEnergyDescriptor &descriptor, co
 
 void truetreadmill::characteristicWritten(const QLowEnergyCharacteristic &characteristic, const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void truetreadmill::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
     QBluetoothUuid _gattCommunicationChannelServiceId(QStringLiteral("a026ee07-0a7d-4ab3-97fa-f1500f9feb8b"));
 
     gattCommunicationChannelService = m_control->createServiceObject(_gattCommunicationChannelServiceId);
@@ -317,15 +317,15 @@ void truetreadmill::serviceScanDone(void) {
 void truetreadmill::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("truetreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("truetreadmill::errorService ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void truetreadmill::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("truetreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("truetreadmill::error ") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void truetreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -352,17 +352,17 @@ void truetreadmill::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -55,20 +55,20 @@ void trxappgateusbbike::writeCharacteristic(uint8_t *data, uint8_t data_len, con
         gattCommunicationChannelService->writeCharacteristic(gattWriteCharacteristic, *writeBuffer);
 
     if (!disable_log) {
-        emit debug(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
+        QZ_EMIT_DEBUG(QStringLiteral(" >> ") + writeBuffer->toHex(' ') + QStringLiteral(" // ") + info);
     }
 
     loop.exec();
 
     if (timeout.isActive() == false) {
-        emit debug(QStringLiteral(" exit for timeout"));
+        QZ_EMIT_DEBUG(QStringLiteral(" exit for timeout"));
     }
 }
 
 void trxappgateusbbike::forceResistance(resistance_t requestResistance) {
 
     if (!initDone) {
-        emit debug(QStringLiteral("forceResistance Ignored, init not done yet"));
+        QZ_EMIT_DEBUG(QStringLiteral("forceResistance Ignored, init not done yet"));
         return;
     }
 
@@ -192,7 +192,7 @@ void trxappgateusbbike::update() {
                 requestResistance = 1;
             }
             if (requestResistance != currentResistance().value()) {
-                emit debug(QStringLiteral("writing resistance ") + QString::number(requestResistance));
+                QZ_EMIT_DEBUG(QStringLiteral("writing resistance ") + QString::number(requestResistance));
 
                 forceResistance(requestResistance);
             }
@@ -202,11 +202,12 @@ void trxappgateusbbike::update() {
 }
 
 void trxappgateusbbike::serviceDiscovered(const QBluetoothUuid &gatt) {
-    emit debug(QStringLiteral("serviceDiscovered ") + gatt.toString());
+    QZ_EMIT_DEBUG(QStringLiteral("serviceDiscovered ") + gatt.toString());
 }
 
 void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
+    markIngress();
     double heart = 0;
     // qDebug() << "characteristicChanged" << characteristic.uuid() << newValue << newValue.length();
     Q_UNUSED(characteristic);
@@ -215,7 +216,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
         settings.value(QZSettings::heart_rate_belt_name, QZSettings::default_heart_rate_belt_name).toString();
     emit packetReceived();
 
-    emit debug(QStringLiteral(" << ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral(" << ") + newValue.toHex(' '));
 
     lastPacket = newValue;
     if ((newValue.length() != 21 && (bike_type != JLL_IC400 && bike_type != ASVIVA && bike_type != FYTTER_RI08 &&
@@ -230,7 +231,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
     double speed = 0.0;
     double resistance = 0.0;
     double watt = 0.0;
-    QTime now = QTime::currentTime();
+    qint64 nowNs = qzclock::nowNs();
     if (bike_type == FYTTER_RI08) {
         speed = cadence * 0.37407407407407407407407407407407;
         watt = GetWattFromPacketFytter(newValue);
@@ -238,8 +239,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
             KCal += ((((0.048 * ((double)watts()) + 1.19) *
                                      settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                                     200.0) /
-                                   (60000.0 / ((double)lastTimeCharChanged.msecsTo(
-                                                  now)))); //(( (0.048* Output in watts +1.19) *
+                                   (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) *
                                                                             // body weight in kg * 3.5) / 200 ) / 60
     } else if (bike_type == TUNTURI || bike_type == TUNTURI_2) {
         speed = cadence * 0.37407407407407407407407407407407;
@@ -249,8 +249,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
             KCal += ((((0.048 * ((double)watts()) + 1.19) *
                                      settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                                     200.0) /
-                                   (60000.0 / ((double)lastTimeCharChanged.msecsTo(
-                                                  now)))); //(( (0.048* Output in watts +1.19) *
+                                   (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) *
                                                                             // body weight in kg * 3.5) / 200 ) / 60
     } else if (bike_type != JLL_IC400 && bike_type != ASVIVA) {
 
@@ -264,8 +263,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
                 KCal += ((((0.048 * ((double)watts()) + 1.19) *
                                       settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                                      200.0) /
-                                    (60000.0 / ((double)lastTimeCharChanged.msecsTo(
-                                                   now)))); //(( (0.048* Output in watts +1.19) * body
+                                    (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) * body
                                                                              // weight in kg * 3.5) / 200 ) / 60
         }
     } else {
@@ -278,8 +276,7 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
                 KCal += ((((0.048 * ((double)watt) + 1.19) *
                                       settings.value(QZSettings::weight, QZSettings::default_weight).toFloat() * 3.5) /
                                      200.0) /
-                                    (60000.0 / ((double)lastTimeCharChanged.msecsTo(
-                                                   now)))); //(( (0.048* Output in watts +1.19) *
+                                    (60000.0 / ((double)qzclock::msecsBetween(lastTimeCharChangedNs, nowNs)))); //(( (0.048* Output in watts +1.19) *
                                                                              // body weight in kg * 3.5) / 200 ) / 60
         }
     }
@@ -327,10 +324,10 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
     } else {
         Speed = metric::calculateSpeedFromPower(
             watts(), Inclination.value(), Speed.value(),
-            fabs(QDateTime::currentDateTime().msecsTo(Speed.lastChanged()) / 1000.0), this->speedLimit());
+            qzclock::secondsSince(Speed.lastChangedNs()), this->speedLimit());
     }
     if (!firstCharChanged) {
-        Distance += ((Speed.value() / 3600.0) / (1000.0 / (lastTimeCharChanged.msecsTo(now))));
+        Distance += ((Speed.value() / 3600.0) / (1000.0 / (qzclock::msecsBetween(lastTimeCharChangedNs, nowNs))));
     }
     if (settings.value(QZSettings::cadence_sensor_name, QZSettings::default_cadence_sensor_name)
             .toString()
@@ -370,18 +367,18 @@ void trxappgateusbbike::characteristicChanged(const QLowEnergyCharacteristic &ch
         Resistance = ResistanceFromFTMSAccessory.value();
     }
 
-    emit debug(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
-    emit debug(QStringLiteral("Current cadence: ") + QString::number(cadence));
-    emit debug(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
-    emit debug(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
-    emit debug(QStringLiteral("Current watt: ") + QString::number(watt));
-    emit debug(QStringLiteral("Current Elapsed from the bike (not used): ") +
-               QString::number(GetElapsedFromPacket(newValue)));
-    emit debug(QStringLiteral("Current Elapsed: ") + QString::number(elapsed.value()));
-    emit debug(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
-    emit debug(QStringLiteral("Current resistance: ") + QString::number(resistance));
-
-    lastTimeCharChanged = now;
+    QZ_EMIT_DEBUG(QStringLiteral("Current speed: ") + QString::number(Speed.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current cadence: ") + QString::number(cadence));
+    QZ_EMIT_DEBUG(QStringLiteral("Current heart: ") + QString::number(Heart.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current KCal: ") + QString::number(KCal.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current watt: ") + QString::number(watt));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Elapsed from the bike (not used): ") +
+                  QString::number(GetElapsedFromPacket(newValue)));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Elapsed: ") + QString::number(elapsed.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current Distance Calculated: ") + QString::number(Distance.value()));
+    QZ_EMIT_DEBUG(QStringLiteral("Current resistance: ") + QString::number(resistance));
+
+    lastTimeCharChangedNs = nowNs;
     firstCharChanged = false;
 }
 
@@ -814,12 +811,12 @@ void trxappgateusbbike::btinit(bool startTape) {
 void trxappgateusbbike::stateChanged(QLowEnergyService::ServiceState state) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceState>();
-    emit debug(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
+    QZ_EMIT_DEBUG(QStringLiteral("BTLE stateChanged ") + QString::fromLocal8Bit(metaEnum.valueToKey(state)));
 
     if (state == QLowEnergyService::ServiceDiscovered) {
         auto characteristics_list = gattCommunicationChannelService->characteristics();
         for (const QLowEnergyCharacteristic &c : qAsConst(characteristics_list)) {
-            emit debug(QStringLiteral("characteristic ") + c.uuid().toString());
+            QZ_EMIT_DEBUG(QStringLiteral("characteristic ") + c.uuid().toString());
         }
 
         QString uuidWrite = QStringLiteral("0000fff2-0000-1000-8000-00805f9b34fb");
@@ -875,7 +872,7 @@ void trxappgateusbbike::stateChanged(QLowEnergyService::ServiceState state) {
             bool virtual_device_enabled =
                 settings.value(QZSettings::virtual_device_enabled, QZSettings::default_virtual_device_enabled).toBool();
             if (virtual_device_enabled) {
-                emit debug(QStringLiteral("creating virtual bike interface..."));
+                QZ_EMIT_DEBUG(QStringLiteral("creating virtual bike interface..."));
 
                 auto virtualBike =
                     new virtualbike(this, noWriteResistance, noHeartService, bikeResistanceOffset, bikeResistanceGain);
@@ -900,7 +897,7 @@ void trxappgateusbbike::stateChanged(QLowEnergyService::ServiceState state) {
 }
 
 void trxappgateusbbike::descriptorWritten(const QLowEnergyDescriptor &descriptor, const QByteArray &newValue) {
-    emit debug(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("descriptorWritten ") + descriptor.name() + QStringLiteral(" ") + newValue.toHex(' '));
 
     initRequest = true;
     emit connectedAndDiscovered();
@@ -909,11 +906,11 @@ void trxappgateusbbike::descriptorWritten(const QLowEnergyDescriptor &descriptor
 void trxappgateusbbike::characteristicWritten(const QLowEnergyCharacteristic &characteristic,
                                               const QByteArray &newValue) {
     Q_UNUSED(characteristic);
-    emit debug(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
+    QZ_EMIT_DEBUG(QStringLiteral("characteristicWritten ") + newValue.toHex(' '));
 }
 
 void trxappgateusbbike::serviceScanDone(void) {
-    emit debug(QStringLiteral("serviceScanDone"));
+    QZ_EMIT_DEBUG(QStringLiteral("serviceScanDone"));
 
     QString uuid = QStringLiteral("0000fff0-0000-1000-8000-00805f9b34fb");
     QString uuid2 = QStringLiteral("49535343-FE7D-4AE5-8FA9-9FAFD205E455");
@@ -1054,15 +1051,15 @@ void trxappgateusbbike::serviceScanDone(void) {
 void trxappgateusbbike::errorService(QLowEnergyService::ServiceError err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyService::ServiceError>();
-    emit debug(QStringLiteral("trxappgateusbbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("trxappgateusbbike::errorService") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void trxappgateusbbike::error(QLowEnergyController::Error err) {
 
     QMetaEnum metaEnum = QMetaEnum::fromType<QLowEnergyController::Error>();
-    emit debug(QStringLiteral("trxappgateusbbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
-               m_control->errorString());
+    QZ_EMIT_DEBUG(QStringLiteral("trxappgateusbbike::error") + QString::fromLocal8Bit(metaEnum.valueToKey(err)) +
+                  m_control->errorString());
 }
 
 void trxappgateusbbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
@@ -1075,8 +1072,8 @@ void trxappgateusbbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
     bool enerfit_SPX_9500 = settings.value(QZSettings::enerfit_SPX_9500, QZSettings::default_enerfit_SPX_9500).toBool();
     bool hop_sport_hs_090h_bike = settings.value(QZSettings::hop_sport_hs_090h_bike, QZSettings::default_hop_sport_hs_090h_bike).toBool();
     bool toorx_bike_srx_500 = settings.value(QZSettings::toorx_bike_srx_500, QZSettings::default_toorx_bike_srx_500).toBool();
-    emit debug(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
-               device.address().toString() + ')');
+    QZ_EMIT_DEBUG(QStringLiteral("Found new device: ") + device.name() + QStringLiteral(" (") +
+                  device.address().toString() + ')');
     // if(device.name().startsWith("TOORX") || device.name().startsWith("V-RUN") || device.name().startsWith("FS-")
     // || device.name().startsWith("i-Console+") || device.name().startsWith("i-Running"))
     {
@@ -1174,17 +1171,17 @@ void trxappgateusbbike::deviceDiscovered(const QBluetoothDeviceInfo &device) {
                 this, [this](QLowEnergyController::Error error) {
                     Q_UNUSED(error);
                     Q_UNUSED(this);
-                    emit debug(QStringLiteral("Cannot connect to remote device."));
+                    QZ_EMIT_DEBUG(QStringLiteral("Cannot connect to remote device."));
                     emit disconnected();
                 });
         connect(m_control, &QLowEnergyController::connected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("Controller connected. Search services..."));
+            QZ_EMIT_DEBUG(QStringLiteral("Controller connected. Search services..."));
             m_control->discoverServices();
         });
         connect(m_control, &QLowEnergyController::disconnected, this, [this]() {
             Q_UNUSED(this);
-            emit debug(QStringLiteral("LowEnergy controller disconnected"));
+            QZ_EMIT_DEBUG(QStringLiteral("LowEnergy controller disconnected"));
             emit disconnected();
         });
 
@@ -86,7 +86,7 @@ class wahookickrsnapbike : public bike {
     QByteArray lastPacket;
     double lastGearValue = -1;
     double lastGrade = 0;
-    QDateTime lastRefreshCharacteristicChanged = QDateTime::currentDateTime();
+    qint64 lastRefreshCharacteristicChangedNs = qzclock::nowNs();
     QDateTime lastGoodCadence = QDateTime::currentDateTime();
     uint8_t firstStateChanged = 0;
 
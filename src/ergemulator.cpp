@@ -0,0 +1,44 @@
+#include "ergemulator.h"
+#include <QtMath>
+
+void ergemulator::setTarget(double watts, double cadence, qint64 nowMs) {
+    if (watts <= 0) {
+        stop();
+        return;
+    }
+    // the model error is about proportional to the power
+    if (m_active && m_target > 0)
+        m_trim *= watts / m_target;
+    else
+        m_trim = 0;
+    m_active = true;
+    m_target = watts;
+    solvedCadence = cadence;
+    solvedMs = nowMs;
+}
+
+bool ergemulator::update(double cadence, double watts, qint64 nowMs) {
+    if (!m_active || cadence < minCadence)
+        return false;
+
+    if (qAbs(cadence - solvedCadence) >= cadenceThreshold) {
+        solvedCadence = cadence;
+        solvedMs = nowMs;
+        return true;
+    }
+
+    if (nowMs - solvedMs < settleTime)
+        return false;
+
+    double error = m_target - watts;
+    if (qAbs(error) <= m_target * deadband)
+        return false;
+
+    // the error lasted since the last solve
+    double dt = qMin((double)(nowMs - solvedMs), (double)settleTime) / 1000.0;
+    double limit = m_target * maxTrim;
+    m_trim = qBound(-limit, m_trim + (gain * error * dt), limit);
+    solvedCadence = cadence;
+    solvedMs = nowMs;
+    return true;
+}
@@ -0,0 +1,52 @@
+#ifndef ERGEMULATOR_H
+#define ERGEMULATOR_H
+
+#include <QtGlobal>
+
+/**
+ * @brief ERG mode for the bikes that only expose resistance levels. The bike solves the resistance for demand() with
+ * its power model (the inverted ergTable, or the driver formula); this class decides when to solve it again and
+ * corrects the model error with a slow integral trim on the measured power:
+ * - a cadence change solves again right away, since the power at a resistance level follows the cadence.
+ * - after a new resistance the power needs settleTime to follow, the trim is frozen meanwhile.
+ * - errors within the deadband are ignored, so the resistance doesn't hunt between two levels.
+ */
+class ergemulator {
+  public:
+    // Units: watts, rpm, milliseconds
+    void setTarget(double watts, double cadence, qint64 nowMs);
+    void stop() { m_active = false; }
+    bool active() const { return m_active; }
+    double target() const { return m_target; }
+    double trim() const { return m_trim; }
+    // the power to solve the resistance for
+    double demand() const { return m_target + m_trim; }
+
+    /**
+     * @brief update Feeds a new reading of the bike.
+     * @return true if the resistance must be solved again for demand().
+     */
+    bool update(double cadence, double watts, qint64 nowMs);
+
+    // no control below this cadence: the power reading is meaningless
+    double minCadence = 20;
+    // Units: rpm
+    double cadenceThreshold = 3;
+    // Units: milliseconds
+    qint64 settleTime = 1500;
+    // Units: fraction of the target
+    double deadband = 0.03;
+    // trim added per second for each watt of error
+    double gain = 0.4;
+    // Units: fraction of the target
+    double maxTrim = 0.3;
+
+  private:
+    bool m_active = false;
+    double m_target = 0;
+    double m_trim = 0;
+    double solvedCadence = 0;
+    qint64 solvedMs = 0;
+};
+
+#endif // ERGEMULATOR_H
@@ -6,6 +6,9 @@
 #include <QObject>
 #include <QDebug>
 #include <QDateTime>
+#include <QPair>
+#include <algorithm>
+#include "qzclock.h"
 #include "qzsettings.h"
 
 struct ergDataPoint {
@@ -35,10 +38,10 @@ public:
     void collectData(uint16_t cadence, uint16_t wattage, uint16_t resistance, bool ignoreResistanceTiming = false) {
         if(resistance != lastResistanceValue) {
             qDebug() << "resistance changed";
-            lastResistanceTime = QDateTime::currentDateTime();
+            lastResistanceTime = qzclock::nowMs();
             lastResistanceValue = resistance;
         }
-        if(lastResistanceTime.msecsTo(QDateTime::currentDateTime()) < 1000 && ignoreResistanceTiming == false) {
+        if(qzclock::nowMs() - lastResistanceTime < 1000 && ignoreResistanceTiming == false) {
             qDebug() << "skipping collecting data due to resistance changing too fast";
             return;
         }
@@ -133,11 +136,83 @@ public:
         }
     }
 
+    /**
+     * @brief estimateResistance Inverts the table: the resistance giving the wattage at the cadence. The wattage of
+     * every learned resistance level is estimated at the cadence, then the resistance is interpolated between the two
+     * levels around the wattage.
+     * @return false if the table doesn't know enough levels near this cadence.
+     */
+    bool estimateResistance(double givenCadence, double givenWattage, double *resistance) const {
+        // the curve of a level is trusted only this far from its points
+        const double cadenceWindow = 20;
+        QList<QPair<double, double>> levels; // resistance, wattage
+
+        QList<uint16_t> resistances;
+        for (const ergDataPoint &point : dataTable) {
+            if (point.cadence > 0 && point.wattage > 0 && !resistances.contains(point.resistance))
+                resistances.append(point.resistance);
+        }
+        std::sort(resistances.begin(), resistances.end());
+
+        for (uint16_t res : qAsConst(resistances)) {
+            const ergDataPoint *lower = nullptr;
+            const ergDataPoint *upper = nullptr;
+            for (const ergDataPoint &point : dataTable) {
+                if (point.resistance != res || point.cadence == 0 || point.wattage == 0)
+                    continue;
+                if (point.cadence <= givenCadence && (!lower || point.cadence > lower->cadence))
+                    lower = &point;
+                else if (point.cadence > givenCadence && (!upper || point.cadence < upper->cadence))
+                    upper = &point;
+            }
+
+            double w;
+            if (lower && upper) {
+                w = lower->wattage + ((upper->wattage - lower->wattage) * (givenCadence - lower->cadence) /
+                                      (double)(upper->cadence - lower->cadence));
+            } else {
+                const ergDataPoint *p = lower ? lower : upper;
+                if (std::abs(p->cadence - givenCadence) > cadenceWindow)
+                    continue;
+                // at the same resistance the power grows about linearly with the cadence
+                w = p->wattage * givenCadence / (double)p->cadence;
+            }
+            // the power can't go down adding resistance: it's noise
+            if (!levels.isEmpty() && w < levels.last().second)
+                w = levels.last().second;
+            levels.append(qMakePair((double)res, w));
+        }
+
+        if (levels.count() < 2 || levels.last().second <= levels.first().second)
+            return false;
+
+        int i = 0;
+        while (i < levels.count() - 2 && levels.at(i + 1).second < givenWattage)
+            i++;
+        // skip the flat segments, they can't be inverted
+        while (i > 0 && levels.at(i + 1).second == levels.at(i).second)
+            i--;
+        while (i < levels.count() - 2 && levels.at(i + 1).second == levels.at(i).second)
+            i++;
+        const QPair<double, double> &a = levels.at(i);
+        const QPair<double, double> &b = levels.at(i + 1);
+        if (b.second == a.second)
+            return false;
+
+        double span = levels.last().second - levels.first().second;
+        // outside the learned range the segment slope is extrapolated, but not too far
+        if (givenWattage < levels.first().second - (span / 4) || givenWattage > levels.last().second + (span / 4))
+            return false;
+
+        double r = a.first + ((b.first - a.first) * (givenWattage - a.second) / (b.second - a.second));
+        *resistance = qMax(0.0, r);
+        return true;
+    }
 
 private:
     QList<ergDataPoint> dataTable;
     uint16_t lastResistanceValue = 0xFFFF;
-    QDateTime lastResistanceTime = QDateTime::currentDateTime();
+    qint64 lastResistanceTime = qzclock::nowMs();
 
     bool ergDataPointExists(uint16_t cadence, uint16_t wattage, uint16_t resistance) {
         for (const ergDataPoint& point : dataTable) {
@@ -0,0 +1,274 @@
+#include "heartratecontroller.h"
+#include "devices/bike.h"
+#include "devices/treadmill.h"
+#include "qzsettings.h"
+#include "qztrace.h"
+#include <QSettings>
+#include <math.h>
+
+using namespace std::chrono_literals;
+
+void hrpid::reset(double currentOutput) {
+    m_base = currentOutput;
+    m_output = currentOutput;
+    m_integral = 0;
+    m_derivative = 0;
+    m_lastMeasured = -1;
+}
+
+double hrpid::update(double setpointMin, double setpointMax, double measured, double dt) {
+    if (dt <= 0)
+        return m_output;
+
+    // inside the band there is nothing to correct: the integral term keeps the actuator where it is
+    double error = 0;
+    if (measured < setpointMin)
+        error = setpointMin - measured;
+    else if (measured > setpointMax)
+        error = setpointMax - measured;
+
+    // derivative on measurement (no kick when the band changes), low pass filtered because the HR belts report
+    // integer bpm
+    if (m_lastMeasured >= 0) {
+        double d = -(measured - m_lastMeasured) / dt;
+        m_derivative = (0.8 * m_derivative) + (0.2 * d);
+    }
+    m_lastMeasured = measured;
+
+    double p = params.kp * error;
+    double d = params.kd * m_derivative;
+
+    // conditional integration: the integral is not accumulated while the actuator is saturated in the same
+    // direction of the error, otherwise it would wind up and overshoot once the heart rate comes back
+    double integral = m_integral + (params.ki * error * dt);
+    double unclamped = m_base + p + integral + d;
+    if (!((unclamped > params.outputMax && error > 0) || (unclamped < params.outputMin && error < 0))) {
+        m_integral = integral;
+    }
+    m_integral = qBound(params.outputMin - m_base, m_integral, params.outputMax - m_base);
+
+    double out = qBound(params.outputMin, m_base + p + m_integral + d, params.outputMax);
+
+    if (params.maxRatePerSecond > 0) {
+        double maxStep = params.maxRatePerSecond * dt;
+        out = qBound(m_output - maxStep, out, m_output + maxStep);
+    }
+
+    m_output = out;
+    return m_output;
+}
+
+heartratecontroller::heartratecontroller(QObject *parent) : QObject(parent) {
+    connect(&timer, &QTimer::timeout, this, &heartratecontroller::sample);
+}
+
+void heartratecontroller::setDevice(bluetoothdevice *d) {
+    if (device != d) {
+        release();
+        device = d;
+    }
+}
+
+hrpidparameters heartratecontroller::defaultParameters(ACTUATOR actuator) {
+    hrpidparameters p;
+    switch (actuator) {
+    case SPEED:
+        p.kp = 0.04;
+        p.ki = 0.002;
+        p.kd = 0.2;
+        p.maxRatePerSecond = 0.1;
+        p.resolution = 0.1;
+        break;
+    case INCLINATION:
+        p.kp = 0.1;
+        p.ki = 0.005;
+        p.kd = 0.5;
+        p.maxRatePerSecond = 0.25;
+        p.resolution = 0.5;
+        break;
+    case POWER:
+        p.kp = 1.0;
+        p.ki = 0.05;
+        p.kd = 4.0;
+        p.maxRatePerSecond = 3.0;
+        p.resolution = 1.0;
+        break;
+    case RESISTANCE:
+        p.kp = 0.08;
+        p.ki = 0.004;
+        p.kd = 0.3;
+        p.maxRatePerSecond = 0.2;
+        p.resolution = 1.0;
+        break;
+    case NONE:
+        break;
+    }
+
+    QSettings settings;
+    double gain =
+        settings.value(QZSettings::heart_rate_controller_gain, QZSettings::default_heart_rate_controller_gain)
+            .toDouble();
+    p.kp *= gain;
+    p.ki *= gain;
+    p.kd *= gain;
+    return p;
+}
+
+heartratecontroller::ACTUATOR heartratecontroller::selectActuator() {
+    QSettings settings;
+    switch (device->deviceType()) {
+    case bluetoothdevice::TREADMILL:
+        if (settings
+                .value(QZSettings::heart_rate_controller_inclination,
+                       QZSettings::default_heart_rate_controller_inclination)
+                .toBool())
+            return INCLINATION;
+        return SPEED;
+    case bluetoothdevice::BIKE:
+        if (((bike *)device)->ergModeSupportedAvailableByHardware())
+            return POWER;
+        return RESISTANCE;
+    case bluetoothdevice::ROWING:
+    case bluetoothdevice::ELLIPTICAL:
+        return RESISTANCE;
+    default:
+        return NONE;
+    }
+}
+
+double heartratecontroller::actuatorValue() {
+    switch (m_actuator) {
+    case SPEED:
+        return device->currentSpeed().value();
+    case INCLINATION:
+        return device->currentInclination().value();
+    case POWER:
+        if (((bike *)device)->lastRequestedPower().value() > 0)
+            return ((bike *)device)->lastRequestedPower().value();
+        return device->wattsMetric().value();
+    case RESISTANCE:
+        return device->currentResistance().value();
+    case NONE:
+        break;
+    }
+    return 0;
+}
+
+void heartratecontroller::writeActuator(double value) {
+    qDebug() << QStringLiteral("heartratecontroller: actuator") << m_actuator << QStringLiteral("->") << value;
+    QZ_TRACE(qztrace::CONTROL, "heartratecontroller", "actuator", (int)m_actuator, "value", value);
+    switch (m_actuator) {
+    case SPEED:
+        ((treadmill *)device)->changeSpeedAndInclination(value, device->currentInclination().value());
+        break;
+    case INCLINATION:
+        ((treadmill *)device)->changeSpeedAndInclination(device->currentSpeed().value(), value);
+        break;
+    case POWER:
+        device->changePower(value);
+        break;
+    case RESISTANCE:
+        device->changeResistance(value);
+        break;
+    case NONE:
+        return;
+    }
+    emit outputChanged(value);
+}
+
+void heartratecontroller::setTarget(double hrMin, double hrMax, double minSpeed, double maxSpeed,
+                                    double maxResistance) {
+    if (!device)
+        return;
+
+    if (!engaged) {
+        m_actuator = selectActuator();
+        if (m_actuator == NONE)
+            return;
+        pid.setParameters(defaultParameters(m_actuator));
+        double resolution = pid.parameters().resolution;
+        lastWritten = actuatorValue();
+        if (resolution > 0)
+            lastWritten = steps(lastWritten, resolution) * resolution;
+        pid.reset(lastWritten);
+        lastSample = 0;
+        engaged = true;
+        timer.start(200ms);
+        qDebug() << QStringLiteral("heartratecontroller: engaged with actuator") << m_actuator
+                 << QStringLiteral("starting from") << lastWritten;
+    }
+
+    hrpidparameters p = pid.parameters();
+    switch (m_actuator) {
+    case SPEED:
+        p.outputMin = qMax(minSpeed, 1.0);
+        p.outputMax = maxSpeed;
+        break;
+    case INCLINATION:
+        p.outputMin = 0;
+        p.outputMax = 15;
+        break;
+    case POWER:
+        p.outputMin = 30;
+        p.outputMax = 1000;
+        break;
+    case RESISTANCE:
+        p.outputMin = 1;
+        p.outputMax = qMin(maxResistance, (double)device->maxResistance());
+        break;
+    case NONE:
+        break;
+    }
+    pid.setParameters(p);
+
+    targetMin = hrMin;
+    targetMax = hrMax;
+    lastTarget = qzclock::nowNs();
+}
+
+void heartratecontroller::release() {
+    if (engaged) {
+        qDebug() << QStringLiteral("heartratecontroller: released");
+    }
+    engaged = false;
+    timer.stop();
+}
+
+void heartratecontroller::sample() {
+    if (!engaged || !device)
+        return;
+
+    // the owner refreshes the target every second while the heart rate mode is active: a stale target means the
+    // workout is paused, stopped or the user switched mode
+    if (qzclock::secondsSince(lastTarget) > 3.0) {
+        release();
+        return;
+    }
+
+    metric heart = device->currentHeart();
+    qint64 t = heart.lastChangedNs();
+    if (lastSample != 0 && t <= lastSample)
+        return; // no new sample from the sensor yet
+
+    double dt = lastSample != 0 ? ((t - lastSample) / 1e9) : 0.2;
+    lastSample = t;
+    dt = qBound(0.05, dt, 5.0);
+
+    double hr = heart.value();
+    if (hr <= 0)
+        return;
+
+    double out = pid.update(targetMin, targetMax, hr, dt);
+    double resolution = pid.parameters().resolution;
+    if (resolution > 0) {
+        qint64 step = steps(out, resolution);
+        if (step == steps(lastWritten, resolution))
+            return;
+        out = step * resolution;
+    }
+
+    lastWritten = out;
+    writeActuator(out);
+}
+
+qint64 heartratecontroller::steps(double value, double resolution) { return llround(value / resolution); }
@@ -0,0 +1,107 @@
+#ifndef HEARTRATECONTROLLER_H
+#define HEARTRATECONTROLLER_H
+
+#include "devices/bluetoothdevice.h"
+#include <QObject>
+#include <QTimer>
+
+/**
+ * @brief Tuning of the heart rate PID loop. Gains are expressed in actuator units per bpm of error
+ * (e.g. km/h per bpm for a treadmill driven by speed).
+ */
+class hrpidparameters {
+  public:
+    double kp = 0;
+    double ki = 0;
+    double kd = 0;
+    double outputMin = 0;
+    double outputMax = 0;
+    // maximum change of the actuator, in actuator units per second
+    double maxRatePerSecond = 0;
+    // smallest actuator change worth a write to the device
+    double resolution = 0;
+};
+
+/**
+ * @brief Discrete PID with conditional integration (anti-windup), derivative on measurement and output rate
+ * limiting. It has no Qt or device dependencies so it can be driven by a simulated heart rate model.
+ */
+class hrpid {
+  public:
+    void setParameters(const hrpidparameters &p) { params = p; }
+    hrpidparameters parameters() const { return params; }
+
+    /**
+     * @brief reset Starts a new control session from the current actuator value, so the first output is bumpless.
+     */
+    void reset(double currentOutput);
+
+    /**
+     * @brief update Runs one step of the loop.
+     * @param setpointMin Lower bound of the target heart rate band. Units: bpm
+     * @param setpointMax Upper bound of the target heart rate band. Units: bpm
+     * @param measured Heart rate sample. Units: bpm
+     * @param dt Seconds since the previous sample.
+     * @return The new actuator value.
+     */
+    double update(double setpointMin, double setpointMax, double measured, double dt);
+
+    double output() const { return m_output; }
+
+  private:
+    hrpidparameters params;
+    double m_base = 0;
+    double m_integral = 0;
+    double m_output = 0;
+    double m_lastMeasured = -1;
+    double m_derivative = 0;
+};
+
+class heartratecontroller : public QObject {
+    Q_OBJECT
+
+  public:
+    enum ACTUATOR { NONE = 0, SPEED, INCLINATION, POWER, RESISTANCE };
+
+    explicit heartratecontroller(QObject *parent = nullptr);
+
+    void setDevice(bluetoothdevice *device);
+
+    /**
+     * @brief setTarget Engages (or keeps engaged) the controller on a heart rate band. It must be refreshed at least
+     * every few seconds: when the caller stops refreshing it, the controller releases the device.
+     */
+    void setTarget(double hrMin, double hrMax, double minSpeed, double maxSpeed, double maxResistance);
+    void release();
+    bool isEngaged() const { return engaged; }
+    ACTUATOR actuator() const { return m_actuator; }
+
+    static hrpidparameters defaultParameters(ACTUATOR actuator);
+    // the value in whole steps of the actuator resolution, so that equal steps compare equal
+    static qint64 steps(double value, double resolution);
+
+  signals:
+    void outputChanged(double value);
+
+  private slots:
+    void sample();
+
+  private:
+    ACTUATOR selectActuator();
+    double actuatorValue();
+    void writeActuator(double value);
+
+    bluetoothdevice *device = nullptr;
+    QTimer timer;
+    hrpid pid;
+    ACTUATOR m_actuator = NONE;
+    bool engaged = false;
+    double targetMin = 0;
+    double targetMax = 0;
+    double lastWritten = 0;
+    // qzclock instants, 0 when not set. Units: nanoseconds
+    qint64 lastTarget = 0;
+    qint64 lastSample = 0;
+};
+
+#endif // HEARTRATECONTROLLER_H
@@ -8,8 +8,10 @@
 #include <jni.h>
 #include <QAndroidJniObject>
 #endif
+#include "latencymonitor.h"
 #include "material.h"
 #include "qfit.h"
+#include "qztrace.h"
 #include "simplecrypt.h"
 #include "templateinfosenderbuilder.h"
 #include "zwiftworkout.h"
@@ -246,6 +248,8 @@ homeform::homeform(QQmlApplicationEngine *engine, bluetooth *bl) {
     datetime = new DataObject(QStringLiteral("Clock"), QStringLiteral("icons/icons/clock.png"),
                               QTime::currentTime().toString(QStringLiteral("hh:mm:ss")), false,
                               QStringLiteral("datetime"), valueTimeFontSize, labelFontSize);
+    latency = new DataObject(QStringLiteral("Latency (ms)"), QStringLiteral("icons/icons/clock.png"),
+                             QStringLiteral("0"), false, QStringLiteral("latency"), valueTimeFontSize, labelFontSize);
     lapElapsed = new DataObject(QStringLiteral("Lap Elapsed"), QStringLiteral("icons/icons/clock.png"),
                                 QStringLiteral("0:00:00"), false, QStringLiteral("lapElapsed"), valueElapsedFontSize,
                                 labelFontSize);
@@ -486,6 +490,46 @@ homeform::homeform(QQmlApplicationEngine *engine, bluetooth *bl) {
     connect(backupTimer, &QTimer::timeout, this, &homeform::backup);
     backupTimer->start(1min);
 
+    hrController = new heartratecontroller(this);
+
+    library = new workoutlibrary(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+                                     QStringLiteral("/workoutlibrary.json"),
+                                 this);
+    library->addFolder(getWritableAppDir() + QStringLiteral("training"));
+    connect(library, &workoutlibrary::indexed, this, &homeform::libraryIndexed);
+
+    finalizer = new workoutfinalizer(this);
+    connect(finalizer, &workoutfinalizer::fitSaved, this, &homeform::finalizerFitSaved);
+    connect(finalizer, &workoutfinalizer::progressChanged, this, &homeform::finalizerProgress);
+    connect(finalizer, &workoutfinalizer::finished, this, &homeform::finalizerFinished);
+
+    // an upload interrupted by a crash or by closing the app is retried now
+    QString pendingUpload = workoutfinalizer::pendingUpload();
+    if (!pendingUpload.isEmpty()) {
+        qDebug() << QStringLiteral("resuming pending strava upload") << pendingUpload;
+        lastFitFileSaved = pendingUpload;
+        QTimer::singleShot(workoutfinalizer::pendingUploadDelay(), this, &homeform::strava_upload_file_prepare);
+    }
+
+    // a journal still on disk means that the last workout was never stopped: QZ crashed or has been killed
+    journal = new sessionjournal(this);
+    if (QFile::exists(journalFileName())) {
+        recoveredJournal = sessionjournal::recover(journalFileName());
+        if (recoveredJournal.valid && !recoveredJournal.finished && recoveredJournal.state.elapsed >= 60) {
+            m_journalResumeRequested = true;
+            QTimer::singleShot(0, this, [this]() { emit journalResumeRequestedChanged(true); });
+        } else {
+            journal_discard();
+        }
+    }
+
+    // the samples are streamed to the collector of the LAN too, when there is one
+    metricsexporter::config exportConfig = metricsexporter::config::fromSettings();
+    if (exportConfig.isEnabled()) {
+        exportConfig.spoolFileName = getWritableAppDir() + QStringLiteral("QZ-metrics-spool.txt");
+        exporter = new metricsexporter(exportConfig, this);
+    }
+
     QObject *rootObject = engine->rootObjects().constFirst();
     QObject *home = rootObject->findChild<QObject *>(QStringLiteral("home"));
     QObject *stack = rootObject;
@@ -522,6 +566,9 @@ homeform::homeform(QQmlApplicationEngine *engine, bluetooth *bl) {
     QObject::connect(stack, SIGNAL(floatingOpen()), this, SLOT(floatingOpen()));
     QObject::connect(stack, SIGNAL(openFloatingWindowBrowser()), this, SLOT(openFloatingWindowBrowser()));
     QObject::connect(stack, SIGNAL(strava_upload_file_prepare()), this, SLOT(strava_upload_file_prepare()));
+    QObject::connect(stack, SIGNAL(journal_resume()), this, SLOT(journal_resume()));
+    QObject::connect(stack, SIGNAL(journal_discard()), this, SLOT(journal_discard()));
+    QObject::connect(stack, SIGNAL(workout_finalization_cancel()), this, SLOT(workout_finalization_cancel()));
 
     qDebug() << "homeform constructor events linked";
 
@@ -740,12 +787,14 @@ void homeform::chartSaved(QString fileName) {
         return;
     chartImagesFilenames.append(fileName);
     if (chartImagesFilenames.length() >= 9) {
-        sendMail();
-        qDebug() << "removing chart images";
-        for (const QString &f : qAsConst(chartImagesFilenames)) {
-            QFile::remove(f);
+        // the mail needs the FIT file and the summary stats: if they are not ready yet, it's sent from
+        // finalizerFinished
+        if (finalizer->isRunning()) {
+            qDebug() << QStringLiteral("chart images ready, waiting for the workout finalization");
+            mailPending = true;
+            return;
         }
-        chartImagesFilenames.clear();
+        sendMail();
     }
 }
 
@@ -1039,6 +1088,17 @@ void homeform::aboutToQuit() {
     if (settings.value(QZSettings::fit_file_saved_on_quit, QZSettings::default_fit_file_saved_on_quit).toBool()) {
         qDebug() << "fit_file_saved_on_quit true";
         fit_save_clicked();
+        journal->finish();
+        QFile::remove(journalProgramFileName());
+    } else if (!journalFitFileName.isEmpty()) {
+        // the workout was stopped, the journal goes once its FIT file is written
+        finalizer->waitForDone();
+        journalFitFileName.clear();
+        journal->finish();
+        QFile::remove(journalProgramFileName());
+    } else {
+        // the workout can be resumed at the next start
+        journal->sync();
     }
 
     if (bluetoothManager->device())
@@ -1046,6 +1106,10 @@ void homeform::aboutToQuit() {
 }
 
 void homeform::trainProgramSignals() {
+    if (journal && journal->isOpen() && trainProgram) {
+        trainprogram::saveXML(journalProgramFileName(), trainProgram->rows);
+    }
+
     if (bluetoothManager->device()) {
         disconnect(trainProgram, &trainprogram::start, bluetoothManager->device(), &bluetoothdevice::start);
         disconnect(trainProgram, &trainprogram::stop, bluetoothManager->device(), &bluetoothdevice::stop);
@@ -1334,6 +1398,12 @@ void homeform::sortTiles() {
                 dataList.append(datetime);
             }
 
+            if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool() &&
+                settings.value(QZSettings::tile_latency_order, QZSettings::default_tile_latency_order).toInt() == i) {
+                latency->setGridId(i);
+                dataList.append(latency);
+            }
+
             if (settings.value(QZSettings::tile_lapelapsed_enabled, false).toBool() &&
                 settings.value(QZSettings::tile_lapelapsed_order, 18).toInt() == i) {
                 lapElapsed->setGridId(i);
@@ -1651,6 +1721,12 @@ void homeform::sortTiles() {
                 dataList.append(datetime);
             }
 
+            if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool() &&
+                settings.value(QZSettings::tile_latency_order, QZSettings::default_tile_latency_order).toInt() == i) {
+                latency->setGridId(i);
+                dataList.append(latency);
+            }
+
             if (settings.value(QZSettings::tile_target_resistance_enabled, true).toBool() &&
                 settings.value(QZSettings::tile_target_resistance_order, 0).toInt() == i) {
                 target_resistance->setGridId(i);
@@ -1997,6 +2073,12 @@ void homeform::sortTiles() {
                 dataList.append(datetime);
             }
 
+            if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool() &&
+                settings.value(QZSettings::tile_latency_order, QZSettings::default_tile_latency_order).toInt() == i) {
+                latency->setGridId(i);
+                dataList.append(latency);
+            }
+
             if (settings.value(QZSettings::tile_target_resistance_enabled, true).toBool() &&
                 settings.value(QZSettings::tile_target_resistance_order, 0).toInt() == i) {
                 target_resistance->setGridId(i);
@@ -2295,6 +2377,12 @@ void homeform::sortTiles() {
                 dataList.append(datetime);
             }
 
+            if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool() &&
+                settings.value(QZSettings::tile_latency_order, QZSettings::default_tile_latency_order).toInt() == i) {
+                latency->setGridId(i);
+                dataList.append(latency);
+            }
+
             if (settings.value(QZSettings::tile_target_resistance_enabled, true).toBool() &&
                 settings.value(QZSettings::tile_target_resistance_order, 0).toInt() == i) {
                 target_resistance->setGridId(i);
@@ -2591,6 +2679,12 @@ void homeform::sortTiles() {
                 dataList.append(datetime);
             }
 
+            if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool() &&
+                settings.value(QZSettings::tile_latency_order, QZSettings::default_tile_latency_order).toInt() == i) {
+                latency->setGridId(i);
+                dataList.append(latency);
+            }
+
             if (settings.value(QZSettings::tile_target_resistance_enabled, true).toBool() &&
                 settings.value(QZSettings::tile_target_resistance_order, 0).toInt() == i) {
                 target_resistance->setGridId(i);
@@ -2845,6 +2939,10 @@ void homeform::deviceConnected(QBluetoothDeviceInfo b) {
     if (b.isValid())
         deviceFound(b.name());
 
+    if (exporter)
+        exporter->setDevice(b.name(), bluetoothManager->device()->deviceType());
+    library->setDeviceType(bluetoothManager->device()->deviceType());
+
     m_labelHelp = false;
     emit changeLabelHelp(m_labelHelp);
 
@@ -2924,6 +3022,7 @@ void homeform::deviceFound(const QString &name) {
 }
 
 void homeform::LargeButton(const QString &name) {
+    controlarbiter::scope source(controlarbiter::USER);
     QSettings settings;
     qDebug() << QStringLiteral("LargeButton") << name;
     if (!bluetoothManager || !bluetoothManager->device())
@@ -3174,6 +3273,7 @@ void homeform::LargeButton(const QString &name) {
 }
 
 void homeform::Plus(const QString &name) {
+    controlarbiter::scope source(controlarbiter::USER);
     QSettings settings;
 
     bool miles = settings.value(QZSettings::miles_unit, QZSettings::default_miles_unit).toBool();
@@ -3200,6 +3300,8 @@ void homeform::Plus(const QString &name) {
                     }
                 }
 
+                // same request with the new difficulty
+                controlarbiter::scope internal(controlarbiter::INTERNAL);
                 ((treadmill *)bluetoothManager->device())
                     ->changeSpeed(((treadmill *)bluetoothManager->device())->lastRawSpeedRequested());
             }
@@ -3228,6 +3330,8 @@ void homeform::Plus(const QString &name) {
                     }
                 }
 
+                // same request with the new difficulty
+                controlarbiter::scope internal(controlarbiter::INTERNAL);
                 ((treadmill *)bluetoothManager->device())
                     ->changeInclination(((treadmill *)bluetoothManager->device())->lastRawInclinationRequested(),
                                         ((treadmill *)bluetoothManager->device())->lastRawInclinationRequested());
@@ -3424,6 +3528,9 @@ void homeform::bluetoothDeviceConnected(bluetoothdevice *b) {
     // heart rate received from apple watch while QZ is running on a different device via TCP socket (iphone_socket)
     connect(this, SIGNAL(heartRate(uint8_t)), b, SLOT(heartRate(uint8_t)));
 #endif
+    if (journalStatsPending) {
+        journalRestoreStats();
+    }
 }
 
 void homeform::bluetoothDeviceDisconnected() {
@@ -3432,6 +3539,7 @@ void homeform::bluetoothDeviceDisconnected() {
 }
 
 void homeform::Minus(const QString &name) {
+    controlarbiter::scope source(controlarbiter::USER);
     QSettings settings;
     bool miles = settings.value(QZSettings::miles_unit, QZSettings::default_miles_unit).toBool();
     qDebug() << QStringLiteral("Minus") << name;
@@ -3457,6 +3565,8 @@ void homeform::Minus(const QString &name) {
                     }
                 }
 
+                // same request with the new difficulty
+                controlarbiter::scope internal(controlarbiter::INTERNAL);
                 ((treadmill *)bluetoothManager->device())
                     ->changeSpeed(((treadmill *)bluetoothManager->device())->lastRawSpeedRequested());
             }
@@ -3485,6 +3595,8 @@ void homeform::Minus(const QString &name) {
                     }
                 }
 
+                // same request with the new difficulty
+                controlarbiter::scope internal(controlarbiter::INTERNAL);
                 ((treadmill *)bluetoothManager->device())
                     ->changeInclination(((treadmill *)bluetoothManager->device())->lastRawInclinationRequested(),
                                         ((treadmill *)bluetoothManager->device())->lastRawInclinationRequested());
@@ -3762,6 +3874,8 @@ void homeform::Start_inner(bool send_event_to_device) {
 
     if (bluetoothManager->device()) {
         bluetoothManager->device()->setPaused(paused | stopped);
+        // the paused seconds must not be filled by the session grid
+        bluetoothManager->device()->sensorFusion()->restartGrid();
     }
 }
 
@@ -3825,7 +3939,13 @@ void homeform::Stop() {
 
     emit workoutEventStateChanged(bluetoothdevice::STOPPED);
 
-    fit_save_clicked();
+    finalizeWorkout();
+
+    if (qztrace::enabled(qztrace::ALL)) {
+        QString traceFile = getWritableAppDir() + QStringLiteral("QZ-trace-") +
+                            QDateTime::currentDateTime().toString("yyyyMMddhhmmss") + QStringLiteral(".json");
+        finalizer->runStage(QStringLiteral("trace"), [traceFile]() { qztrace::exportChromeTrace(traceFile); });
+    }
 
     if (bluetoothManager->device()) {
         bluetoothManager->device()->setPaused(paused | stopped);
@@ -3857,6 +3977,7 @@ void homeform::Lap() {
 
             bluetoothManager->device()->setLap();
             lapTrigger = true;
+            journal->appendLap();
         }
     }
 }
@@ -3921,6 +4042,7 @@ QString homeform::signal() {
 
 void homeform::update() {
 
+    QZ_TRACE_SCOPE(qztrace::UI, "homeform::update");
     QSettings settings;
     double currentHRZone = 1;
     double ftpZone = 1;
@@ -4029,8 +4151,8 @@ void homeform::update() {
             remaningTimeTrainingProgramCurrentRow->setSecondLine(
                 trainProgram->currentRowElapsedTime().toString(QStringLiteral("h:mm:ss")));
             targetMets->setValue(QString::number(trainProgram->currentTargetMets(), 'f', 1));
-            trainrow next = trainProgram->getRowFromCurrent(1);
-            trainrow next_1 = trainProgram->getRowFromCurrent(2);
+            const trainrow &next = trainProgram->getRowFromCurrent(1);
+            const trainrow &next_1 = trainProgram->getRowFromCurrent(2);
             if (next.duration.second() != 0 || next.duration.minute() != 0 || next.duration.hour() != 0) {
                 if (next.requested_peloton_resistance != -1)
                     nextRows->setValue(QStringLiteral("PR") + QString::number(next.requested_peloton_resistance) +
@@ -4141,6 +4263,15 @@ void homeform::update() {
             formattedTime = currentTime.toString("H:mm:ss");
         }
         datetime->setValue(formattedTime);
+        latencymonitor::record(latencymonitor::UI, bluetoothManager->device()->ingressNs());
+        if (settings.value(QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled).toBool()) {
+            const latencyhistogram &ui = latencymonitor::histogram(latencymonitor::UI);
+            const latencyhistogram &notify = latencymonitor::histogram(latencymonitor::NOTIFY);
+            latency->setValue(QString::number(ui.percentile(50) / 1000.0, 'f', 0) + QStringLiteral("/") +
+                              QString::number(ui.percentile(99) / 1000.0, 'f', 0));
+            latency->setSecondLine(QStringLiteral("virtual ") + QString::number(notify.percentile(50) / 1000.0, 'f', 0) +
+                                   QStringLiteral("/") + QString::number(notify.percentile(99) / 1000.0, 'f', 0));
+        }
         if (power5s)
             watts = bluetoothManager->device()->wattsMetric().average5s();
         else
@@ -4266,7 +4397,8 @@ void homeform::update() {
                 QString::number(((treadmill *)bluetoothManager->device())->currentVerticalOscillation().max(), 'f', 0));
 
             // if there is no training program, the color is based on presets
-            if (!trainProgram || trainProgram->currentRow().speed == -1 || trainProgram->currentRow().upper_speed == -1) {
+            if (!trainProgram || trainProgram->currentRow().speed == -1 ||
+                trainProgram->currentRow().ranges().upper_speed == -1) {
                 if (bluetoothManager->device()->currentSpeed().value() < 9) {
                     speed->setValueFontColor(QStringLiteral("white"));
                     this->pace->setValueFontColor(QStringLiteral("white"));
@@ -4290,14 +4422,13 @@ void homeform::update() {
                     this->pace->setValueFontColor(QStringLiteral("red"));
                 }
             } else {
-                if (bluetoothManager->device()->currentSpeed().value() <= trainProgram->currentRow().upper_speed &&
-                    bluetoothManager->device()->currentSpeed().value() >= trainProgram->currentRow().lower_speed) {
+                const trainrowranges &ranges = trainProgram->currentRow().ranges();
+                if (bluetoothManager->device()->currentSpeed().value() <= ranges.upper_speed &&
+                    bluetoothManager->device()->currentSpeed().value() >= ranges.lower_speed) {
                     this->target_zone->setValueFontColor(QStringLiteral("limegreen"));
                     this->pace->setValueFontColor(QStringLiteral("limegreen"));
-                } else if (bluetoothManager->device()->currentSpeed().value() <=
-                                (trainProgram->currentRow().upper_speed + 0.2) &&
-                            bluetoothManager->device()->currentSpeed().value() >=
-                                (trainProgram->currentRow().lower_speed - 0.2)) {
+                } else if (bluetoothManager->device()->currentSpeed().value() <= (ranges.upper_speed + 0.2) &&
+                           bluetoothManager->device()->currentSpeed().value() >= (ranges.lower_speed - 0.2)) {
                     this->target_zone->setValueFontColor(QStringLiteral("orange"));
                     this->pace->setValueFontColor(QStringLiteral("orange"));
                 } else {
@@ -4306,7 +4437,7 @@ void homeform::update() {
                 }
             }
 
-            switch (trainProgram->currentRow().pace_intensity) {
+            switch (trainProgram->currentRow().ranges().pace_intensity) {
             case 0:
                 this->target_zone->setValue(tr("Rec."));
                 break;
@@ -4462,23 +4593,22 @@ void homeform::update() {
             this->target_pace->setValue(
                 ((rower *)bluetoothManager->device())->lastRequestedPace().toString(QStringLiteral("m:ss")));
             if (trainProgram) {
+                const trainrowranges &ranges = trainProgram->currentRow().ranges();
                 this->target_pace->setSecondLine(((rower *)bluetoothManager->device())
-                                                     ->speedToPace(trainProgram->currentRow().lower_speed)
+                                                     ->speedToPace(ranges.lower_speed)
                                                      .toString(QStringLiteral("m:ss")) +
                                                  " - " +
                                                  ((rower *)bluetoothManager->device())
-                                                     ->speedToPace(trainProgram->currentRow().upper_speed)
+                                                     ->speedToPace(ranges.upper_speed)
                                                      .toString(QStringLiteral("m:ss")));
 
                 if (((rower *)bluetoothManager->device())->lastRequestedCadence().value() > 0) {
-                    if (bluetoothManager->device()->currentSpeed().value() <= trainProgram->currentRow().upper_speed &&
-                        bluetoothManager->device()->currentSpeed().value() >= trainProgram->currentRow().lower_speed) {
+                    if (bluetoothManager->device()->currentSpeed().value() <= ranges.upper_speed &&
+                        bluetoothManager->device()->currentSpeed().value() >= ranges.lower_speed) {
                         this->target_zone->setValueFontColor(QStringLiteral("limegreen"));
                         this->pace->setValueFontColor(QStringLiteral("limegreen"));
-                    } else if (bluetoothManager->device()->currentSpeed().value() <=
-                                   (trainProgram->currentRow().upper_speed + 0.2) &&
-                               bluetoothManager->device()->currentSpeed().value() >=
-                                   (trainProgram->currentRow().lower_speed - 0.2)) {
+                    } else if (bluetoothManager->device()->currentSpeed().value() <= (ranges.upper_speed + 0.2) &&
+                               bluetoothManager->device()->currentSpeed().value() >= (ranges.lower_speed - 0.2)) {
                         this->target_zone->setValueFontColor(QStringLiteral("orange"));
                         this->pace->setValueFontColor(QStringLiteral("orange"));
                     } else {
@@ -4489,7 +4619,7 @@ void homeform::update() {
                     this->target_zone->setValueFontColor(QStringLiteral("white"));
                     this->pace->setValueFontColor(QStringLiteral("white"));
                 }
-                switch (trainProgram->currentRow().pace_intensity) {
+                switch (ranges.pace_intensity) {
                 case 0:
                     this->target_zone->setValue(tr("Rec."));
                     break;
@@ -4681,8 +4811,9 @@ void homeform::update() {
             QStringLiteral(" MAX: ") + QString::number((bluetoothManager->device())->wattsMetric().max(), 'f', 0));
 
         if (trainProgram) {
-            int8_t lower_requested_peloton_resistance = trainProgram->currentRow().lower_requested_peloton_resistance;
-            int8_t upper_requested_peloton_resistance = trainProgram->currentRow().upper_requested_peloton_resistance;
+            const trainrowranges &ranges = trainProgram->currentRow().ranges();
+            int8_t lower_requested_peloton_resistance = ranges.lower_requested_peloton_resistance;
+            int8_t upper_requested_peloton_resistance = ranges.upper_requested_peloton_resistance;
             double lower_requested_peloton_resistance_to_bike_resistance = 0;
             if (bluetoothManager->device()->deviceType() == bluetoothdevice::BIKE)
                 lower_requested_peloton_resistance_to_bike_resistance =
@@ -4721,8 +4852,8 @@ void homeform::update() {
                 }
             }
 
-            int16_t lower_cadence = trainProgram->currentRow().lower_cadence;
-            int16_t upper_cadence = trainProgram->currentRow().upper_cadence;
+            int16_t lower_cadence = ranges.lower_cadence;
+            int16_t upper_cadence = ranges.upper_cadence;
             if (lower_cadence != -1) {
                 this->target_cadence->setSecondLine(QStringLiteral("MIN: ") + QString::number(lower_cadence, 'f', 0) +
                                                     QStringLiteral(" MAX: ") + QString::number(upper_cadence, 'f', 0));
@@ -4843,7 +4974,7 @@ void homeform::update() {
 
         if (bluetoothManager->device()->deviceType() == bluetoothdevice::BIKE ||
             (bluetoothManager->device()->deviceType() == bluetoothdevice::ROWING &&
-             (!trainProgram || trainProgram->currentRow().pace_intensity == -1))) {
+             (!trainProgram || trainProgram->currentRow().ranges().pace_intensity == -1))) {
             if (requestedPerc < 56) {
 
                 requestedMinW = QString::number(0, 'f', 0);
@@ -5225,6 +5356,10 @@ void homeform::update() {
                     }
                 }
             }
+        } else if (settings.value(QZSettings::heart_rate_controller, QZSettings::default_heart_rate_controller)
+                       .toBool() &&
+                   heartRateControllerTarget()) {
+            // the closed loop runs at the heart rate sensor rate inside heartratecontroller
         } else if (!settings.value(QZSettings::treadmill_pid_heart_zone, QZSettings::default_treadmill_pid_heart_zone)
                         .toString()
                         .contains(QStringLiteral("Disabled")) ||
@@ -5775,26 +5910,52 @@ void homeform::update() {
                 }
             }
 
-            if(bluetoothManager->device()->currentSpeed().value() > 0 && !isinf(bluetoothManager->device()->currentSpeed().value()))
-                bluetoothManager->device()->addCurrentDistance1s((bluetoothManager->device()->currentSpeed().value() / 3600.0));
-            
-            qDebug() << "Current Distance 1s:" << bluetoothManager->device()->currentDistance1s().value() << bluetoothManager->device()->currentSpeed().value();
+            // the session is recorded on an exact 1s grid: a late tick of the timer fills the missed seconds with the
+            // samples interpolated by the fusion stage, an early one doesn't duplicate a second
+            bluetoothdevice *dev = bluetoothManager->device();
+            sensorfusion *fusion = dev->sensorFusion();
+            // the devices feed the fusion at every update: this only covers the ones that stopped sending
+            if (qzclock::secondsSince(dev->metricsPublishedNs()) >= 1.0)
+                dev->publishMetrics();
+            QList<qint64> ticks = fusion->dueTicks(qzclock::nowMs());
+            uint32_t elapsedSeconds = dev->elapsedTime().second() + (dev->elapsedTime().minute() * 60) +
+                                      (dev->elapsedTime().hour() * 3600);
+
+            for (qint64 t : qAsConst(ticks)) {
+                bool filled = t != ticks.last();
+                double tickSpeed = filled ? fusion->valueAt(sensorfusion::SPEED, t) : dev->currentSpeed().value();
+
+                if (tickSpeed > 0 && !isinf(tickSpeed))
+                    dev->addCurrentDistance1s(tickSpeed / 3600.0);
+
+                qDebug() << "Current Distance 1s:" << dev->currentDistance1s().value() << tickSpeed;
+
+                uint32_t tickElapsed = elapsedSeconds;
+                if (filled) {
+                    tickElapsed -= qMin(elapsedSeconds, (uint32_t)((ticks.last() - t) / 1000));
+                    qDebug() << QStringLiteral("filling a missed session sample at") << t;
+                }
 
-            SessionLine s(
-                bluetoothManager->device()->currentSpeed().value(), inclination, bluetoothManager->device()->currentDistance1s().value(),
-                watts, resistance, peloton_resistance, (uint8_t)bluetoothManager->device()->currentHeart().value(),
-                pace, cadence, bluetoothManager->device()->calories().value(),
-                bluetoothManager->device()->elevationGain().value(),
-                bluetoothManager->device()->elapsedTime().second() +
-                    (bluetoothManager->device()->elapsedTime().minute() * 60) +
-                    (bluetoothManager->device()->elapsedTime().hour() * 3600),
+                SessionLine s(
+                    tickSpeed, inclination, dev->currentDistance1s().value(),
+                    filled ? fusion->valueAt(sensorfusion::POWER, t) : watts, resistance, peloton_resistance,
+                    (uint8_t)(filled ? fusion->valueAt(sensorfusion::HEART, t) : dev->currentHeart().value()), pace,
+                    filled ? fusion->valueAt(sensorfusion::CADENCE, t) : cadence, dev->calories().value(),
+                    dev->elevationGain().value(), tickElapsed,
 
-                lapTrigger, totalStrokes, avgStrokesRate, maxStrokesRate, avgStrokesLength,
-                bluetoothManager->device()->currentCordinate(), strideLength, groundContact, verticalOscillation, stepCount);
+                    lapTrigger && !filled, totalStrokes, avgStrokesRate, maxStrokesRate, avgStrokesLength,
+                    dev->currentCordinate(), strideLength, groundContact, verticalOscillation, stepCount,
+                    QDateTime::fromMSecsSinceEpoch(fusion->wallTime(t)));
 
-            Session.append(s);
+                Session.append(s);
+                journalSample(s);
+                if (exporter)
+                    exporter->append(s);
+            }
+            if (!ticks.isEmpty())
+                latencymonitor::record(latencymonitor::SESSION, dev->ingressNs());
 
-            if (lapTrigger) {
+            if (lapTrigger && !ticks.isEmpty()) {
                 lapTrigger = false;
             }
 
@@ -5914,10 +6075,6 @@ void homeform::trainprogram_open_clicked(const QUrl &fileName) {
 
     if (!file.fileName().isEmpty()) {
         {
-            if (previewTrainProgram) {
-                delete previewTrainProgram;
-                previewTrainProgram = 0;
-            }
             if (trainProgram) {
                 delete trainProgram;
             }
@@ -5963,18 +6120,31 @@ void homeform::trainprogram_preview(const QUrl &fileName) {
     qDebug() << fileNameLocal;
     if (!fileNameLocal.isEmpty()) {
         {
-            if (previewTrainProgram) {
-                delete previewTrainProgram;
-                previewTrainProgram = 0;
-            }
-            previewTrainProgram = trainprogram::load(file.fileName(), bluetoothManager, fileNameLocal.right(3).toUpper());
-            emit previewWorkoutPointsChanged(preview_workout_points());
-            emit previewWorkoutDescriptionChanged(previewWorkoutDescription());
-            emit previewWorkoutTagsChanged(previewWorkoutTags());
+            previewFileName = QFileInfo(file.fileName()).absoluteFilePath();
+            previewInfo = library->info(file.fileName());
+            if (!previewInfo.isValid()) {
+                // not indexed yet, or from another folder: the preview is shown when the library is done with it
+                library->request(file.fileName(), fileNameLocal.right(3));
+            }
+            previewChanged();
         }
     }
 }
 
+void homeform::libraryIndexed(const QString &fileName) {
+    if (fileName != previewFileName || previewInfo.isValid())
+        return;
+    previewInfo = library->info(fileName);
+    previewChanged();
+}
+
+void homeform::previewChanged() {
+    emit previewWorkoutPointsChanged(preview_workout_points());
+    emit previewWorkoutDescriptionChanged(previewWorkoutDescription());
+    emit previewWorkoutTagsChanged(previewWorkoutTags());
+    emit previewWorkoutSummaryChanged(previewWorkoutSummary());
+}
+
 void homeform::trainprogram_zwo_loaded(const QString &s) {
     qDebug() << QStringLiteral("trainprogram_zwo_loaded") << s;
     trainProgram = new trainprogram(zwiftworkout::loadJSON(s), bluetoothManager);
@@ -6011,41 +6181,111 @@ void homeform::gpx_save_clicked() {
     }
 }
 
-void homeform::fit_save_clicked() {
-
-    QString path = getWritableAppDir();
+QSharedPointer<const workoutsnapshot> homeform::workoutSnapshot() {
     bluetoothdevice *dev = bluetoothManager->device();
-    if (dev) {
-        QString filename = path +
-                           QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
-                           QStringLiteral(".fit");
+    if (!dev)
+        return QSharedPointer<const workoutsnapshot>();
+
+    QSharedPointer<workoutsnapshot> s(new workoutsnapshot());
+    s->session = Session;
+    s->deviceType = dev->deviceType();
+    s->processFlag = qobject_cast<m3ibike *>(dev) ? QFIT_PROCESS_DISTANCENOISE : QFIT_PROCESS_NONE;
+    s->workoutType = stravaPelotonWorkoutType;
+    if (!stravaPelotonActivityName.isEmpty() && !stravaPelotonInstructorName.isEmpty())
+        s->workoutName = stravaPelotonActivityName + " - " + stravaPelotonInstructorName;
+    s->deviceName = dev->bluetoothDevice.name();
+    s->fitFilename = getWritableAppDir() +
+                     QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
+                     QStringLiteral(".fit");
+    QSettings settings;
+    if (settings.value(QZSettings::gpx_autosave, QZSettings::default_gpx_autosave).toBool())
+        s->gpxFilename = s->fitFilename.left(s->fitFilename.length() - 4) + QStringLiteral(".gpx");
+    return s;
+}
 
-        QString workoutName = "";
-        if (!stravaPelotonActivityName.isEmpty() && !stravaPelotonInstructorName.isEmpty())
-            workoutName = stravaPelotonActivityName + " - " + stravaPelotonInstructorName;
+void homeform::finalizeWorkout() {
+    QSharedPointer<const workoutsnapshot> s = workoutSnapshot();
+    if (s.isNull()) {
+        // nothing to save
+        journal->finish();
+        QFile::remove(journalProgramFileName());
+        return;
+    }
 
-        qfit::save(filename, Session, dev->deviceType(),
-                   qobject_cast<m3ibike *>(dev) ? QFIT_PROCESS_DISTANCENOISE : QFIT_PROCESS_NONE,
-                   stravaPelotonWorkoutType, workoutName, dev->bluetoothDevice.name());
+    mailPending = false;
+    journalFitFileName = s->fitFilename;
+    finalizer->start(s);
+    emit finalizationRunningChanged(finalizer->isRunning());
+}
+
+void homeform::finalizerFitSaved(const QString &filename) {
+    if (filename == journalFitFileName) {
+        journalFitFileName.clear();
+        journal->finish();
+        QFile::remove(journalProgramFileName());
+    }
+    // the upload is one of the stages that cancel() skips
+    if (finalizer->isCancelled()) {
         lastFitFileSaved = filename;
+        return;
+    }
+    fitFileSaved(filename);
+}
 
-        QSettings settings;
-        if (!settings.value(QZSettings::strava_accesstoken, QZSettings::default_strava_accesstoken)
-                 .toString()
-                 .isEmpty()) {
+void homeform::finalizerProgress(int percent, const QString &stage) {
+    qDebug() << QStringLiteral("workout finalization") << stage << percent << QStringLiteral("%");
+    m_finalizationProgress = percent;
+    m_finalizationStage = stage;
+    emit finalizationProgressChanged(m_finalizationProgress);
+    emit finalizationRunningChanged(finalizer->isRunning());
+}
 
-            QString mode = settings.value(QZSettings::strava_upload_mode, QZSettings::default_strava_upload_mode).toString();
-            if(mode.startsWith("Always")) { // always
-                strava_upload_file_prepare();
-            } else if(mode.startsWith("Request")) {
-                setStravaUploadRequested(true);
-                emit stravaUploadRequestedChanged(true);
-            }
+void homeform::workout_finalization_cancel() {
+    qDebug() << QStringLiteral("workout_finalization_cancel");
+    finalizer->cancel();
+}
+
+void homeform::finalizerFinished(bool cancelled) {
+    emit finalizationRunningChanged(finalizer->isRunning());
+    if (cancelled)
+        setToastRequested(QStringLiteral("Workout saving cancelled"));
+    if (mailPending && !cancelled) {
+        mailPending = false;
+        sendMail();
+    }
+}
+
+void homeform::fit_save_clicked() {
+
+    QSharedPointer<const workoutsnapshot> s = workoutSnapshot();
+    if (!s.isNull()) {
+        qfit::save(s->fitFilename, s->session, s->deviceType, s->processFlag, s->workoutType, s->workoutName,
+                   s->deviceName);
+        fitFileSaved(s->fitFilename);
+    }
+}
+
+void homeform::fitFileSaved(const QString &filename) {
+    lastFitFileSaved = filename;
+
+    QSettings settings;
+    if (!settings.value(QZSettings::strava_accesstoken, QZSettings::default_strava_accesstoken)
+             .toString()
+             .isEmpty()) {
+
+        QString mode = settings.value(QZSettings::strava_upload_mode, QZSettings::default_strava_upload_mode).toString();
+        if(mode.startsWith("Always")) { // always
+            strava_upload_file_prepare();
+        } else if(mode.startsWith("Request")) {
+            setStravaUploadRequested(true);
+            emit stravaUploadRequestedChanged(true);
         }
     }
 }
 
 void homeform::strava_upload_file_prepare() {
+    // kept until Strava confirms the upload, so it's retried at the next launch if the app is closed meanwhile
+    workoutfinalizer::setPendingUpload(lastFitFileSaved);
     QFile f(lastFitFileSaved);
     f.open(QFile::OpenModeFlag::ReadOnly);
     QByteArray fitfile = f.readAll();
@@ -6397,6 +6637,10 @@ void homeform::writeFileCompleted() {
 
     qDebug() << "reply:" << response;
 
+    if (reply->error() == QNetworkReply::NoError) {
+        workoutfinalizer::clearPendingUpload();
+    }
+
     setToastRequested("Strava Upload Completed!");
 }
 
@@ -6644,9 +6888,8 @@ void homeform::setVideoRate(double value) {
 void homeform::smtpError(SmtpClient::SmtpError e) { qDebug() << QStringLiteral("SMTP ERROR") << e; }
 
 QByteArray homeform::currentPelotonImage() {
-    if (pelotonHandler && pelotonHandler->current_image_downloaded &&
-        !pelotonHandler->current_image_downloaded->downloadedData().isEmpty())
-        return pelotonHandler->current_image_downloaded->downloadedData();
+    if (pelotonHandler)
+        return pelotonHandler->currentImage();
     return QByteArray();
 }
 
@@ -6654,6 +6897,16 @@ void homeform::sendMail() {
 
     QSettings settings;
 
+    // the chart images are owned by the mail stage from now on, it removes them once the mail is sent
+    QList<QString> images = chartImagesFilenames;
+    chartImagesFilenames.clear();
+    auto removeImages = [images]() {
+        qDebug() << "removing chart images";
+        for (const QString &f : images) {
+            QFile::remove(f);
+        }
+    };
+
     bool miles = settings.value(QZSettings::miles_unit, QZSettings::default_miles_unit).toBool();
     double unit_conversion = 1.0;
     double meter_feet_conversion = 1.0;
@@ -6664,6 +6917,7 @@ void homeform::sendMail() {
     // TODO: add a condition to avoid sending mail when the user look at the chart while is riding
     if (settings.value(QZSettings::user_email, QZSettings::default_user_email).toString().length() == 0 ||
         !bluetoothManager->device()) {
+        removeImages();
         return;
     }
 
@@ -6678,56 +6932,33 @@ void homeform::sendMail() {
 #ifdef SMTP_SERVER
 #define _STR(x) #x
 #define STRINGIFY(x) _STR(x)
-    SmtpClient smtp(STRINGIFY(SMTP_SERVER), 587, SmtpClient::TlsConnection);
-    connect(&smtp, SIGNAL(smtpError(SmtpClient::SmtpError)), this, SLOT(smtpError(SmtpClient::SmtpError)));
 #else
 #pragma message "stmp server is unset!"
-    SmtpClient smtp(QLatin1String(""), 25, SmtpClient::TlsConnection);
+    removeImages();
     return;
 #endif
-
-// We need to set the username (your email address) and the password
-// for smtp authentication.
-#ifdef SMTP_PASSWORD
-#define _STR(x) #x
-#define STRINGIFY(x) _STR(x)
-    smtp.setUser(STRINGIFY(SMTP_USERNAME));
-#else
+#ifndef SMTP_PASSWORD
 #pragma message "smtp username is unset!"
-    return;
-#endif
-#ifdef SMTP_PASSWORD
-#define _STR(x) #x
-#define STRINGIFY(x) _STR(x)
-    smtp.setPassword(STRINGIFY(SMTP_PASSWORD));
-#else
-#pragma message "smtp password is unset!"
+    removeImages();
     return;
 #endif
 
-    // Now we create a MimeMessage object. This will be the email.
-
-    MimeMessage message;
+    // the heavy scans were already done by the summary stage of the finalization pipeline
+    workoutsummary summary = finalizer->summary();
+    if (!summary.valid) {
+        summary = workoutsummary::compute(&Session);
+    }
 
-    message.setSender(new EmailAddress(QStringLiteral("no-reply@qzapp.it"), QStringLiteral("QZ")));
-    message.addRecipient(new EmailAddress(settings.value(QZSettings::user_email, QLatin1String("")).toString(),
-                                          settings.value(QZSettings::user_email, QLatin1String("")).toString()));
+    QString recipient = settings.value(QZSettings::user_email, QLatin1String("")).toString();
+    QString subject = QStringLiteral("Test");
     if (!Session.isEmpty()) {
-        QString title = Session.constFirst().time.toString();
+        subject = Session.constFirst().time.toString();
         if (!stravaPelotonActivityName.isEmpty()) {
-            title +=
+            subject +=
                 QStringLiteral(" ") + stravaPelotonActivityName + QStringLiteral(" - ") + stravaPelotonInstructorName;
         }
-        message.setSubject(title);
-    } else {
-        message.setSubject(QStringLiteral("Test"));
     }
 
-    // Now add some text to the email.
-    // First we create a MimeText object.
-
-    MimeText text;
-
     QString textMessage = QStringLiteral("Great workout!\n\n");
 
     if (pelotonHandler) {
@@ -6781,26 +7012,26 @@ void homeform::sendMail() {
         QStringLiteral("Moving Time: ") + bluetoothManager->device()->movingTime().toString() + QStringLiteral("\n");
     textMessage += QStringLiteral("Weight Loss (") + weightLossUnit + "): " + QString::number(WeightLoss, 'f', 2) +
                    QStringLiteral("\n");
-    textMessage += QStringLiteral("Estimated VO2Max: ") + QString::number(metric::calculateVO2Max(&Session), 'f', 0) +
+    textMessage += QStringLiteral("Estimated VO2Max: ") + QString::number(summary.vo2max, 'f', 0) +
                    QStringLiteral("\n");
     if(bluetoothManager->device()->deviceType() == bluetoothdevice::BLUETOOTH_TYPE::TREADMILL) {
         textMessage += QStringLiteral("Running Stress Score: ") + QString::number(((treadmill*)bluetoothManager->device())->runningStressScore(), 'f', 0) +
                        QStringLiteral("\n");
     }
-    double peak = metric::powerPeak(&Session, 5);
+    double peak = summary.peak5s;
     double weightKg = settings.value(QZSettings::weight, QZSettings::default_weight).toFloat();
     textMessage += QStringLiteral("5 Seconds Power: ") + QString::number(peak, 'f', 0) +
                    QStringLiteral("W ") + QString::number(peak/weightKg, 'f', 1) + QStringLiteral("W/Kg\n");
-    peak = metric::powerPeak(&Session, 60);
+    peak = summary.peak1m;
     textMessage += QStringLiteral("1 Minute Power: ") + QString::number(peak, 'f', 0) +
                    QStringLiteral("W ") + QString::number(peak/weightKg, 'f', 1) + QStringLiteral("W/Kg\n");
-    peak = metric::powerPeak(&Session, 5 * 60);
+    peak = summary.peak5m;
     textMessage += QStringLiteral("5 Minutes Power: ") + QString::number(peak, 'f', 0) +
                    QStringLiteral("W ") + QString::number(peak/weightKg, 'f', 1) + QStringLiteral("W/Kg\n");    
 
     // FTP
     double ftpSetting = settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-    peak = (metric::powerPeak(&Session, 20 * 60) * 0.95) * 0.95;
+    peak = (summary.peak20m * 0.95) * 0.95;
     textMessage += QStringLiteral("Estimated FTP: ") + QString::number(peak, 'f', 0) +
                    QStringLiteral("W ");
     if(peak > ftpSetting) {
@@ -6893,115 +7124,125 @@ void homeform::sendMail() {
     textMessage += QStringLiteral("\n\nSMTP server: ") + QString(STRINGIFY(SMTP_SERVER));
 #endif
 
-    text.setText(textMessage);
-    message.addPart(&text);
-
-    for (const QString &f : qAsConst(chartImagesFilenames)) {
-
-        // Create a MimeInlineFile object for each image
-        MimeInlineFile *image = new MimeInlineFile((new QFile(f)));
-
-        // An unique content id must be setted
-        image->setContentId(f);
-        image->setContentType(QStringLiteral("image/jpg"));
-        message.addPart(image);
-    }
-
-    if (!lastFitFileSaved.isEmpty()) {
-
-        // Create a MimeInlineFile object for each image
-        MimeInlineFile *fit = new MimeInlineFile((new QFile(lastFitFileSaved)));
-
-        // An unique content id must be setted
-        fit->setContentId(lastFitFileSaved);
-        fit->setContentType(QStringLiteral("application/octet-stream"));
-        message.addPart(fit);
-    }
-
-    if (!lastTrainProgramFileSaved.isEmpty()) {
-
-        // Create a MimeInlineFile object for each image
-        MimeInlineFile *xml = new MimeInlineFile((new QFile(lastTrainProgramFileSaved)));
-
-        // An unique content id must be setted
-        xml->setContentId(lastTrainProgramFileSaved);
-        xml->setContentType(QStringLiteral("application/octet-stream"));
-        message.addPart(xml);
-        lastTrainProgramFileSaved = "";
-    }
-
-    QString filenameJPG = QStringLiteral("");
-    if (pelotonHandler && pelotonHandler->current_image_downloaded &&
-        !pelotonHandler->current_image_downloaded->downloadedData().isEmpty()) {
-
-        QString path = getWritableAppDir();
-        QString filename = path +
-                           QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
-                           QStringLiteral("_peloton_image.png");
-        filenameJPG =
-            path + QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
-            QStringLiteral("_peloton_image.jpg");
-        QFile file(filename);
-        file.open(QIODevice::WriteOnly);
-        file.write(pelotonHandler->current_image_downloaded->downloadedData());
-        file.close();
-        QImage image(filename);
-        QImageWriter writer(filename, "png");
-        writer.setFileName(filenameJPG);
-        writer.setFormat("jpg");
-        writer.setQuality(30);
-        writer.write(image);
-        QFile::remove(filename);        
-
-        // Create a MimeInlineFile object for each image
-        MimeInlineFile *pelotonImage = new MimeInlineFile((new QFile(filenameJPG)));
-
-        // An unique content id must be setted
-        pelotonImage->setContentId(filenameJPG);
-        pelotonImage->setContentType(QStringLiteral("image/jpg"));
-        message.addPart(pelotonImage);
-    }
-
-    /* THE SMTP SERVER DOESN'T LIKE THE ZIP FILE
-    extern QString logfilename;
-    if (settings.value(QZSettings::log_debug).toBool() && QFile::exists(getWritableAppDir() + logfilename)) {
-        QString fileName = getWritableAppDir() + logfilename;
-        QFile f(fileName);
-        f.open(QIODevice::ReadOnly);
-        QTextStream ts(&f);
-        QByteArray b = f.readAll();
-        f.close();
-        QByteArray c = qCompress(b, 9);
-        QFile fc(fileName.replace(".log", ".zip"));
-        fc.open(QIODevice::WriteOnly);
-        c.remove(0, 4);
-        fc.write(c);
-        fc.close();
-
-        // Create a MimeInlineFile object for each image
-        MimeInlineFile *log = new MimeInlineFile((new QFile(fileName)));
-
-        // An unique content id must be setted
-        log->setContentId(fileName);
-        log->setContentType(QStringLiteral("application/octet-stream"));
-        message.addPart(log);
-    }*/
-
-    bool r = false;
-    uint8_t i = 0;
-    while (!r) {
-        qDebug() << "trying to send email #" << i;
-        r = smtp.connectToHost();
-        r = smtp.login();
-        r = smtp.sendMail(message);
-        if (i++ == 3)
-            break;
+    QString fitFile = lastFitFileSaved;
+    QString trainProgramFile = lastTrainProgramFileSaved;
+    lastTrainProgramFileSaved = "";
+
+    QByteArray pelotonImage;
+    if (pelotonHandler) {
+        pelotonImage = pelotonHandler->currentImage();
     }
-    smtp.quit();
+    QString path = getWritableAppDir();
+
+    // the image conversion and the SMTP session are blocking (up to 4 retries), they run on the finalization pool
+    bool queued = finalizer->runStage(QStringLiteral("mail"), [=]() {
+#if defined(SMTP_SERVER) && defined(SMTP_PASSWORD)
+        SmtpClient smtp(STRINGIFY(SMTP_SERVER), 587, SmtpClient::TlsConnection);
+        QObject::connect(&smtp, &SmtpClient::smtpError,
+                         [](SmtpClient::SmtpError e) { qDebug() << QStringLiteral("SMTP ERROR") << e; });
+
+        // We need to set the username (your email address) and the password
+        // for smtp authentication.
+        smtp.setUser(STRINGIFY(SMTP_USERNAME));
+        smtp.setPassword(STRINGIFY(SMTP_PASSWORD));
+
+        // Now we create a MimeMessage object. This will be the email.
+
+        MimeMessage message;
+
+        message.setSender(new EmailAddress(QStringLiteral("no-reply@qzapp.it"), QStringLiteral("QZ")));
+        message.addRecipient(new EmailAddress(recipient, recipient));
+        message.setSubject(subject);
+
+        // Now add some text to the email.
+        // First we create a MimeText object.
+
+        MimeText text;
+        text.setText(textMessage);
+        message.addPart(&text);
+
+        for (const QString &f : images) {
+
+            // Create a MimeInlineFile object for each image
+            MimeInlineFile *image = new MimeInlineFile((new QFile(f)));
+
+            // An unique content id must be setted
+            image->setContentId(f);
+            image->setContentType(QStringLiteral("image/jpg"));
+            message.addPart(image);
+        }
+
+        if (!fitFile.isEmpty()) {
+
+            MimeInlineFile *fit = new MimeInlineFile((new QFile(fitFile)));
+
+            // An unique content id must be setted
+            fit->setContentId(fitFile);
+            fit->setContentType(QStringLiteral("application/octet-stream"));
+            message.addPart(fit);
+        }
+
+        if (!trainProgramFile.isEmpty()) {
+
+            MimeInlineFile *xml = new MimeInlineFile((new QFile(trainProgramFile)));
+
+            // An unique content id must be setted
+            xml->setContentId(trainProgramFile);
+            xml->setContentType(QStringLiteral("application/octet-stream"));
+            message.addPart(xml);
+        }
+
+        QString filenameJPG = QStringLiteral("");
+        if (!pelotonImage.isEmpty()) {
+            QString filename = path +
+                               QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
+                               QStringLiteral("_peloton_image.png");
+            filenameJPG =
+                path + QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
+                QStringLiteral("_peloton_image.jpg");
+            QFile file(filename);
+            file.open(QIODevice::WriteOnly);
+            file.write(pelotonImage);
+            file.close();
+            QImage image(filename);
+            QImageWriter writer(filename, "png");
+            writer.setFileName(filenameJPG);
+            writer.setFormat("jpg");
+            writer.setQuality(30);
+            writer.write(image);
+            QFile::remove(filename);
+
+            // Create a MimeInlineFile object for each image
+            MimeInlineFile *pelotonImageFile = new MimeInlineFile((new QFile(filenameJPG)));
+
+            // An unique content id must be setted
+            pelotonImageFile->setContentId(filenameJPG);
+            pelotonImageFile->setContentType(QStringLiteral("image/jpg"));
+            message.addPart(pelotonImageFile);
+        }
+
+        bool r = false;
+        uint8_t i = 0;
+        while (!r) {
+            qDebug() << "trying to send email #" << i;
+            r = smtp.connectToHost();
+            r = smtp.login();
+            r = smtp.sendMail(message);
+            if (i++ == 3)
+                break;
+        }
+        smtp.quit();
 
-    // delete image variable
-    if(!filenameJPG.isEmpty())
-        QFile::remove(filenameJPG);
+        // delete image variable
+        if (!filenameJPG.isEmpty())
+            QFile::remove(filenameJPG);
+#endif
+        removeImages();
+    });
+
+    if (!queued) {
+        removeImages();
+    }
 }
 
 #if defined(Q_OS_ANDROID)
@@ -7156,6 +7397,74 @@ void homeform::restart() {
 #endif
 }
 
+bool homeform::heartRateControllerTarget() {
+    QSettings settings;
+    bluetoothdevice *dev = bluetoothManager->device();
+    double hrMin = 0;
+    double hrMax = 0;
+    double maxSpeed = 30;
+    double minSpeed = 0;
+    double maxResistance = 100;
+    trainrow row;
+    if (trainProgram)
+        row = trainProgram->currentRow();
+
+    QString zoneSetting =
+        settings.value(QZSettings::treadmill_pid_heart_zone, QZSettings::default_treadmill_pid_heart_zone).toString();
+    uint8_t zone = 0;
+    if (row.zoneHR > 0)
+        zone = row.zoneHR;
+    else if (!zoneSetting.contains(QStringLiteral("Disabled")))
+        zone = zoneSetting.toUInt();
+
+    if (zone > 0) {
+        // zone N is between the (N-1)th and the Nth threshold (percentage of the max heart rate). The controller
+        // aims at the middle half of the zone so small fluctuations don't leave it.
+        const double thresholds[] = {
+            0,
+            settings.value(QZSettings::heart_rate_zone1, QZSettings::default_heart_rate_zone1).toDouble(),
+            settings.value(QZSettings::heart_rate_zone2, QZSettings::default_heart_rate_zone2).toDouble(),
+            settings.value(QZSettings::heart_rate_zone3, QZSettings::default_heart_rate_zone3).toDouble(),
+            settings.value(QZSettings::heart_rate_zone4, QZSettings::default_heart_rate_zone4).toDouble(),
+            100};
+        zone = qMin(zone, (uint8_t)5);
+        double maxHeartRate = heartRateMax();
+        double low = (thresholds[zone - 1] * maxHeartRate) / 100.0;
+        double high = (thresholds[zone] * maxHeartRate) / 100.0;
+        hrMin = low + ((high - low) / 4.0);
+        hrMax = high - ((high - low) / 4.0);
+    } else if (row.HRmin > 0 && row.HRmax > 0) {
+        hrMin = row.HRmin;
+        hrMax = row.HRmax;
+    } else if (settings.value(QZSettings::treadmill_pid_heart_min, QZSettings::default_treadmill_pid_heart_min)
+                       .toInt() > 0 &&
+               settings.value(QZSettings::treadmill_pid_heart_max, QZSettings::default_treadmill_pid_heart_max)
+                       .toInt() > 0) {
+        hrMin = settings.value(QZSettings::treadmill_pid_heart_min, QZSettings::default_treadmill_pid_heart_min)
+                    .toInt();
+        hrMax = settings.value(QZSettings::treadmill_pid_heart_max, QZSettings::default_treadmill_pid_heart_max)
+                    .toInt();
+    } else {
+        hrController->release();
+        return false;
+    }
+
+    if (row.maxSpeed > 0)
+        maxSpeed = row.maxSpeed;
+    if (row.minSpeed > 0)
+        minSpeed = row.minSpeed;
+    if (row.maxResistance > 0)
+        maxResistance = row.maxResistance;
+
+    hrController->setDevice(dev);
+    if (!stopped && !paused && dev->currentHeart().value() && dev->currentSpeed().value() > 0.0f) {
+        hrController->setTarget(hrMin, hrMax, minSpeed, maxSpeed, maxResistance);
+    } else {
+        hrController->release();
+    }
+    return true;
+}
+
 double homeform::heartRateMax() {
     QSettings settings;
     double maxHeartRate = 220.0 - settings.value(QZSettings::age, QZSettings::default_age).toDouble();
@@ -7182,12 +7491,28 @@ void homeform::clearFiles() {
     }
 }
 
-int homeform::preview_workout_points() {
-    if (previewTrainProgram) {
-        QTime d = previewTrainProgram->duration();
-        return (d.hour() * 3600) + (d.minute() * 60) + d.second();
-    }
-    return 0;
+int homeform::preview_workout_points() { return previewInfo.duration; }
+
+QString homeform::previewWorkoutSummary() {
+    if (!previewInfo.isValid() || previewInfo.duration == 0)
+        return QLatin1String("");
+    QString s = QTime(0, 0, 0).addSecs(previewInfo.duration).toString(QStringLiteral("h:mm:ss"));
+    if (previewInfo.distance > 0)
+        s += QStringLiteral(" - ") + QString::number(previewInfo.distance, 'f', 1) + QStringLiteral(" km");
+    if (previewInfo.tss > 0)
+        s += QStringLiteral(" - TSS ") + QString::number(previewInfo.tss, 'f', 0) + QStringLiteral(" - IF ") +
+             QString::number(previewInfo.intensityFactor, 'f', 2);
+    return s;
+}
+
+QStringList homeform::searchTrainPrograms(const QString &text) {
+    QStringList l;
+    if (text.isEmpty())
+        return l;
+    const QList<workoutinfo> found = library->search(text);
+    for (const workoutinfo &i : found)
+        l.append(QFileInfo(i.fileName).fileName());
+    return l;
 }
 
 #if defined(Q_OS_WIN) || (defined(Q_OS_MAC) && !defined(Q_OS_IOS)) || (defined(Q_OS_ANDROID) && defined(LICENSE))
@@ -7301,3 +7626,123 @@ void homeform::videoSeekPosition(int ms) {
     auto videoPlaybackHalfPlayer = qvariant_cast<QMediaPlayer *>(videoPlaybackHalf->property("mediaObject"));
     videoPlaybackHalfPlayer->setPosition(ms);
 }
+
+QString homeform::journalFileName() { return getWritableAppDir() + QStringLiteral("QZ-journal.bin"); }
+
+QString homeform::journalProgramFileName() { return getWritableAppDir() + QStringLiteral("QZ-journal.xml"); }
+
+void homeform::journalSample(const SessionLine &s) {
+    bluetoothdevice *dev = bluetoothManager->device();
+    // the journal of the interrupted workout stays on disk until the user chooses to resume it or not, the one of the
+    // stopped workout until its FIT file is written: the new workout is journaled from its start afterwards
+    if (!dev || journalStatsPending || m_journalResumeRequested || !journalFitFileName.isEmpty())
+        return;
+
+    bool begun = false;
+    if (!journal->isOpen()) {
+        if (!journal->begin(journalFileName(), dev->deviceType()))
+            return;
+        if (trainProgram) {
+            trainprogram::saveXML(journalProgramFileName(), trainProgram->rows);
+        }
+        // the samples recorded while the resume prompt was open too
+        for (const SessionLine &line : qAsConst(Session)) {
+            journal->appendSample(line);
+        }
+        begun = true;
+    }
+
+    journalstate state;
+    QTime elapsed = dev->elapsedTime();
+    state.elapsed = elapsed.hour() * 3600 + elapsed.minute() * 60 + elapsed.second() + (elapsed.msec() / 1000.0);
+    QTime moving = dev->movingTime();
+    state.moving = moving.hour() * 3600 + moving.minute() * 60 + moving.second();
+    state.odometer = dev->odometer();
+    state.distance1s = dev->currentDistance1s().value();
+    state.calories = dev->calories().value();
+    state.elevationGain = dev->elevationGain().value();
+    state.jouls = dev->jouls().value();
+    if (trainProgram && trainProgram->isStarted()) {
+        state.programStep = trainProgram->currentStepIndex();
+        state.programTicks = trainProgram->elapsedTicks();
+        state.programOffset = trainProgram->offsetElapsedTime();
+        state.programStepDistance = trainProgram->currentStepTraveled();
+    }
+    if (!begun) {
+        journal->appendSample(s);
+    }
+    journal->appendState(state);
+}
+
+void homeform::journal_resume() {
+    m_journalResumeRequested = false;
+    emit journalResumeRequestedChanged(false);
+
+    if (!recoveredJournal.valid)
+        return;
+
+    qDebug() << QStringLiteral("resuming the workout from the journal") << recoveredJournal.started
+             << recoveredJournal.session.count();
+
+    Session = recoveredJournal.session;
+
+    QList<trainrow> rows = trainprogram::loadXML(
+        journalProgramFileName(), (bluetoothdevice::BLUETOOTH_TYPE)recoveredJournal.deviceType);
+    if (!rows.isEmpty()) {
+        if (trainProgram) {
+            delete trainProgram;
+        }
+        trainProgram = new trainprogram(rows, bluetoothManager);
+        trainProgramSignals();
+    }
+
+    // the workout restarts paused: the user will resume it with the start button
+    paused = true;
+    stopped = false;
+    journalStatsPending = true;
+    if (bluetoothManager->device()) {
+        journalRestoreStats();
+    }
+    emit workoutNameChanged(workoutName());
+    setToastRequested(QStringLiteral("Workout restored, press start to continue"));
+}
+
+void homeform::journalRestoreStats() {
+    bluetoothdevice *dev = bluetoothManager->device();
+    const journalstate &state = recoveredJournal.state;
+
+    if (dev->deviceType() != recoveredJournal.deviceType) {
+        qDebug() << QStringLiteral("journal recorded with a different device type") << recoveredJournal.deviceType
+                 << dev->deviceType();
+    }
+
+    dev->restoreStats(state.elapsed, state.moving, state.odometer, state.distance1s, state.calories,
+                      state.elevationGain, state.jouls);
+    dev->setPaused(true);
+    // after the accumulators, so the program takes the restored odometer as reference
+    if (trainProgram) {
+        trainProgram->resume(state.programStep, state.programTicks, state.programOffset, state.programStepDistance);
+    }
+    journalStatsPending = false;
+
+    // a fresh journal with the whole recovered workout, so a second crash loses nothing
+    if (journal->begin(journalFileName(), dev->deviceType())) {
+        if (trainProgram) {
+            trainprogram::saveXML(journalProgramFileName(), trainProgram->rows);
+        }
+        for (const SessionLine &s : qAsConst(Session)) {
+            journal->appendSample(s);
+        }
+        journal->appendState(state);
+    }
+    recoveredJournal = journalrecovery();
+    qDebug() << QStringLiteral("journal stats restored, elapsed") << state.elapsed;
+}
+
+void homeform::journal_discard() {
+    m_journalResumeRequested = false;
+    emit journalResumeRequestedChanged(false);
+    recoveredJournal = journalrecovery();
+    QFile::remove(journalFileName());
+    QFile::remove(journalProgramFileName());
+}
@@ -3,6 +3,7 @@
 
 #include "PathController.h"
 #include "bluetooth.h"
+#include "heartratecontroller.h"
 #include "fit_profile.hpp"
 #include "gpx.h"
 #include "peloton.h"
@@ -10,9 +11,13 @@
 #include "qmdnsengine/cache.h"
 #include "qmdnsengine/resolver.h"
 #include "screencapture.h"
+#include "metricsexporter.h"
+#include "sessionjournal.h"
 #include "sessionline.h"
 #include "smtpclient/src/SmtpMime"
 #include "trainprogram.h"
+#include "workoutfinalizer.h"
+#include "workoutlibrary.h"
 #include <QChart>
 #include <QColor>
 #include <QGraphicsScene>
@@ -180,12 +185,17 @@ class homeform : public QObject {
     Q_PROPERTY(bool startRequested READ startRequested NOTIFY startRequestedChanged WRITE setStartRequestedChanged)
     Q_PROPERTY(QString toastRequested READ toastRequested NOTIFY toastRequestedChanged WRITE setToastRequested)
     Q_PROPERTY(bool stravaUploadRequested READ stravaUploadRequested NOTIFY stravaUploadRequestedChanged WRITE setStravaUploadRequested)
+    Q_PROPERTY(bool journalResumeRequested READ journalResumeRequested NOTIFY journalResumeRequestedChanged WRITE setJournalResumeRequested)
+    Q_PROPERTY(bool finalizationRunning READ finalizationRunning NOTIFY finalizationRunningChanged)
+    Q_PROPERTY(int finalizationProgress READ finalizationProgress NOTIFY finalizationProgressChanged)
+    Q_PROPERTY(QString finalizationStage READ finalizationStage NOTIFY finalizationProgressChanged)
 
     // workout preview
     Q_PROPERTY(int preview_workout_points READ preview_workout_points NOTIFY previewWorkoutPointsChanged)
     Q_PROPERTY(QList<double> preview_workout_watt READ preview_workout_watt)
     Q_PROPERTY(QString previewWorkoutDescription READ previewWorkoutDescription NOTIFY previewWorkoutDescriptionChanged)
     Q_PROPERTY(QString previewWorkoutTags READ previewWorkoutTags NOTIFY previewWorkoutTagsChanged)
+    Q_PROPERTY(QString previewWorkoutSummary READ previewWorkoutSummary NOTIFY previewWorkoutSummaryChanged)
 
     Q_PROPERTY(bool currentCoordinateValid READ currentCoordinateValid)
     Q_PROPERTY(bool trainProgramLoadedWithVideo READ trainProgramLoadedWithVideo)
@@ -437,6 +447,10 @@ class homeform : public QObject {
     QString pelotonProvider() { return m_pelotonProvider; }
     QString toastRequested() { return m_toastRequested; }
     bool stravaUploadRequested() { return m_stravaUploadRequested; }
+    bool journalResumeRequested() { return m_journalResumeRequested; }
+    bool finalizationRunning() { return finalizer && finalizer->isRunning(); }
+    int finalizationProgress() { return m_finalizationProgress; }
+    QString finalizationStage() { return m_finalizationStage; }
     void setPelotonProvider(const QString &value) { m_pelotonProvider = value; }
     bool generalPopupVisible();
     bool licensePopupVisible();
@@ -493,6 +507,9 @@ class homeform : public QObject {
     void setStravaUploadRequested(bool value) {
         m_stravaUploadRequested = value;
     }
+    void setJournalResumeRequested(bool value) {
+        m_journalResumeRequested = value;
+    }
     void setGeneralPopupVisible(bool value);
     int workout_sample_points() { return Session.count(); }
     int preview_workout_points();
@@ -563,33 +580,17 @@ class homeform : public QObject {
         return l;
     }
 
-    QList<double> preview_workout_watt() {
-        QList<double> l;
-        if (!previewTrainProgram)
-            return l;
-        QTime d = previewTrainProgram->duration();
-        l.reserve((d.hour() * 3600) + (d.minute() * 60) + d.second() + 1);
-        foreach (trainrow r, previewTrainProgram->loadedRows) {
-            for (int i = 0; i < (r.duration.hour() * 3600) + (r.duration.minute() * 60) + r.duration.second(); i++) {
-                l.append(r.power);
-            }
-        }
-        return l;
-    }
+    // a point every workoutinfo::profileStep seconds
+    QList<double> preview_workout_watt() { return previewInfo.profile.toList(); }
 
-    QString previewWorkoutDescription() {
-        if (previewTrainProgram) {
-            return previewTrainProgram->description;
-        }
-        return "";
-    }
+    QString previewWorkoutDescription() { return previewInfo.description; }
 
-    QString previewWorkoutTags() {
-        if (previewTrainProgram) {
-            return previewTrainProgram->tags;
-        }
-        return "";
-    }
+    QString previewWorkoutTags() { return previewInfo.tags; }
+
+    QString previewWorkoutSummary();
+
+    // the names of the indexed programs with the text in the name, in the description or in the tags
+    Q_INVOKABLE QStringList searchTrainPrograms(const QString &text);
 
     bool currentCoordinateValid() {
         if (bluetoothManager && bluetoothManager->device()) {
@@ -612,6 +613,7 @@ class homeform : public QObject {
     DataObject *odometer;
     DataObject *pace;
     DataObject *datetime;
+    DataObject *latency;
     DataObject *resistance;
     DataObject *watt;
     DataObject *avgWatt;
@@ -680,7 +682,11 @@ class homeform : public QObject {
     bluetooth *bluetoothManager;
     QQmlApplicationEngine *engine;
     trainprogram *trainProgram = nullptr;
-    trainprogram *previewTrainProgram = nullptr;
+    // the preview comes from the index of the library, the program is loaded only when it's opened
+    workoutlibrary *library = nullptr;
+    workoutinfo previewInfo;
+    QString previewFileName;
+    void previewChanged();
     QString backupFitFileName =
         QStringLiteral("QZ-backup-") +
         QDateTime::currentDateTime().toString().replace(QStringLiteral(":"), QStringLiteral("_")) +
@@ -711,6 +717,9 @@ class homeform : public QObject {
     QString m_pelotonProvider = "";
     QString m_toastRequested = "";
     bool m_stravaUploadRequested = false;
+    bool m_journalResumeRequested = false;
+    int m_finalizationProgress = 0;
+    QString m_finalizationStage;
     int m_pelotonLoginState = -1;
     int m_pzpLoginState = -1;
     int m_zwiftLoginState = -1;
@@ -730,6 +739,20 @@ class homeform : public QObject {
 
     QList<QString> chartImagesFilenames;
 
+    workoutfinalizer *finalizer = nullptr;
+    heartratecontroller *hrController = nullptr;
+    sessionjournal *journal = nullptr;
+    metricsexporter *exporter = nullptr;
+    journalrecovery recoveredJournal;
+    bool journalStatsPending = false;
+    // the FIT file of the stopped workout: its journal is kept until it's written
+    QString journalFitFileName;
+    QString journalFileName();
+    QString journalProgramFileName();
+    void journalSample(const SessionLine &s);
+    void journalRestoreStats();
+    bool mailPending = false;
+
     bool m_autoresistance = true;
     bool m_stopRequested = false;
     bool m_startRequested = false;
@@ -757,6 +780,7 @@ class homeform : public QObject {
 
     void update();
     double heartRateMax();
+    bool heartRateControllerTarget();
     void backup();
     bool getDevice();
     bool getLap();
@@ -799,6 +823,9 @@ class homeform : public QObject {
     void restoreSettings();
     void saveProfile(QString profilename);
     void restart();
+    QSharedPointer<const workoutsnapshot> workoutSnapshot();
+    void finalizeWorkout();
+    void fitFileSaved(const QString &filename);
     bool pelotonAskStart() { return m_pelotonAskStart; }
     void Minus(const QString &);
     void Plus(const QString &);
@@ -825,6 +852,7 @@ class homeform : public QObject {
     void gpx_open_other_folder(const QUrl &fileName);
     void profile_open_clicked(const QUrl &fileName);
     void trainprogram_preview(const QUrl &fileName);
+    void libraryIndexed(const QString &fileName);
     void gpxpreview_open_clicked(const QUrl &fileName);
     void trainprogram_zwo_loaded(const QString &comp);
     void gpx_open_clicked(const QUrl &fileName);
@@ -862,6 +890,12 @@ class homeform : public QObject {
     void bluetoothDeviceDisconnected();
     void onToastRequested(QString message);
     void strava_upload_file_prepare();
+    void finalizerFitSaved(const QString &filename);
+    void finalizerProgress(int percent, const QString &stage);
+    void finalizerFinished(bool cancelled);
+    void workout_finalization_cancel();
+    void journal_resume();
+    void journal_discard();
 
 #if defined(Q_OS_WIN) || (defined(Q_OS_MAC) && !defined(Q_OS_IOS)) || (defined(Q_OS_ANDROID) && defined(LICENSE))
     void licenseReply(QNetworkReply *reply);
@@ -890,6 +924,9 @@ class homeform : public QObject {
     void changePelotonProvider(QString value);
     void toastRequestedChanged(QString value);
     void stravaUploadRequestedChanged(bool value);
+    void journalResumeRequestedChanged(bool value);
+    void finalizationRunningChanged(bool value);
+    void finalizationProgressChanged(int value);
     void generalPopupVisibleChanged(bool value);
     void licensePopupVisibleChanged(bool value);
     void videoIconVisibleChanged(bool value);
@@ -914,6 +951,7 @@ class homeform : public QObject {
     void previewWorkoutPointsChanged(int value);
     void previewWorkoutDescriptionChanged(QString value);
     void previewWorkoutTagsChanged(QString value);
+    void previewWorkoutSummaryChanged(QString value);
     void stravaAuthUrlChanged(QString value);
     void stravaWebVisibleChanged(bool value);
 
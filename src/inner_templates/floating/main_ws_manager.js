@@ -105,6 +105,7 @@ function main_ws_queue_process(msg) {
 
 function main_ws_connect() {
     let socket = new WebSocket((location.protocol == 'https:'?'wss://' : 'ws://') + host_url + '/' + get_template_name() + '-ws');
+    socket.binaryType = 'arraybuffer';
     socket.onopen = function (event) {
         console.log('Upgrade HTTP connection OK');
         main_ws = socket;
@@ -124,6 +125,12 @@ function main_ws_connect() {
         socket.close();
     };
     socket.onmessage = function (event) {
+        // the binary telemetry, for the pages that include qztelemetry.js
+        if (typeof event.data !== 'string') {
+            if (typeof qz_telemetry_process === 'function')
+                qz_telemetry_process(event.data);
+            return;
+        }
         console.log(event.data);
         let msg = JSON.parse(event.data);
         main_ws_queue_process(msg);
@@ -0,0 +1,100 @@
+// decoder of the binary telemetry of the web server, see templatetelemetry.h for the frames
+const QZ_TELEMETRY_VERSION = 1;
+let qz_telemetry = null;
+
+class QZTelemetry {
+    // onupdate(workout, changed) at every frame, with the names of the fields that changed
+    constructor(onupdate) {
+        this.onupdate = onupdate;
+        this.fields = {};
+        this.workout = {};
+        this.sequence = -1;
+        qz_telemetry = this;
+    }
+
+    // rate: frames per second, 1 to 10, 0 to stop; fields: the names, all of them when empty
+    subscribe(rate, fields) {
+        let el = new MainWSQueueElement({
+            msg: 'telemetry',
+            content: {rate: rate, fields: fields || []}
+        }, function(msg) {
+            if (msg.msg === 'R_telemetry') {
+                return msg.content;
+            }
+            return null;
+        }, 5000, 3);
+        return el.enqueue();
+    }
+
+    process(buffer) {
+        let view = new DataView(buffer);
+        if (view.byteLength < 4 || view.getUint8(0) !== 0x51 || view.getUint8(1) !== 0x5A)
+            return;
+        if (view.getUint8(2) !== QZ_TELEMETRY_VERSION) {
+            console.log('Telemetry version not supported ' + view.getUint8(2));
+            return;
+        }
+        let type = view.getUint8(3);
+        if (type === 0)
+            this.processSchema(view);
+        else
+            this.processFrame(view, type === 1);
+    }
+
+    processSchema(view) {
+        let count = view.getUint8(4);
+        let offset = 5;
+        this.fields = {};
+        for (let i = 0; i < count; i++) {
+            let index = view.getUint8(offset);
+            let type = view.getUint8(offset + 1);
+            let len = view.getUint8(offset + 2);
+            let name = '';
+            for (let k = 0; k < len; k++)
+                name += String.fromCharCode(view.getUint8(offset + 3 + k));
+            this.fields[index] = {name: name, type: type};
+            offset += 3 + len;
+        }
+    }
+
+    processFrame(view, keyframe) {
+        let sequence = view.getUint32(4, true);
+        // a delta is only good on top of the frame before it
+        if (!keyframe && (this.sequence < 0 || sequence !== this.sequence + 1)) {
+            if (this.sequence >= 0)
+                console.log('Telemetry frame lost, waiting for a key frame');
+            this.sequence = -1;
+            return;
+        }
+        this.sequence = sequence;
+        let low = view.getUint32(8, true);
+        let high = view.getUint32(12, true);
+        let offset = 16;
+        let changed = [];
+        for (let i = 0; i < 64; i++) {
+            let present = i < 32 ? (low >>> i) & 1 : (high >>> (i - 32)) & 1;
+            if (!present)
+                continue;
+            let field = this.fields[i];
+            if (!field)
+                return;
+            let value;
+            if (field.type === 1) {
+                value = view.getFloat64(offset, true);
+                offset += 8;
+            } else {
+                value = view.getFloat32(offset, true);
+                offset += 4;
+            }
+            this.workout[field.name] = value;
+            changed.push(field.name);
+        }
+        if (this.onupdate)
+            this.onupdate(this.workout, changed);
+    }
+}
+
+function qz_telemetry_process(buffer) {
+    if (qz_telemetry)
+        qz_telemetry.process(buffer);
+}
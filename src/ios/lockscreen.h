@@ -71,13 +71,6 @@ class lockscreen {
     void eliteAriaFan();
     void eliteAriaFan_fanSpeedRequest(unsigned char speed);
     
-    // Zwift API
-    void zwift_api_decodemessage_player(const char* data, int len);
-    float zwift_api_getaltitude();
-    int zwift_api_getdistance();
-    float zwift_api_getlatitude();
-    float zwift_api_getlongitude();
-    
     // quick actions    
     static void set_action_profile(const char* profile);
     static const char* get_action_profile();
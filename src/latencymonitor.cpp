@@ -0,0 +1,145 @@
+#include "latencymonitor.h"
+#include "qzclock.h"
+#include <QtAlgorithms>
+
+latencyhistogram latencymonitor::histograms[latencymonitor::STAGES];
+std::atomic<qint64> latencymonitor::lastIngress[latencymonitor::STAGES] = {};
+std::atomic<quint64> latencymonitor::packets{0};
+
+int latencyhistogram::bucketOf(qint64 us) {
+    if (us < 0)
+        us = 0;
+    quint64 v = (quint64)us;
+    if (v < (quint64)(subBuckets * 2))
+        return (int)v;
+    int msb = 63 - (int)qCountLeadingZeroBits(v);
+    int shift = msb - subBucketBits;
+    int bucket = ((shift + 1) * subBuckets) + (int)((v >> shift) - subBuckets);
+    return qMin(bucket, buckets - 1);
+}
+
+qint64 latencyhistogram::bucketLowerBound(int bucket) {
+    if (bucket < subBuckets * 2)
+        return bucket;
+    int shift = (bucket / subBuckets) - 1;
+    return (qint64)((bucket % subBuckets) + subBuckets) << shift;
+}
+
+void latencyhistogram::record(qint64 us) {
+    if (us < 0)
+        us = 0;
+    counts[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(us, std::memory_order_relaxed);
+    qint64 m = m_max.load(std::memory_order_relaxed);
+    while (us > m && !m_max.compare_exchange_weak(m, us, std::memory_order_relaxed)) {
+    }
+}
+
+void latencyhistogram::reset() {
+    for (int i = 0; i < buckets; i++)
+        counts[i].store(0, std::memory_order_relaxed);
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+void latencyhistogram::merge(const latencyhistogram &other) {
+    for (int i = 0; i < buckets; i++) {
+        quint64 c = other.counts[i].load(std::memory_order_relaxed);
+        if (c)
+            counts[i].fetch_add(c, std::memory_order_relaxed);
+    }
+    m_count.fetch_add(other.count(), std::memory_order_relaxed);
+    m_sum.fetch_add(other.m_sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    qint64 om = other.max();
+    qint64 m = m_max.load(std::memory_order_relaxed);
+    while (om > m && !m_max.compare_exchange_weak(m, om, std::memory_order_relaxed)) {
+    }
+}
+
+QJsonObject latencyhistogram::toJson(double scale) const {
+    QJsonObject o;
+    o[QStringLiteral("count")] = (double)count();
+    o[QStringLiteral("mean")] = mean() / scale;
+    o[QStringLiteral("p50")] = (double)percentile(50) / scale;
+    o[QStringLiteral("p90")] = (double)percentile(90) / scale;
+    o[QStringLiteral("p99")] = (double)percentile(99) / scale;
+    o[QStringLiteral("p999")] = (double)percentile(99.9) / scale;
+    o[QStringLiteral("max")] = (double)max() / scale;
+    return o;
+}
+
+double latencyhistogram::mean() const {
+    quint64 c = count();
+    if (!c)
+        return 0;
+    return (double)m_sum.load(std::memory_order_relaxed) / (double)c;
+}
+
+qint64 latencyhistogram::percentile(double p) const {
+    // the buckets can move while we read them: count them again instead of trusting m_count
+    quint64 total = 0;
+    for (int i = 0; i < buckets; i++)
+        total += counts[i].load(std::memory_order_relaxed);
+    if (!total)
+        return 0;
+    quint64 rank = (quint64)qMax(1.0, qMin(p, 100.0) / 100.0 * (double)total + 0.5);
+    if (rank >= total)
+        return max();
+    quint64 seen = 0;
+    for (int i = 0; i < buckets; i++) {
+        seen += counts[i].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return qMin(bucketLowerBound(i), max());
+    }
+    return max();
+}
+
+void latencymonitor::record(STAGE stage, qint64 ingressNs) {
+    // no ingress stamp: the driver doesn't tag its packets
+    if (ingressNs <= 0)
+        return;
+    // the consumers poll: count every packet once per stage
+    if (lastIngress[stage].exchange(ingressNs, std::memory_order_relaxed) == ingressNs)
+        return;
+    histograms[stage].record((qzclock::nowNs() - ingressNs) / 1000);
+}
+
+QString latencymonitor::stageName(STAGE stage) {
+    switch (stage) {
+    case METRICS:
+        return QStringLiteral("metrics");
+    case NOTIFY:
+        return QStringLiteral("notify");
+    case DIRCON:
+        return QStringLiteral("dircon");
+    case UI:
+        return QStringLiteral("ui");
+    case SESSION:
+        return QStringLiteral("session");
+    case TEMPLATE:
+        return QStringLiteral("template");
+    default:
+        return QString();
+    }
+}
+
+QJsonObject latencymonitor::toJson() {
+    QJsonObject stages;
+    for (int i = 0; i < STAGES; i++)
+        stages[stageName((STAGE)i)] = histograms[i].toJson();
+    QJsonObject r;
+    r[QStringLiteral("unit")] = QStringLiteral("us");
+    r[QStringLiteral("packets")] = (double)ingressCount();
+    r[QStringLiteral("stages")] = stages;
+    return r;
+}
+
+void latencymonitor::reset() {
+    for (int i = 0; i < STAGES; i++) {
+        histograms[i].reset();
+        lastIngress[i].store(0, std::memory_order_relaxed);
+    }
+    packets.store(0, std::memory_order_relaxed);
+}
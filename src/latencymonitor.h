@@ -0,0 +1,73 @@
+#ifndef LATENCYMONITOR_H
+#define LATENCYMONITOR_H
+
+#include <QJsonObject>
+#include <QString>
+#include <atomic>
+
+/**
+ * @brief Log-linear histogram (HdrHistogram style) of durations in microseconds: 16 buckets for every power of 2, so
+ * every value is kept with a precision better than 7% from 1us to about 12 days. Recording is lock free and never
+ * allocates, so it can be called from any thread. The buckets don't depend on the unit: a caller needing a finer
+ * resolution can record nanoseconds and scale them in toJson.
+ */
+class latencyhistogram {
+  public:
+    void record(qint64 us);
+    void reset();
+    void merge(const latencyhistogram &other);
+    // count, mean, percentiles and max, every value divided by scale
+    QJsonObject toJson(double scale = 1.0) const;
+
+    quint64 count() const { return m_count.load(std::memory_order_relaxed); }
+    // Units: microseconds
+    qint64 max() const { return m_max.load(std::memory_order_relaxed); }
+    double mean() const;
+    // lower bound of the bucket holding the p-th percentile. Units: microseconds
+    qint64 percentile(double p) const;
+
+    static int bucketOf(qint64 us);
+    static qint64 bucketLowerBound(int bucket);
+
+    static const int subBucketBits = 4;
+    static const int subBuckets = 1 << subBucketBits;
+    static const int buckets = subBuckets * 37;
+
+  private:
+    std::atomic<quint64> counts[buckets] = {};
+    std::atomic<quint64> m_count{0};
+    std::atomic<qint64> m_sum{0};
+    std::atomic<qint64> m_max{0};
+};
+
+/**
+ * @brief Latency of the data pipeline. A packet is stamped when a driver receives it (bluetoothdevice::markIngress)
+ * and every stage records how long after that it handled the data:
+ * METRICS: update_metrics published the snapshot
+ * NOTIFY: a virtual device notifier encoded it
+ * DIRCON: the DirCon server wrote it to the sockets
+ * UI: homeform pushed it to the tiles
+ * SESSION: homeform appended it to the session
+ * TEMPLATE: the template clients (web server, tcp client) received it
+ * A stage records every packet only once, even if it reads the same data again.
+ */
+class latencymonitor {
+  public:
+    enum STAGE { METRICS = 0, NOTIFY, DIRCON, UI, SESSION, TEMPLATE, STAGES };
+
+    static void ingress() { packets.fetch_add(1, std::memory_order_relaxed); }
+    static void record(STAGE stage, qint64 ingressNs);
+
+    static latencyhistogram &histogram(STAGE stage) { return histograms[stage]; }
+    static quint64 ingressCount() { return packets.load(std::memory_order_relaxed); }
+    static QString stageName(STAGE stage);
+    static QJsonObject toJson();
+    static void reset();
+
+  private:
+    static latencyhistogram histograms[STAGES];
+    static std::atomic<qint64> lastIngress[STAGES];
+    static std::atomic<quint64> packets;
+};
+
+#endif // LATENCYMONITOR_H
@@ -11,17 +11,24 @@
 #include <QQmlContext>
 
 #include "bluetooth.h"
+#include "devicebridge.h"
+#include "devicefleet.h"
 #include "devices/domyostreadmill/domyostreadmill.h"
 #include "homeform.h"
 #include "mainwindow.h"
 #include "qfit.h"
+#include "qztrace.h"
+#include "startupprofiler.h"
 #include "virtualdevices/virtualtreadmill.h"
 #include <QDir>
 #include <QGuiApplication>
 #include <QOperatingSystemVersion>
 #include <QQmlApplicationEngine>
+#include <QQuickWindow>
 #include <QSettings>
+#include <QSharedPointer>
 #include <QStandardPaths>
+#include <QTimer>
 #ifdef CHARTJS
 #include <QtWebView/QtWebView>
 #endif
@@ -52,6 +59,7 @@ bool testHomeFitnessBudy = false;
 bool testPowerZonePack = false;
 QString peloton_username = "";
 QString peloton_password = "";
+QString peloton_api_url = "https://api.onepeloton.com/";
 QString pzp_username = "";
 QString pzp_password = "";
 bool fit_file_saved_on_quit = false;
@@ -82,6 +90,9 @@ QString logfilename = QStringLiteral("debug-") +
                           .replace(QStringLiteral("."), QStringLiteral("_")) +
                       QStringLiteral(".log");
 QUrl profileToLoad;
+bool simulating = false;
+fleetconfig simulation;
+QString bridgeFile;
 static const QtMessageHandler QT_DEFAULT_MESSAGE_HANDLER = qInstallMessageHandler(0);
 
 QCoreApplication *createApplication(int &argc, char *argv[]) {
@@ -162,6 +173,10 @@ QCoreApplication *createApplication(int &argc, char *argv[]) {
 
             peloton_password = argv[++i];
         }
+        if (!qstrcmp(argv[i], "-peloton-api-url")) {
+
+            peloton_api_url = argv[++i];
+        }
         if (!qstrcmp(argv[i], "-pzp-username")) {
 
             pzp_username = argv[++i];
@@ -185,6 +200,43 @@ QCoreApplication *createApplication(int &argc, char *argv[]) {
         if (!qstrcmp(argv[i], "-fit-file-saved-on-quit")) {
             fit_file_saved_on_quit = true;
         }
+        if (!qstrcmp(argv[i], "-bridge")) {
+            bridgeFile = argv[++i];
+        }
+        if (!qstrcmp(argv[i], "-simulate-devices")) {
+            simulating = true;
+            simulation.devices = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-clients")) {
+            simulation.clients = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-type")) {
+            simulation.type = argv[++i];
+        }
+        if (!qstrcmp(argv[i], "-simulate-profile")) {
+            simulation.profile = telemetryprofile::fromName(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-dropouts")) {
+            simulation.dropoutsPerMinute = atof(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-device-time")) {
+            simulation.deviceInterval = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-client-time")) {
+            simulation.clientInterval = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-control-time")) {
+            simulation.controlInterval = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-duration")) {
+            simulation.duration = atoi(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-seed")) {
+            simulation.seed = atol(argv[++i]);
+        }
+        if (!qstrcmp(argv[i], "-simulate-report")) {
+            simulation.reportFile = argv[++i];
+        }
         if (!qstrcmp(argv[i], "-profile")) {
             QString profileName = argv[++i];
             if (QFile::exists(homeform::getProfileDir() + "/" + profileName + ".qzs")) {
@@ -240,8 +292,7 @@ QCoreApplication *createApplication(int &argc, char *argv[]) {
 
 void myMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg) {
 
-    QSettings settings;
-    static bool logdebug = settings.value(QZSettings::log_debug, QZSettings::default_log_debug).toBool();
+    static bool logdebug = QSettings().value(QZSettings::log_debug, QZSettings::default_log_debug).toBool();
 #if defined(Q_OS_LINUX) // Linux OS does not read settings file for now
     if ((logs == false && !forceQml) || (logdebug == false && forceQml))
 #else
@@ -287,7 +338,21 @@ void myMessageOutput(QtMsgType type, const QMessageLogContext &context, const QS
     (*QT_DEFAULT_MESSAGE_HANDLER)(type, context, msg);
 }
 
+static void logAllSettings() {
+    // ~650 keys: skipped when nobody reads the log
+    if (!qztrace::logEnabled())
+        return;
+    QSettings settings;
+    foreach (QString s, settings.allKeys()) {
+        if (!s.contains(QStringLiteral("password")) && !s.contains("user_email") && !s.contains("username")) {
+
+            qDebug() << s << settings.value(s);
+        }
+    }
+}
+
 int main(int argc, char *argv[]) {
+    startupprofiler::mark("main");
 #ifdef Q_OS_WIN32
     qputenv("QT_MULTIMEDIA_PREFERRED_PLUGINS", "windowsmediafoundation");
 #endif
@@ -403,13 +468,24 @@ int main(int argc, char *argv[]) {
 #endif
     
     qInstallMessageHandler(myMessageOutput);
-    qDebug() << QStringLiteral("version ") << app->applicationVersion();
-    foreach (QString s, settings.allKeys()) {
-        if (!s.contains(QStringLiteral("password")) && !s.contains("user_email") && !s.contains("username")) {
-
-            qDebug() << s << settings.value(s);
-        }
+    {
+        // same rule of myMessageOutput: the devices don't build their debug strings if they are going to be dropped
+        bool logdebug = settings.value(QZSettings::log_debug, QZSettings::default_log_debug).toBool();
+#if defined(Q_OS_LINUX)
+        qztrace::setLogEnabled(forceQml ? logdebug : logs);
+#else
+        qztrace::setLogEnabled(logdebug);
+#endif
+        if (settings.value(QZSettings::trace_enabled, QZSettings::default_trace_enabled).toBool())
+            qztrace::setCategories(qztrace::ALL);
     }
+    qDebug() << QStringLiteral("version ") << app->applicationVersion();
+#if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
+    // with the UI the settings are logged after the first frame
+    if (!forceQml)
+        logAllSettings();
+#endif
+    startupprofiler::mark("settings");
 
 #if 0
     qDebug() << "-";
@@ -432,7 +508,20 @@ int main(int argc, char *argv[]) {
 
 #if !defined(Q_OS_ANDROID) && !defined(Q_OS_IOS)
     if (!forceQml) {
-        if (onlyVirtualBike) {
+        if (simulating) {
+            devicefleet *fleet = new devicefleet(simulation);
+            QObject::connect(fleet, &devicefleet::finished, [&]() { app->exit(0); });
+            fleet->start();
+            return app->exec();
+        } else if (!bridgeFile.isEmpty()) {
+            QList<bridgemachine> machines = bridgemachine::load(bridgeFile);
+            if (machines.isEmpty())
+                return 1;
+            devicebridge bridge(machines);
+            if (!bridge.start())
+                return 1;
+            return app->exec();
+        } else if (onlyVirtualBike) {
             virtualbike V(new bike(), noWriteResistance,
                           noHeartService); // FIXED: clang-analyzer-cplusplus.NewDeleteLeaks - potential leak
 
@@ -447,7 +536,7 @@ int main(int argc, char *argv[]) {
         } else if (testPeloton) {
             settings.setValue(QZSettings::peloton_username, peloton_username);
             settings.setValue(QZSettings::peloton_password, peloton_password);
-            peloton *p = new peloton(0, 0);
+            peloton *p = new peloton(0, 0, peloton_api_url);
             p->setTestMode(true);
             QObject::connect(p, &peloton::loginState, [&](bool ok) {
                 if (ok) {
@@ -571,6 +660,7 @@ int main(int argc, char *argv[]) {
     bluetooth bl(logs, deviceName, noWriteResistance, noHeartService, pollDeviceTime, noConsole, testResistance,
                  bikeResistanceOffset,
                  bikeResistanceGain); // FIXED: clang-analyzer-cplusplus.NewDeleteLeaks - potential leak
+    startupprofiler::mark("bluetooth");
 
 #ifdef Q_OS_IOS
 #ifndef IO_UNDER_QT
@@ -606,9 +696,28 @@ int main(int argc, char *argv[]) {
         engine.rootContext()->setContextProperty("CHARTJS", QVariant(false));
 #endif
         engine.load(url);
+        startupprofiler::mark("qml");
         homeform *h = new homeform(&engine, &bl);
         QObject::connect(app.data(), &QCoreApplication::aboutToQuit, h,
                          &homeform::aboutToQuit); // NOTE: clazy-unneeded-cast
+        startupprofiler::mark("homeform");
+
+        QQuickWindow *window =
+            engine.rootObjects().isEmpty() ? nullptr : qobject_cast<QQuickWindow *>(engine.rootObjects().constFirst());
+        if (window) {
+            // frameSwapped comes from the render thread: the window as context queues the lambda to this thread
+            QSharedPointer<QMetaObject::Connection> firstFrame(new QMetaObject::Connection);
+            *firstFrame = QObject::connect(window, &QQuickWindow::frameSwapped, window, [firstFrame]() {
+                // more frames could already be queued
+                if (!QObject::disconnect(*firstFrame))
+                    return;
+                startupprofiler::mark("first frame");
+                startupprofiler::report();
+                QTimer::singleShot(0, logAllSettings);
+            });
+        } else {
+            logAllSettings();
+        }
 
         {
 #ifdef Q_OS_ANDROID
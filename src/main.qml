@@ -43,6 +43,9 @@ ApplicationWindow {
     signal floatingOpen()
     signal openFloatingWindowBrowser();
     signal strava_upload_file_prepare();
+    signal journal_resume();
+    signal journal_discard();
+    signal workout_finalization_cancel();
 
     property bool lockTiles: false
     property bool settings_restart_to_apply: false
@@ -404,6 +407,44 @@ ApplicationWindow {
         visible: rootItem.stravaUploadRequested
     }
 
+    MessageDialog {
+        text: "Unfinished workout"
+        informativeText: "The last workout was interrupted. Do you want to resume it?"
+        buttons: (MessageDialog.Yes | MessageDialog.No)
+        onYesClicked: {journal_resume(); rootItem.journalResumeRequested = false;}
+        onNoClicked: {journal_discard(); rootItem.journalResumeRequested = false;}
+        visible: rootItem.journalResumeRequested
+    }
+
+    Popup {
+        id: popupFinalization
+        x: Math.round((parent.width - width) / 2)
+        y: parent.height - height - 20
+        width: Math.min(parent.width - 20, 500)
+        modal: false
+        focus: false
+        closePolicy: Popup.NoAutoClose
+        visible: rootItem.finalizationRunning
+        Row {
+            spacing: 10
+            Label {
+                anchors.verticalCenter: parent.verticalCenter
+                text: qsTr("Saving the workout") + " (" + rootItem.finalizationStage + ")"
+            }
+            ProgressBar {
+                anchors.verticalCenter: parent.verticalCenter
+                width: popupFinalization.width - 260
+                from: 0
+                to: 100
+                value: rootItem.finalizationProgress
+            }
+            Button {
+                text: qsTr("Cancel")
+                onClicked: workout_finalization_cancel()
+            }
+        }
+    }
+
     header: ToolBar {
         contentHeight: toolButton.implicitHeight
         Material.primary: settings.theme_status_bar_background_color
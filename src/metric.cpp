@@ -40,12 +40,12 @@ void metric::setValue(double v, bool applyGainAndOffset) {
         }
     }
 
-    QDateTime now = QDateTime::currentDateTime();
+    qint64 nowNs = qzclock::nowNs();
     if (v != m_value && v != INFINITY) {
-        m_valueChanged = now;
+        m_valueChangedNs = nowNs;
         if (m_last5.count() > 1) {
             double diff = v - m_value;
-            double diffFromLastValue = qAbs(now.msecsTo(m_lastChanged));
+            double diffFromLastValue = (double)(nowNs - m_lastChangedNs) / 1e6;
             if (diffFromLastValue > 0)
                 m_rateAtSec = diff * (1000.0 / diffFromLastValue);
             else
@@ -54,7 +54,7 @@ void metric::setValue(double v, bool applyGainAndOffset) {
     }
 
     // it has to be here, even if the value is the same, due to https://github.com/cagnulein/qdomyos-zwift/issues/1325
-    m_lastChanged = now;
+    m_lastChangedNs = nowNs;
 
     m_value = v;
 
@@ -186,6 +186,8 @@ double metric::average20s() {
 }
 
 
+void metric::restore(double value) { m_offset = m_value - value; }
+
 void metric::operator=(double v) { setValue(v); }
 
 void metric::operator+=(double v) { setValue(m_value + v); }
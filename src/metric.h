@@ -2,6 +2,7 @@
 #define METRIC_H
 
 #include "qdebugfixup.h"
+#include "qzclock.h"
 #include "sessionline.h"
 #include <QDateTime>
 #include <math.h>
@@ -22,8 +23,9 @@ class metric {
     void setValue(double value, bool applyGainAndOffset = true);
     double value();
     double valueRaw();
-    QDateTime lastChanged() { return m_lastChanged; }
-    QDateTime valueChanged() { return m_valueChanged; }
+    // when the device last sent the value, and when it last changed, on the monotonic clock (qzclock). Units: ns
+    qint64 lastChangedNs() { return m_lastChangedNs; }
+    qint64 valueChangedNs() { return m_valueChangedNs; }
     double average();
     double average5s();
     double average20s();
@@ -40,6 +42,8 @@ class metric {
     double lapMax();
     void clearLap(bool accumulator);
     void clear(bool accumulator);
+    // moves an accumulator back to a previous value (e.g. a resumed workout) keeping the raw value of the device
+    void restore(double value);
     void operator=(double);
     void operator+=(double);
     void setPaused(bool p);
@@ -71,8 +75,8 @@ class metric {
     double m_lapMin = 999999999;
     double m_lapMax = 0;
 
-    QDateTime m_lastChanged = QDateTime::currentDateTime();
-    QDateTime m_valueChanged = QDateTime::currentDateTime();
+    qint64 m_lastChangedNs = qzclock::nowNs();
+    qint64 m_valueChangedNs = qzclock::nowNs();
     double m_rateAtSec = 0;
 
     _metric_type m_type = METRIC_OTHER;
@@ -0,0 +1,431 @@
+#include "metricsexporter.h"
+#include "qzsettings.h"
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QHostInfo>
+#include <QMutexLocker>
+#include <QSettings>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <QUdpSocket>
+#include <cmath>
+
+// the lines of a datagram, under the usual MTU
+static const int maxDatagram = 1400;
+// the collector doesn't keep up: the next batches wait on the disk
+static const qint64 maxPendingTcp = 1024 * 1024;
+
+metricsspool::metricsspool(const QString &fileName, qint64 limit) : fileName(fileName), limit(limit) {}
+
+qint64 metricsspool::size() const { return fileName.isEmpty() ? 0 : QFileInfo(fileName).size(); }
+
+bool metricsspool::append(const QByteArray &lines, int *dropped) {
+    if (dropped)
+        *dropped = 0;
+    if (fileName.isEmpty())
+        return false;
+    QByteArray out = lines;
+    if (size() + lines.size() > limit) {
+        // the oldest lines go, down to three quarters of the limit so that the file isn't rewritten at every batch
+        out = take() + lines;
+        qint64 target = qMax(limit * 3 / 4, qMin<qint64>(limit, lines.size()));
+        int start = 0;
+        while (out.size() - start > target) {
+            int end = out.indexOf('\n', start);
+            start = end < 0 ? out.size() : end + 1;
+        }
+        if (dropped)
+            *dropped = out.left(start).count('\n');
+        out = out.mid(start);
+    }
+    QFile output(fileName);
+    if (!output.open(QIODevice::WriteOnly | QIODevice::Append))
+        return false;
+    return output.write(out) == out.size();
+}
+
+QByteArray metricsspool::take() {
+    QFile input(fileName);
+    if (fileName.isEmpty() || !input.open(QIODevice::ReadOnly))
+        return QByteArray();
+    QByteArray lines = input.readAll();
+    input.close();
+    QFile::remove(fileName);
+    return lines;
+}
+
+metricsexporter::config metricsexporter::config::fromSettings() {
+    QSettings settings;
+    config c;
+    QString transport =
+        settings.value(QZSettings::metrics_export_transport, QZSettings::default_metrics_export_transport)
+            .toString()
+            .toLower();
+    if (transport == QStringLiteral("udp"))
+        c.transport = UDP;
+    else if (transport == QStringLiteral("tcp"))
+        c.transport = TCP;
+    c.host = settings.value(QZSettings::metrics_export_host, QZSettings::default_metrics_export_host).toString();
+    c.port = settings.value(QZSettings::metrics_export_port, QZSettings::default_metrics_export_port).toUInt();
+    c.httpPort =
+        settings.value(QZSettings::metrics_export_http_port, QZSettings::default_metrics_export_http_port).toUInt();
+    if (c.host.isEmpty())
+        c.transport = NONE;
+    return c;
+}
+
+metricsexporter::metricsexporter(const config &c, QObject *parent)
+    : QObject(parent), m_config(c), m_spool(c.spoolFileName, c.spoolLimit) {
+    m_thread.setObjectName(QStringLiteral("metricsexporter"));
+    m_worker = new QObject();
+    m_worker->moveToThread(&m_thread);
+    m_thread.start();
+    QMetaObject::invokeMethod(m_worker, [this]() { startWorker(); });
+}
+
+metricsexporter::~metricsexporter() {
+    // the last samples are sent or spooled, and the sockets deleted on their thread
+    QMetaObject::invokeMethod(m_worker, [this]() { stopWorker(); }, Qt::BlockingQueuedConnection);
+    m_thread.quit();
+    m_thread.wait();
+    delete m_worker;
+}
+
+static const char *typeName(bluetoothdevice::BLUETOOTH_TYPE type) {
+    switch (type) {
+    case bluetoothdevice::TREADMILL:
+        return "treadmill";
+    case bluetoothdevice::BIKE:
+        return "bike";
+    case bluetoothdevice::ROWING:
+        return "rowing";
+    case bluetoothdevice::ELLIPTICAL:
+        return "elliptical";
+    case bluetoothdevice::JUMPROPE:
+        return "jumprope";
+    default:
+        return "unknown";
+    }
+}
+
+QByteArray metricsexporter::tags(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type) {
+    QByteArray device = name.toUtf8();
+    // the line protocol escapes commas, equal signs and spaces of the tags
+    QByteArray escaped;
+    for (char c : device) {
+        if (c == ',' || c == '=' || c == ' ')
+            escaped.append('\\');
+        escaped.append(c);
+    }
+    QByteArray t;
+    if (!escaped.isEmpty())
+        t += ",device=" + escaped;
+    t += QByteArray(",type=") + typeName(type);
+    return t;
+}
+
+QByteArray metricsexporter::labels(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type) {
+    QByteArray device = name.toUtf8();
+    QByteArray escaped;
+    for (char c : device) {
+        if (c == '\\' || c == '"')
+            escaped.append('\\');
+        if (c == '\n')
+            escaped.append("\\n");
+        else
+            escaped.append(c);
+    }
+    return "device=\"" + escaped + "\",type=\"" + typeName(type) + "\"";
+}
+
+// the fields of a sample, without the ones the device doesn't have
+static QList<QPair<const char *, double>> fields(const SessionLine &s) {
+    QList<QPair<const char *, double>> f = {
+        {"speed", s.speed},
+        {"inclination", double(s.inclination)},
+        {"distance", s.distance},
+        {"watts", double(s.watt)},
+        {"resistance", double(s.resistance)},
+        {"peloton_resistance", double(s.peloton_resistance)},
+        {"heart", double(s.heart)},
+        {"cadence", double(s.cadence)},
+        {"calories", s.calories},
+        {"elevation", s.elevationGain},
+        {"elapsed", double(s.elapsedTime)},
+    };
+    if (s.coordinate.isValid()) {
+        f.append({"latitude", s.coordinate.latitude()});
+        f.append({"longitude", s.coordinate.longitude()});
+    }
+    for (int i = f.count() - 1; i >= 0; i--) {
+        if (!std::isfinite(f.at(i).second))
+            f.removeAt(i);
+    }
+    return f;
+}
+
+QByteArray metricsexporter::lineProtocol(const QString &measurement, const QByteArray &tags, const SessionLine &s) {
+    QByteArray line;
+    for (char c : measurement.toUtf8()) {
+        if (c == ',' || c == ' ')
+            line.append('\\');
+        line.append(c);
+    }
+    line += tags;
+    char separator = ' ';
+    for (const auto &f : fields(s)) {
+        line.append(separator);
+        line += f.first;
+        line.append('=');
+        line += QByteArray::number(f.second, 'g', 12);
+        separator = ',';
+    }
+    if (separator == ' ')
+        return QByteArray();
+    line.append(' ');
+    line += QByteArray::number(s.time.toMSecsSinceEpoch() * 1000000LL);
+    line.append('\n');
+    return line;
+}
+
+QByteArray metricsexporter::prometheus(const QString &measurement, const QByteArray &labels, const SessionLine &s) {
+    QByteArray out;
+    QByteArray prefix = measurement.toUtf8() + "_";
+    for (const auto &f : fields(s)) {
+        QByteArray name = prefix + f.first;
+        out += "# TYPE " + name + " gauge\n";
+        out += name + "{" + labels + "} " + QByteArray::number(f.second, 'g', 12) + "\n";
+    }
+    return out;
+}
+
+void metricsexporter::setDevice(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type) {
+    QMutexLocker locker(&m_mutex);
+    m_tags = tags(name, type);
+    m_labels = labels(name, type);
+}
+
+void metricsexporter::append(const SessionLine &s) {
+    bool full = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        m_last = s;
+        m_hasLast = true;
+        if (m_config.transport == NONE)
+            return;
+        if (m_queue.count() >= m_config.queueCapacity) {
+            m_queue.removeFirst();
+            m_dropped++;
+        }
+        m_queue.append(s);
+        full = m_queue.count() >= m_config.batchSize;
+    }
+    if (full && !m_flushPending.exchange(true))
+        QMetaObject::invokeMethod(m_worker, [this]() { flush(); });
+}
+
+void metricsexporter::startWorker() {
+    if (m_config.transport != NONE) {
+        m_timer = new QTimer();
+        connect(m_timer, &QTimer::timeout, m_worker, [this]() { flush(); });
+        m_timer->start(m_config.flushInterval);
+    }
+
+    if (m_config.transport == UDP) {
+        m_udp = new QUdpSocket();
+        m_address = QHostAddress(m_config.host);
+        if (m_address.isNull())
+            resolve();
+        qDebug() << QStringLiteral("metricsexporter: udp") << m_config.host << m_config.port;
+    } else if (m_config.transport == TCP) {
+        m_tcp = new QTcpSocket();
+        // the spool goes out as soon as the collector is back
+        connect(m_tcp, &QTcpSocket::connected, m_worker, [this]() { flush(); });
+        connect(m_tcp, &QTcpSocket::bytesWritten, m_worker, [this](qint64 bytes) { written(bytes); });
+        connect(m_tcp, &QTcpSocket::stateChanged, m_worker, [this](QAbstractSocket::SocketState state) {
+            if (state == QAbstractSocket::UnconnectedState)
+                requeue();
+        });
+        m_tcp->connectToHost(m_config.host, m_config.port);
+        qDebug() << QStringLiteral("metricsexporter: tcp") << m_config.host << m_config.port;
+    }
+
+    if (m_config.httpPort) {
+        m_http = new QTcpServer();
+        connect(m_http, &QTcpServer::newConnection, m_worker, [this]() {
+            while (QTcpSocket *client = m_http->nextPendingConnection())
+                serve(client);
+        });
+        if (!m_http->listen(QHostAddress::Any, m_config.httpPort))
+            qDebug() << QStringLiteral("metricsexporter: unable to listen on") << m_config.httpPort;
+    }
+}
+
+void metricsexporter::stopWorker() {
+    if (m_tcp)
+        m_tcp->waitForBytesWritten(1000);
+    flush();
+    if (m_tcp) {
+        m_tcp->waitForBytesWritten(1000);
+        // what is still in the buffer is spooled for the next session rather than lost
+        requeue();
+        m_tcp->abort();
+    }
+    delete m_timer;
+    delete m_udp;
+    delete m_tcp;
+    delete m_http;
+    m_timer = nullptr;
+    m_udp = nullptr;
+    m_tcp = nullptr;
+    m_http = nullptr;
+}
+
+void metricsexporter::resolve() {
+    if (m_lookupPending)
+        return;
+    m_lookupPending = true;
+    QHostInfo::lookupHost(m_config.host, m_worker, [this](const QHostInfo &info) {
+        m_lookupPending = false;
+        if (!info.addresses().isEmpty())
+            m_address = info.addresses().first();
+        qDebug() << QStringLiteral("metricsexporter: resolved") << m_config.host << m_address;
+    });
+}
+
+bool metricsexporter::canDeliver() {
+    if (m_tcp) {
+        if (m_tcp->state() == QAbstractSocket::UnconnectedState)
+            m_tcp->connectToHost(m_config.host, m_config.port);
+        return m_tcp->state() == QAbstractSocket::ConnectedState && m_tcp->bytesToWrite() <= maxPendingTcp;
+    }
+    // the name didn't resolve yet: tried again at every batch
+    if (m_udp && m_address.isNull())
+        resolve();
+    return m_udp && !m_address.isNull();
+}
+
+void metricsexporter::written(qint64 bytes) {
+    // the socket writes its buffer in order, so the lines written are the first ones in flight
+    m_sent += m_inFlight.left(bytes).count('\n');
+    m_inFlight.remove(0, bytes);
+}
+
+void metricsexporter::requeue() {
+    if (m_inFlight.isEmpty())
+        return;
+    qint64 count = m_inFlight.count('\n');
+    QByteArray lines = m_inFlight + m_spool.take();
+    m_inFlight.clear();
+    int lost = 0;
+    if (m_spool.append(lines, &lost)) {
+        m_spooled += count;
+        m_dropped += lost;
+    } else {
+        m_dropped += lines.count('\n');
+    }
+}
+
+qint64 metricsexporter::deliver(const QByteArray &lines) {
+    if (m_tcp) {
+        qint64 n = qMax<qint64>(0, m_tcp->write(lines));
+        m_inFlight += lines.left(n);
+        return n;
+    }
+
+    int start = 0;
+    while (start < lines.size()) {
+        int end = lines.size();
+        if (end - start > maxDatagram) {
+            end = lines.lastIndexOf('\n', start + maxDatagram - 1) + 1;
+            // a line longer than a datagram goes alone
+            if (end <= start)
+                end = lines.indexOf('\n', start) + 1;
+            if (end <= start)
+                end = lines.size();
+        }
+        if (m_udp->writeDatagram(lines.constData() + start, end - start, m_address, m_config.port) < 0)
+            break;
+        start = end;
+    }
+    return start;
+}
+
+void metricsexporter::flush() {
+    m_flushPending = false;
+    QList<SessionLine> batch;
+    QByteArray tags;
+    {
+        QMutexLocker locker(&m_mutex);
+        batch.swap(m_queue);
+        tags = m_tags;
+    }
+
+    // the spool first, so that the collector gets the samples in order; it stays on the disk while the collector
+    // can't take it
+    bool ready = canDeliver();
+    if (ready && !m_spool.isEmpty()) {
+        QByteArray spooled = m_spool.take();
+        qint64 n = deliver(spooled);
+        if (!m_tcp)
+            m_sent += spooled.left(n).count('\n');
+        if (n < spooled.size()) {
+            int lost = 0;
+            m_spool.append(spooled.mid(n), &lost);
+            m_dropped += lost;
+        } else {
+            qDebug() << QStringLiteral("metricsexporter: spool sent") << spooled.size();
+        }
+    }
+
+    QByteArray lines;
+    for (const SessionLine &s : qAsConst(batch))
+        lines += lineProtocol(m_config.measurement, tags, s);
+    if (lines.isEmpty())
+        return;
+
+    qint64 n = ready && m_spool.isEmpty() ? deliver(lines) : 0;
+    // on tcp the lines are counted when the socket writes them
+    if (!m_tcp)
+        m_sent += lines.left(n).count('\n');
+    if (n < lines.size()) {
+        QByteArray rest = lines.mid(n);
+        int lost = 0;
+        if (m_spool.append(rest, &lost)) {
+            m_spooled += rest.count('\n');
+            m_dropped += lost;
+        } else {
+            m_dropped += rest.count('\n');
+        }
+    }
+}
+
+void metricsexporter::serve(QTcpSocket *client) {
+    connect(client, &QTcpSocket::disconnected, client, &QObject::deleteLater);
+    connect(client, &QTcpSocket::readyRead, client, [this, client]() {
+        if (!client->canReadLine())
+            return;
+        QByteArray request = client->readLine();
+        QByteArray path = request.split(' ').value(1);
+        QByteArray body, status = "200 OK";
+        if (path == "/metrics") {
+            QMutexLocker locker(&m_mutex);
+            if (m_hasLast)
+                body = prometheus(m_config.measurement, m_labels, m_last);
+            QByteArray prefix = m_config.measurement.toUtf8() + "_export_";
+            body += "# TYPE " + prefix + "sent_total counter\n" + prefix + "sent_total " +
+                    QByteArray::number(m_sent.load()) + "\n";
+            body += "# TYPE " + prefix + "spooled_total counter\n" + prefix + "spooled_total " +
+                    QByteArray::number(m_spooled.load()) + "\n";
+            body += "# TYPE " + prefix + "dropped_total counter\n" + prefix + "dropped_total " +
+                    QByteArray::number(m_dropped.load()) + "\n";
+        } else {
+            status = "404 Not Found";
+        }
+        client->write("HTTP/1.1 " + status + "\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: " +
+                      QByteArray::number(body.size()) + "\r\nConnection: close\r\n\r\n" + body);
+        client->disconnectFromHost();
+    });
+}
@@ -0,0 +1,123 @@
+#ifndef METRICSEXPORTER_H
+#define METRICSEXPORTER_H
+
+#include "devices/bluetoothdevice.h"
+#include "sessionline.h"
+#include <QHostAddress>
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QThread>
+#include <atomic>
+
+class QTcpServer;
+class QTcpSocket;
+class QTimer;
+class QUdpSocket;
+
+// the lines that the collector didn't take, on the disk until it is back
+class metricsspool {
+  public:
+    metricsspool(const QString &fileName, qint64 limit);
+
+    // when the spool is full the oldest lines make room for these ones, dropped counts them; false without the file
+    bool append(const QByteArray &lines, int *dropped = nullptr);
+    // all the lines, the spool is empty afterwards
+    QByteArray take();
+    bool isEmpty() const { return size() == 0; }
+    qint64 size() const;
+
+  private:
+    QString fileName;
+    qint64 limit;
+};
+
+/**
+ * @brief Streams the session samples to a time-series collector on the LAN, as InfluxDB line protocol over UDP or
+ * TCP, and serves the last sample in the Prometheus text format on an HTTP port. append only copies the sample in a
+ * bounded queue: the batches are sent every second from a worker thread, so the network never slows the session
+ * path. While the collector is unreachable, or too slow on TCP, the lines go to a spool file that is sent first when
+ * it is back; the oldest samples are dropped when the queue or the spool are full.
+ */
+class metricsexporter : public QObject {
+    Q_OBJECT
+
+  public:
+    enum TRANSPORT { NONE = 0, UDP, TCP };
+
+    class config {
+      public:
+        TRANSPORT transport = NONE;
+        QString host;
+        quint16 port = 8094;
+        quint16 httpPort = 0; // 0 without the pull endpoint
+        QString measurement = QStringLiteral("qz");
+        int batchSize = 50;
+        int flushInterval = 1000; // ms
+        int queueCapacity = 3600;
+        QString spoolFileName;
+        qint64 spoolLimit = 8 * 1024 * 1024;
+
+        bool isEnabled() const { return transport != NONE || httpPort; }
+        static config fromSettings();
+    };
+
+    explicit metricsexporter(const config &c, QObject *parent = nullptr);
+    ~metricsexporter();
+
+    void setDevice(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type);
+    // thread safe, never waits for the network
+    void append(const SessionLine &s);
+
+    // in lines, sent when the socket wrote them
+    qint64 sent() const { return m_sent.load(); }
+    qint64 spooled() const { return m_spooled.load(); }
+    qint64 dropped() const { return m_dropped.load(); }
+
+    static QByteArray lineProtocol(const QString &measurement, const QByteArray &tags, const SessionLine &s);
+    static QByteArray prometheus(const QString &measurement, const QByteArray &labels, const SessionLine &s);
+    // the tags of the line protocol and the labels of prometheus for the device
+    static QByteArray tags(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type);
+    static QByteArray labels(const QString &name, bluetoothdevice::BLUETOOTH_TYPE type);
+
+  private:
+    // worker thread
+    void startWorker();
+    void stopWorker();
+    void flush();
+    // whether the collector can take the lines now: the spool is only read back when it does
+    bool canDeliver();
+    qint64 deliver(const QByteArray &lines);
+    void resolve();
+    void written(qint64 bytes);
+    // the lines the tcp socket didn't write go back to the spool, before the ones already there
+    void requeue();
+    void serve(QTcpSocket *client);
+
+    config m_config;
+    metricsspool m_spool;
+    QThread m_thread;
+    QObject *m_worker = nullptr;
+    QTimer *m_timer = nullptr;
+    QUdpSocket *m_udp = nullptr;
+    QTcpSocket *m_tcp = nullptr;
+    QTcpServer *m_http = nullptr;
+    QHostAddress m_address;
+    bool m_lookupPending = false;
+    // the lines given to the tcp socket and not written yet
+    QByteArray m_inFlight;
+
+    mutable QMutex m_mutex;
+    QList<SessionLine> m_queue;
+    SessionLine m_last;
+    bool m_hasLast = false;
+    QByteArray m_tags;
+    QByteArray m_labels;
+
+    std::atomic<bool> m_flushPending{false};
+    std::atomic<qint64> m_sent{0};
+    std::atomic<qint64> m_spooled{0};
+    std::atomic<qint64> m_dropped{0};
+};
+
+#endif // METRICSEXPORTER_H
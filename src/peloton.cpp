@@ -1,11 +1,15 @@
 #include "peloton.h"
+#include <QImage>
+#include <QStandardPaths>
 #include <chrono>
 
 using namespace std::chrono_literals;
 
 const bool log_request = true;
 
-peloton::peloton(bluetooth *bl, QObject *parent) : QObject(parent) {
+peloton::peloton(bluetooth *bl, QObject *parent, const QString &apiUrl)
+    : QObject(parent), apiUrl(apiUrl),
+      cache(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/peloton")) {
 
     QSettings settings;
     bluetoothManager = bl;
@@ -490,8 +494,7 @@ void peloton::startEngine() {
 
     QSettings settings;
     timer->stop();
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::login_onfinish);
-    QUrl url(QStringLiteral("https://api.onepeloton.com/auth/login"));
+    QUrl url(apiUrl + QStringLiteral("auth/login"));
     QNetworkRequest request(url);
 
     request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
@@ -505,12 +508,14 @@ void peloton::startEngine() {
     QJsonDocument doc(obj);
     QByteArray data = doc.toJson();
 
-    mgr->post(request, data);
+    QNetworkReply *reply = mgr->post(request, data);
+    connect(reply, &QNetworkReply::finished, this, [this, reply]() {
+        login_onfinish(reply);
+        reply->deleteLater();
+    });
 }
 
 void peloton::login_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::login_onfinish);
-
     QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     QJsonDocument document = QJsonDocument::fromJson(payload, &parseError);
@@ -540,8 +545,6 @@ void peloton::login_onfinish(QNetworkReply *reply) {
 }
 
 void peloton::workoutlist_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::workoutlist_onfinish);
-
     QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     current_workout = QJsonDocument::fromJson(payload, &parseError);
@@ -573,7 +576,10 @@ void peloton::workoutlist_onfinish(QNetworkReply *reply) {
         qDebug() << QStringLiteral("peloton::workoutlist_onfinish workoutlist_onfinish IN PROGRESS!");
 
         if ((bluetoothManager && bluetoothManager->device()) || testMode) {
+            workoutRequests++;
+            // the summary is only logged, the workout doesn't wait for it
             getSummary(id);
+            getWorkout(id);
             timer->start(1min); // timeout request
             current_workout_status = status;
         } else {
@@ -596,8 +602,6 @@ void peloton::workoutlist_onfinish(QNetworkReply *reply) {
 }
 
 void peloton::summary_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::summary_onfinish);
-
     QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     current_workout_summary = QJsonDocument::fromJson(payload, &parseError);
@@ -607,15 +611,18 @@ void peloton::summary_onfinish(QNetworkReply *reply) {
     } else {
         qDebug() << QStringLiteral("peloton::summary_onfinish");
     }
-
-    getWorkout(current_workout_id);
 }
 
 void peloton::instructor_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::instructor_onfinish);
+    QByteArray payload = reply->readAll(); // JSON
+    if (reply->error() == QNetworkReply::NoError) {
+        cache.setInstructor(current_instructor_id, payload);
+    }
+    instructorLoaded(payload);
+}
 
+void peloton::instructorLoaded(const QByteArray &payload) {
     QSettings settings;
-    QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     instructor = QJsonDocument::fromJson(payload, &parseError);
     current_instructor_name = instructor.object()[QStringLiteral("name")].toString();
@@ -639,12 +646,8 @@ void peloton::instructor_onfinish(QNetworkReply *reply) {
     }
     emit workoutChanged(current_workout_name, current_instructor_name);
 
-    /*
-    if (workout_name.toUpper().contains(QStringLiteral("POWER ZONE"))) {
-        qDebug() << QStringLiteral("!!Peloton Power Zone Ride Override!!");
-        getPerformance(current_workout_id);
-    } else*/
-    { getRide(current_ride_id); }
+    instructorPending = false;
+    workoutReady();
 }
 
 void peloton::downloadImage() {
@@ -652,14 +655,32 @@ void peloton::downloadImage() {
         delete current_image_downloaded;
         current_image_downloaded = 0;
     }
-    if (!current_image_url.isEmpty()) {
-        current_image_downloaded = new fileDownloader(current_image_url);
+    current_image = cache.image(current_image_url);
+    if (!current_image_url.isEmpty() && current_image.isEmpty()) {
+        fileDownloader *downloader = new fileDownloader(current_image_url);
+        QString url = current_image_url;
+        connect(downloader, &fileDownloader::downloaded, downloader,
+                [this, downloader, url]() {
+                    // an error page is not an image, and it must not stay in the cache
+                    if (!QImage::fromData(downloader->downloadedData()).isNull()) {
+                        cache.setImage(url, downloader->downloadedData());
+                    }
+                });
+        current_image_downloaded = downloader;
     }
 }
 
-void peloton::workout_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::workout_onfinish);
+QByteArray peloton::currentImage() const {
+    if (!current_image.isEmpty()) {
+        return current_image;
+    }
+    if (current_image_downloaded) {
+        return current_image_downloaded->downloadedData();
+    }
+    return QByteArray();
+}
 
+void peloton::workout_onfinish(QNetworkReply *reply) {
     QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     workout = QJsonDocument::fromJson(payload, &parseError);
@@ -683,13 +704,41 @@ void peloton::workout_onfinish(QNetworkReply *reply) {
         qDebug() << QStringLiteral("peloton::workout_onfinish");
     }
 
-    getInstructor(current_instructor_id);
+    // the instructor and the ride don't depend on each other; a recurring class has both in the cache
+    instructorPending = true;
+    ridePending = true;
+
+    QByteArray cachedInstructor = cache.instructor(current_instructor_id);
+    if (!cachedInstructor.isEmpty()) {
+        instructorLoaded(cachedInstructor);
+    } else {
+        getInstructor(current_instructor_id);
+    }
+
+    QString signature = rowsSignature();
+    QByteArray cachedRide;
+    if (!signature.isEmpty() && cache.rows(current_ride_id, signature,
+                                           bluetoothManager->device()->deviceType(), &trainrows)) {
+        qDebug() << QStringLiteral("peloton::workout_onfinish rows from the cache") << trainrows.length();
+        current_api = peloton_api;
+        ridePending = false;
+        workoutReady();
+    } else if (!(cachedRide = cache.ride(current_ride_id)).isEmpty()) {
+        rideLoaded(cachedRide);
+    } else {
+        getRide(current_ride_id);
+    }
 }
 
 void peloton::ride_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::ride_onfinish);
-
     QByteArray payload = reply->readAll(); // JSON
+    if (reply->error() == QNetworkReply::NoError) {
+        cache.setRide(current_ride_id, payload);
+    }
+    rideLoaded(payload);
+}
+
+void peloton::rideLoaded(const QByteArray &payload) {
     QJsonParseError parseError;
     QJsonDocument document = QJsonDocument::fromJson(payload, &parseError);
     QJsonObject ride = document.object();
@@ -727,56 +776,64 @@ void peloton::ride_onfinish(QNetworkReply *reply) {
             duration++;
         }
 
-        r.lower_requested_peloton_resistance = resistance_range[QStringLiteral("lower")].toInt();
-        r.upper_requested_peloton_resistance = resistance_range[QStringLiteral("upper")].toInt();
+        trainrowranges &ranges = r.editRanges();
+        ranges.lower_requested_peloton_resistance = resistance_range[QStringLiteral("lower")].toInt();
+        ranges.upper_requested_peloton_resistance = resistance_range[QStringLiteral("upper")].toInt();
 
-        r.lower_cadence = cadence_range[QStringLiteral("lower")].toInt();
-        r.upper_cadence = cadence_range[QStringLiteral("upper")].toInt();
+        ranges.lower_cadence = cadence_range[QStringLiteral("lower")].toInt();
+        ranges.upper_cadence = cadence_range[QStringLiteral("upper")].toInt();
 
-        r.average_requested_peloton_resistance =
-            (r.lower_requested_peloton_resistance + r.upper_requested_peloton_resistance) / 2;
-        r.average_cadence = (r.lower_cadence + r.upper_cadence) / 2;
+        ranges.average_requested_peloton_resistance =
+            (ranges.lower_requested_peloton_resistance + ranges.upper_requested_peloton_resistance) / 2;
+        ranges.average_cadence = (ranges.lower_cadence + ranges.upper_cadence) / 2;
 
         if (bluetoothManager && bluetoothManager->device()) {
             if (bluetoothManager->device()->deviceType() == bluetoothdevice::BIKE) {
-                r.lower_resistance = ((bike *)bluetoothManager->device())
-                                         ->pelotonToBikeResistance(resistance_range[QStringLiteral("lower")].toInt());
-                r.upper_resistance = ((bike *)bluetoothManager->device())
-                                         ->pelotonToBikeResistance(resistance_range[QStringLiteral("upper")].toInt());
-                r.average_resistance = ((bike *)bluetoothManager->device())
-                                           ->pelotonToBikeResistance(r.average_requested_peloton_resistance);
+                ranges.lower_resistance =
+                    ((bike *)bluetoothManager->device())
+                        ->pelotonToBikeResistance(resistance_range[QStringLiteral("lower")].toInt());
+                ranges.upper_resistance =
+                    ((bike *)bluetoothManager->device())
+                        ->pelotonToBikeResistance(resistance_range[QStringLiteral("upper")].toInt());
+                ranges.average_resistance = ((bike *)bluetoothManager->device())
+                                                ->pelotonToBikeResistance(ranges.average_requested_peloton_resistance);
             } else if (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL) {
-                r.lower_resistance =
+                ranges.lower_resistance =
                     ((elliptical *)bluetoothManager->device())
                         ->pelotonToEllipticalResistance(resistance_range[QStringLiteral("lower")].toInt());
-                r.upper_resistance =
+                ranges.upper_resistance =
                     ((elliptical *)bluetoothManager->device())
                         ->pelotonToEllipticalResistance(resistance_range[QStringLiteral("upper")].toInt());
-                r.average_resistance = ((elliptical *)bluetoothManager->device())
-                                           ->pelotonToEllipticalResistance(r.average_requested_peloton_resistance);
+                ranges.average_resistance =
+                    ((elliptical *)bluetoothManager->device())
+                        ->pelotonToEllipticalResistance(ranges.average_requested_peloton_resistance);
             }
         }
 
         // Set for compatibility
         if (difficulty == QStringLiteral("average")) {
-            r.resistance = r.average_resistance;
-            r.requested_peloton_resistance = r.average_requested_peloton_resistance;
-            r.cadence = r.average_cadence;
+            r.resistance = ranges.average_resistance;
+            r.requested_peloton_resistance = ranges.average_requested_peloton_resistance;
+            r.cadence = ranges.average_cadence;
         } else if (difficulty == QStringLiteral("upper")) {
-            r.resistance = r.upper_resistance;
-            r.requested_peloton_resistance = r.upper_requested_peloton_resistance;
-            r.cadence = r.upper_cadence;
+            r.resistance = ranges.upper_resistance;
+            r.requested_peloton_resistance = ranges.upper_requested_peloton_resistance;
+            r.cadence = ranges.upper_cadence;
         } else { // lower
-            r.resistance = r.lower_resistance;
-            r.requested_peloton_resistance = r.lower_requested_peloton_resistance;
-            r.cadence = r.lower_cadence;
+            r.resistance = ranges.lower_resistance;
+            r.requested_peloton_resistance = ranges.lower_requested_peloton_resistance;
+            r.cadence = ranges.lower_cadence;
         }
 
         // in order to have compact rows in the training program to have an Remaining Time tile set correctly
-        if (i == 0 ||
-            (r.lower_requested_peloton_resistance != trainrows.last().lower_requested_peloton_resistance ||
-             r.upper_requested_peloton_resistance != trainrows.last().upper_requested_peloton_resistance ||
-             r.lower_cadence != trainrows.last().lower_cadence || r.upper_cadence != trainrows.last().upper_cadence)) {
+        bool changed = i == 0;
+        if (!changed) {
+            const trainrowranges &last = trainrows.last().ranges();
+            changed = ranges.lower_requested_peloton_resistance != last.lower_requested_peloton_resistance ||
+                      ranges.upper_requested_peloton_resistance != last.upper_requested_peloton_resistance ||
+                      ranges.lower_cadence != last.lower_cadence || ranges.upper_cadence != last.upper_cadence;
+        }
+        if (changed) {
             r.duration = QTime(0, 0, 0).addSecs(duration);
             trainrows.append(r);
         } else {
@@ -806,20 +863,13 @@ void peloton::ride_onfinish(QNetworkReply *reply) {
                         if (peloton_spinups_autoresistance) {
                             double PowerLow = 0.5;
                             double PowerHigh = 0.83;
-                            for (uint32_t i = 0; i < Duration; i++) {
+                            if (Duration > 0) {
                                 trainrow row;
-                                row.duration = QTime(0, 0, 1, 0);
-                                row.rampDuration =
-                                    QTime((Duration - i) / 3600, (Duration - i) / 60, (Duration - i) % 60, 0);
-                                row.rampElapsed = QTime(i / 3600, i / 60, i % 60, 0);
-                                if (PowerHigh > PowerLow) {
-                                    row.power = (PowerLow + (((PowerHigh - PowerLow) / Duration) * i)) *
-                                                settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                                } else {
-                                    row.power = (PowerLow - (((PowerLow - PowerHigh) / Duration) * i)) *
-                                                settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                                }
-                                qDebug() << row.duration << "power" << row.power << row.rampDuration << row.rampElapsed;
+                                row.duration = QTime(0, 0, 0, 0).addSecs(Duration);
+                                row.power = PowerLow * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+                                row.powerTo =
+                                    PowerHigh * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+                                qDebug() << row.duration << "power" << row.power << "to" << row.powerTo;
                                 trainrows.append(row);
                                 atLeastOnePower = true;
                             }
@@ -835,20 +885,12 @@ void peloton::ride_onfinish(QNetworkReply *reply) {
                         uint32_t Duration = len;
                         double PowerLow = 0.5;
                         double PowerHigh = 0.45;
-                        for (uint32_t i = 0; i < Duration; i++) {
+                        if (Duration > 0) {
                             trainrow row;
-                            row.duration = QTime(0, 0, 1, 0);
-                            row.rampDuration =
-                                QTime((Duration - i) / 3600, (Duration - i) / 60, (Duration - i) % 60, 0);
-                            row.rampElapsed = QTime(i / 3600, i / 60, i % 60, 0);
-                            if (PowerHigh > PowerLow) {
-                                row.power = (PowerLow + (((PowerHigh - PowerLow) / Duration) * i)) *
-                                            settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                            } else {
-                                row.power = (PowerLow - (((PowerLow - PowerHigh) / Duration) * i)) *
-                                            settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                            }
-                            qDebug() << row.duration << "power" << row.power << row.rampDuration << row.rampElapsed;
+                            row.duration = QTime(0, 0, 0, 0).addSecs(Duration);
+                            row.power = PowerLow * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+                            row.powerTo = PowerHigh * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+                            qDebug() << row.duration << "power" << row.power << "to" << row.powerTo;
                             trainrows.append(row);
                             atLeastOnePower = true;
                         }
@@ -1086,23 +1128,48 @@ void peloton::ride_onfinish(QNetworkReply *reply) {
         qDebug() << "peloton::ride_onfinish" << trainrows.length();
     }
 
+    QString signature = rowsSignature();
+    if (!trainrows.isEmpty() && !signature.isEmpty()) {
+        cache.setRows(current_ride_id, signature, trainrows);
+    }
+
+    ridePending = false;
+    workoutReady();
+}
+
+void peloton::workoutReady() {
+    if (instructorPending || ridePending) {
+        return;
+    }
+
     if (!trainrows.isEmpty()) {
         emit workoutStarted(current_workout_name, current_instructor_name);
         timer->start(30s); // check for a status changed
     } else {
         // fallback
-        getPerformance(current_workout_id);
+        QByteArray cachedPerformance = cache.performance(current_ride_id);
+        if (!cachedPerformance.isEmpty()) {
+            performanceLoaded(cachedPerformance);
+        } else {
+            getPerformance(current_workout_id);
+        }
     }
 }
 
 void peloton::performance_onfinish(QNetworkReply *reply) {
-    disconnect(mgr, &QNetworkAccessManager::finished, this, &peloton::performance_onfinish);
+    QByteArray payload = reply->readAll(); // JSON
+    // the graph is of the workout, but its targets are of the ride
+    if (reply->error() == QNetworkReply::NoError) {
+        cache.setPerformance(current_ride_id, payload);
+    }
+    performanceLoaded(payload);
+}
 
+void peloton::performanceLoaded(const QByteArray &payload) {
     QSettings settings;
     QString difficulty =
         settings.value(QZSettings::peloton_difficulty, QZSettings::default_peloton_difficulty).toString();
 
-    QByteArray payload = reply->readAll(); // JSON
     QJsonParseError parseError;
     performance = QJsonDocument::fromJson(payload, &parseError);
     current_api = peloton_api;
@@ -1187,7 +1254,7 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
                     if(inc_lower != -100)
                         r.inclination = inc_lower;
                     if(paceintensity_avg != -1) {
-                        r.pace_intensity = paceintensity_lower;
+                        r.editRanges().pace_intensity = paceintensity_lower;
                     }
                 } else if (!difficulty.toUpper().compare(QStringLiteral("UPPER"))) {
                     if(speed_lower != -1)
@@ -1195,7 +1262,7 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
                     if(inc_lower != -100)
                         r.inclination = inc_upper;
                     if(paceintensity_avg != -1) {
-                        r.pace_intensity = paceintensity_upper;
+                        r.editRanges().pace_intensity = paceintensity_upper;
                     }
                 } else {
                     if(speed_lower != -1)
@@ -1203,7 +1270,7 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
                     if(inc_lower != -100)
                         r.inclination = ((inc_upper - inc_lower) / 2.0) + inc_lower;
                     if(paceintensity_avg != -1) {
-                        r.pace_intensity = paceintensity_avg;
+                        r.editRanges().pace_intensity = paceintensity_avg;
                     }
                 }
 
@@ -1215,23 +1282,24 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
                         .toDouble();
 
                 if(inc_lower != -100) {
-                    r.lower_inclination = inc_lower;
-                    r.average_inclination = inc_average;
-                    r.upper_inclination = inc_upper;
+                    trainrowranges &ranges = r.editRanges();
+                    ranges.lower_inclination = inc_lower;
+                    ranges.average_inclination = inc_average;
+                    ranges.upper_inclination = inc_upper;
                     r.inclination *= gain;
                     r.inclination += offset;
-                    r.lower_inclination *= gain;
-                    r.lower_inclination += offset;
-                    r.average_inclination *= gain;
-                    r.average_inclination += offset;
-                    r.upper_inclination *= gain;
-                    r.upper_inclination += offset;
+                    ranges.lower_inclination *= gain;
+                    ranges.lower_inclination += offset;
+                    ranges.average_inclination *= gain;
+                    ranges.average_inclination += offset;
+                    ranges.upper_inclination *= gain;
+                    ranges.upper_inclination += offset;
                 }
 
                 if(speed_lower != -1) {
-                    r.lower_speed = speed_lower * miles;
-                    r.average_speed = speed_average * miles;
-                    r.upper_speed = speed_upper * miles;
+                    r.editRanges().lower_speed = speed_lower * miles;
+                    r.editRanges().average_speed = speed_average * miles;
+                    r.editRanges().upper_speed = speed_upper * miles;
                 }
                 trainrows.append(r);
                 qDebug() << i << r.duration << r.speed << r.inclination;
@@ -1279,34 +1347,34 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
                 }
 
                 if (pace_intensity_lower >= 0 && pace_intensity_lower < 5) {
-                    r.average_speed =
+                    r.editRanges().average_speed =
                         (rowerpaceToSpeed(rower_pace[pace_intensity_lower].levels[peloton_rower_level].fast_pace) +
                          rowerpaceToSpeed(rower_pace[pace_intensity_lower].levels[peloton_rower_level].slow_pace)) /
                         2.0;
-                    r.upper_speed =
+                    r.editRanges().upper_speed =
                         rowerpaceToSpeed(rower_pace[pace_intensity_lower].levels[peloton_rower_level].fast_pace);
-                    r.lower_speed =
+                    r.editRanges().lower_speed =
                         rowerpaceToSpeed(rower_pace[pace_intensity_lower].levels[peloton_rower_level].slow_pace);
 
                     if (!difficulty.toUpper().compare(QStringLiteral("LOWER"))) {
-                        r.pace_intensity = pace_intensity_lower;
-                        r.speed = r.lower_speed;
+                        r.editRanges().pace_intensity = pace_intensity_lower;
+                        r.speed = r.ranges().lower_speed;
                     } else if (!difficulty.toUpper().compare(QStringLiteral("UPPER"))) {
-                        r.pace_intensity = pace_intensity_upper;
-                        r.speed = r.upper_speed;
+                        r.editRanges().pace_intensity = pace_intensity_upper;
+                        r.speed = r.ranges().upper_speed;
                     } else {
-                        r.pace_intensity = (pace_intensity_upper + pace_intensity_lower) / 2;
-                        r.speed = r.average_speed;
+                        r.editRanges().pace_intensity = (pace_intensity_upper + pace_intensity_lower) / 2;
+                        r.speed = r.ranges().average_speed;
                     }
                     r.forcespeed = 1;
                 }                
 
-                r.lower_cadence = strokes_rate_lower;
-                r.average_cadence = strokes_rate_average;
-                r.upper_cadence = strokes_rate_upper;
+                r.editRanges().lower_cadence = strokes_rate_lower;
+                r.editRanges().average_cadence = strokes_rate_average;
+                r.editRanges().upper_cadence = strokes_rate_upper;
 
                 trainrows.append(r);
-                qDebug() << i << r.duration << r.cadence << r.speed << r.upper_speed << r.lower_speed;
+                qDebug() << i << r.duration << r.cadence << r.speed << r.ranges().upper_speed << r.ranges().lower_speed;
             } else if (segment_type.contains("floor") || segment_type.contains("free_mode")) {
                 int offset_start = offset[QStringLiteral("start")].toInt();
                 int offset_end = offset[QStringLiteral("end")].toInt();
@@ -1340,6 +1408,10 @@ void peloton::performance_onfinish(QNetworkReply *reply) {
     }
 
     if (!trainrows.isEmpty()) {
+        QString signature = rowsSignature();
+        if (!signature.isEmpty()) {
+            cache.setRows(current_ride_id, signature, trainrows);
+        }
 
         emit workoutStarted(current_workout_name, current_instructor_name);
     } else {
@@ -1367,71 +1439,70 @@ double peloton::rowerpaceToSpeed(double pace) {
     return 3600.0 / seconds;
 }
 
-void peloton::getInstructor(const QString &instructor_id) {
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::instructor_onfinish);
-
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/instructor/") + instructor_id);
-    qDebug() << "peloton::getInstructor" << url;
+void peloton::get(const QString &path, void (peloton::*onfinish)(QNetworkReply *)) {
+    QUrl url(apiUrl + path);
+    qDebug() << "peloton::get" << url;
     QNetworkRequest request(url);
 
     request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
     request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
 
-    mgr->get(request);
+    QNetworkReply *reply = mgr->get(request);
+    int workout = workoutRequests;
+    connect(reply, &QNetworkReply::finished, this, [this, reply, onfinish, workout]() {
+        if (workout == workoutRequests) {
+            (this->*onfinish)(reply);
+        } else {
+            qDebug() << QStringLiteral("peloton::get reply of a workout before") << reply->url();
+        }
+        reply->deleteLater();
+    });
 }
 
-void peloton::getRide(const QString &ride_id) {
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::ride_onfinish);
+QString peloton::rowsSignature() {
+    if (!bluetoothManager || !bluetoothManager->device()) {
+        return QString();
+    }
 
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/ride/") + ride_id +
-             QStringLiteral("/details?stream_source=multichannel"));
-    qDebug() << "peloton::getRide" << url;
-    QNetworkRequest request(url);
+    // the resistance of the rows is converted by the device, with the gain and the offset, and some devices convert
+    // it by their name or up to their max resistance
+    QSettings settings;
+    QStringList signature;
+    bluetoothdevice *dev = bluetoothManager->device();
+    signature << QStringLiteral("2") << QString::fromLatin1(dev->metaObject()->className())
+              << QString::number(dev->deviceType()) << dev->bluetoothDevice.name()
+              << QString::number(dev->maxResistance());
+    for (const QString &key :
+         {QZSettings::peloton_difficulty, QZSettings::ftp, QZSettings::peloton_treadmill_level,
+          QZSettings::peloton_rower_level, QZSettings::peloton_spinups_autoresistance,
+          QZSettings::treadmill_force_speed, QZSettings::zwift_inclination_gain, QZSettings::zwift_inclination_offset,
+          QZSettings::peloton_gain, QZSettings::peloton_offset}) {
+        signature << settings.value(key).toString();
+    }
+    return signature.join(QStringLiteral(";"));
+}
 
-    request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
+void peloton::getInstructor(const QString &instructor_id) {
+    get(QStringLiteral("api/instructor/") + instructor_id, &peloton::instructor_onfinish);
+}
 
-    mgr->get(request);
+void peloton::getRide(const QString &ride_id) {
+    get(QStringLiteral("api/ride/") + ride_id + QStringLiteral("/details?stream_source=multichannel"),
+        &peloton::ride_onfinish);
 }
 
 void peloton::getPerformance(const QString &workout) {
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::performance_onfinish);
-
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/workout/") + workout +
-             QStringLiteral("/performance_graph?every_n=") + QString::number(peloton_workout_second_resolution));
-    qDebug() << "peloton::getPerformance" << url;
-    QNetworkRequest request(url);
-
-    request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
-
-    mgr->get(request);
+    get(QStringLiteral("api/workout/") + workout + QStringLiteral("/performance_graph?every_n=") +
+            QString::number(peloton_workout_second_resolution),
+        &peloton::performance_onfinish);
 }
 
 void peloton::getWorkout(const QString &workout) {
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::workout_onfinish);
-
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/workout/") + workout);
-    qDebug() << "peloton::getWorkout" << url;
-    QNetworkRequest request(url);
-
-    request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
-
-    mgr->get(request);
+    get(QStringLiteral("api/workout/") + workout, &peloton::workout_onfinish);
 }
 
 void peloton::getSummary(const QString &workout) {
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::summary_onfinish);
-
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/workout/") + workout + QStringLiteral("/summary"));
-    qDebug() << "peloton::getSummary" << url;
-    QNetworkRequest request(url);
-
-    request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
-
-    mgr->get(request);
+    get(QStringLiteral("api/workout/") + workout + QStringLiteral("/summary"), &peloton::summary_onfinish);
 }
 
 void peloton::getWorkoutList(int num) {
@@ -1444,20 +1515,11 @@ void peloton::getWorkoutList(int num) {
     // int pages = num / limit; //NOTE: clang-analyzer-deadcode.DeadStores
     // int rem = num % limit; //NOTE: clang-analyzer-deadcode.DeadStores
 
-    connect(mgr, &QNetworkAccessManager::finished, this, &peloton::workoutlist_onfinish);
-
     int current_page = 0;
 
-    QUrl url(QStringLiteral("https://api.onepeloton.com/api/user/") + user_id +
-             QStringLiteral("/workouts?sort_by=-created&page=") + QString::number(current_page) +
-             QStringLiteral("&limit=") + QString::number(limit));
-    qDebug() << "peloton::getWorkoutList" << url;
-    QNetworkRequest request(url);
-
-    request.setHeader(QNetworkRequest::ContentTypeHeader, QStringLiteral("application/json"));
-    request.setHeader(QNetworkRequest::UserAgentHeader, QStringLiteral("qdomyos-zwift"));
-
-    mgr->get(request);
+    get(QStringLiteral("api/user/") + user_id + QStringLiteral("/workouts?sort_by=-created&page=") +
+            QString::number(current_page) + QStringLiteral("&limit=") + QString::number(limit),
+        &peloton::workoutlist_onfinish);
 }
 
 void peloton::setTestMode(bool test) { testMode = test; }
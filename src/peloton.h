@@ -2,6 +2,7 @@
 #define PELOTON_H
 
 #include "bluetooth.h"
+#include "pelotoncache.h"
 #include "powerzonepack.h"
 #include "trainprogram.h"
 #include <QAbstractOAuth2>
@@ -28,7 +29,9 @@ class peloton : public QObject {
 
     Q_OBJECT
   public:
-    explicit peloton(bluetooth *bl, QObject *parent = nullptr);
+    // apiUrl is for a mocked API, to test the workouts offline
+    explicit peloton(bluetooth *bl, QObject *parent = nullptr,
+                     const QString &apiUrl = QStringLiteral("https://api.onepeloton.com/"));
     QList<trainrow> trainrows;
 
     enum _PELOTON_API { peloton_api = 0, powerzonepack_api = 1, homefitnessbuddy_api = 2, no_metrics = 3 };
@@ -46,6 +49,8 @@ class peloton : public QObject {
     QString current_image_url = QLatin1String("");
     fileDownloader *current_image_downloaded = nullptr;
     void downloadImage();
+    // the image of the class, from the cache or from the download
+    QByteArray currentImage() const;
     QDateTime current_original_air_time;
     int current_pedaling_duration = 0;
 
@@ -60,6 +65,17 @@ class peloton : public QObject {
     const int peloton_workout_second_resolution = 10;
     bool peloton_credentials_wrong = false;
     QNetworkAccessManager *mgr = nullptr;
+    QString apiUrl;
+    // the requests of a workout run together; the replies of the workouts before are dropped
+    int workoutRequests = 0;
+    bool instructorPending = false;
+    bool ridePending = false;
+    void get(const QString &path, void (peloton::*onfinish)(QNetworkReply *));
+
+    pelotoncache cache;
+    QByteArray current_image;
+    // what the rows of a ride depend on, besides the ride; empty if they can't be cached
+    QString rowsSignature();
 
     QJsonDocument current_workout;
     QJsonDocument current_workout_summary;
@@ -80,6 +96,11 @@ class peloton : public QObject {
     void getInstructor(const QString &instructor_id);
     void getRide(const QString &ride_id);
     void getPerformance(const QString &workout);
+    void instructorLoaded(const QByteArray &payload);
+    void rideLoaded(const QByteArray &payload);
+    void performanceLoaded(const QByteArray &payload);
+    // starts the workout when both the instructor and the ride are here
+    void workoutReady();
 
     bool testMode = false;
 
@@ -0,0 +1,152 @@
+#include "pelotoncache.h"
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QSaveFile>
+#include <algorithm>
+
+pelotoncache::pelotoncache(const QString &path, qint64 maxBytes, int maxDays)
+    : path(path), maxBytes(maxBytes), maxDays(maxDays) {}
+
+// the age of a file is the last time it was used, not the time it was written
+static void touch(const QString &fileName) {
+    QFile file(fileName);
+    if (file.open(QIODevice::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
+}
+
+QString pelotoncache::fileName(const QString &folder, const QString &id, const QString &extension) const {
+    // the ids of peloton are hex strings, anything else doesn't go in a file name
+    static const QRegularExpression validId(QStringLiteral("^[A-Za-z0-9_-]+$"));
+    if (path.isEmpty() || !validId.match(id).hasMatch())
+        return QString();
+    return path + QStringLiteral("/") + folder + QStringLiteral("/") + id + extension;
+}
+
+QByteArray pelotoncache::read(const QString &fileName) const {
+    QFile input(fileName);
+    if (fileName.isEmpty() || !input.open(QIODevice::ReadOnly))
+        return QByteArray();
+    QByteArray data = input.readAll();
+    input.close();
+    touch(fileName);
+    return data;
+}
+
+void pelotoncache::write(const QString &fileName, const QByteArray &data) {
+    if (fileName.isEmpty() || data.isEmpty())
+        return;
+    QDir().mkpath(QFileInfo(fileName).absolutePath());
+    // a class that is running must never find half a file
+    QSaveFile output(fileName);
+    if (!output.open(QIODevice::WriteOnly) || output.write(data) != data.size() || !output.commit())
+        qDebug() << QStringLiteral("pelotoncache: unable to write") << fileName;
+    written();
+}
+
+void pelotoncache::written() {
+    if (pruned)
+        return;
+    pruned = true;
+    prune();
+}
+
+void pelotoncache::prune() {
+    if (path.isEmpty())
+        return;
+
+    QDateTime oldest = QDateTime::currentDateTimeUtc().addDays(-maxDays);
+    QFileInfoList files;
+    qint64 total = 0;
+    QDirIterator it(path, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        QFileInfo info = it.fileInfo();
+        if (info.lastModified() < oldest) {
+            QFile::remove(info.absoluteFilePath());
+            continue;
+        }
+        files.append(info);
+        total += info.size();
+    }
+    if (total <= maxBytes)
+        return;
+
+    std::sort(files.begin(), files.end(),
+              [](const QFileInfo &a, const QFileInfo &b) { return a.lastModified() < b.lastModified(); });
+    for (const QFileInfo &info : qAsConst(files)) {
+        if (total <= maxBytes)
+            break;
+        if (QFile::remove(info.absoluteFilePath()))
+            total -= info.size();
+    }
+    qDebug() << QStringLiteral("pelotoncache: pruned to") << total << QStringLiteral("bytes");
+}
+
+QByteArray pelotoncache::ride(const QString &ride_id) const {
+    return read(fileName(QStringLiteral("rides"), ride_id, QStringLiteral(".json")));
+}
+
+void pelotoncache::setRide(const QString &ride_id, const QByteArray &json) {
+    write(fileName(QStringLiteral("rides"), ride_id, QStringLiteral(".json")), json);
+}
+
+QByteArray pelotoncache::performance(const QString &ride_id) const {
+    return read(fileName(QStringLiteral("performance"), ride_id, QStringLiteral(".json")));
+}
+
+void pelotoncache::setPerformance(const QString &ride_id, const QByteArray &json) {
+    write(fileName(QStringLiteral("performance"), ride_id, QStringLiteral(".json")), json);
+}
+
+QByteArray pelotoncache::instructor(const QString &instructor_id) const {
+    return read(fileName(QStringLiteral("instructors"), instructor_id, QStringLiteral(".json")));
+}
+
+void pelotoncache::setInstructor(const QString &instructor_id, const QByteArray &json) {
+    write(fileName(QStringLiteral("instructors"), instructor_id, QStringLiteral(".json")), json);
+}
+
+static QString hash(const QString &s) {
+    return QString::fromLatin1(QCryptographicHash::hash(s.toUtf8(), QCryptographicHash::Sha1).toHex());
+}
+
+QByteArray pelotoncache::image(const QString &url) const {
+    return read(fileName(QStringLiteral("images"), hash(url), QString()));
+}
+
+void pelotoncache::setImage(const QString &url, const QByteArray &data) {
+    write(fileName(QStringLiteral("images"), hash(url), QString()), data);
+}
+
+bool pelotoncache::rows(const QString &ride_id, const QString &signature, bluetoothdevice::BLUETOOTH_TYPE device_type,
+                        QList<trainrow> *rows) const {
+    QString name = fileName(QStringLiteral("rows"), ride_id + QStringLiteral("-") + hash(signature),
+                            QStringLiteral(".xml"));
+    if (name.isEmpty() || !QFile::exists(name))
+        return false;
+    touch(name);
+    *rows = trainprogram::loadXML(name, device_type);
+    return !rows->isEmpty();
+}
+
+void pelotoncache::setRows(const QString &ride_id, const QString &signature, const QList<trainrow> &rows) {
+    QString name = fileName(QStringLiteral("rows"), ride_id + QStringLiteral("-") + hash(signature),
+                            QStringLiteral(".xml"));
+    if (name.isEmpty())
+        return;
+    QDir().mkpath(QFileInfo(name).absolutePath());
+    // saveXML writes in place, so the rows are renamed only when they are complete
+    QString temp = name + QStringLiteral(".tmp");
+    QFile::remove(temp);
+    if (trainprogram::saveXML(temp, rows)) {
+        QFile::remove(name);
+        QFile::rename(temp, name);
+        written();
+    }
+}
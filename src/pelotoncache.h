@@ -0,0 +1,53 @@
+#ifndef PELOTONCACHE_H
+#define PELOTONCACHE_H
+
+#include "trainprogram.h"
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+/**
+ * @brief The Peloton data that doesn't change once a class is published, saved on the disk: the details of the
+ * rides, the target metrics and the image of a ride, and the instructors. A recurring class doesn't need them from
+ * the API anymore, and the rows computed from them are saved too, so it starts without parsing them again.
+ * The files not used for maxDays are removed, and then the least recently used ones until the cache fits in maxBytes.
+ */
+class pelotoncache {
+  public:
+    explicit pelotoncache(const QString &path, qint64 maxBytes = 64 * 1024 * 1024, int maxDays = 180);
+
+    // the json as it came from the API, empty if it's not in the cache
+    QByteArray ride(const QString &ride_id) const;
+    void setRide(const QString &ride_id, const QByteArray &json);
+    QByteArray performance(const QString &ride_id) const;
+    void setPerformance(const QString &ride_id, const QByteArray &json);
+    QByteArray instructor(const QString &instructor_id) const;
+    void setInstructor(const QString &instructor_id, const QByteArray &json);
+    QByteArray image(const QString &url) const;
+    void setImage(const QString &url, const QByteArray &data);
+
+    /**
+     * @brief rows The rows computed for a ride. The rows depend on the device and on the settings too, so they are
+     * found only if they were saved with the same signature.
+     * @return false if they are not in the cache
+     */
+    bool rows(const QString &ride_id, const QString &signature, bluetoothdevice::BLUETOOTH_TYPE device_type,
+              QList<trainrow> *rows) const;
+    void setRows(const QString &ride_id, const QString &signature, const QList<trainrow> &rows);
+
+    // removes the files past the limits; done by the first write of the session, when the cache grows
+    void prune();
+
+  private:
+    QString fileName(const QString &folder, const QString &id, const QString &extension) const;
+    QByteArray read(const QString &fileName) const;
+    void write(const QString &fileName, const QByteArray &data);
+    void written();
+
+    QString path;
+    qint64 maxBytes;
+    int maxDays;
+    bool pruned = false;
+};
+
+#endif // PELOTONCACHE_H
@@ -27,11 +27,13 @@ CONFIG += c++17 console app_bundle optimize_full ltcg
 
 CONFIG += qmltypes
 
+# compiles the QML of qml.qrc ahead of time instead of at every start
+CONFIG += qtquickcompiler
+
 #win32: CONFIG += webengine
 #unix:!android: CONFIG += webengine
 
 win32:DEFINES += _ITERATOR_DEBUG_LEVEL=0
-win32:!mingw:LIBS += -llibprotobuf -llibprotoc -labseil_dll -llibprotobuf-lite -L$$PWD
 
 QML_IMPORT_NAME = org.cagnulein.qdomyoszwift
 QML_IMPORT_MAJOR_VERSION = 1
@@ -96,6 +98,7 @@ androidadblog.cpp \
 devices/apexbike/apexbike.cpp \
 handleurl.cpp \
 devices/iconceptelliptical/iconceptelliptical.cpp \
+latencymonitor.cpp \
 localipaddress.cpp \
 devices/pelotonbike/pelotonbike.cpp \
 devices/schwinn170bike/schwinn170bike.cpp \
@@ -156,6 +159,7 @@ devices/bowflext216treadmill/bowflext216treadmill.cpp \
 devices/bowflextreadmill/bowflextreadmill.cpp \
 devices/chronobike/chronobike.cpp \
 devices/concept2skierg/concept2skierg.cpp \
+controlarbiter.cpp \
 devices/cscbike/cscbike.cpp \
 devices/dircon/dirconmanager.cpp \
 devices/dircon/dirconpacket.cpp \
@@ -169,8 +173,11 @@ devices/echelonstride/echelonstride.cpp \
 devices/eliterizer/eliterizer.cpp \
 devices/elitesterzosmart/elitesterzosmart.cpp \
 devices/elliptical.cpp \
+ergemulator.cpp \
 devices/eslinkertreadmill/eslinkertreadmill.cpp \
 devices/fakebike/fakebike.cpp \
+devicebridge.cpp \
+devicefleet.cpp \
 filedownloader.cpp \
 devices/fitmetria_fanfit/fitmetria_fanfit.cpp \
 devices/fitplusbike/fitplusbike.cpp \
@@ -204,6 +211,7 @@ devices/ftmsbike/ftmsbike.cpp \
 devices/ftmsrower/ftmsrower.cpp \
 gpx.cpp \
 devices/heartratebelt/heartratebelt.cpp \
+heartratecontroller.cpp \
 homefitnessbuddy.cpp \
 homeform.cpp \
 devices/horizongr7bike/horizongr7bike.cpp \
@@ -217,23 +225,30 @@ devices/kingsmithr2treadmill/kingsmithr2treadmill.cpp \
 main.cpp \
 devices/mcfbike/mcfbike.cpp \
 metric.cpp \
+metricsexporter.cpp \
 devices/nautiluselliptical/nautiluselliptical.cpp \
 devices/nautilustreadmill/nautilustreadmill.cpp \
 devices/npecablebike/npecablebike.cpp \
 devices/pafersbike/pafersbike.cpp \
 devices/paferstreadmill/paferstreadmill.cpp \
 peloton.cpp \
+pelotoncache.cpp \
 powerzonepack.cpp \
 devices/proformbike/proformbike.cpp \
 devices/proformelliptical/proformelliptical.cpp \
 devices/proformtreadmill/proformtreadmill.cpp \
 qfit.cpp \
+qzclock.cpp \
+qztrace.cpp \
 qzsettings.cpp \
 devices/renphobike/renphobike.cpp \
 devices/rower.cpp \
 devices/schwinnic4bike/schwinnic4bike.cpp \
 screencapture.cpp \
+sensorfusion.cpp \
+sessionjournal.cpp \
 sessionline.cpp \
+settingsproxy.cpp \
 devices/shuaa5treadmill/shuaa5treadmill.cpp \
 signalhandler.cpp \
 simplecrypt.cpp \
@@ -262,16 +277,22 @@ devices/sportstechbike/sportstechbike.cpp \
 devices/strydrunpowersensor/strydrunpowersensor.cpp \
 devices/tacxneo2/tacxneo2.cpp \
 tcpclientinfosender.cpp \
+telemetryprofile.cpp \
 devices/technogymmyruntreadmill/technogymmyruntreadmill.cpp \
 devices/technogymmyruntreadmillrfcomm/technogymmyruntreadmillrfcomm.cpp \
+templateassets.cpp \
 templateinfosender.cpp \
 templateinfosenderbuilder.cpp \
+templatetelemetry.cpp \
+timelineindex.cpp \
 devices/stagesbike/stagesbike.cpp \
+startupprofiler.cpp \
 devices/toorxtreadmill/toorxtreadmill.cpp \
 devices/treadmill.cpp \
 devices/truetreadmill/truetreadmill.cpp \
 devices/trxappgateusbbike/trxappgateusbbike.cpp \
 devices/ultrasportbike/ultrasportbike.cpp \
+videosync.cpp \
 virtualdevices/virtualrower.cpp \
 devices/wahookickrsnapbike/wahookickrsnapbike.cpp \
 devices/yesoulbike/yesoulbike.cpp \
@@ -283,16 +304,15 @@ devices/m3ibike/m3ibike.cpp \
 devices/domyosbike/domyosbike.cpp \
 scanrecordresult.cpp \
 windows_zwift_incline_paddleocr_thread.cpp \
-zwiftworkout.cpp
+workoutfinalizer.cpp \
+workoutlibrary.cpp \
+zwiftplayerstate.cpp \
+zwiftworkout.cpp \
+zwiftworldstate.cpp
    
 macx: SOURCES += macos/lockscreen.mm
 !ios: SOURCES += mainwindow.cpp charts.cpp
 
-#zwift api
-msvc {
-    SOURCES += zwift-api/zwift_messages.pb.cc
-}
-
 # Default rules for deployment.
 qnx: target.path = /tmp/$${TARGET}/bin
 else: unix:!android: target.path = /opt/$${TARGET}/bin
@@ -334,6 +354,7 @@ devices/apexbike/apexbike.h \
 devices/discoveryoptions.h \
 handleurl.h \
 devices/iconceptelliptical/iconceptelliptical.h \
+latencymonitor.h \
 localipaddress.h \
 devices/pelotonbike/pelotonbike.h \
 devices/schwinn170bike/schwinn170bike.h \
@@ -406,6 +427,7 @@ devices/bowflext216treadmill/bowflext216treadmill.h \
 devices/bowflextreadmill/bowflextreadmill.h \
 devices/chronobike/chronobike.h \
 devices/concept2skierg/concept2skierg.h \
+controlarbiter.h \
 devices/cscbike/cscbike.h \
 devices/dircon/dirconmanager.h \
 devices/dircon/dirconpacket.h \
@@ -419,12 +441,16 @@ devices/echelonstride/echelonstride.h \
 devices/eliterizer/eliterizer.h \
 devices/elitesterzosmart/elitesterzosmart.h \
 devices/elliptical.h \
+ergemulator.h \
 devices/eslinkertreadmill/eslinkertreadmill.h \
 devices/fakebike/fakebike.h \
+devicebridge.h \
+devicefleet.h \
 filedownloader.h \
 devices/fitmetria_fanfit/fitmetria_fanfit.h \
 devices/fitplusbike/fitplusbike.h \
 devices/ftmsrower/ftmsrower.h \
+heartratecontroller.h \
 homefitnessbuddy.h \
 devices/horizongr7bike/horizongr7bike.h \
 devices/iconceptbike/iconceptbike.h \
@@ -663,25 +689,32 @@ ios/M3iIOS-Interface.h \
 material.h \
 devices/mcfbike/mcfbike.h \
 metric.h \
+metricsexporter.h \
 devices/nautiluselliptical/nautiluselliptical.h \
 devices/nautilustreadmill/nautilustreadmill.h \
 devices/npecablebike/npecablebike.h \
 devices/pafersbike/pafersbike.h \
 devices/paferstreadmill/paferstreadmill.h \
 peloton.h \
+pelotoncache.h \
 powerzonepack.h \
 devices/proformbike/proformbike.h \
 devices/proformelliptical/proformelliptical.h \
 devices/proformtreadmill/proformtreadmill.h \
 qdebugfixup.h \
 qfit.h \
+qzclock.h \
+qztrace.h \
 qmdnsengine_export.h \
 qzsettings.h \
 devices/renphobike/renphobike.h \
 devices/rower.h \
 devices/schwinnic4bike/schwinnic4bike.h \
 screencapture.h \
+sensorfusion.h \
+sessionjournal.h \
 sessionline.h \
+settingsproxy.h \
 devices/shuaa5treadmill/shuaa5treadmill.h \
 signalhandler.h \
 simplecrypt.h \
@@ -712,11 +745,16 @@ devices/sportstechbike/sportstechbike.h \
 devices/strydrunpowersensor/strydrunpowersensor.h \
 devices/tacxneo2/tacxneo2.h \
 tcpclientinfosender.h \
+telemetryprofile.h \
 devices/technogymmyruntreadmill/technogymmyruntreadmill.h \
 devices/technogymmyruntreadmillrfcomm/technogymmyruntreadmillrfcomm.h \
+templateassets.h \
 templateinfosender.h \
 templateinfosenderbuilder.h \
+templatetelemetry.h \
+timelineindex.h \
 devices/stagesbike/stagesbike.h \
+startupprofiler.h \
 devices/toorxtreadmill/toorxtreadmill.h \
 gpx.h \
 devices/treadmill.h \
@@ -726,6 +764,7 @@ devices/truetreadmill/truetreadmill.h \
 devices/trxappgateusbbike/trxappgateusbbike.h \
 devices/trxappgateusbtreadmill/trxappgateusbtreadmill.h \
 devices/ultrasportbike/ultrasportbike.h \
+videosync.h \
 virtualdevices/virtualbike.h \
 virtualdevices/virtualrower.h \
 virtualdevices/virtualtreadmill.h \
@@ -736,7 +775,11 @@ wobjectimpl.h \
 devices/yesoulbike/yesoulbike.h \
 scanrecordresult.h \
 windows_zwift_incline_paddleocr_thread.h \
-zwiftworkout.h
+workoutfinalizer.h \
+workoutlibrary.h \
+zwiftplayerstate.h \
+zwiftworkout.h \
+zwiftworldstate.h
 
 
 exists(secret.h): HEADERS += secret.h
@@ -771,8 +814,6 @@ DISTFILES += \
     $$PWD/android/src/WearableController.java \
     $$PWD/android/src/WearableMessageListenerService.java \
     $$PWD/android/src/ZapClickLayer.java \
-    $$PWD/android/src/ZwiftAPI.java \
-    $$PWD/android/src/main/proto/zwift_messages.proto \
     .clang-format \
    AppxManifest.xml \
    android/AndroidManifest.xml \
@@ -0,0 +1,31 @@
+#include "qzclock.h"
+#include <QElapsedTimer>
+#include <atomic>
+
+static std::atomic<bool> manual{false};
+static std::atomic<qint64> manualNs{0};
+
+static QElapsedTimer &steady() {
+    // QElapsedTimer uses CLOCK_MONOTONIC, mach_absolute_time or QueryPerformanceCounter depending on the platform
+    static QElapsedTimer timer = []() {
+        QElapsedTimer t;
+        t.start();
+        return t;
+    }();
+    return timer;
+}
+
+qint64 qzclock::nowNs() {
+    if (manual.load(std::memory_order_relaxed))
+        return manualNs.load(std::memory_order_relaxed);
+    return steady().nsecsElapsed();
+}
+
+void qzclock::setManual(bool enabled, qint64 startNs) {
+    manualNs.store(startNs);
+    manual.store(enabled);
+}
+
+void qzclock::advance(qint64 ns) { manualNs.fetch_add(ns); }
+
+bool qzclock::isManual() { return manual.load(); }
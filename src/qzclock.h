@@ -0,0 +1,33 @@
+#ifndef QZCLOCK_H
+#define QZCLOCK_H
+
+#include <QtGlobal>
+
+/**
+ * @brief Monotonic timebase for deltas and timestamps used in arithmetic (integrated distance, energy, rates).
+ * Unlike QDateTime::currentDateTime() it costs no time zone conversion and it doesn't jump with NTP or DST changes.
+ * The origin is arbitrary: the values are only meaningful compared to each other, within the same run.
+ * Tests and replays can switch to a manual source and move the time forward faster than the real one.
+ */
+class qzclock {
+  public:
+    // Units: nanoseconds
+    static qint64 nowNs();
+    // Units: milliseconds
+    static qint64 nowMs() { return nowNs() / 1000000; }
+    // Units: seconds
+    static double secondsSince(qint64 ns) { return (double)(nowNs() - ns) / 1e9; }
+    // Units: milliseconds, the monotonic counterpart of QDateTime::msecsTo
+    static double msecsBetween(qint64 fromNs, qint64 toNs) { return (double)(toNs - fromNs) / 1e6; }
+    static double msecsSince(qint64 ns) { return msecsBetween(ns, nowNs()); }
+
+    /**
+     * @brief setManual Replaces the steady clock with a manual one, starting from startNs. Passing false goes back to
+     * the steady clock.
+     */
+    static void setManual(bool enabled, qint64 startNs = 0);
+    static void advance(qint64 ns);
+    static bool isManual();
+};
+
+#endif // QZCLOCK_H
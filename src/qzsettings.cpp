@@ -763,8 +763,24 @@ const QString QZSettings::gears_zwift_ratio = QStringLiteral("gears_zwift_ratio"
 const QString QZSettings::domyos_bike_500_profile_v2 = QStringLiteral("domyos_bike_500_profile_v2");
 const QString QZSettings::gears_offset = QStringLiteral("gears_offset");
 const QString QZSettings::proform_carbon_tl_PFTL59720 = QStringLiteral("proform_carbon_tl_PFTL59720");
+const QString QZSettings::strava_pending_upload = QStringLiteral("strava_pending_upload");
+const QString QZSettings::default_strava_pending_upload = QStringLiteral("");
+const QString QZSettings::strava_pending_upload_attempts = QStringLiteral("strava_pending_upload_attempts");
+const QString QZSettings::gpx_autosave = QStringLiteral("gpx_autosave");
+const QString QZSettings::heart_rate_controller = QStringLiteral("heart_rate_controller");
+const QString QZSettings::heart_rate_controller_gain = QStringLiteral("heart_rate_controller_gain");
+const QString QZSettings::heart_rate_controller_inclination = QStringLiteral("heart_rate_controller_inclination");
+const QString QZSettings::trace_enabled = QStringLiteral("trace_enabled");
+const QString QZSettings::tile_latency_enabled = QStringLiteral("tile_latency_enabled");
+const QString QZSettings::tile_latency_order = QStringLiteral("tile_latency_order");
+const QString QZSettings::metrics_export_transport = QStringLiteral("metrics_export_transport");
+const QString QZSettings::default_metrics_export_transport = QStringLiteral("none");
+const QString QZSettings::metrics_export_host = QStringLiteral("metrics_export_host");
+const QString QZSettings::default_metrics_export_host = QStringLiteral("");
+const QString QZSettings::metrics_export_port = QStringLiteral("metrics_export_port");
+const QString QZSettings::metrics_export_http_port = QStringLiteral("metrics_export_http_port");
 
-const uint32_t allSettingsCount = 646;
+const uint32_t allSettingsCount = 659;
 
 QVariant allSettings[allSettingsCount][2] = {
     {QZSettings::cryptoKeySettingsProfiles, QZSettings::default_cryptoKeySettingsProfiles},
@@ -1417,6 +1433,19 @@ QVariant allSettings[allSettingsCount][2] = {
     {QZSettings::domyos_bike_500_profile_v2, QZSettings::default_domyos_bike_500_profile_v2},
     {QZSettings::gears_offset, QZSettings::default_gears_offset},
     {QZSettings::proform_carbon_tl_PFTL59720, QZSettings::default_proform_carbon_tl_PFTL59720},
+    {QZSettings::strava_pending_upload, QZSettings::default_strava_pending_upload},
+    {QZSettings::strava_pending_upload_attempts, QZSettings::default_strava_pending_upload_attempts},
+    {QZSettings::gpx_autosave, QZSettings::default_gpx_autosave},
+    {QZSettings::heart_rate_controller, QZSettings::default_heart_rate_controller},
+    {QZSettings::heart_rate_controller_gain, QZSettings::default_heart_rate_controller_gain},
+    {QZSettings::heart_rate_controller_inclination, QZSettings::default_heart_rate_controller_inclination},
+    {QZSettings::trace_enabled, QZSettings::default_trace_enabled},
+    {QZSettings::tile_latency_enabled, QZSettings::default_tile_latency_enabled},
+    {QZSettings::tile_latency_order, QZSettings::default_tile_latency_order},
+    {QZSettings::metrics_export_transport, QZSettings::default_metrics_export_transport},
+    {QZSettings::metrics_export_host, QZSettings::default_metrics_export_host},
+    {QZSettings::metrics_export_port, QZSettings::default_metrics_export_port},
+    {QZSettings::metrics_export_http_port, QZSettings::default_metrics_export_http_port},
 };
 
 void QZSettings::qDebugAllSettings(bool showDefaults) {
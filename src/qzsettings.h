@@ -2138,6 +2138,45 @@ class QZSettings {
     static const QString proform_carbon_tl_PFTL59720;
     static constexpr bool default_proform_carbon_tl_PFTL59720 = false;    
 
+    static const QString strava_pending_upload;
+    static const QString default_strava_pending_upload;
+
+    static const QString strava_pending_upload_attempts;
+    static constexpr int default_strava_pending_upload_attempts = 0;
+
+    static const QString gpx_autosave;
+    static constexpr bool default_gpx_autosave = false;
+
+    static const QString heart_rate_controller;
+    static constexpr bool default_heart_rate_controller = false;
+
+    static const QString heart_rate_controller_gain;
+    static constexpr double default_heart_rate_controller_gain = 1.0;
+
+    static const QString heart_rate_controller_inclination;
+    static constexpr bool default_heart_rate_controller_inclination = false;
+
+    static const QString trace_enabled;
+    static constexpr bool default_trace_enabled = false;
+
+    static const QString tile_latency_enabled;
+    static constexpr bool default_tile_latency_enabled = false;
+
+    static const QString tile_latency_order;
+    static constexpr int default_tile_latency_order = 55;
+
+    static const QString metrics_export_transport;
+    static const QString default_metrics_export_transport;
+
+    static const QString metrics_export_host;
+    static const QString default_metrics_export_host;
+
+    static const QString metrics_export_port;
+    static constexpr int default_metrics_export_port = 8094;
+
+    static const QString metrics_export_http_port;
+    static constexpr int default_metrics_export_http_port = 0;
+
     /**
      * @brief Write the QSettings values using the constants from this namespace.
      * @param showDefaults Optionally indicates if the default should be shown with the key.
@@ -0,0 +1,206 @@
+#include "qztrace.h"
+#include <QDebug>
+#include <QFile>
+#include <QHash>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QThread>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+std::atomic<quint32> qztrace::categories{0};
+std::atomic<bool> qztrace::m_logEnabled{true};
+
+// number of events kept: the oldest ones are overwritten. Must be a power of 2
+static const quint64 ringSize = 16384;
+static std::atomic<qztrace::event *> ring{nullptr};
+static std::atomic<quint64> head{0};
+// used by a writer that sees the category enabled before the ring (the categories load is relaxed). One per thread:
+// the writers of different threads would race on a shared one
+static thread_local qztrace::event discarded;
+
+void qztrace::setCategories(quint32 mask) {
+    // the ring is never freed: a writer could still be using it after the categories are disabled
+    if (mask && !ring.load(std::memory_order_acquire)) {
+        event *r = new event[ringSize];
+        event *expected = nullptr;
+        if (!ring.compare_exchange_strong(expected, r, std::memory_order_acq_rel))
+            delete[] r;
+    }
+    categories.store(mask, std::memory_order_release);
+    qDebug() << QStringLiteral("qztrace: categories") << QString::number(mask, 16);
+}
+
+qztrace::event *qztrace::begin(quint32 category, char phase, const char *name) {
+    event *r = ring.load(std::memory_order_acquire);
+    quint64 index = 0;
+    event *e = &discarded;
+    if (r) {
+        index = head.fetch_add(1, std::memory_order_relaxed);
+        e = &r[index & (ringSize - 1)];
+    }
+    e->sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    e->index = index;
+    e->ns = qzclock::nowNs();
+    e->thread = (quint64)(quintptr)QThread::currentThreadId();
+    e->name = name;
+    e->category = category;
+    e->phase = phase;
+    e->payloadLength = 0;
+    for (int i = 0; i < maxArgs; i++)
+        e->args[i].type = arg::NONE;
+    return e;
+}
+
+void qztrace::commit(event *e) { e->sequence.store(e->index + 1, std::memory_order_release); }
+
+void qztrace::packet(quint32 category, const char *name, const QByteArray &data) {
+    event *e = begin(category, 'i', name);
+    int len = qMin(data.size(), maxPayload);
+    memcpy(e->payload, data.constData(), len);
+    e->payloadLength = len;
+    e->args[0].key = "length";
+    e->args[0].type = arg::INT;
+    e->args[0].i = data.size();
+    commit(e);
+}
+
+int qztrace::count() { return (int)qMin(head.load(std::memory_order_relaxed), ringSize); }
+
+void qztrace::clear() {
+    event *r = ring.load(std::memory_order_acquire);
+    if (!r)
+        return;
+    for (quint64 i = 0; i < ringSize; i++)
+        r[i].sequence.store(0, std::memory_order_relaxed);
+    head.store(0, std::memory_order_relaxed);
+}
+
+static const char *categoryName(quint32 category) {
+    switch (category) {
+    case qztrace::DEVICE:
+        return "device";
+    case qztrace::BLE_RX:
+        return "ble_rx";
+    case qztrace::BLE_TX:
+        return "ble_tx";
+    case qztrace::CONTROL:
+        return "control";
+    case qztrace::VIRTUAL:
+        return "virtual";
+    case qztrace::UI:
+        return "ui";
+    case qztrace::WORKOUT:
+        return "workout";
+    default:
+        return "other";
+    }
+}
+
+namespace {
+// plain copy of an event, taken while the writers keep going
+struct copiedevent {
+    quint64 index;
+    qint64 ns;
+    quint64 thread;
+    const char *name;
+    quint32 category;
+    char phase;
+    quint8 payloadLength;
+    char payload[qztrace::maxPayload];
+    qztrace::arg args[qztrace::maxArgs];
+};
+} // namespace
+
+bool qztrace::exportChromeTrace(const QString &filename) {
+    event *r = ring.load(std::memory_order_acquire);
+    if (!r)
+        return false;
+
+    std::vector<copiedevent> events;
+    events.reserve(ringSize);
+    for (quint64 i = 0; i < ringSize; i++) {
+        event &e = r[i];
+        quint64 before = e.sequence.load(std::memory_order_acquire);
+        if (!before)
+            continue;
+        copiedevent c;
+        c.index = before - 1;
+        c.ns = e.ns;
+        c.thread = e.thread;
+        c.name = e.name;
+        c.category = e.category;
+        c.phase = e.phase;
+        c.payloadLength = e.payloadLength;
+        memcpy(c.payload, e.payload, sizeof(c.payload));
+        for (int a = 0; a < maxArgs; a++)
+            c.args[a] = e.args[a];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // overwritten while copying
+        if (e.sequence.load(std::memory_order_relaxed) != before)
+            continue;
+        events.push_back(c);
+    }
+    // the ring position is the order the events were recorded in
+    std::sort(events.begin(), events.end(),
+              [](const copiedevent &a, const copiedevent &b) { return a.index < b.index; });
+
+    QHash<quint64, int> threads;
+    QJsonArray traceEvents;
+    for (const copiedevent &c : events) {
+        if (!threads.contains(c.thread))
+            threads.insert(c.thread, threads.count() + 1);
+
+        QJsonObject o;
+        o[QStringLiteral("name")] = QString::fromLatin1(c.name);
+        o[QStringLiteral("cat")] = QString::fromLatin1(categoryName(c.category));
+        o[QStringLiteral("ph")] = QString(QLatin1Char(c.phase));
+        o[QStringLiteral("ts")] = (double)c.ns / 1000.0;
+        o[QStringLiteral("pid")] = 1;
+        o[QStringLiteral("tid")] = threads.value(c.thread);
+        if (c.phase == 'i')
+            o[QStringLiteral("s")] = QStringLiteral("t");
+
+        QJsonObject args;
+        for (int a = 0; a < maxArgs; a++) {
+            const arg &v = c.args[a];
+            QString key = QString::fromLatin1(v.key);
+            switch (v.type) {
+            case arg::INT:
+                args[key] = (double)v.i;
+                break;
+            case arg::DOUBLE:
+                args[key] = v.d;
+                break;
+            case arg::TEXT:
+                args[key] = QString::fromLatin1(v.s);
+                break;
+            default:
+                break;
+            }
+        }
+        if (c.payloadLength)
+            args[QStringLiteral("data")] =
+                QString::fromLatin1(QByteArray(c.payload, c.payloadLength).toHex(' '));
+        if (!args.isEmpty())
+            o[QStringLiteral("args")] = args;
+        traceEvents.append(o);
+    }
+
+    QJsonObject root;
+    root[QStringLiteral("traceEvents")] = traceEvents;
+    root[QStringLiteral("displayTimeUnit")] = QStringLiteral("ms");
+
+    QFile f(filename);
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << QStringLiteral("qztrace: unable to write") << filename << f.errorString();
+        return false;
+    }
+    f.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    f.close();
+    qDebug() << QStringLiteral("qztrace: exported") << events.size() << QStringLiteral("events to") << filename;
+    return true;
+}
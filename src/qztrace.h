@@ -0,0 +1,184 @@
+#ifndef QZTRACE_H
+#define QZTRACE_H
+
+#include "qzclock.h"
+#include <QByteArray>
+#include <QDebug>
+#include <QString>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @brief Structured tracing. An event stores the static name, the category, the timestamp and up to 4 binary
+ * arguments (numbers or string literals) or a short packet: nothing is formatted when it's recorded. The events go in
+ * a fixed ring buffer and are formatted only when the trace is exported (Chrome trace JSON, chrome://tracing or
+ * Perfetto).
+ * When a category is disabled the cost of a trace point is a relaxed load and a bit test; building with QZ_NO_TRACE
+ * removes the trace points altogether.
+ */
+class qztrace {
+  public:
+    enum CATEGORY : quint32 {
+        DEVICE = 1 << 0,  // device state and metrics
+        BLE_RX = 1 << 1,  // packets received from the devices
+        BLE_TX = 1 << 2,  // packets written to the devices
+        CONTROL = 1 << 3, // resistance/power/speed/inclination requests
+        VIRTUAL = 1 << 4, // virtual device notifications
+        UI = 1 << 5,      // homeform update, charts, tiles
+        WORKOUT = 1 << 6, // program, session and finalization
+        ALL = 0xFFFFFFFF
+    };
+
+    struct arg {
+        enum TYPE : quint8 { NONE = 0, INT, DOUBLE, TEXT };
+        const char *key = nullptr;
+        TYPE type = NONE;
+        union {
+            qint64 i;
+            double d;
+            const char *s;
+        };
+        arg() : i(0) {}
+    };
+
+    static const int maxArgs = 4;
+    static const int maxPayload = 24;
+
+    struct event {
+        // position in the ring + 1 once the event is complete, 0 while it's being written
+        std::atomic<quint64> sequence{0};
+        quint64 index = 0;
+        qint64 ns = 0;
+        quint64 thread = 0;
+        const char *name = nullptr;
+        quint32 category = 0;
+        char phase = 'i';
+        quint8 payloadLength = 0;
+        char payload[maxPayload];
+        arg args[maxArgs];
+    };
+
+    static bool enabled(quint32 category) { return (categories.load(std::memory_order_relaxed) & category) != 0; }
+
+    /**
+     * @brief setCategories Starts recording the specified categories (0 stops the recording). The ring buffer is
+     * allocated the first time.
+     */
+    static void setCategories(quint32 mask);
+
+    // text log (the debug signal of the devices): mirrors the log_debug setting
+    static bool logEnabled() { return m_logEnabled.load(std::memory_order_relaxed); }
+    static void setLogEnabled(bool enabled) { m_logEnabled.store(enabled, std::memory_order_relaxed); }
+
+    template <typename... Args> static void record(quint32 category, char phase, const char *name, Args... args) {
+        event *e = begin(category, phase, name);
+        fill(e, 0, args...);
+        commit(e);
+    }
+    static void packet(quint32 category, const char *name, const QByteArray &data);
+
+    /**
+     * @brief Records a begin event on construction and an end one on destruction, if the category is enabled.
+     */
+    class scope {
+      public:
+        scope(quint32 category, const char *name) : m_category(category), m_name(name) {
+            if (enabled(m_category))
+                record(m_category, 'B', m_name);
+        }
+        ~scope() {
+            if (enabled(m_category))
+                record(m_category, 'E', m_name);
+        }
+
+      private:
+        quint32 m_category;
+        const char *m_name;
+    };
+
+    static int count();
+    static void clear();
+    static bool exportChromeTrace(const QString &filename);
+
+  private:
+    static std::atomic<quint32> categories;
+    static std::atomic<bool> m_logEnabled;
+
+    static event *begin(quint32 category, char phase, const char *name);
+    static void commit(event *e);
+
+    static void fill(event *, int) {}
+    template <typename T, typename... Rest>
+    static void fill(event *e, int index, const char *key, T value, Rest... rest) {
+        if (index < maxArgs) {
+            arg &a = e->args[index];
+            a.key = key;
+            set(a, value);
+        }
+        fill(e, index + 1, rest...);
+    }
+    template <typename T> static typename std::enable_if<std::is_integral<T>::value>::type set(arg &a, T v) {
+        a.type = arg::INT;
+        a.i = (qint64)v;
+    }
+    template <typename T> static typename std::enable_if<std::is_floating_point<T>::value>::type set(arg &a, T v) {
+        a.type = arg::DOUBLE;
+        a.d = (double)v;
+    }
+    // only string literals: the pointer is kept until the export
+    static void set(arg &a, const char *v) {
+        a.type = arg::TEXT;
+        a.s = v;
+    }
+};
+
+#define QZ_TRACE_CONCAT_INNER(a, b) a##b
+#define QZ_TRACE_CONCAT(a, b) QZ_TRACE_CONCAT_INNER(a, b)
+
+#ifdef QZ_NO_TRACE
+#define QZ_TRACE(category, name, ...)                                                                                  \
+    do {                                                                                                               \
+    } while (0)
+#define QZ_TRACE_COUNTER(category, name, ...)                                                                          \
+    do {                                                                                                               \
+    } while (0)
+#define QZ_TRACE_PACKET(category, name, data)                                                                          \
+    do {                                                                                                               \
+    } while (0)
+#define QZ_TRACE_SCOPE(category, name)
+#else
+// instant event, the arguments are "key", value pairs
+#define QZ_TRACE(category, name, ...)                                                                                  \
+    do {                                                                                                               \
+        if (Q_UNLIKELY(qztrace::enabled(category)))                                                                    \
+            qztrace::record(category, 'i', name, ##__VA_ARGS__);                                                       \
+    } while (0)
+// counter event: every argument becomes a series in the trace viewer
+#define QZ_TRACE_COUNTER(category, name, ...)                                                                          \
+    do {                                                                                                               \
+        if (Q_UNLIKELY(qztrace::enabled(category)))                                                                    \
+            qztrace::record(category, 'C', name, ##__VA_ARGS__);                                                       \
+    } while (0)
+#define QZ_TRACE_PACKET(category, name, data)                                                                          \
+    do {                                                                                                               \
+        if (Q_UNLIKELY(qztrace::enabled(category)))                                                                    \
+            qztrace::packet(category, name, data);                                                                     \
+    } while (0)
+#define QZ_TRACE_SCOPE(category, name) qztrace::scope QZ_TRACE_CONCAT(qztraceScope, __LINE__)(category, name)
+#endif
+
+// the debug signal builds its string only if somebody is going to read it
+#define QZ_EMIT_DEBUG(text)                                                                                            \
+    do {                                                                                                               \
+        if (qztrace::logEnabled())                                                                                     \
+            emit debug(text);                                                                                          \
+    } while (0)
+
+// qDebug() whose arguments (packet dumps) are evaluated only if the debug log is on: QZ_DEBUG << data.toHex(' ');
+// The else keeps it a single statement, like the qCDebug() macros of Qt.
+#define QZ_DEBUG                                                                                                       \
+    if (!qztrace::logEnabled()) {                                                                                      \
+    } else                                                                                                             \
+        qDebug()
+
+#endif // QZTRACE_H
@@ -0,0 +1,71 @@
+#include "sensorfusion.h"
+#include <QDateTime>
+
+sensorfusion::sensorfusion(int periodMs) : m_period(qMax(1, periodMs)) {}
+
+void sensorfusion::setPeriod(int periodMs) {
+    m_period = qMax(1, periodMs);
+    restartGrid();
+}
+
+void sensorfusion::clear() {
+    for (int i = 0; i < CHANNELS; i++)
+        channels[i].clear();
+    restartGrid();
+}
+
+void sensorfusion::push(CHANNEL channel, double value, qint64 timestamp) {
+    QVector<sample> &c = channels[channel];
+    if (!c.isEmpty()) {
+        if (timestamp == c.last().t)
+            return;
+        if (timestamp < c.last().t) {
+            // the clock went back: the history is no longer comparable
+            c.clear();
+        }
+    }
+    c.append({timestamp, value});
+
+    int old = 0;
+    while (old < c.count() - 1 && timestamp - c.at(old).t > historyMs)
+        old++;
+    if (old > 0)
+        c.remove(0, old);
+}
+
+double sensorfusion::valueAt(CHANNEL channel, qint64 t) const {
+    const QVector<sample> &c = channels[channel];
+    if (c.isEmpty())
+        return 0;
+    if (t <= c.first().t)
+        return c.first().v;
+    if (t >= c.last().t)
+        return c.last().v;
+
+    // the buffers are a few seconds long and the instants requested are recent: scan from the end
+    int i = c.count() - 2;
+    while (i > 0 && c.at(i).t > t)
+        i--;
+    const sample &a = c.at(i);
+    const sample &b = c.at(i + 1);
+    return a.v + ((b.v - a.v) * (double)(t - a.t) / (double)(b.t - a.t));
+}
+
+QList<qint64> sensorfusion::dueTicks(qint64 now) {
+    QList<qint64> ticks;
+    qint64 grid = now - (now % m_period);
+
+    if (lastTick < 0 || grid - lastTick > (qint64)maxFill * m_period || grid < lastTick) {
+        lastTick = grid;
+        gridAnchor = grid;
+        wallAnchor = QDateTime::currentMSecsSinceEpoch() - (now - grid);
+        ticks.append(grid);
+        return ticks;
+    }
+
+    for (qint64 t = lastTick + m_period; t <= grid; t += m_period)
+        ticks.append(t);
+    if (!ticks.isEmpty())
+        lastTick = ticks.last();
+    return ticks;
+}
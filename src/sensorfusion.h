@@ -0,0 +1,67 @@
+#ifndef SENSORFUSION_H
+#define SENSORFUSION_H
+
+#include <QList>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief Aligns the metrics coming from different sensors (trainer, heart belt, power meter, cadence sensor) on a
+ * uniform time grid. Every channel keeps the last few seconds of samples stamped with their arrival time, and the
+ * values on the grid are interpolated from them, so the consumer gets exactly one sample per period even if its
+ * own timer is late or early.
+ */
+class sensorfusion {
+  public:
+    enum CHANNEL { SPEED = 0, CADENCE, POWER, HEART, RESISTANCE, INCLINATION, CHANNELS };
+
+    explicit sensorfusion(int periodMs = 1000);
+
+    void setPeriod(int periodMs);
+    int period() const { return m_period; }
+
+    /**
+     * @brief push Adds a sample to a channel. A sample with the same timestamp of the last one is ignored, so the
+     * caller can push the current value of a metric as often as it wants.
+     * @param timestamp Arrival time of the sample on the qzclock timebase. Units: milliseconds
+     */
+    void push(CHANNEL channel, double value, qint64 timestamp);
+
+    /**
+     * @brief valueAt Value of the channel at the time t: linear interpolation between the samples around t, or the
+     * nearest sample when t is outside of the buffer.
+     */
+    double valueAt(CHANNEL channel, qint64 t) const;
+    bool hasData(CHANNEL channel) const { return !channels[channel].isEmpty(); }
+
+    /**
+     * @brief dueTicks Returns the grid instants up to now not emitted yet. Missed instants are filled up to maxFill
+     * periods, a longer gap (pause, app in background) restarts the grid.
+     */
+    QList<qint64> dueTicks(qint64 now);
+
+    /**
+     * @brief wallTime Wall clock time of a grid instant. The offset is taken when the grid starts, so the timestamps
+     * stay exactly periodic even if the wall clock is adjusted meanwhile. Units: milliseconds since epoch
+     */
+    qint64 wallTime(qint64 tick) const { return wallAnchor + (tick - gridAnchor); }
+    void restartGrid() { lastTick = -1; }
+    void clear();
+
+    // samples older than this, compared to the last one of the channel, are dropped. Units: milliseconds
+    static const int historyMs = 5000;
+    static const int maxFill = 5;
+
+  private:
+    struct sample {
+        qint64 t;
+        double v;
+    };
+    QVector<sample> channels[CHANNELS];
+    int m_period;
+    qint64 lastTick = -1;
+    qint64 gridAnchor = 0;
+    qint64 wallAnchor = 0;
+};
+
+#endif // SENSORFUSION_H
@@ -0,0 +1,290 @@
+#include "sessionjournal.h"
+#include <QDataStream>
+#include <QDebug>
+#include <QMutexLocker>
+#include <QtMath>
+
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+static void prepareStream(QDataStream &ds) {
+    ds.setByteOrder(QDataStream::LittleEndian);
+    ds.setFloatingPointPrecision(QDataStream::DoublePrecision);
+}
+
+sessionjournal::sessionjournal(QObject *parent) : QThread(parent) {}
+
+sessionjournal::~sessionjournal() {
+    // the journal is left on disk on purpose: if the workout wasn't finished it will be offered for resume
+    stopWriter();
+    file.close();
+}
+
+bool sessionjournal::begin(const QString &filename, uint8_t deviceType) {
+    stopWriter();
+    file.close();
+
+    m_filename = filename;
+    file.setFileName(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << QStringLiteral("sessionjournal: unable to open") << filename << file.errorString();
+        m_open = false;
+        return false;
+    }
+
+    pending.clear();
+    appendedBytes = 0;
+    committedBytes = 0;
+
+    QByteArray payload;
+    QDataStream ds(&payload, QIODevice::WriteOnly);
+    prepareStream(ds);
+    ds << (quint32)magic << (quint8)deviceType << (qint64)QDateTime::currentDateTime().toMSecsSinceEpoch();
+    appendRecord(RECORD_HEADER, payload);
+
+    m_open = true;
+    quit = false;
+    start(QThread::LowPriority);
+    qDebug() << QStringLiteral("sessionjournal: started") << filename;
+    return true;
+}
+
+void sessionjournal::appendRecord(uint8_t type, const QByteArray &payload) {
+    QByteArray record;
+    record.reserve(payload.size() + 5);
+    record.append((char)type);
+    record.append((char)(payload.size() & 0xFF));
+    record.append((char)((payload.size() >> 8) & 0xFF));
+    record.append(payload);
+    quint16 crc = qChecksum(record.constData(), record.size());
+    record.append((char)(crc & 0xFF));
+    record.append((char)((crc >> 8) & 0xFF));
+
+    QMutexLocker locker(&mutex);
+    pending.append(record);
+    appendedBytes += record.size();
+}
+
+void sessionjournal::appendSample(const SessionLine &s) {
+    if (!m_open)
+        return;
+
+    QByteArray payload;
+    QDataStream ds(&payload, QIODevice::WriteOnly);
+    prepareStream(ds);
+    double latitude = s.coordinate.isValid() ? s.coordinate.latitude() : NAN;
+    double longitude = s.coordinate.isValid() ? s.coordinate.longitude() : NAN;
+    double altitude = s.coordinate.isValid() ? s.coordinate.altitude() : NAN;
+    ds << s.speed << (qint8)s.inclination << s.distance << (quint16)s.watt << (qint16)s.resistance
+       << (qint8)s.peloton_resistance << (quint8)s.heart << s.pace << (quint8)s.cadence
+       << (qint64)s.time.toMSecsSinceEpoch() << s.calories << s.elevationGain << (quint32)s.elapsedTime
+       << (quint8)s.lapTrigger << (quint32)s.totalStrokes << s.avgStrokesRate << s.maxStrokesRate
+       << s.avgStrokesLength << latitude << longitude << altitude << s.instantaneousStrideLengthCM
+       << s.groundContactMS << s.verticalOscillationMM << s.stepCount;
+    appendRecord(RECORD_SAMPLE, payload);
+}
+
+void sessionjournal::appendState(const journalstate &state) {
+    if (!m_open)
+        return;
+
+    QByteArray payload;
+    QDataStream ds(&payload, QIODevice::WriteOnly);
+    prepareStream(ds);
+    ds << state.elapsed << state.odometer << state.distance1s << state.calories << state.elevationGain
+       << state.jouls << (quint16)state.programStep << (qint32)state.programTicks << (qint32)state.programOffset
+       << state.programStepDistance << state.moving;
+    appendRecord(RECORD_STATE, payload);
+}
+
+void sessionjournal::appendLap() {
+    if (!m_open)
+        return;
+    appendRecord(RECORD_LAP, QByteArray());
+}
+
+void sessionjournal::finish() {
+    if (!m_open)
+        return;
+
+    appendRecord(RECORD_FINISH, QByteArray());
+    stopWriter();
+    file.close();
+    m_open = false;
+    QFile::remove(m_filename);
+    qDebug() << QStringLiteral("sessionjournal: finished") << m_filename;
+}
+
+void sessionjournal::sync() {
+    if (!m_open || !isRunning())
+        return;
+
+    QMutexLocker locker(&mutex);
+    quint64 target = appendedBytes;
+    syncRequested = true;
+    wakeUp.wakeAll();
+    while (committedBytes < target && isRunning()) {
+        if (!committed.wait(&mutex, 5000))
+            break;
+    }
+}
+
+void sessionjournal::stopWriter() {
+    if (isRunning()) {
+        {
+            QMutexLocker locker(&mutex);
+            quit = true;
+            wakeUp.wakeAll();
+        }
+        wait();
+    }
+    quit = false;
+}
+
+bool sessionjournal::commit() {
+    QByteArray data;
+    quint64 upTo;
+    {
+        QMutexLocker locker(&mutex);
+        data.swap(pending);
+        upTo = appendedBytes;
+    }
+
+    bool ok = true;
+    if (!data.isEmpty()) {
+        ok = file.write(data) == data.size() && file.flush();
+        // flush() only reaches the OS cache, the group commit is durable after the fsync
+#ifdef Q_OS_WIN
+        _commit(file.handle());
+#else
+        ::fsync(file.handle());
+#endif
+        if (!ok) {
+            qDebug() << QStringLiteral("sessionjournal: write error") << file.errorString();
+        }
+    }
+
+    QMutexLocker locker(&mutex);
+    committedBytes = upTo;
+    committed.wakeAll();
+    return ok;
+}
+
+void sessionjournal::run() {
+    forever {
+        bool exiting;
+        {
+            QMutexLocker locker(&mutex);
+            if (!quit && !syncRequested)
+                wakeUp.wait(&mutex, commitInterval);
+            syncRequested = false;
+            exiting = quit;
+        }
+        commit();
+        if (exiting)
+            break;
+    }
+}
+
+journalrecovery sessionjournal::recover(const QString &filename) {
+    journalrecovery r;
+    QFile f(filename);
+    if (!f.open(QIODevice::ReadOnly))
+        return r;
+
+    QByteArray data = f.readAll();
+    f.close();
+
+    int pos = 0;
+    while (pos + 3 <= data.size()) {
+        uint8_t type = (uint8_t)data.at(pos);
+        int len = (uint8_t)data.at(pos + 1) | ((uint8_t)data.at(pos + 2) << 8);
+        if (pos + 3 + len + 2 > data.size()) {
+            qDebug() << QStringLiteral("sessionjournal: truncated record at") << pos;
+            break;
+        }
+        quint16 crc = (uint8_t)data.at(pos + 3 + len) | ((uint8_t)data.at(pos + 3 + len + 1) << 8);
+        if (qChecksum(data.constData() + pos, 3 + len) != crc) {
+            qDebug() << QStringLiteral("sessionjournal: bad checksum at") << pos;
+            break;
+        }
+
+        QByteArray payload = data.mid(pos + 3, len);
+        QDataStream ds(payload);
+        prepareStream(ds);
+        pos += 3 + len + 2;
+
+        switch (type) {
+        case RECORD_HEADER: {
+            quint32 m;
+            quint8 deviceType;
+            qint64 started;
+            ds >> m >> deviceType >> started;
+            if (m != magic) {
+                qDebug() << QStringLiteral("sessionjournal: not a journal") << filename;
+                return r;
+            }
+            r.deviceType = deviceType;
+            r.started = QDateTime::fromMSecsSinceEpoch(started);
+            r.valid = true;
+            break;
+        }
+        case RECORD_SAMPLE: {
+            SessionLine s;
+            qint8 inclination, peloton_resistance;
+            quint16 watt;
+            qint16 resistance;
+            quint8 heart, cadence, lap;
+            qint64 time;
+            quint32 elapsedTime, totalStrokes;
+            double latitude, longitude, altitude;
+            ds >> s.speed >> inclination >> s.distance >> watt >> resistance >> peloton_resistance >> heart >>
+                s.pace >> cadence >> time >> s.calories >> s.elevationGain >> elapsedTime >> lap >> totalStrokes >>
+                s.avgStrokesRate >> s.maxStrokesRate >> s.avgStrokesLength >> latitude >> longitude >> altitude >>
+                s.instantaneousStrideLengthCM >> s.groundContactMS >> s.verticalOscillationMM >> s.stepCount;
+            s.inclination = inclination;
+            s.watt = watt;
+            s.resistance = resistance;
+            s.peloton_resistance = peloton_resistance;
+            s.heart = heart;
+            s.cadence = cadence;
+            s.time = QDateTime::fromMSecsSinceEpoch(time);
+            s.elapsedTime = elapsedTime;
+            s.lapTrigger = lap;
+            s.totalStrokes = totalStrokes;
+            if (!qIsNaN(latitude) && !qIsNaN(longitude))
+                s.coordinate = QGeoCoordinate(latitude, longitude, altitude);
+            r.session.append(s);
+            break;
+        }
+        case RECORD_STATE: {
+            quint16 step;
+            qint32 ticks, offset;
+            ds >> r.state.elapsed >> r.state.odometer >> r.state.distance1s >> r.state.calories >>
+                r.state.elevationGain >> r.state.jouls >> step >> ticks >> offset >> r.state.programStepDistance;
+            r.state.programStep = step;
+            r.state.programTicks = ticks;
+            r.state.programOffset = offset;
+            // appended later to the record: the older journals don't have it
+            if (!ds.atEnd())
+                ds >> r.state.moving;
+            break;
+        }
+        case RECORD_LAP:
+            break;
+        case RECORD_FINISH:
+            r.finished = true;
+            break;
+        default:
+            qDebug() << QStringLiteral("sessionjournal: unknown record") << type;
+            break;
+        }
+    }
+
+    qDebug() << QStringLiteral("sessionjournal: recovered") << r.session.count() << QStringLiteral("samples from")
+             << filename << QStringLiteral("finished") << r.finished;
+    return r;
+}
@@ -0,0 +1,96 @@
+#ifndef SESSIONJOURNAL_H
+#define SESSIONJOURNAL_H
+
+#include "sessionline.h"
+#include <QByteArray>
+#include <QFile>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+/**
+ * @brief Accumulators and train program position needed to resume a workout. Written next to every sample.
+ */
+class journalstate {
+  public:
+    double elapsed = 0;     // seconds
+    double moving = -1;     // seconds, -1 in the journals written before it was recorded
+    double odometer = 0;    // km
+    double distance1s = 0;  // km
+    double calories = 0;    // kcal
+    double elevationGain = 0; // meters
+    double jouls = 0;
+    uint16_t programStep = 0;
+    int32_t programTicks = 0;
+    int32_t programOffset = 0;
+    double programStepDistance = 0;
+};
+
+/**
+ * @brief Content recovered from a journal file.
+ */
+class journalrecovery {
+  public:
+    uint8_t deviceType = 0;
+    QDateTime started;
+    QList<SessionLine> session;
+    journalstate state;
+    bool finished = false;
+    bool valid = false;
+};
+
+/**
+ * @brief Append only binary journal of the workout. Every record is [type u8][length u16][payload][crc u16]
+ * (little endian) so a torn write at the end is detected and dropped on recovery.
+ * The records are encoded on the caller thread into a memory buffer; this thread writes and fsyncs the buffer in
+ * groups, so the 1Hz samples never wait for the storage.
+ */
+class sessionjournal : public QThread {
+    Q_OBJECT
+
+  public:
+    explicit sessionjournal(QObject *parent = nullptr);
+    ~sessionjournal();
+
+    bool begin(const QString &filename, uint8_t deviceType);
+    void appendSample(const SessionLine &s);
+    void appendState(const journalstate &state);
+    void appendLap();
+    // writes the end marker and removes the journal: a finished workout doesn't need to be recovered
+    void finish();
+    // forces a group commit now and waits for it
+    void sync();
+    bool isOpen() { return m_open; }
+    QString fileName() { return m_filename; }
+
+    static journalrecovery recover(const QString &filename);
+
+    // interval between two group commits. Units: milliseconds
+    static const int commitInterval = 2000;
+
+  protected:
+    void run() override;
+
+  private:
+    enum RECORD_TYPE { RECORD_HEADER = 1, RECORD_SAMPLE = 2, RECORD_STATE = 3, RECORD_LAP = 4, RECORD_FINISH = 5 };
+    static const uint32_t magic = 0x314A5A51; // "QZJ1"
+
+    void appendRecord(uint8_t type, const QByteArray &payload);
+    bool commit();
+    void stopWriter();
+
+    QFile file;
+    QString m_filename;
+    bool m_open = false;
+
+    QMutex mutex;
+    QWaitCondition wakeUp;
+    QWaitCondition committed;
+    QByteArray pending;
+    quint64 appendedBytes = 0;
+    quint64 committedBytes = 0;
+    bool quit = false;
+    bool syncRequested = false;
+};
+
+#endif // SESSIONJOURNAL_H
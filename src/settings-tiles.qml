@@ -195,6 +195,8 @@ ScrollView {
         property int  tile_rss_order: 53        
         property bool tile_biggears_enabled: false
         property int  tile_biggears_order: 54
+        property bool tile_latency_enabled: false
+        property int  tile_latency_order: 55
     }
 
 
@@ -207,7 +209,7 @@ ScrollView {
             title: qsTr("Speed")
             linkedBoolSetting: "tile_speed_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelSpeedOrder
@@ -231,7 +233,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_speed_order = speedOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -252,7 +254,7 @@ ScrollView {
             title: qsTr("Inclination")
             linkedBoolSetting: "tile_inclination_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelinclinationOrder
@@ -276,7 +278,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_inclination_order = inclinationOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -284,7 +286,7 @@ ScrollView {
             title: qsTr("Cadence")
             linkedBoolSetting: "tile_cadence_enabled"
             settings: settings
-            accordionContent:  ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 SwitchDelegate {
                     id: cadenceColorEnabled
                     text: qsTr("Enable Cadence color")
@@ -338,7 +340,7 @@ ScrollView {
                         onClicked: {settings.tile_cadence_order = cadenceOrderTextField.displayText; toast.show("Setting saved!"); }
                     }
                 }
-            }
+            } }
         }
 
         Label {
@@ -359,7 +361,7 @@ ScrollView {
             title: qsTr("Elevation")
             linkedBoolSetting: "tile_elevation_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelelevationOrder
@@ -383,7 +385,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_elevation_order = elevationOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }            
 
         AccordionCheckElement {
@@ -391,7 +393,7 @@ ScrollView {
             title: qsTr("Calories")
             linkedBoolSetting: "tile_calories_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelcaloriesOrder
@@ -415,7 +417,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_calories_order = caloriesOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -436,7 +438,7 @@ ScrollView {
             title: qsTr("Odometer")
             linkedBoolSetting: "tile_odometer_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelodometerOrder
@@ -460,7 +462,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_odometer_order = odometerOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -481,7 +483,7 @@ ScrollView {
             title: qsTr("Pace")
             linkedBoolSetting: "tile_pace_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelpaceOrder
@@ -505,7 +507,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_pace_order = paceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -526,7 +528,7 @@ ScrollView {
             title: qsTr("Resistance")
             linkedBoolSetting: "tile_resistance_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelresistanceOrder
@@ -550,7 +552,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_resistance_order = resistanceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -571,7 +573,7 @@ ScrollView {
             title: qsTr("Watt")
             linkedBoolSetting: "tile_watt_enabled"
             settings: settings
-            accordionContent:  RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelwattOrder
@@ -595,7 +597,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_watt_order = wattOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -616,7 +618,7 @@ ScrollView {
             title: qsTr("Weight loss")
             linkedBoolSetting: "tile_weight_loss_enabled"
             settings: settings
-            accordionContent:  RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelweightLossOrder
@@ -640,7 +642,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_weight_loss_order = weightLossOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -662,7 +664,7 @@ ScrollView {
             title: qsTr("AVG Watt")
             linkedBoolSetting: "tile_avgwatt_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelavgwattOrder
@@ -686,7 +688,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_avgwatt_order = avgwattOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -708,7 +710,7 @@ ScrollView {
 				title: qsTr("AVG Watt Lap")
 				linkedBoolSetting: "tile_avg_watt_lap_enabled"
 				settings: settings
-				accordionContent: RowLayout {
+				lazyContent: Component { RowLayout {
 				    spacing: 10
 					 Label {
 					     id: labelavgwattLapOrder
@@ -732,7 +734,7 @@ ScrollView {
 						  Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
 						  onClicked: {settings.tile_avg_watt_lap_order = avgwattLapOrderTextField.displayText; toast.show("Setting saved!"); }
 						}
-					}
+					} }
 				}
 
         AccordionCheckElement {
@@ -740,7 +742,7 @@ ScrollView {
             title: qsTr("FTP %")
             linkedBoolSetting: "tile_ftp_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelftpOrder
@@ -764,7 +766,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_ftp_order = ftpOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -785,7 +787,7 @@ ScrollView {
             title: qsTr("Heart")
             linkedBoolSetting: "tile_heart_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelheartrateOrder
@@ -809,7 +811,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_heart_order = heartrateOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -817,7 +819,7 @@ ScrollView {
             title: qsTr("Fan")
             linkedBoolSetting: "tile_fan_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelfanOrder
@@ -841,7 +843,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_fan_order = fanOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -862,7 +864,7 @@ ScrollView {
             title: qsTr("Jouls")
             linkedBoolSetting: "tile_jouls_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeljoulsOrder
@@ -886,7 +888,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_jouls_order = joulsOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -907,7 +909,7 @@ ScrollView {
             title: qsTr("Elapsed")
             linkedBoolSetting: "tile_elapsed_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelelapsedOrder
@@ -931,7 +933,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_elapsed_order = elapsedOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -952,7 +954,7 @@ ScrollView {
             title: qsTr("Moving Time")
             linkedBoolSetting: "tile_moving_time_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelmovingTimeOrder
@@ -976,7 +978,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_moving_time_order = movingTimeOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -997,7 +999,7 @@ ScrollView {
             title: qsTr("Peloton Offset")
             linkedBoolSetting: "tile_peloton_offset_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelpelotonOffsetOrder
@@ -1021,7 +1023,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_peloton_offset_order = pelotonOffsetOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1042,7 +1044,7 @@ ScrollView {
             title: qsTr("Peloton Remaining")
             linkedBoolSetting: "tile_peloton_remaining_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelPelotonRemainingOrder
@@ -1066,7 +1068,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_peloton_remaining_order = pelotonRemainingOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1088,7 +1090,7 @@ ScrollView {
             title: qsTr("Peloton Difficulty")
             linkedBoolSetting: "tile_peloton_difficulty_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelpelotonDifficultyOrder
@@ -1112,7 +1114,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_peloton_difficulty_order = pelotonDifficultyOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }*/
 
         AccordionCheckElement {
@@ -1120,7 +1122,7 @@ ScrollView {
             title: qsTr("Lap Elapsed")
             linkedBoolSetting: "tile_lapelapsed_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labellapElapsedOrder
@@ -1144,7 +1146,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_lapelapsed_order = lapElapsedOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -1152,7 +1154,7 @@ ScrollView {
             title: qsTr("Peloton Resistance")
             linkedBoolSetting: "tile_peloton_resistance_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 SwitchDelegate {
                     id: pelotonResistanceColorEnabled
                     text: qsTr("Enable Peloton Resistance color")
@@ -1192,7 +1194,7 @@ ScrollView {
                         onClicked: {settings.tile_peloton_resistance_order = peloton_resistanceOrderTextField.displayText; toast.show("Setting saved!"); }
                     }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1213,7 +1215,7 @@ ScrollView {
             title: qsTr("Target Resistance")
             linkedBoolSetting: "tile_target_resistance_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_resistanceOrder
@@ -1237,7 +1239,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_resistance_order = target_resistanceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1259,7 +1261,7 @@ ScrollView {
             title: qsTr("Target Peloton Resistance")
             linkedBoolSetting: "tile_target_peloton_resistance_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_peloton_resistanceOrder
@@ -1283,7 +1285,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_peloton_resistance_order = target_peloton_resistanceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1304,7 +1306,7 @@ ScrollView {
             title: qsTr("Target Cadence")
             linkedBoolSetting: "tile_target_cadence_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_cadenceOrder
@@ -1328,7 +1330,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_cadence_order = target_cadenceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1349,7 +1351,7 @@ ScrollView {
             title: qsTr("Target Power")
             linkedBoolSetting: "tile_target_power_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_powerOrder
@@ -1373,7 +1375,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_power_order = target_powerOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1395,7 +1397,7 @@ ScrollView {
             title: qsTr("Target Power Zone")
             linkedBoolSetting: "tile_target_zone_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_zoneOrder
@@ -1419,7 +1421,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_zone_order = target_zoneOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1440,7 +1442,7 @@ ScrollView {
             title: qsTr("Target Speed")
             linkedBoolSetting: "tile_target_speed_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltargetspeedOrder
@@ -1464,7 +1466,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_speed_order = target_speedOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -1472,7 +1474,7 @@ ScrollView {
             title: qsTr("Target Pace")
             linkedBoolSetting: "tile_target_pace_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltargetpaceOrder
@@ -1496,7 +1498,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_pace_order = target_paceOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -1504,7 +1506,7 @@ ScrollView {
             title: qsTr("Target Incline")
             linkedBoolSetting: "tile_target_incline_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltarget_inclineOrder
@@ -1528,14 +1530,14 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_target_incline_order = target_inclineOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: wattKgEnabledAccordion
             title: qsTr("Watt/Kg")
             linkedBoolSetting: "tile_watt_kg_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelwatt_kgOrder
@@ -1559,7 +1561,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_watt_kg_order = watt_kgOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1580,7 +1582,7 @@ ScrollView {
             title: qsTr("Gears")
             linkedBoolSetting: "tile_gears_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelgearsOrder
@@ -1604,7 +1606,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_gears_order = gearsOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1624,7 +1626,7 @@ ScrollView {
             title: qsTr("Gears Big Buttons")
             linkedBoolSetting: "tile_biggears_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     text: qsTr("order index:")
@@ -1646,7 +1648,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_biggears_order = biggearsOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1667,7 +1669,7 @@ ScrollView {
             title: qsTr("Remaining Time/Row")
             linkedBoolSetting: "tile_remainingtimetrainprogramrow_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelremainingTimeTrainingProgramRowOrder
@@ -1691,7 +1693,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_remainingtimetrainprogramrow_order = remainingTimeTrainingProgramRowOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1712,7 +1714,7 @@ ScrollView {
             title: qsTr("Next Rows")
             linkedBoolSetting: "tile_nextrowstrainprogram_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelnextRowsTrainingProgramOrder
@@ -1736,7 +1738,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_nextrowstrainprogram_order = nextRowsTrainingProgramOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1757,7 +1759,7 @@ ScrollView {
             title: qsTr("METS")
             linkedBoolSetting: "tile_mets_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelmetsOrder
@@ -1781,7 +1783,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_mets_order = metsOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1802,7 +1804,7 @@ ScrollView {
             title: qsTr("Target METS")
             linkedBoolSetting: "tile_targetmets_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeltargetmetsOrder
@@ -1826,7 +1828,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_targetmets_order = targetmetsOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -1834,7 +1836,7 @@ ScrollView {
             title: qsTr("Time")
             linkedBoolSetting: "tile_datetime_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labeldatetimeOrder
@@ -1858,7 +1860,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_datetime_order = datetimeOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1874,12 +1876,57 @@ ScrollView {
             color: Material.color(Material.Lime)
         }
 
+        AccordionCheckElement {
+            id: latencyEnabledAccordion
+            title: qsTr("Latency")
+            linkedBoolSetting: "tile_latency_enabled"
+            settings: settings
+            lazyContent: Component { RowLayout {
+                spacing: 10
+                Label {
+                    id: labellatencyOrder
+                    text: qsTr("order index:")
+                    Layout.fillWidth: true
+                    horizontalAlignment: Text.AlignRight
+                }
+                ComboBox {
+                    id: latencyOrderTextField
+                    model: rootItem.tile_order
+                    displayText: settings.tile_latency_order
+                    Layout.fillHeight: false
+                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                    onActivated: {
+                        displayText = latencyOrderTextField.currentValue
+                     }
+                }
+                Button {
+                    id: oklatencyOrderButton
+                    text: "OK"
+                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                    onClicked: {settings.tile_latency_order = latencyOrderTextField.displayText; toast.show("Setting saved!"); }
+                }
+            } }
+        }
+
+        Label {
+            text: qsTr("Debug tile: milliseconds from the data received from the device to the screen (median and 99th percentile). The second line shows the same for the virtual device.")
+            font.bold: true
+            font.italic: true
+            font.pixelSize: Qt.application.font.pixelSize - 2
+            textFormat: Text.PlainText
+            wrapMode: Text.WordWrap
+            verticalAlignment: Text.AlignVCenter
+            Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+            Layout.fillWidth: true
+            color: Material.color(Material.Lime)
+        }
+
         AccordionCheckElement {
             id: targetStrokesCountAccordion
             title: qsTr("Strokes Count")
             linkedBoolSetting: "tile_strokes_count_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelstrokes_countOrder
@@ -1903,7 +1950,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_strokes_count_order = strokes_countOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1924,7 +1971,7 @@ ScrollView {
             title: qsTr("Strokes Length")
             linkedBoolSetting: "tile_strokes_length_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelstrokes_lengthOrder
@@ -1948,7 +1995,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_strokes_length_order = strokes_lengthOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -1969,7 +2016,7 @@ ScrollView {
             title: qsTr("Steering Angle")
             linkedBoolSetting: "tile_steering_angle_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelsteeringAngleOrder
@@ -1993,7 +2040,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_steering_angle_order = steeringAngleOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2014,7 +2061,7 @@ ScrollView {
             title: qsTr("PID HR Zone")
             linkedBoolSetting: "tile_pid_hr_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelPIDHROrder
@@ -2038,7 +2085,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_pid_hr_order = pidHROrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2059,7 +2106,7 @@ ScrollView {
             title: qsTr("External Incline")
             linkedBoolSetting: "tile_ext_incline_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelExtInclineOrder
@@ -2083,7 +2130,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_ext_incline_order = extInclineOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2104,7 +2151,7 @@ ScrollView {
             title: qsTr("Stride Length")
             linkedBoolSetting: "tile_instantaneous_stride_length_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelStrideLengthOrder
@@ -2128,7 +2175,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_instantaneous_stride_length_order = strideLengthOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2149,7 +2196,7 @@ ScrollView {
             title: qsTr("Ground Contact")
             linkedBoolSetting: "tile_ground_contact_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelGroundContactOrder
@@ -2173,7 +2220,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_ground_contact_order = groundContactOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2194,7 +2241,7 @@ ScrollView {
             title: qsTr("Vertical Oscillation")
             linkedBoolSetting: "tile_vertical_oscillation_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelVerticalOscillationOrder
@@ -2218,7 +2265,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_vertical_oscillation_order = verticalOscillationOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         Label {
@@ -2239,7 +2286,7 @@ ScrollView {
             title: qsTr("Pace Last 500m")
             linkedBoolSetting: "tile_pace_last500m_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelPacelast500mOrder
@@ -2263,7 +2310,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_pace_last500m_order = pacelast500mOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -2271,7 +2318,7 @@ ScrollView {
             title: qsTr("Step Count")
             linkedBoolSetting: "tile_step_count_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelStepCountOrder
@@ -2295,7 +2342,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_step_count_order = stepCountOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
@@ -2303,7 +2350,7 @@ ScrollView {
             title: qsTr("Erg Mode")
             linkedBoolSetting: "tile_erg_mode_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     id: labelErgModeOrder
@@ -2327,14 +2374,14 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_erg_mode_order = ergModeOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }
 
         AccordionCheckElement {
             title: qsTr("Running Stress Score")
             linkedBoolSetting: "tile_rss_enabled"
             settings: settings
-            accordionContent: RowLayout {
+            lazyContent: Component { RowLayout {
                 spacing: 10
                 Label {
                     text: qsTr("order index:")
@@ -2356,7 +2403,7 @@ ScrollView {
                     Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
                     onClicked: {settings.tile_rss_order = rssOrderTextField.displayText; toast.show("Setting saved!"); }
                 }
-            }
+            } }
         }        
 
         AccordionCheckElement {
@@ -2364,7 +2411,7 @@ ScrollView {
             title: qsTr("Preset Resistance 1")
             linkedBoolSetting: "tile_preset_resistance_1_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -2466,14 +2513,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_resistance_1_color = presetResistance1ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetResistance2EnabledAccordion
             title: qsTr("Preset Resistance 2")
             linkedBoolSetting: "tile_preset_resistance_2_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -2575,14 +2622,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_resistance_2_color = presetResistance2ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetResistance3EnabledAccordion
             title: qsTr("Preset Resistance 3")
             linkedBoolSetting: "tile_preset_resistance_3_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -2684,14 +2731,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_resistance_3_color = presetResistance3ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetResistance4EnabledAccordion
             title: qsTr("Preset Resistance 4")
             linkedBoolSetting: "tile_preset_resistance_4_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -2793,14 +2840,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_resistance_4_color = presetResistance4ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetResistance5EnabledAccordion
             title: qsTr("Preset Resistance 5")
             linkedBoolSetting: "tile_preset_resistance_5_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -2902,14 +2949,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_resistance_5_color = presetResistance5ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetSpeed1EnabledAccordion
             title: qsTr("Preset Speed 1")
             linkedBoolSetting: "tile_preset_speed_1_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3011,14 +3058,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_speed_1_color = presetSpeed1ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetSpeed2EnabledAccordion
             title: qsTr("Preset Speed 2")
             linkedBoolSetting: "tile_preset_speed_2_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3120,14 +3167,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_speed_2_color = presetSpeed2ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetSpeed3EnabledAccordion
             title: qsTr("Preset Speed 3")
             linkedBoolSetting: "tile_preset_speed_3_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3229,14 +3276,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_speed_3_color = presetSpeed3ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetSpeed4EnabledAccordion
             title: qsTr("Preset Speed 4")
             linkedBoolSetting: "tile_preset_speed_4_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3338,14 +3385,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_speed_4_color = presetSpeed4ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetSpeed5EnabledAccordion
             title: qsTr("Preset Speed 5")
             linkedBoolSetting: "tile_preset_speed_5_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3447,14 +3494,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_speed_5_color = presetSpeed5ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetInclination1EnabledAccordion
             title: qsTr("Preset Inclination 1")
             linkedBoolSetting: "tile_preset_inclination_1_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3556,14 +3603,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_inclination_1_color = presetInclination1ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetInclination2EnabledAccordion
             title: qsTr("Preset Inclination 2")
             linkedBoolSetting: "tile_preset_inclination_2_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3631,7 +3678,7 @@ ScrollView {
                         onClicked: {settings.tile_preset_inclination_2_label = presetInclination2LabelTextField.displayText; toast.show("Setting saved!"); }
                     }
                 }
-            }
+            } }
 				RowLayout {
 				    Label {
 					     id: labelPresetInclination2Color
@@ -3672,7 +3719,7 @@ ScrollView {
             title: qsTr("Preset Inclination 3")
             linkedBoolSetting: "tile_preset_inclination_3_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3774,14 +3821,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_inclination_3_color = presetInclination3ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetInclination4EnabledAccordion
             title: qsTr("Preset Inclination 4")
             linkedBoolSetting: "tile_preset_inclination_4_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3883,14 +3930,14 @@ ScrollView {
 								onClicked: {settings.tile_preset_inclination_4_color = presetInclination4ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
         AccordionCheckElement {
             id: presetInclination5EnabledAccordion
             title: qsTr("Preset Inclination 5")
             linkedBoolSetting: "tile_preset_inclination_5_enabled"
             settings: settings
-            accordionContent: ColumnLayout {
+            lazyContent: Component { ColumnLayout {
                 spacing: 10
                 RowLayout {
                     Label {
@@ -3992,7 +4039,7 @@ ScrollView {
 								onClicked: {settings.tile_preset_inclination_5_color = presetInclination5ColorTextField.displayText; toast.show("Setting saved!"); }
 						  }
 					 }
-            }
+            } }
         }
     }
 }
@@ -978,6 +978,19 @@ import QtQuick.Dialogs 1.0
             property bool domyos_bike_500_profile_v2: false
             property double gears_offset: 0.0
             property bool proform_carbon_tl_PFTL59720: false
+            property string strava_pending_upload: ""
+            property int strava_pending_upload_attempts: 0
+            property bool gpx_autosave: false
+            property bool heart_rate_controller: false
+            property real heart_rate_controller_gain: 1.0
+            property bool heart_rate_controller_inclination: false
+            property bool trace_enabled: false
+            property bool tile_latency_enabled: false
+            property int  tile_latency_order: 55
+            property string metrics_export_transport: "none"
+            property string metrics_export_host: ""
+            property int metrics_export_port: 8094
+            property int metrics_export_http_port: 0
         }
 
         function paddingZeros(text, limit) {
@@ -1019,7 +1032,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     RowLayout {
                         spacing: 10
@@ -1406,7 +1419,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
 
             /*Label {
@@ -1427,7 +1440,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: switchDelegate
@@ -1868,7 +1881,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -1880,7 +1893,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: speedPowerBasedDelegate
@@ -2456,7 +2469,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
 
                 Label {
                     text: qsTr("Expand the bars to the right to display the options under this setting. Select your specific model (if it is listed) and leave all other settings on default. If you encounter problems or have a question about the QZ settings for your equipment, open a support ticket on GitHub or ask the QZ community on the QZ Facebook Group.")
@@ -2477,7 +2490,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: schwinnBikeResistanceDelegate
@@ -2556,7 +2569,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             color: Material.color(Material.Lime)
                         }
-                    }
+                    } }
                 }
                 AccordionElement {
                     id: horizonBikeAccordion
@@ -2599,7 +2612,7 @@ import QtQuick.Dialogs 1.0
                     //width: 640
                     //anchors.top: acc1.bottom
                     //anchors.topMargin: 10
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         RowLayout {
                             spacing: 10
@@ -2688,7 +2701,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: settings.gears_from_bike = checked
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -2697,7 +2710,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                     SwitchDelegate {
                         id: inspirePelotonFormulaDelegate
@@ -2727,7 +2740,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         onClicked: settings.inspire_peloton_formula2 = checked
                     }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -2736,7 +2749,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: renphoPelotonFormulaDelegate
@@ -2765,7 +2778,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: settings.renpho_bike_double_resistance = checked
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -2930,7 +2943,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         RowLayout {
                             spacing: 10
@@ -2970,7 +2983,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.flywheel_life_fitness_ic8 = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
                 AccordionElement {
                     id: domyosBikeAccordion
@@ -3439,7 +3452,7 @@ import QtQuick.Dialogs 1.0
                     //width: 640
                     //anchors.top: acc1.bottom
                     //anchors.topMargin: 10
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: m3iBikeQtSearchDelegate
@@ -3520,7 +3533,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: settings.m3i_bike_kcal = checked
                         }
-                    }
+                    } }
                 }
             }
 
@@ -3713,7 +3726,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: topBarEnabledDelegate
@@ -4081,7 +4094,7 @@ import QtQuick.Dialogs 1.0
                             }
                         }
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -4090,7 +4103,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
 
                     RowLayout {
@@ -4711,7 +4724,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -4719,7 +4732,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
 
                     RowLayout {
@@ -4929,7 +4942,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -4937,7 +4950,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
 
                     SwitchDelegate {
@@ -5020,7 +5033,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -5061,7 +5074,7 @@ import QtQuick.Dialogs 1.0
                     color: Material.color(Material.Lime)
                 }
 
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     RowLayout {
                         spacing: 10
@@ -5089,7 +5102,7 @@ import QtQuick.Dialogs 1.0
                             onClicked: { settings.treadmill_pid_heart_zone = treadmillPidHRTextField.displayText; toast.show("Setting saved!"); }
                         }
                     }
-                }
+                } }
 
                 Label {
                     text: qsTr("QZ controls your treadmill or bike to keep you within a chosen Heart Rate Zone. Turn on, set a target heart rate (HR) zone in which to train and click OK. For example, enter 2 to train in HR zone 2 and the treadmill will auto adjust the speed (or resistance on a bike) to maintain your heart rate in zone 2. QZ gradually increases or decreases your speed (or bike resistance) in small increments every 40 seconds to reach and maintain your target HR zone. During a workout, you can display and use the ‘+’ and ‘-’ button on the PID HR Zone tile to change the target HR zone.")
@@ -5161,6 +5174,84 @@ import QtQuick.Dialogs 1.0
                     color: Material.color(Material.Lime)
                 }
 
+                SwitchDelegate {
+                    id: heartRateControllerDelegate
+                    text: qsTr("Continuous HR Controller")
+                    spacing: 0
+                    bottomPadding: 0
+                    topPadding: 0
+                    rightPadding: 0
+                    leftPadding: 0
+                    clip: false
+                    checked: settings.heart_rate_controller
+                    Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                    Layout.fillWidth: true
+                    onClicked: settings.heart_rate_controller = checked
+                }
+
+                Label {
+                    text: qsTr("Instead of changing speed or resistance in fixed steps every few seconds, QZ follows every heart rate sample with a PID controller, applying smaller and smoother corrections to keep you in the HR zone or range selected above. Default is off.")
+                    font.bold: true
+                    font.italic: true
+                    font.pixelSize: Qt.application.font.pixelSize - 2
+                    textFormat: Text.PlainText
+                    wrapMode: Text.WordWrap
+                    verticalAlignment: Text.AlignVCenter
+                    Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                    Layout.fillWidth: true
+                    color: Material.color(Material.Lime)
+                }
+
+                RowLayout {
+                    spacing: 10
+                    Label {
+                        text: qsTr("HR Controller Gain:")
+                        Layout.fillWidth: true
+                    }
+                    TextField {
+                        id: heartRateControllerGainTextField
+                        text: settings.heart_rate_controller_gain
+                        horizontalAlignment: Text.AlignRight
+                        Layout.fillHeight: false
+                        Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                        inputMethodHints: Qt.ImhFormattedNumbersOnly
+                        onActiveFocusChanged: if(this.focus) this.cursorPosition = this.text.length
+                    }
+                    Button {
+                        text: "OK"
+                        Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                        onClicked: { settings.heart_rate_controller_gain = heartRateControllerGainTextField.text; toast.show("Setting saved!"); }
+                    }
+                }
+
+                SwitchDelegate {
+                    id: heartRateControllerInclinationDelegate
+                    text: qsTr("HR Controller drives Inclination")
+                    spacing: 0
+                    bottomPadding: 0
+                    topPadding: 0
+                    rightPadding: 0
+                    leftPadding: 0
+                    clip: false
+                    checked: settings.heart_rate_controller_inclination
+                    Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                    Layout.fillWidth: true
+                    onClicked: settings.heart_rate_controller_inclination = checked
+                }
+
+                Label {
+                    text: qsTr("Treadmill only: the HR controller changes the inclination instead of the speed. Default is off.")
+                    font.bold: true
+                    font.italic: true
+                    font.pixelSize: Qt.application.font.pixelSize - 2
+                    textFormat: Text.PlainText
+                    wrapMode: Text.WordWrap
+                    verticalAlignment: Text.AlignVCenter
+                    Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                    Layout.fillWidth: true
+                    color: Material.color(Material.Lime)
+                }
+
                 RowLayout {
                     spacing: 10
                     Label {
@@ -5391,7 +5482,7 @@ import QtQuick.Dialogs 1.0
                     title: qsTr("Training Program Random Options")
                     linkedBoolSetting: "trainprogram_random"
                     settings: settings
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         RowLayout {
                             spacing: 10
@@ -5592,7 +5683,7 @@ import QtQuick.Dialogs 1.0
                                 onClicked: { settings.trainprogram_resistance_max = trainProgramRandomResistanceMaxTextField.text; toast.show("Setting saved!"); }
                             }
                         }
-                    }
+                    } }
                 }
 
                 Label {
@@ -5616,7 +5707,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: treadmillAsABikeDelegate
@@ -5632,7 +5723,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         onClicked: { settings.virtual_device_force_bike = checked; window.settings_restart_to_apply = true; }
                     }
-                }
+                } }
 
                 Label {
                     text: qsTr("Turn on to convert your treadmill output to bike output when riding on Zwift. QZ sends your treadmill metrics to Zwift over Bluetooth so that you can participate as a bike rider. Default is off.")
@@ -5985,7 +6076,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0    
                         Label {
                             text: qsTr("Specific Model:")
@@ -6192,7 +6283,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.nordictrack_ifit_adb_remote = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6201,7 +6292,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: pafersTreadmillDelegate
@@ -6231,7 +6322,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.pafers_treadmill_bh_iboxster_plus = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6239,7 +6330,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             text: qsTr("Inclination")
@@ -6254,7 +6345,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.gem_module_inclination = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6262,7 +6353,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             text: qsTr("Miles unit from the device")
@@ -6277,7 +6368,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: settings.sole_treadmill_miles = checked
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6286,7 +6377,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: kingSmithTreadmillDelegate
@@ -6360,7 +6451,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.kingsmith_encrypt_g1_walking_pad = checked; settings.kingsmith_encrypt_v5 = false; settings.kingsmith_encrypt_v3 = false; settings.kingsmith_encrypt_v2 = false; settings.kingsmith_encrypt_v4 = false; window.settings_restart_to_apply = true; }
                         }                        
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6369,7 +6460,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: fitfiuMCV460TreadmillDelegate
@@ -6398,7 +6489,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.zero_zt2500_treadmill = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6407,7 +6498,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: domyosTreadmillButtonsDelegate
@@ -6594,7 +6685,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             color: Material.color(Material.Lime)
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6603,7 +6694,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: soleInclinationDelegate
@@ -6688,7 +6779,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.sole_treadmill_tt8 = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6697,7 +6788,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: myrunDelegate
@@ -6713,7 +6804,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.technogym_myrun_treadmill_experimental = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6722,7 +6813,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         SwitchDelegate {
                             id: fitshowAnyrunDelegate
                             text: qsTr("AnyRun")
@@ -6802,7 +6893,7 @@ import QtQuick.Dialogs 1.0
                                 onClicked: { settings.fitshow_user_id = fitshowTreadmillUserIdTextField.text; toast.show("Setting saved!"); }
                             }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6811,7 +6902,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         SwitchDelegate {
                             id: eslinkerTreadmillCadenzaDelegate
                             text: qsTr("Cadenza Treadmill (Bodytone)")
@@ -6853,7 +6944,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.eslinker_costaway = checked; window.settings_restart_to_apply = true; }
                         }                        
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -6862,7 +6953,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             id: horizonParagonXTreadmillCadenzaDelegate
@@ -7052,7 +7143,7 @@ import QtQuick.Dialogs 1.0
                                 onClicked: { settings.horizon_treadmill_profile_user5 = horizonTreadmillProfile5TextField.text; window.settings_restart_to_apply = true; toast.show("Setting saved!"); }
                             }
                         }
-                    }
+                    } }
                 }
 
                 AccordionElement {
@@ -7060,7 +7151,7 @@ import QtQuick.Dialogs 1.0
                     indicatRectColor: Material.color(Material.Grey)
                     textColor: Material.color(Material.Yellow)
                     color: Material.backgroundColor
-                    accordionContent: ColumnLayout {
+                    lazyContent: Component { ColumnLayout {
                         spacing: 0
                         SwitchDelegate {
                             text: qsTr("Force Using FTMS")
@@ -7075,7 +7166,7 @@ import QtQuick.Dialogs 1.0
                             Layout.fillWidth: true
                             onClicked: { settings.horizon_treadmill_force_ftms = checked; window.settings_restart_to_apply = true; }
                         }
-                    }
+                    } }
                 }
             }
 
@@ -7085,7 +7176,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: toorxRouteKeyDelegate
@@ -7376,7 +7467,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         onClicked: { settings.iconsole_elliptical = checked; window.settings_restart_to_apply = true; }
                     }                    
-                }
+                } }
             }
 
             AccordionElement {
@@ -7384,7 +7475,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     AccordionElement {
                         title: qsTr("PM3, PM4 Options")
@@ -7480,7 +7571,7 @@ import QtQuick.Dialogs 1.0
                             onClicked: { settings.proform_rower_sport_rl = checked; window.settings_restart_to_apply = true; }
                         }
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -7489,7 +7580,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
 
                     AccordionElement {
@@ -7679,7 +7770,7 @@ import QtQuick.Dialogs 1.0
                             onClicked: { settings.iconcept_elliptical = checked; window.settings_restart_to_apply = true; }
                         }
                     }
-                }
+                } }
             }
 
             AccordionElement {
@@ -7691,7 +7782,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     Label {
                         id: labelFilterDevice
@@ -8435,7 +8526,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }                    
-                }
+                } }
             }
 
             AccordionElement {
@@ -8444,7 +8535,7 @@ import QtQuick.Dialogs 1.0
                 indicatRectColor: Material.color(Material.Grey)
                 textColor: Material.color(Material.Grey)
                 color: Material.backgroundColor
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
 
                     AccordionElement {
@@ -9550,14 +9641,14 @@ import QtQuick.Dialogs 1.0
                             }
                         }
                     }
-                }
+                } }
                 AccordionElement {
                         title: qsTr("Zwift Devices Options")
                         indicatRectColor: Material.color(Material.Grey)
                         textColor: Material.color(Material.Yellow)
                         color: Material.backgroundColor
 
-                        accordionContent: ColumnLayout {
+                        lazyContent: Component { ColumnLayout {
                             spacing: 0
                             SwitchDelegate {
                                 text: qsTr("Zwift Click")
@@ -9693,7 +9784,7 @@ import QtQuick.Dialogs 1.0
                                 Layout.fillWidth: true
                                 color: Material.color(Material.Lime)
                             }                            
-                        }
+                        } }
                     }
 
             }
@@ -9716,7 +9807,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     RowLayout {
                         spacing: 10
@@ -9758,7 +9849,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         onClicked: settings.gpx_loop = checked
                     }
-                }
+                } }
             }
 
             /*
@@ -9771,7 +9862,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     RowLayout {
                         spacing: 10
@@ -9797,7 +9888,7 @@ import QtQuick.Dialogs 1.0
                             onClicked: settings.video_playback_window_s = videoWindowTextField.text
                         }
                     }
-                }
+                } }
             }*/
 
             AccordionElement {
@@ -9809,7 +9900,7 @@ import QtQuick.Dialogs 1.0
                 //width: 640
                 //anchors.top: acc1.bottom
                 //anchors.topMargin: 10
-                accordionContent: ColumnLayout {
+                lazyContent: Component { ColumnLayout {
                     spacing: 0
                     SwitchDelegate {
                         id: bluetoothRelaxedDelegate
@@ -10291,6 +10382,136 @@ import QtQuick.Dialogs 1.0
                         }
                     }
 
+                    AccordionElement {
+                        id: metricsExportAccordion
+                        title: qsTr("Metrics Export")
+                        indicatRectColor: Material.color(Material.Grey)
+                        textColor: Material.color(Material.Grey)
+                        color: Material.backgroundColor
+                        accordionContent: ColumnLayout {
+                            spacing: 0
+                            RowLayout {
+                                spacing: 10
+                                Label {
+                                    text: qsTr("Transport:")
+                                    Layout.fillWidth: true
+                                }
+                                ComboBox {
+                                    id: metricsExportTransportTextField
+                                    model: [ "none", "udp", "tcp" ]
+                                    displayText: settings.metrics_export_transport
+                                    Layout.fillHeight: false
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    onActivated: {
+                                        console.log("combomodel activated" + metricsExportTransportTextField.currentIndex)
+                                        displayText = metricsExportTransportTextField.currentValue
+                                     }
+
+                                }
+                                Button {
+                                    text: "OK"
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    onClicked: { settings.metrics_export_transport = metricsExportTransportTextField.displayText; window.settings_restart_to_apply = true; toast.show("Setting saved!"); }
+                                }
+                            }
+
+                            RowLayout {
+                                spacing: 10
+                                Label {
+                                    text: qsTr("Host:")
+                                    Layout.fillWidth: true
+                                }
+                                TextField {
+                                    id: metricsExportHostTextField
+                                    text: settings.metrics_export_host
+                                    horizontalAlignment: Text.AlignRight
+                                    Layout.fillHeight: false
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    inputMethodHints: Qt.ImhNoAutoUppercase | Qt.ImhNoPredictiveText
+                                    onAccepted: settings.metrics_export_host = text
+                                    onActiveFocusChanged: if(this.focus) this.cursorPosition = this.text.length
+                                }
+                                Button {
+                                    text: "OK"
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    onClicked: { settings.metrics_export_host = metricsExportHostTextField.text; window.settings_restart_to_apply = true; toast.show("Setting saved!"); }
+                                }
+                            }
+
+                            RowLayout {
+                                spacing: 10
+                                Label {
+                                    text: qsTr("Port:")
+                                    Layout.fillWidth: true
+                                }
+                                TextField {
+                                    id: metricsExportPortTextField
+                                    text: settings.metrics_export_port
+                                    horizontalAlignment: Text.AlignRight
+                                    Layout.fillHeight: false
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    inputMethodHints: Qt.ImhDigitsOnly
+                                    onAccepted: settings.metrics_export_port = text
+                                    onActiveFocusChanged: if(this.focus) this.cursorPosition = this.text.length
+                                }
+                                Button {
+                                    text: "OK"
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    onClicked: { settings.metrics_export_port = metricsExportPortTextField.text; window.settings_restart_to_apply = true; toast.show("Setting saved!"); }
+                                }
+                            }
+
+                            Label {
+                                text: qsTr("Streams the workout samples to a collector on your network (Telegraf, InfluxDB, ...) as InfluxDB line protocol, over UDP or TCP. While the collector is unreachable the samples are kept on the disk and sent when it is back. Default: none, port 8094.")
+                                font.bold: true
+                                font.italic: true
+                                font.pixelSize: Qt.application.font.pixelSize - 2
+                                textFormat: Text.PlainText
+                                wrapMode: Text.WordWrap
+                                verticalAlignment: Text.AlignVCenter
+                                Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                                Layout.fillWidth: true
+                                color: Material.color(Material.Lime)
+                            }
+
+                            RowLayout {
+                                spacing: 10
+                                Label {
+                                    text: qsTr("Prometheus Port:")
+                                    Layout.fillWidth: true
+                                }
+                                TextField {
+                                    id: metricsExportHttpPortTextField
+                                    text: settings.metrics_export_http_port
+                                    horizontalAlignment: Text.AlignRight
+                                    Layout.fillHeight: false
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    inputMethodHints: Qt.ImhDigitsOnly
+                                    onAccepted: settings.metrics_export_http_port = text
+                                    onActiveFocusChanged: if(this.focus) this.cursorPosition = this.text.length
+                                }
+                                Button {
+                                    text: "OK"
+                                    Layout.alignment: Qt.AlignRight | Qt.AlignVCenter
+                                    onClicked: { settings.metrics_export_http_port = metricsExportHttpPortTextField.text; window.settings_restart_to_apply = true; toast.show("Setting saved!"); }
+                                }
+                            }
+
+                            Label {
+                                text: qsTr("The port where Prometheus can scrape the last sample at /metrics. Default: 0, disabled.")
+                                font.bold: true
+                                font.italic: true
+                                font.pixelSize: Qt.application.font.pixelSize - 2
+                                textFormat: Text.PlainText
+                                wrapMode: Text.WordWrap
+                                verticalAlignment: Text.AlignVCenter
+                                Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                                Layout.fillWidth: true
+                                color: Material.color(Material.Lime)
+                            }
+                        }
+                    }
+
                     SwitchDelegate {
                         id: androidWakeLockDelegate
                         text: qsTr("Android WakeLock")
@@ -10569,6 +10790,62 @@ import QtQuick.Dialogs 1.0
                         color: Material.color(Material.Lime)
                     }
 
+                    SwitchDelegate {
+                        id: gpxAutosaveDelegate
+                        text: qsTr("Save a GPX file too")
+                        spacing: 0
+                        bottomPadding: 0
+                        topPadding: 0
+                        rightPadding: 0
+                        leftPadding: 0
+                        clip: false
+                        checked: settings.gpx_autosave
+                        Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                        Layout.fillWidth: true
+                        onClicked: settings.gpx_autosave = checked
+                    }
+
+                    Label {
+                        text: qsTr("When you stop a workout, QZ saves a GPX file next to the FIT file.")
+                        font.bold: true
+                        font.italic: true
+                        font.pixelSize: Qt.application.font.pixelSize - 2
+                        textFormat: Text.PlainText
+                        wrapMode: Text.WordWrap
+                        verticalAlignment: Text.AlignVCenter
+                        Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                        Layout.fillWidth: true
+                        color: Material.color(Material.Lime)
+                    }
+
+                    SwitchDelegate {
+                        id: traceEnabledDelegate
+                        text: qsTr("Performance Trace")
+                        spacing: 0
+                        bottomPadding: 0
+                        topPadding: 0
+                        rightPadding: 0
+                        leftPadding: 0
+                        clip: false
+                        checked: settings.trace_enabled
+                        Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                        Layout.fillWidth: true
+                        onClicked: { settings.trace_enabled = checked; window.settings_restart_to_apply = true; }
+                    }
+
+                    Label {
+                        text: qsTr("Records the device packets and the timings of the app during a workout and saves them, when you stop it, in a QZ-trace file that can be opened with chrome://tracing or ui.perfetto.dev.")
+                        font.bold: true
+                        font.italic: true
+                        font.pixelSize: Qt.application.font.pixelSize - 2
+                        textFormat: Text.PlainText
+                        wrapMode: Text.WordWrap
+                        verticalAlignment: Text.AlignVCenter
+                        Layout.alignment: Qt.AlignLeft | Qt.AlignTop
+                        Layout.fillWidth: true
+                        color: Material.color(Material.Lime)
+                    }
+
                     Button {
                         id: clearLogs
                         text: "Clear History"
@@ -10588,7 +10865,7 @@ import QtQuick.Dialogs 1.0
                         Layout.fillWidth: true
                         color: Material.color(Material.Lime)
                     }
-                }
+                } }
             }
         }
     }
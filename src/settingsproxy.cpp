@@ -0,0 +1,86 @@
+#include "settingsproxy.h"
+
+settingsproxy::settingsproxy(QObject *parent) : QObject(parent) {}
+
+static QVariant scriptValue(const QVariant &v) {
+    switch (v.type()) {
+    case QVariant::Int:
+    case QVariant::UInt:
+    case QVariant::Double:
+    case QVariant::String:
+    case QVariant::Bool:
+    case QVariant::StringList:
+        return v;
+    default:
+        return QVariant();
+    }
+}
+
+QVariant settingsproxy::rawValue(const QString &key) {
+    QHash<QString, QVariant>::const_iterator it = cache.constFind(key);
+    if (it != cache.constEnd()) {
+        m_hits++;
+        return it.value();
+    }
+    m_misses++;
+    QVariant v = settings.value(key);
+    // the missing keys are cached too, a script asks for the same ones at every update
+    cache.insert(key, v);
+    return v;
+}
+
+QVariant settingsproxy::value(const QString &key) { return scriptValue(rawValue(key)); }
+
+bool settingsproxy::contains(const QString &key) { return rawValue(key).isValid(); }
+
+QStringList settingsproxy::keys() {
+    if (!keysValid) {
+        keyList = settings.allKeys();
+        keysValid = true;
+    }
+    return keyList;
+}
+
+bool settingsproxy::setValue(const QString &key, const QVariant &v) {
+    bool existed = contains(key);
+    if (existed && rawValue(key) == v)
+        return false;
+    settings.setValue(key, v);
+    cache.insert(key, v);
+    if (!existed && keysValid)
+        keyList.append(key);
+    emit changed(key, v);
+    return true;
+}
+
+int settingsproxy::refresh() {
+    QList<QPair<QString, QVariant>> changes;
+    for (QHash<QString, QVariant>::iterator it = cache.begin(); it != cache.end(); ++it) {
+        QVariant v = settings.value(it.key());
+        if (v != it.value()) {
+            it.value() = v;
+            changes.append(qMakePair(it.key(), v));
+        }
+    }
+    if (keysValid) {
+        QStringList current = settings.allKeys();
+        for (const QString &key : qAsConst(current)) {
+            if (!cache.contains(key) && !keyList.contains(key)) {
+                QVariant v = settings.value(key);
+                cache.insert(key, v);
+                changes.append(qMakePair(key, v));
+            }
+        }
+        keyList = current;
+    }
+    // emitted after the scan: a slot could write a setting
+    for (const QPair<QString, QVariant> &c : qAsConst(changes))
+        emit changed(c.first, c.second);
+    return changes.count();
+}
+
+void settingsproxy::invalidate() {
+    cache.clear();
+    keyList.clear();
+    keysValid = false;
+}
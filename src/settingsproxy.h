@@ -0,0 +1,57 @@
+#ifndef SETTINGSPROXY_H
+#define SETTINGSPROXY_H
+
+#include <QHash>
+#include <QObject>
+#include <QSettings>
+#include <QStringList>
+#include <QVariant>
+
+/**
+ * @brief Cached read access to the settings for the template scripts and clients. A value is read from QSettings the
+ * first time it's asked and then kept until it's changed through setValue or the cache is invalidated, so exposing
+ * the settings doesn't cost a copy of all the ~650 keys.
+ */
+class settingsproxy : public QObject {
+    Q_OBJECT
+  public:
+    explicit settingsproxy(QObject *parent = nullptr);
+
+    // for the scripts: an invalid QVariant if the key is missing or its type can't be converted to javascript
+    Q_INVOKABLE QVariant value(const QString &key);
+    Q_INVOKABLE bool contains(const QString &key);
+    Q_INVOKABLE QStringList keys();
+
+    // the value as stored, an invalid QVariant if the key is missing
+    QVariant rawValue(const QString &key);
+
+    // writes through to QSettings, emits changed() only when the value really changes
+    bool setValue(const QString &key, const QVariant &value);
+    void sync() { settings.sync(); }
+
+    // forgets the cache: the settings could have been changed without setValue
+    void invalidate();
+
+    /**
+     * @brief refresh Reads again the cached values and the key list, and emits changed() for every value changed
+     * without setValue (from the settings page for example). Unlike invalidate, the cache stays warm.
+     * @return the number of changed keys
+     */
+    int refresh();
+
+    quint64 hits() const { return m_hits; }
+    quint64 misses() const { return m_misses; }
+
+  signals:
+    void changed(const QString &key, const QVariant &value);
+
+  private:
+    QSettings settings;
+    QHash<QString, QVariant> cache;
+    QStringList keyList;
+    bool keysValid = false;
+    quint64 m_hits = 0;
+    quint64 m_misses = 0;
+};
+
+#endif // SETTINGSPROXY_H
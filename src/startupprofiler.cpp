@@ -0,0 +1,28 @@
+#include "startupprofiler.h"
+#include "qzclock.h"
+#include <QDebug>
+#include <QList>
+#include <QPair>
+
+static qint64 startNs = -1;
+static QList<QPair<const char *, qint64>> steps;
+static bool reported = false;
+
+void startupprofiler::mark(const char *step) {
+    qint64 now = qzclock::nowNs();
+    if (startNs < 0)
+        startNs = now;
+    steps.append(qMakePair(step, now));
+}
+
+void startupprofiler::report() {
+    if (reported || steps.isEmpty())
+        return;
+    reported = true;
+    qint64 previous = startNs;
+    for (const QPair<const char *, qint64> &s : qAsConst(steps)) {
+        qDebug() << QStringLiteral("startup:") << s.first << (s.second - previous) / 1000000 << QStringLiteral("ms");
+        previous = s.second;
+    }
+    qDebug() << QStringLiteral("startup: total") << (previous - startNs) / 1000000 << QStringLiteral("ms");
+}
@@ -0,0 +1,18 @@
+#ifndef STARTUPPROFILER_H
+#define STARTUPPROFILER_H
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Times the steps of the startup, from main() to the first frame on the screen. The report is logged once, so a
+ * log sent by a user with a slow device tells where the time goes.
+ */
+class startupprofiler {
+  public:
+    // the time of a step is measured from the previous mark, the first mark is the origin
+    static void mark(const char *step);
+    static void report();
+};
+
+#endif // STARTUPPROFILER_H
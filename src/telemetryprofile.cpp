@@ -0,0 +1,96 @@
+#include "telemetryprofile.h"
+#include "qzclock.h"
+#include <QtMath>
+
+telemetryprofile::telemetryprofile(PROFILE profile, quint32 seed) : m_profile(profile), random(seed) {}
+
+telemetryprofile::PROFILE telemetryprofile::fromName(const QString &name) {
+    QString n = name.toLower();
+    if (n == QStringLiteral("intervals"))
+        return INTERVALS;
+    if (n == QStringLiteral("sprints"))
+        return SPRINTS;
+    if (n == QStringLiteral("ramp"))
+        return RAMP;
+    return STEADY;
+}
+
+QString telemetryprofile::name(PROFILE profile) {
+    switch (profile) {
+    case INTERVALS:
+        return QStringLiteral("intervals");
+    case SPRINTS:
+        return QStringLiteral("sprints");
+    case RAMP:
+        return QStringLiteral("ramp");
+    default:
+        return QStringLiteral("steady");
+    }
+}
+
+double telemetryprofile::intensity(double t) const {
+    switch (m_profile) {
+    case INTERVALS: {
+        // 5 minutes of warm up, then 4 minutes at threshold and 3 minutes of recovery
+        if (t < 300)
+            return 0.55;
+        double cycle = fmod(t - 300, 420);
+        return cycle < 240 ? 1.05 : 0.55;
+    }
+    case SPRINTS:
+        // a 15 seconds sprint every 5 minutes
+        return (t > 60 && fmod(t, 300) < 15) ? 2.5 : 0.65;
+    case RAMP: {
+        // +5% every minute up to 150%, then 4 minutes of cool down
+        double cycle = fmod(t, 22 * 60);
+        if (cycle >= 18 * 60)
+            return 0.4;
+        return 0.4 + (0.05 * floor(cycle / 60));
+    }
+    default:
+        return 0.7;
+    }
+}
+
+double telemetryprofile::noise(double sigma) {
+    // Box-Muller
+    double u1 = qMax(random.generateDouble(), 1e-12);
+    double u2 = random.generateDouble();
+    return sigma * qSqrt(-2.0 * qLn(u1)) * qCos(2.0 * M_PI * u2);
+}
+
+telemetrysample telemetryprofile::sampleAt(double t) {
+    double dt = qMax(0.0, t - lastT);
+    lastT = t;
+    m_samples++;
+
+    telemetrysample s;
+    double i = intensity(t);
+
+    double target = restHeart + ((thresholdHeart - restHeart) * qMin(i, 1.15)) + (heartDrift * t / 60.0);
+    if (heart < 0)
+        heart = restHeart;
+    heart += (target - heart) * (1.0 - qExp(-dt / heartLag));
+
+    if (dropoutRate > 0 && t >= dropoutUntil && random.generateDouble() < dropoutRate * dt / 60.0)
+        dropoutUntil = t + 1.0 + (random.generateDouble() * 4.0);
+    if (t < dropoutUntil) {
+        m_dropouts++;
+        s.dropout = true;
+        return s;
+    }
+
+    s.watt = qMax(0.0, (ftp * i) * (1.0 + noise(0.03)));
+    s.cadence = qBound(0.0, 75.0 + (25.0 * qMin(i, 1.4)) + noise(1.5), 140.0);
+    s.speed = qMax(0.0, (thresholdSpeed * qMin(i, 1.6)) + noise(0.05));
+    s.heart = qRound(heart + noise(0.7));
+    s.inclination = m_profile == RAMP ? qRound(qMin(i, 1.0) * 10.0) / 2.0 : 1.0;
+    return s;
+}
+
+telemetrysample telemetryprofile::next() {
+    qint64 now = qzclock::nowNs();
+    if (startNs < 0)
+        startNs = now;
+    return sampleAt((double)(now - startNs) / 1e9);
+}
@@ -0,0 +1,82 @@
+#ifndef TELEMETRYPROFILE_H
+#define TELEMETRYPROFILE_H
+
+#include <QRandomGenerator>
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief One reading of a simulated machine. When dropout is true the machine didn't send anything.
+ */
+class telemetrysample {
+  public:
+    double watt = 0;        // watts
+    double cadence = 0;     // rpm, strokes per minute for the rowers
+    double speed = 0;       // km/h, running speed for the treadmills
+    double heart = 0;       // bpm
+    double inclination = 0; // percentage
+    bool dropout = false;
+};
+
+/**
+ * @brief Deterministic rider model used by the fake devices in simulation mode. The effort follows the selected
+ * profile (relative to the FTP), the heart rate follows the effort with a first order lag and a slow cardiac drift,
+ * and the machine randomly stops sending data for a few seconds. The same seed gives the same ride.
+ */
+class telemetryprofile {
+  public:
+    enum PROFILE { STEADY = 0, INTERVALS, SPRINTS, RAMP };
+
+    explicit telemetryprofile(PROFILE profile = STEADY, quint32 seed = 1);
+
+    static PROFILE fromName(const QString &name);
+    static QString name(PROFILE profile);
+
+    void setFtp(double watt) { ftp = watt; }
+    // running speed at the threshold, used for the treadmills. Units: km/h
+    void setThresholdSpeed(double kmh) { thresholdSpeed = kmh; }
+    // average number of dropouts per minute, 0 disables them
+    void setDropoutRate(double perMinute) { dropoutRate = perMinute; }
+
+    /**
+     * @brief sampleAt Reading of the machine at the time t. The heart rate and the dropouts keep their state between
+     * the calls, so t must not decrease.
+     * @param t Seconds since the start of the ride.
+     */
+    telemetrysample sampleAt(double t);
+
+    /**
+     * @brief next Reading at the current qzclock time: the first call starts the ride.
+     */
+    telemetrysample next();
+
+    // effort at the time t as a fraction of the FTP
+    double intensity(double t) const;
+
+    quint64 samples() const { return m_samples; }
+    quint64 dropouts() const { return m_dropouts; }
+
+  private:
+    double noise(double sigma);
+
+    PROFILE m_profile;
+    QRandomGenerator random;
+    double ftp = 200;
+    double thresholdSpeed = 12;
+    double dropoutRate = 0;
+    double restHeart = 60;
+    double thresholdHeart = 165;
+    // bpm per minute of exercise at the same effort
+    double heartDrift = 0.15;
+    // time constant of the heart rate response. Units: seconds
+    double heartLag = 30;
+
+    double heart = -1;
+    double lastT = 0;
+    double dropoutUntil = -1;
+    qint64 startNs = -1;
+    quint64 m_samples = 0;
+    quint64 m_dropouts = 0;
+};
+
+#endif // TELEMETRYPROFILE_H
@@ -0,0 +1,242 @@
+#include "templateassets.h"
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QLocale>
+#include <QMimeDatabase>
+#include <QVector>
+
+static const QString httpDateFormat = QStringLiteral("ddd, dd MMM yyyy hh:mm:ss 'GMT'");
+
+templateassets::templateassets(QObject *parent) : QObject(parent) {
+    connect(&watcher, &QFileSystemWatcher::fileChanged, this, &templateassets::changed);
+    connect(&watcher, &QFileSystemWatcher::directoryChanged, this, &templateassets::changed);
+}
+
+void templateassets::addFolder(const QString &relative, const QString &absolute) {
+    folders.insert(relative, absolute);
+    // the inner templates are in the resources, they don't change
+    if (absolute.startsWith(QLatin1Char(':')))
+        return;
+    QStringList dirs = {absolute};
+    QDirIterator it(absolute, QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+    while (it.hasNext())
+        dirs.append(it.next());
+    watcher.addPaths(dirs);
+}
+
+void templateassets::clear() {
+    folders.clear();
+    cache.clear();
+    if (!watcher.files().isEmpty())
+        watcher.removePaths(watcher.files());
+    if (!watcher.directories().isEmpty())
+        watcher.removePaths(watcher.directories());
+}
+
+QString templateassets::fileName(const QString &urlPath) const {
+    QString path = urlPath.startsWith(QLatin1Char('/')) ? urlPath.mid(1) : urlPath;
+    int idx = path.indexOf(QLatin1Char('/'));
+    if (idx <= 0)
+        return QString();
+    QString folder = folders.value(path.left(idx));
+    QString file = QDir::cleanPath(path.mid(idx + 1));
+    // nothing out of the folder of the template
+    if (folder.isEmpty() || file.isEmpty() || file == QStringLiteral(".") || file.startsWith(QStringLiteral("..")) ||
+        QDir::isAbsolutePath(file))
+        return QString();
+    return folder + QStringLiteral("/") + file;
+}
+
+static bool compressible(const QByteArray &mimeType) {
+    return mimeType.startsWith("text/") || mimeType == "application/javascript" ||
+           mimeType == "application/x-javascript" || mimeType == "application/json" || mimeType == "image/svg+xml" ||
+           mimeType == "application/xml";
+}
+
+static QByteArray readFile(const QString &fileName) {
+    QFile input(fileName);
+    if (!input.open(QIODevice::ReadOnly))
+        return QByteArray();
+    return input.readAll();
+}
+
+const templateasset *templateassets::load(const QString &fileName) {
+    auto i = cache.constFind(fileName);
+    if (i != cache.constEnd())
+        return &i.value();
+
+    QFileInfo info(fileName);
+    QFile input(fileName);
+    if (!info.isFile() || !input.open(QIODevice::ReadOnly))
+        return nullptr;
+
+    templateasset a;
+    a.data = input.readAll();
+    a.mimeType = QMimeDatabase().mimeTypeForFile(fileName, QMimeDatabase::MatchExtension).name().toLatin1();
+    a.lastModified = info.lastModified().toUTC();
+    a.etag = "\"" + QCryptographicHash::hash(a.data, QCryptographicHash::Md5).toHex() + "\"";
+    if (compressible(a.mimeType)) {
+        // the variants compressed ahead of time win over the gzip done here
+        a.gzip = readFile(fileName + QStringLiteral(".gz"));
+        if (a.gzip.isEmpty() && a.data.size() >= 256) {
+            a.gzip = gzip(a.data);
+            if (a.gzip.size() > (a.data.size() * 9) / 10)
+                a.gzip.clear();
+        }
+        a.brotli = readFile(fileName + QStringLiteral(".br"));
+    }
+    qDebug() << QStringLiteral("templateassets: loaded") << fileName << a.data.size() << QStringLiteral("gzip")
+             << a.gzip.size() << QStringLiteral("br") << a.brotli.size();
+
+    if (!fileName.startsWith(QLatin1Char(':')))
+        watcher.addPath(fileName);
+    return &cache.insert(fileName, a).value();
+}
+
+// the tag of a variant, as a cache must not take the gzip for the plain file
+static QByteArray variantTag(const QByteArray &etag, const QByteArray &encoding) {
+    if (encoding.isEmpty())
+        return etag;
+    return etag.left(etag.length() - 1) + "-" + encoding + "\"";
+}
+
+static bool accepts(const QByteArray &acceptEncoding, const QByteArray &encoding) {
+    for (const QByteArray &token : acceptEncoding.split(',')) {
+        QList<QByteArray> parts = token.split(';');
+        if (parts.first().trimmed().toLower() != encoding)
+            continue;
+        for (int i = 1; i < parts.count(); i++) {
+            QByteArray p = parts.at(i).trimmed();
+            if (p.startsWith("q=") && p.mid(2).toDouble() <= 0)
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+templateassets::response templateassets::respond(const QString &urlPath, const QByteArray &ifNoneMatch,
+                                                 const QByteArray &ifModifiedSince, const QByteArray &acceptEncoding) {
+    response r;
+    QString name = fileName(urlPath);
+    if (name.isEmpty()) {
+        r.status = 403;
+        r.body = "Unautorized";
+        return r;
+    }
+    const templateasset *a = load(name);
+    if (!a) {
+        r.body = "Not found";
+        return r;
+    }
+
+    QByteArray encoding;
+    const QByteArray *body = &a->data;
+    if (!a->brotli.isEmpty() && accepts(acceptEncoding, "br")) {
+        encoding = "br";
+        body = &a->brotli;
+    } else if (!a->gzip.isEmpty() && accepts(acceptEncoding, "gzip")) {
+        encoding = "gzip";
+        body = &a->gzip;
+    }
+
+    r.mimeType = a->mimeType;
+    r.headers.append({"ETag", variantTag(a->etag, encoding)});
+    if (a->lastModified.isValid())
+        r.headers.append({"Last-Modified", QLocale::c().toString(a->lastModified, httpDateFormat).toLatin1()});
+    // the clients ask every time, a file that didn't change costs a 304
+    r.headers.append({"Cache-Control", "no-cache"});
+    if (!a->gzip.isEmpty() || !a->brotli.isEmpty())
+        r.headers.append({"Vary", "Accept-Encoding"});
+
+    bool notModified = false;
+    if (!ifNoneMatch.isEmpty()) {
+        for (QByteArray tag : ifNoneMatch.split(',')) {
+            tag = tag.trimmed();
+            if (tag.startsWith("W/"))
+                tag = tag.mid(2);
+            // the tag of another variant is another body, the client doesn't have this one
+            if (tag == "*" || tag == variantTag(a->etag, encoding))
+                notModified = true;
+        }
+    } else if (!ifModifiedSince.isEmpty()) {
+        QDateTime since = QLocale::c().toDateTime(QString::fromLatin1(ifModifiedSince.trimmed()), httpDateFormat);
+        since.setTimeSpec(Qt::UTC);
+        // the header has the seconds only
+        notModified = since.isValid() && a->lastModified.isValid() &&
+                      a->lastModified.toSecsSinceEpoch() <= since.toSecsSinceEpoch();
+    }
+
+    if (notModified) {
+        r.status = 304;
+        return r;
+    }
+    r.status = 200;
+    r.body = *body;
+    if (!encoding.isEmpty())
+        r.headers.append({"Content-Encoding", encoding});
+    return r;
+}
+
+void templateassets::changed(const QString &path) {
+    // a folder created in a watched one is watched too
+    if (watcher.directories().contains(path) && QFileInfo(path).isDir()) {
+        const QStringList watched = watcher.directories();
+        QStringList dirs;
+        QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (it.hasNext()) {
+            QString dir = it.next();
+            if (!watched.contains(dir))
+                dirs.append(dir);
+        }
+        if (!dirs.isEmpty())
+            watcher.addPaths(dirs);
+    }
+
+    for (auto i = cache.begin(); i != cache.end();) {
+        if (i.key() == path || QFileInfo(i.key()).absolutePath() == QFileInfo(path).absoluteFilePath()) {
+            watcher.removePath(i.key());
+            i = cache.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+quint32 templateassets::crc32(const QByteArray &data) {
+    static const QVector<quint32> table = []() {
+        QVector<quint32> t(256);
+        for (quint32 i = 0; i < 256; i++) {
+            quint32 c = i;
+            for (int k = 0; k < 8; k++)
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            t[i] = c;
+        }
+        return t;
+    }();
+    quint32 crc = 0xFFFFFFFFu;
+    for (char b : data)
+        crc = table[(crc ^ static_cast<quint8>(b)) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+QByteArray templateassets::gzip(const QByteArray &data) {
+    // qCompress: the size on 4 bytes, then the zlib stream: 2 bytes of header, deflate, the adler32 on 4 bytes
+    QByteArray z = qCompress(data, 9);
+    if (z.size() < 10)
+        return QByteArray();
+
+    QByteArray out("\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\xff", 10);
+    out.append(z.constData() + 6, z.size() - 10);
+    quint32 crc = crc32(data);
+    quint32 size = static_cast<quint32>(data.size());
+    for (int i = 0; i < 4; i++)
+        out.append(static_cast<char>((crc >> (i * 8)) & 0xFF));
+    for (int i = 0; i < 4; i++)
+        out.append(static_cast<char>((size >> (i * 8)) & 0xFF));
+    return out;
+}
@@ -0,0 +1,68 @@
+#ifndef TEMPLATEASSETS_H
+#define TEMPLATEASSETS_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPair>
+
+// a file of a template folder, read once with its compressed variants
+class templateasset {
+  public:
+    QByteArray mimeType;
+    QByteArray data;
+    QByteArray gzip;   // empty when the type doesn't compress or doesn't get smaller
+    QByteArray brotli; // from the .br file next to the asset, there isn't a brotli encoder here
+    QByteArray etag;
+    QDateTime lastModified;
+};
+
+/**
+ * @brief The static files of the template folders for the web server. A file is read, hashed and compressed on its
+ * first request, then served from memory with ETag and Last-Modified, so the clients revalidate it with a 304. The
+ * folders are watched, a file that changes is read again.
+ */
+class templateassets : public QObject {
+    Q_OBJECT
+
+  public:
+    class response {
+      public:
+        int status = 404;
+        QByteArray mimeType = "text/plain";
+        QByteArray body;
+        QList<QPair<QByteArray, QByteArray>> headers;
+    };
+
+    explicit templateassets(QObject *parent = nullptr);
+
+    // the files of absolute are served under /relative/
+    void addFolder(const QString &relative, const QString &absolute);
+    void clear();
+
+    /**
+     * @brief respond The response to a GET of the path of the url, /relative/file, with the values of the
+     * If-None-Match, If-Modified-Since and Accept-Encoding headers of the request.
+     */
+    response respond(const QString &urlPath, const QByteArray &ifNoneMatch, const QByteArray &ifModifiedSince,
+                     const QByteArray &acceptEncoding);
+
+    // the gzip format of the data, as deflate and the crc of qCompress don't make one
+    static QByteArray gzip(const QByteArray &data);
+    static quint32 crc32(const QByteArray &data);
+
+  private slots:
+    void changed(const QString &path);
+
+  private:
+    QString fileName(const QString &urlPath) const;
+    const templateasset *load(const QString &fileName);
+    QHash<QString, QString> folders;
+    QHash<QString, templateasset> cache;
+    QFileSystemWatcher watcher;
+};
+
+#endif // TEMPLATEASSETS_H
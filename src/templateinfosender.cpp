@@ -1,5 +1,6 @@
 #include "templateinfosender.h"
 #include "qdebugfixup.h"
+#include <QRegularExpression>
 #include <chrono>
 
 using namespace std::chrono_literals;
@@ -16,31 +17,153 @@ TemplateInfoSender::~TemplateInfoSender() { stop(); }
 
 bool TemplateInfoSender::init(const QString &script) {
     jscript = script;
+    compiled = QJSValue();
+    compiledEngine = nullptr;
+    lastUpdate.invalidate();
+    lastNs = maxNs = totalNs = updates = 0;
+    readInterval();
     stop();
     return init();
 }
 
+bool TemplateInfoSender::readInterval() {
+    int old = interval;
+    interval = qMax(100, settings.value(QStringLiteral("template_") + templateId + QStringLiteral("_interval"), 1000)
+                             .toInt());
+    return interval != old;
+}
+
+QJSValue TemplateInfoSender::compile(QJSEngine *eng, const QString &script) {
+    // the last statement starts after the last ; or } out of brackets, strings and comments that has code after it,
+    // and ends at its last code, without the ; and the comments
+    int depth = 0, last = 0, boundary = -1, end = 0;
+    for (int i = 0; i < script.length(); i++) {
+        QChar c = script.at(i);
+        if (c.isSpace())
+            continue;
+        if (c == QLatin1Char('/') && script.mid(i, 2) == QLatin1String("//")) {
+            i = script.indexOf(QLatin1Char('\n'), i);
+            if (i < 0)
+                break;
+            continue;
+        }
+        if (c == QLatin1Char('/') && script.mid(i, 2) == QLatin1String("/*")) {
+            i = script.indexOf(QLatin1String("*/"), i + 2);
+            if (i < 0)
+                break;
+            i++;
+            continue;
+        }
+        if (c == QLatin1Char(';') && depth == 0) {
+            boundary = i + 1;
+            continue;
+        }
+        if (boundary >= 0 && depth == 0) {
+            last = boundary;
+            boundary = -1;
+        }
+        if (c == QLatin1Char('"') || c == QLatin1Char('\'') || c == QLatin1Char('`')) {
+            for (i++; i < script.length() && script.at(i) != c; i++) {
+                if (script.at(i) == QLatin1Char('\\'))
+                    i++;
+            }
+        } else if (c == QLatin1Char('(') || c == QLatin1Char('[') || c == QLatin1Char('{')) {
+            depth++;
+        } else if (c == QLatin1Char(')') || c == QLatin1Char(']') || c == QLatin1Char('}')) {
+            depth--;
+            if (depth == 0 && c == QLatin1Char('}'))
+                boundary = i + 1;
+        }
+        end = qMin(i + 1, script.length());
+    }
+
+    QString head = script.left(last);
+    QString tail = script.mid(last, end - last).trimmed();
+    static const QRegularExpression statement(
+        QStringLiteral("^(let|var|const|function|class|if|for|while|do|switch|try|throw|return)\\b"));
+    if (depth != 0 || tail.isEmpty() || statement.match(tail).hasMatch())
+        return QJSValue();
+
+    // the tail on its own lines, a comment in it must not take the bracket
+    QJSValue f = eng->evaluate(QStringLiteral("(function (workout) {\n") + head + QStringLiteral("\nreturn (\n") + tail +
+                               QStringLiteral("\n);\n})"));
+    return f.isCallable() ? f : QJSValue();
+}
+
 bool TemplateInfoSender::update(QJSEngine *eng) {
-    if (!jscript.isEmpty()) {
-        QJSValue jsv = eng->evaluate(jscript);
-        if (!jsv.isError()) {
-            QString evalres = jsv.toString();
-            qDebug() << QStringLiteral("eval res ") << evalres;
-            return send(evalres);
+    if (jscript.isEmpty())
+        return false;
+
+    QJSValue glob = eng->globalObject();
+    QElapsedTimer elapsed;
+    QJSValue jsv;
+    if (compiledEngine != eng) {
+        compiledEngine = eng;
+        compiled = compile(eng, jscript);
+        if (compiled.isCallable()) {
+            // the script runs here: unless its value is a function to call instead, that is the value of this update
+            elapsed.start();
+            jsv = compiled.callWithInstance(glob, {glob.property(QStringLiteral("workout"))});
+            if (jsv.isCallable()) {
+                compiled = jsv;
+                elapsed.invalidate();
+            }
         } else {
+            qDebug() << QStringLiteral("Template") << templateId
+                     << QStringLiteral("can't be compiled, it is evaluated at every update");
+        }
+    }
+
+    if (!elapsed.isValid()) {
+        elapsed.start();
+        jsv = compiled.isCallable() ? compiled.callWithInstance(glob, {glob.property(QStringLiteral("workout"))})
+                                    : eng->evaluate(jscript);
+    }
+    lastNs = elapsed.nsecsElapsed();
+    maxNs = qMax(maxNs, lastNs);
+    totalNs += lastNs;
+    updates++;
+    lastUpdate.start();
+
+    if (!jsv.isError()) {
+        QString evalres = toData(eng, jsv);
+        qDebug() << QStringLiteral("eval res ") << evalres;
+        return send(evalres);
+    } else {
 #if (QT_VERSION < QT_VERSION_CHECK(5, 12, 0))
-            int errorType = 255;
+        int errorType = 255;
 #else
-            int errorType = jsv.errorType();
+        int errorType = jsv.errorType();
 #endif
-            qDebug() << QStringLiteral("Scripts contains an error:") << jscript << QStringLiteral("error") << errorType;
-            return false;
-        }
-    } else {
+        qDebug() << QStringLiteral("Scripts contains an error:") << jscript << QStringLiteral("error") << errorType;
         return false;
     }
 }
 
+QString TemplateInfoSender::toData(QJSEngine *eng, const QJSValue &value) {
+    // the structured values go out as json, the others as they are
+    if (value.isObject() && !value.isCallable()) {
+        QJSValue stringify = eng->globalObject().property(QStringLiteral("JSON")).property(QStringLiteral("stringify"));
+        return stringify.call({value}).toString();
+    }
+    return value.toString();
+}
+
+bool TemplateInfoSender::due(int tick) const {
+    return !lastUpdate.isValid() || lastUpdate.elapsed() + (tick / 2) >= interval;
+}
+
+QJsonObject TemplateInfoSender::stats() const {
+    QJsonObject json;
+    json[QStringLiteral("compiled")] = compiled.isCallable();
+    json[QStringLiteral("interval")] = interval;
+    json[QStringLiteral("updates")] = updates;
+    json[QStringLiteral("last")] = lastNs / 1000.0;
+    json[QStringLiteral("avg")] = updates ? (totalNs / updates) / 1000.0 : 0.0;
+    json[QStringLiteral("max")] = maxNs / 1000.0;
+    return json;
+}
+
 QString TemplateInfoSender::js() const { return jscript; }
 
 QString TemplateInfoSender::getId() const { return templateId; }
@@ -1,9 +1,12 @@
 #ifndef TEMPLATEINFOSENDER_H
 #define TEMPLATEINFOSENDER_H
+#include <QElapsedTimer>
 #include <QJSEngine>
+#include <QJsonObject>
 #include <QObject>
 #include <QSettings>
 #include <QTimer>
+#include <QVector>
 
 class TemplateInfoSender : public QObject {
     Q_OBJECT
@@ -17,8 +20,34 @@ class TemplateInfoSender : public QObject {
     bool update(QJSEngine *eng);
     QString js() const;
     QString getId() const;
+    // the update period, template_<id>_interval in the settings (ms)
+    int updateInterval() const { return interval; }
+    // reads the period again from the settings, true if it changed
+    bool readInterval();
+    // true when the period is over, give or take half a tick of the builder
+    bool due(int tick) const;
+    // the execution time of the script: last, average and max in us, and the updates
+    QJsonObject stats() const;
+    // the period of the fastest binary telemetry client (ms), 0 without them
+    virtual int telemetryInterval() const { return 0; }
+    // the frames of the telemetry clients whose period is over
+    virtual void sendTelemetry(const QVector<double> &values, int tick) {
+        Q_UNUSED(values);
+        Q_UNUSED(tick);
+    }
+
+    /**
+     * @brief compile The script as a function of the workout, so that the engine parses it once. The value of the
+     * last statement is returned, as evaluate does; a script whose value is itself a function is called instead, on
+     * the first update. Not callable when the script can't be made a function: it is evaluated at every update then.
+     * The script runs in the scope of the function: its var, let and function declarations are local and start again
+     * at every update, while evaluate kept them on the global object. A value that must last from an update to the
+     * next goes on the global object explicitly, as this.count = (this.count || 0) + 1.
+     */
+    static QJSValue compile(QJSEngine *eng, const QString &script);
   signals:
     void onDataReceived(QByteArray data);
+    void telemetryIntervalChanged();
 
   protected:
     virtual bool init() = 0;
@@ -30,7 +59,16 @@ class TemplateInfoSender : public QObject {
     void reinit();
 
   private:
+    QString toData(QJSEngine *eng, const QJSValue &value);
     QTimer retryTimer;
+    QJSValue compiled;
+    QJSEngine *compiledEngine = nullptr;
+    int interval = 1000;
+    QElapsedTimer lastUpdate;
+    qint64 lastNs = 0;
+    qint64 maxNs = 0;
+    qint64 totalNs = 0;
+    qint64 updates = 0;
 };
 
 #endif // TEMPLATEINFOSENDER_H
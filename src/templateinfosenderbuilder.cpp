@@ -1,5 +1,7 @@
 #include "templateinfosenderbuilder.h"
 #include "devices/bike.h"
+#include "latencymonitor.h"
+#include "templatetelemetry.h"
 #include "treadmill.h"
 #include <QDirIterator>
 #include <QJsonArray>
@@ -8,6 +10,7 @@
 #include <QNetworkInterface>
 #include <QStandardPaths>
 #include <QTime>
+#include <QtNumeric>
 #include <limits>
 #ifdef Q_HTTPSERVER
 #include "webserverinfosender.h"
@@ -19,60 +22,122 @@
 
 using namespace std::chrono_literals;
 
-#define TRAINPROGRAM_FIELD_TO_STRING()                                                                      \
-    item[QStringLiteral("duration")] = row.duration.toString();                                             \
-    item[QStringLiteral("duration_s")] = QTime(0,0,0).secsTo(row.duration);                                 \
-    item[QStringLiteral("distance")] = row.distance;                                                        \
-    item[QStringLiteral("speed")] = row.speed;                                                              \
-    item[QStringLiteral("minspeed")] = row.minSpeed;                                                        \
-    item[QStringLiteral("maxspeed")] = row.maxSpeed;                                                        \
-    item[QStringLiteral("fanspeed")] = row.fanspeed;                                                        \
-    item[QStringLiteral("inclination")] = row.inclination;                                                  \
-    item[QStringLiteral("resistance")] = row.resistance;                                                    \
-    item[QStringLiteral("maxresistance")] = row.maxResistance;                                              \
-    item[QStringLiteral("mets")] = row.mets;                                                                \
-    item[QStringLiteral("pace_intensity")] = row.pace_intensity;                                            \
-    item[QStringLiteral("lower_resistance")] = row.lower_resistance;                                        \
-    item[QStringLiteral("upper_resistance")] = row.upper_resistance;                                        \
-    item[QStringLiteral("requested_peloton_resistance")] = row.requested_peloton_resistance;                \
-    item[QStringLiteral("lower_requested_peloton_resistance")] = row.lower_requested_peloton_resistance;    \
-    item[QStringLiteral("upper_requested_peloton_resistance")] = row.upper_requested_peloton_resistance;    \
-    item[QStringLiteral("power")] = row.power;                                                              \
-    item[QStringLiteral("cadence")] = row.cadence;                                                          \
-    item[QStringLiteral("lower_cadence")] = row.lower_cadence;                                              \
-    item[QStringLiteral("upper_cadence")] = row.upper_cadence;                                              \
-    item[QStringLiteral("forcespeed")] = row.forcespeed;                                                    \
-    item[QStringLiteral("loopTimeHR")] = row.loopTimeHR;                                                    \
-    item[QStringLiteral("zoneHR")] = row.zoneHR;                                                            \
-    item[QStringLiteral("HRmin")] = row.HRmin;                                                              \
-    item[QStringLiteral("HRmax")] = row.HRmax;                                                              \
-    item[QStringLiteral("maxSpeed")] = row.maxSpeed;                                                        \
-    item[QStringLiteral("latitude")] = row.latitude;                                                        \
-    item[QStringLiteral("longitude")] = row.longitude;                                                      \
-    item[QStringLiteral("altitude")] = row.altitude;                                                        \
-    item[QStringLiteral("azimuth")] = row.azimuth;
+#define TRAINPROGRAM_FIELD_TO_STRING()                                                                            \
+    item[QStringLiteral("duration")] = row.duration.toString();                                                   \
+    item[QStringLiteral("duration_s")] = QTime(0,0,0).secsTo(row.duration);                                       \
+    item[QStringLiteral("distance")] = row.distance;                                                              \
+    item[QStringLiteral("speed")] = row.speed;                                                                    \
+    item[QStringLiteral("minspeed")] = row.minSpeed;                                                              \
+    item[QStringLiteral("maxspeed")] = row.maxSpeed;                                                              \
+    item[QStringLiteral("fanspeed")] = row.fanspeed;                                                              \
+    item[QStringLiteral("inclination")] = row.inclination;                                                        \
+    item[QStringLiteral("resistance")] = row.resistance;                                                          \
+    item[QStringLiteral("maxresistance")] = row.maxResistance;                                                    \
+    item[QStringLiteral("mets")] = row.mets;                                                                      \
+    item[QStringLiteral("pace_intensity")] = row.ranges().pace_intensity;                                         \
+    item[QStringLiteral("lower_resistance")] = row.ranges().lower_resistance;                                     \
+    item[QStringLiteral("upper_resistance")] = row.ranges().upper_resistance;                                     \
+    item[QStringLiteral("requested_peloton_resistance")] = row.requested_peloton_resistance;                      \
+    item[QStringLiteral("lower_requested_peloton_resistance")] = row.ranges().lower_requested_peloton_resistance; \
+    item[QStringLiteral("upper_requested_peloton_resistance")] = row.ranges().upper_requested_peloton_resistance; \
+    item[QStringLiteral("power")] = row.power;                                                                    \
+    item[QStringLiteral("cadence")] = row.cadence;                                                                \
+    item[QStringLiteral("lower_cadence")] = row.ranges().lower_cadence;                                           \
+    item[QStringLiteral("upper_cadence")] = row.ranges().upper_cadence;                                           \
+    item[QStringLiteral("forcespeed")] = row.forcespeed;                                                          \
+    item[QStringLiteral("loopTimeHR")] = row.loopTimeHR;                                                          \
+    item[QStringLiteral("zoneHR")] = row.zoneHR;                                                                  \
+    item[QStringLiteral("HRmin")] = row.HRmin;                                                                    \
+    item[QStringLiteral("HRmax")] = row.HRmax;                                                                    \
+    item[QStringLiteral("maxSpeed")] = row.maxSpeed;                                                              \
+    item[QStringLiteral("latitude")] = row.latitude;                                                              \
+    item[QStringLiteral("longitude")] = row.longitude;                                                            \
+    item[QStringLiteral("altitude")] = row.altitude;                                                              \
+    item[QStringLiteral("azimuth")] = row.azimuth;                                                                \
+    if (row.isRamp()) {                                                                                           \
+        item[QStringLiteral("powerto")] = row.powerTo;                                                            \
+        item[QStringLiteral("speedto")] = row.speedTo;                                                            \
+        item[QStringLiteral("inclinationto")] = row.inclinationTo;                                                \
+        item[QStringLiteral("cadenceto")] = row.cadenceTo;                                                        \
+        item[QStringLiteral("resistanceto")] = row.resistanceTo;                                                  \
+    }
 
 
 QHash<QString, TemplateInfoSenderBuilder *> TemplateInfoSenderBuilder::instanceMap;
 TemplateInfoSenderBuilder::TemplateInfoSenderBuilder(QObject *parent) : QObject(parent) {
     engine = new QJSEngine(this);
     engine->installExtensions(QJSEngine::AllExtensions);
+    settingsProxy = new settingsproxy(this);
+    connect(settingsProxy, &settingsproxy::changed, this, [this](const QString &key, const QVariant &value) {
+        // the keys changed by the same message go out together
+        if (pendingSettingsDelta.isEmpty() && !settingsSubscribers.isEmpty())
+            QTimer::singleShot(0, this, &TemplateInfoSenderBuilder::flushSettingsDelta);
+        if (!settingsSubscribers.isEmpty())
+            pendingSettingsDelta.insert(key, QJsonValue::fromVariant(value));
+    });
     connect(&updateTimer, &QTimer::timeout, this, &TemplateInfoSenderBuilder::onUpdateTimeout);
     updateTimer.setSingleShot(false);
+    settingsTimer.setInterval(1000);
+    connect(&settingsTimer, &QTimer::timeout, this, [this]() {
+        if (settingsSubscribers.isEmpty())
+            settingsTimer.stop();
+        else
+            settingsProxy->refresh();
+    });
 }
 
 TemplateInfoSenderBuilder::~TemplateInfoSenderBuilder() { stop(); }
 
+bool TemplateInfoSenderBuilder::secondElapsed(QElapsedTimer &timer) const {
+    // give or take half a tick
+    if (timer.isValid() && timer.elapsed() + (updateTimer.interval() / 2) < 1000)
+        return false;
+    timer.start();
+    return true;
+}
+
+bool TemplateInfoSenderBuilder::sessionDue() const {
+    return device && !device->isPaused() &&
+           (!sessionTimer.isValid() || sessionTimer.elapsed() + (updateTimer.interval() / 2) >= 1000);
+}
+
 void TemplateInfoSenderBuilder::onUpdateTimeout() {
-    buildContext();
-    QHash<QString, TemplateInfoSender *>::Iterator it;
+    // the period of a template can be changed from its settings page
+    if (secondElapsed(intervalTimer)) {
+        bool changed = false;
+        for (TemplateInfoSender *t : qAsConst(templateInfoMap))
+            changed = t->readInterval() || changed;
+        if (changed && updateTimer.interval() != tickInterval())
+            updateTimer.start(tickInterval());
+    }
+
+    QList<TemplateInfoSender *> due, telemetry;
+    for (TemplateInfoSender *t : qAsConst(templateInfoMap)) {
+        if (t->due(updateTimer.interval()))
+            due.append(t);
+        if (t->telemetryInterval() > 0)
+            telemetry.append(t);
+    }
+    if (due.isEmpty() && telemetry.isEmpty())
+        return;
+
+    // the script context is built for the templates and the session sample, the telemetry reads the device directly
+    if (!due.isEmpty() || sessionDue())
+        buildContext();
     bool rv;
-    for (it = templateInfoMap.begin(); it != templateInfoMap.end(); it++) {
-        rv = it.value()->update(engine);
+    for (TemplateInfoSender *t : qAsConst(due)) {
+        rv = t->update(engine);
         if (!rv) {
-            qDebug() << QStringLiteral("Error updating") << it.key() << QStringLiteral("template");
+            qDebug() << QStringLiteral("Error updating") << t->getId() << QStringLiteral("template");
         }
     }
+    if (!telemetry.isEmpty()) {
+        QVector<double> values = telemetryValues();
+        for (TemplateInfoSender *t : qAsConst(telemetry))
+            t->sendTelemetry(values, updateTimer.interval());
+    }
+    if (device && !templateInfoMap.isEmpty())
+        latencymonitor::record(latencymonitor::TEMPLATE, device->ingressNs());
 }
 
 void TemplateInfoSenderBuilder::stop() {
@@ -159,6 +224,7 @@ void TemplateInfoSenderBuilder::load(const QString &idInfo, const QStringList &f
     foldersToLook = folders;
     templateInfoMap.clear();
     templateFilesList.clear();
+    settingsSubscribers.clear();
     QStringList globalIdList, globalFolderList;
     int startIdIndex = 0;
     for (auto &tdir : folders) {
@@ -216,6 +282,7 @@ TemplateInfoSender *TemplateInfoSenderBuilder::newTemplate(const QString &id, co
     if (tempInfo) {
         TemplateInfoSender *old;
         if ((old = templateInfoMap.value(id, 0))) {
+            settingsSubscribers.remove(old);
             delete old;
         }
         qDebug() << QStringLiteral("Template Registered") << id << QStringLiteral(" type") << tp
@@ -223,6 +290,10 @@ TemplateInfoSender *TemplateInfoSenderBuilder::newTemplate(const QString &id, co
         templateInfoMap.insert(id, tempInfo);
         tempInfo->init(dataTempl);
         connect(tempInfo, &TemplateInfoSender::onDataReceived, this, &TemplateInfoSenderBuilder::onDataReceived);
+        connect(tempInfo, &TemplateInfoSender::telemetryIntervalChanged, this, [this]() {
+            if (updateTimer.isActive() && updateTimer.interval() != tickInterval())
+                updateTimer.start(tickInterval());
+        });
     }
     return tempInfo;
 }
@@ -234,6 +305,7 @@ void TemplateInfoSenderBuilder::clearSessionArray() {
     for (int i = 0; i < len; i++) {
         sessionArray.removeAt(0);
     }
+    sessionTimer.invalidate();
 }
 
 void TemplateInfoSenderBuilder::start(bluetoothdevice *dev) {
@@ -242,15 +314,24 @@ void TemplateInfoSenderBuilder::start(bluetoothdevice *dev) {
     buildContext(true);
     device = dev;
     activityDescription = QLatin1String("");
-    updateTimer.start(1s);
+    updateTimer.start(tickInterval());
+}
+
+int TemplateInfoSenderBuilder::tickInterval() const {
+    // the timer ticks at the fastest template, the others skip the ticks before their period
+    int tick = 1000;
+    for (TemplateInfoSender *t : qAsConst(templateInfoMap)) {
+        tick = qMin(tick, t->updateInterval());
+        if (t->telemetryInterval() > 0)
+            tick = qMin(tick, t->telemetryInterval());
+    }
+    return tick;
 }
 
 QStringList TemplateInfoSenderBuilder::templateIdList() const { return templateFilesList.keys(); }
 
 void TemplateInfoSenderBuilder::onGetSettings(const QJsonValue &val, TemplateInfoSender *tempSender) {
     QJsonObject outObj;
-    QSettings settings;
-    QStringList keys = settings.allKeys();
     QJsonValue keys_req;
     QJsonArray keys_arr;
     QVariantList keys_to_retrieve;
@@ -263,20 +344,22 @@ void TemplateInfoSenderBuilder::onGetSettings(const QJsonValue &val, TemplateInf
             if (key.startsWith(QStringLiteral("$"))) {
                 outObj.insert(key, 1);
                 QRegExp regex(key.mid(1));
-                for (auto &keypresent : settings.allKeys()) {
+                const QStringList keys = settingsProxy->keys();
+                for (auto &keypresent : keys) {
                     if (regex.indexIn(keypresent) >= 0) {
-                        outObj.insert(keypresent, QJsonValue::fromVariant(settings.value(keypresent)));
+                        outObj.insert(keypresent, QJsonValue::fromVariant(settingsProxy->rawValue(keypresent)));
                     }
                 }
-            } else if (settings.contains(key)) {
-                outObj.insert(key, QJsonValue::fromVariant(settings.value(key)));
+            } else if (settingsProxy->contains(key)) {
+                outObj.insert(key, QJsonValue::fromVariant(settingsProxy->rawValue(key)));
             } else {
                 outObj.insert(key, QJsonValue());
             }
         }
     } else {
-        for (auto &key : settings.allKeys()) {
-            outObj.insert(key, QJsonValue::fromVariant(settings.value(key)));
+        const QStringList keys = settingsProxy->keys();
+        for (auto &key : keys) {
+            outObj.insert(key, QJsonValue::fromVariant(settingsProxy->rawValue(key)));
         }
     }
     QJsonObject main;
@@ -286,7 +369,64 @@ void TemplateInfoSenderBuilder::onGetSettings(const QJsonValue &val, TemplateInf
     tempSender->send(out.toJson());
 }
 
+void TemplateInfoSenderBuilder::onSubscribeSettings(const QJsonValue &val, TemplateInfoSender *tempSender) {
+    QStringList keys;
+    QJsonValue keys_req;
+    if (val.isObject() && (keys_req = val.toObject()[QStringLiteral("keys")]).isArray()) {
+        for (const QJsonValue &k : keys_req.toArray())
+            keys.append(k.toString());
+    }
+    if (!settingsSubscribers.contains(tempSender))
+        connect(tempSender, &QObject::destroyed, this,
+                [this, tempSender]() { settingsSubscribers.remove(tempSender); });
+    settingsSubscribers.insert(tempSender, keys);
+    if (!settingsTimer.isActive())
+        settingsTimer.start();
+
+    // the current values, then only the changes through settingschanged
+    QJsonObject outObj;
+    for (const QString &key : qAsConst(keys))
+        outObj.insert(key, QJsonValue::fromVariant(settingsProxy->rawValue(key)));
+    QJsonObject main;
+    main[QStringLiteral("msg")] = QStringLiteral("R_subscribesettings");
+    main[QStringLiteral("content")] = outObj;
+    QJsonDocument out(main);
+    tempSender->send(out.toJson());
+}
+
+void TemplateInfoSenderBuilder::onUnsubscribeSettings(TemplateInfoSender *tempSender) {
+    settingsSubscribers.remove(tempSender);
+    QJsonObject main;
+    main[QStringLiteral("msg")] = QStringLiteral("R_unsubscribesettings");
+    QJsonDocument out(main);
+    tempSender->send(out.toJson());
+}
+
+void TemplateInfoSenderBuilder::flushSettingsDelta() {
+    QJsonObject delta = pendingSettingsDelta;
+    pendingSettingsDelta = QJsonObject();
+    for (auto it = settingsSubscribers.constBegin(); it != settingsSubscribers.constEnd(); ++it) {
+        QJsonObject outObj;
+        if (it.value().isEmpty()) {
+            outObj = delta;
+        } else {
+            for (const QString &key : it.value()) {
+                if (delta.contains(key))
+                    outObj.insert(key, delta.value(key));
+            }
+        }
+        if (outObj.isEmpty())
+            continue;
+        QJsonObject main;
+        main[QStringLiteral("msg")] = QStringLiteral("settingschanged");
+        main[QStringLiteral("content")] = outObj;
+        QJsonDocument out(main);
+        it.key()->send(out.toJson());
+    }
+}
+
 void TemplateInfoSenderBuilder::onSetResistance(const QJsonValue &msgContent, TemplateInfoSender *tempSender) {
+    controlarbiter::scope source(controlarbiter::REMOTE);
     QJsonObject obj, outObj;
     QJsonValue resVal;
     outObj[QStringLiteral("value")] = QJsonValue(QJsonValue::Null);
@@ -330,6 +470,7 @@ void TemplateInfoSenderBuilder::onSetFanSpeed(const QJsonValue &msgContent, Temp
 }
 
 void TemplateInfoSenderBuilder::onSetPower(const QJsonValue &msgContent, TemplateInfoSender *tempSender) {
+    controlarbiter::scope source(controlarbiter::REMOTE);
     QJsonObject obj, outObj;
     QJsonValue resVal;
     outObj[QStringLiteral("value")] = QJsonValue(QJsonValue::Null);
@@ -370,6 +511,7 @@ void TemplateInfoSenderBuilder::onSetCadence(const QJsonValue &msgContent, Templ
 }
 
 void TemplateInfoSenderBuilder::onSetSpeed(const QJsonValue &msgContent, TemplateInfoSender *tempSender) {
+    controlarbiter::scope source(controlarbiter::REMOTE);
     QJsonObject obj, outObj;
     QJsonValue resVal;
     double vald;
@@ -414,25 +556,24 @@ void TemplateInfoSenderBuilder::onSetSettings(const QJsonValue &msgContent, Temp
     QVariant valConv;
     QVariant settingVal;
     QJsonObject outObj;
-    QSettings settings;
     for (auto &key : keys) {
-        if (settings.contains(key)) {
+        if (settingsProxy->contains(key)) {
             val = obj[key];
             valConv = val.toVariant();
-            settingVal = settings.value(key);
+            settingVal = settingsProxy->rawValue(key);
             if (valConv.type() == settingVal.type()) {
-                settings.setValue(key, valConv);
+                settingsProxy->setValue(key, valConv);
                 outObj.insert(key, val);
             } else {
                 outObj.insert(key, QJsonValue::fromVariant(settingVal));
             }
         } else {
             val = obj[key];
-            settings.setValue(key, val.toVariant());
+            settingsProxy->setValue(key, val.toVariant());
             outObj.insert(key, val);
         }
     }
-    settings.sync();
+    settingsProxy->sync();
     QJsonObject main;
     main[QStringLiteral("msg")] = QStringLiteral("R_setsettings");
     main[QStringLiteral("content")] = outObj;
@@ -524,6 +665,19 @@ void TemplateInfoSenderBuilder::onGetSessionArray(TemplateInfoSender *tempSender
     tempSender->send(out.toJson());
 }
 
+void TemplateInfoSenderBuilder::onGetLatency(TemplateInfoSender *tempSender) {
+    QJsonObject main;
+    QJsonObject content = latencymonitor::toJson();
+    QJsonObject templates;
+    for (TemplateInfoSender *t : qAsConst(templateInfoMap))
+        templates[t->getId()] = t->stats();
+    content[QStringLiteral("templates")] = templates;
+    main[QStringLiteral("content")] = content;
+    main[QStringLiteral("msg")] = QStringLiteral("R_getlatency");
+    QJsonDocument out(main);
+    tempSender->send(out.toJson());
+}
+
 void TemplateInfoSenderBuilder::onGetGPXBase64(TemplateInfoSender *tempSender) {
     if (!device)
         return;
@@ -801,6 +955,12 @@ void TemplateInfoSenderBuilder::onDataReceived(const QByteArray &data) {
                 if (msg == QStringLiteral("getsettings")) {
                     onGetSettings(jsonObject[QStringLiteral("content")], sender);
                     return;
+                } else if (msg == QStringLiteral("subscribesettings")) {
+                    onSubscribeSettings(jsonObject[QStringLiteral("content")], sender);
+                    return;
+                } else if (msg == QStringLiteral("unsubscribesettings")) {
+                    onUnsubscribeSettings(sender);
+                    return;
                 } else if (msg == QStringLiteral("getlatlon")) {
                     onGetLatLon(sender);
                     return;
@@ -879,6 +1039,9 @@ void TemplateInfoSenderBuilder::onDataReceived(const QByteArray &data) {
                 } else if (msg == QStringLiteral("getsessionarray")) {
                     onGetSessionArray(sender);
                     return;
+                } else if (msg == QStringLiteral("getlatency")) {
+                    onGetLatency(sender);
+                    return;
                 }
                 if (msg == QStringLiteral("start")) {
                     onStart(sender);
@@ -898,10 +1061,34 @@ void TemplateInfoSenderBuilder::onDataReceived(const QByteArray &data) {
     // qDebug() << QStringLiteral("Unrecognized message") << data;
 }
 
+QJSValue TemplateInfoSenderBuilder::settingsObject() {
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 12, 0))
+    QJSValue factory = engine->evaluate(QStringLiteral(
+        "(function(s) { return new Proxy({}, {"
+        "  get: function(t, k) { return typeof k === 'string' ? s.value(k) : undefined; },"
+        "  has: function(t, k) { return s.contains(k); },"
+        "  ownKeys: function(t) { return s.keys(); },"
+        "  getOwnPropertyDescriptor: function(t, k) {"
+        "    return s.contains(k) ? { value: s.value(k), writable: false, enumerable: true, configurable: true }"
+        "                         : undefined; }"
+        "}); })"));
+    return factory.call(QJSValueList() << engine->newQObject(settingsProxy));
+#else
+    // no Proxy in the javascript engine: a copy of the values
+    QJSValue sett = engine->newObject();
+    const QStringList keys = settingsProxy->keys();
+    for (const QString &key : keys) {
+        QVariant v = settingsProxy->value(key);
+        if (v.isValid())
+            sett.setProperty(key, engine->toScriptValue(v));
+    }
+    return sett;
+#endif
+}
+
 void TemplateInfoSenderBuilder::buildContext(bool forceReinit) {
     QJSValue glob = engine->globalObject();
     QJSValue obj;
-    QSettings settings;
 
     if (!homeform::singleton()) {
         qDebug() << QStringLiteral("homeform::singleton() not available. You should never see this!");
@@ -915,35 +1102,11 @@ void TemplateInfoSenderBuilder::buildContext(bool forceReinit) {
         obj = glob.property(QStringLiteral("workout"));
 
     if (!glob.hasOwnProperty(QStringLiteral("settings")) || forceReinit) {
-        QJSValue sett = engine->newObject();
-        glob.setProperty(QStringLiteral("settings"), sett);
-        QVariant::Type typesett;
-        QVariant valsett;
-        int i = 0;
-        auto allKeys_list = settings.allKeys();
-        for (const auto &key : allKeys_list) {
-            valsett.setValue(settings.value(key));
-            typesett = valsett.type();
-            if (typesett == QVariant::Int) {
-                sett.setProperty(key, valsett.toInt());
-            } else if (typesett == QVariant::Double) {
-                sett.setProperty(key, valsett.toDouble());
-            } else if (typesett == QVariant::String) {
-                sett.setProperty(key, valsett.toString());
-            } else if (typesett == QVariant::Bool) {
-                sett.setProperty(key, valsett.toBool());
-            } else if (typesett == QVariant::UInt) {
-                sett.setProperty(key, valsett.toUInt());
-            } else if (typesett == QVariant::StringList) {
-                QStringList settL = valsett.toStringList();
-                QJSValue settLJ = engine->newArray(settL.size());
-                i = 0;
-                for (const auto &settLK : qAsConst(settL)) {
-                    settLJ.setProperty(i++, settLK);
-                }
-                sett.setProperty(key, settLJ);
-            }
-        }
+        // the scripts read the settings on demand: a reinit only reads again the cached values, and the subscribed
+        // clients get the ones changed in the meantime
+        settingsProxy->refresh();
+        if (!glob.hasOwnProperty(QStringLiteral("settings")))
+            glob.setProperty(QStringLiteral("settings"), settingsObject());
         obj.setProperty(QStringLiteral("BIKE_TYPE"), (int)bluetoothdevice::BIKE);
         obj.setProperty(QStringLiteral("ELLIPTICAL_TYPE"), (int)bluetoothdevice::ELLIPTICAL);
         obj.setProperty(QStringLiteral("ROWING_TYPE"), (int)bluetoothdevice::ROWING);
@@ -953,209 +1116,213 @@ void TemplateInfoSenderBuilder::buildContext(bool forceReinit) {
     if (!device) {
         obj.setProperty(QStringLiteral("deviceId"), QJSValue());
     } else {
-        QTime el = device->elapsedTime();
-        QTime elLap = device->lapElapsedTime();
-        QString name;
-        QString nickName;
-        bluetoothdevice::BLUETOOTH_TYPE tp = device->deviceType();
+        workoutValues([&obj](const QString &name, const QJSValue &value) { obj.setProperty(name, value); });
+        if (!device->isPaused() && secondElapsed(sessionTimer)) {
+            sessionArray.append(QJsonObject::fromVariantMap(obj.toVariant().toMap()));
+        }
+    }
+}
+
+void TemplateInfoSenderBuilder::workoutValues(const std::function<void(const QString &, const QJSValue &)> &set) {
+    QTime el = device->elapsedTime();
+    QTime elLap = device->lapElapsedTime();
+    QString name;
+    QString nickName;
+    bluetoothdevice::BLUETOOTH_TYPE tp = device->deviceType();
 
-        metric dep;
+    metric dep;
 #ifdef Q_OS_IOS
-        obj.setProperty("deviceId", device->bluetoothDevice.deviceUuid().toString());
+    set("deviceId", device->bluetoothDevice.deviceUuid().toString());
 #else
-        obj.setProperty(QStringLiteral("deviceId"), device->bluetoothDevice.address().toString());
+    set(QStringLiteral("deviceId"), device->bluetoothDevice.address().toString());
 #endif
-        obj.setProperty(QStringLiteral("deviceName"),
-                        (name = device->bluetoothDevice.name()).isEmpty() ? QString(QStringLiteral("N/A")) : name);
-        obj.setProperty(QStringLiteral("deviceRSSI"), device->bluetoothDevice.rssi());
-        obj.setProperty(QStringLiteral("deviceType"), (int)device->deviceType());
-        obj.setProperty(QStringLiteral("deviceConnected"), (bool)device->connected());
-        obj.setProperty(QStringLiteral("devicePaused"), (bool)device->isPaused());
-        obj.setProperty(QStringLiteral("elapsed_s"), el.second());
-        obj.setProperty(QStringLiteral("elapsed_m"), el.minute());
-        obj.setProperty(QStringLiteral("elapsed_h"), el.hour());
-        obj.setProperty(QStringLiteral("lapelapsed_s"), elLap.second());
-        obj.setProperty(QStringLiteral("lapelapsed_m"), elLap.minute());
-        obj.setProperty(QStringLiteral("lapelapsed_h"), elLap.hour());
-        el = device->currentPace();
-        obj.setProperty(QStringLiteral("pace_s"), el.second());
-        obj.setProperty(QStringLiteral("pace_m"), el.minute());
-        obj.setProperty(QStringLiteral("pace_h"), el.hour());
-        obj.setProperty(QStringLiteral("pace_color"), homeform::singleton()->pace->valueFontColor());
-        el = device->averagePace();
-        obj.setProperty(QStringLiteral("avgpace_s"), el.second());
-        obj.setProperty(QStringLiteral("avgpace_m"), el.minute());
-        obj.setProperty(QStringLiteral("avgpace_h"), el.hour());
-        el = device->maxPace();
-        obj.setProperty(QStringLiteral("maxpace_s"), el.second());
-        obj.setProperty(QStringLiteral("maxpace_m"), el.minute());
-        obj.setProperty(QStringLiteral("maxpace_h"), el.hour());
-        el = device->movingTime();
-        obj.setProperty(QStringLiteral("moving_s"), el.second());
-        obj.setProperty(QStringLiteral("moving_m"), el.minute());
-        obj.setProperty(QStringLiteral("moving_h"), el.hour());
-        obj.setProperty(QStringLiteral("speed"), (dep = device->currentSpeed()).value());
-        obj.setProperty(QStringLiteral("speed_avg"), dep.average());
-        obj.setProperty(QStringLiteral("speed_color"), homeform::singleton()->speed->valueFontColor());
-        obj.setProperty(QStringLiteral("speed_lapavg"), dep.lapAverage());
-        obj.setProperty(QStringLiteral("speed_lapmax"), dep.lapMax());
-        obj.setProperty(QStringLiteral("calories"), device->calories().value());
-        obj.setProperty(QStringLiteral("distance"), device->odometer());
-        obj.setProperty(QStringLiteral("heart"), (dep = device->currentHeart()).value());
-        obj.setProperty(QStringLiteral("heart_color"), homeform::singleton()->heart->valueFontColor());
-        obj.setProperty(QStringLiteral("heart_avg"), dep.average());
-        obj.setProperty(QStringLiteral("heart_lapavg"), dep.lapAverage());
-        obj.setProperty(QStringLiteral("heart_max"), dep.max());
-        obj.setProperty(QStringLiteral("heart_lapmax"), dep.lapMax());
-        obj.setProperty(QStringLiteral("jouls"), device->jouls().value());
-        obj.setProperty(QStringLiteral("elevation"), device->elevationGain().value());
-        obj.setProperty(QStringLiteral("difficult"), device->difficult());
-        obj.setProperty(QStringLiteral("watts"), (dep = device->wattsMetric()).value());
-        obj.setProperty(QStringLiteral("watts_avg"), dep.average());
-        obj.setProperty(QStringLiteral("watts_color"), homeform::singleton()->watt->valueFontColor());
-        obj.setProperty(QStringLiteral("watts_lapavg"), dep.lapAverage());
-        obj.setProperty(QStringLiteral("watts_max"), dep.max());
-        obj.setProperty(QStringLiteral("watts_lapmax"), dep.lapMax());
-        obj.setProperty(QStringLiteral("kgwatts"), (dep = device->wattKg()).value());
-        obj.setProperty(QStringLiteral("kgwatts_avg"), dep.average());
-        obj.setProperty(QStringLiteral("kgwatts_max"), dep.max());
-        obj.setProperty(QStringLiteral("workoutName"), workoutName);
-        obj.setProperty(QStringLiteral("workoutStartDate"), workoutStartDate);
-        obj.setProperty(QStringLiteral("instructorName"), instructorName);
-        obj.setProperty(QStringLiteral("latitude"), device->currentCordinate().latitude());
-        obj.setProperty(QStringLiteral("longitude"), device->currentCordinate().longitude());
-        obj.setProperty(QStringLiteral("altitude"), device->currentCordinate().altitude());
-        obj.setProperty(QStringLiteral("peloton_offset"), pelotonOffset());
-        obj.setProperty(QStringLiteral("peloton_ask_start"), pelotonAskStart());
-        obj.setProperty(QStringLiteral("autoresistance"), homeform::singleton()->autoResistance());
-        if (homeform::singleton()->trainingProgram()) {
-            el = homeform::singleton()->trainingProgram()->currentRowRemainingTime();
-            obj.setProperty(QStringLiteral("row_remaining_time_s"), el.second());
-            obj.setProperty(QStringLiteral("row_remaining_time_m"), el.minute());
-            obj.setProperty(QStringLiteral("row_remaining_time_h"), el.hour());
-        } else {
-            obj.setProperty(QStringLiteral("row_remaining_time_s"), 0);
-            obj.setProperty(QStringLiteral("row_remaining_time_m"), 0);
-            obj.setProperty(QStringLiteral("row_remaining_time_h"), 0);
-        }
-        if (homeform::singleton()->trainingProgram()) {
-            el = homeform::singleton()->trainingProgram()->remainingTime();
-            obj.setProperty(QStringLiteral("remaining_time_s"), el.second());
-            obj.setProperty(QStringLiteral("remaining_time_m"), el.minute());
-            obj.setProperty(QStringLiteral("remaining_time_h"), el.hour());
-        } else {
-            obj.setProperty(QStringLiteral("remaining_time_s"), 0);
-            obj.setProperty(QStringLiteral("remaining_time_m"), 0);
-            obj.setProperty(QStringLiteral("remaining_time_h"), 0);
-        }
-        obj.setProperty(
-            QStringLiteral("nickName"),
-            (nickName = settings.value(QZSettings::user_nickname, QZSettings::default_user_nickname).toString())
-                    .isEmpty()
-                ? QString(QStringLiteral("N/A"))
-                : nickName);
-        if (tp == bluetoothdevice::BIKE) {
-            obj.setProperty(QStringLiteral("gears"), ((bike *)device)->gears());
-            obj.setProperty(QStringLiteral("target_resistance"), ((bike *)device)->lastRequestedResistance().value());
-            obj.setProperty(QStringLiteral("target_peloton_resistance"),
-                            ((bike *)device)->lastRequestedPelotonResistance().value());
-            obj.setProperty(QStringLiteral("target_cadence"), ((bike *)device)->lastRequestedCadence().value());
-            obj.setProperty(QStringLiteral("target_power"), ((bike *)device)->lastRequestedPower().value());
-            obj.setProperty(QStringLiteral("power_zone"), ((bike *)device)->currentPowerZone().value());
-            obj.setProperty(QStringLiteral("power_zone_lapavg"), ((bike *)device)->currentPowerZone().lapAverage());
-            obj.setProperty(QStringLiteral("power_zone_lapmax"), ((bike *)device)->currentPowerZone().lapMax());
-            obj.setProperty(QStringLiteral("target_power_zone"), ((bike *)device)->targetPowerZone().value());
-            obj.setProperty(QStringLiteral("power_zone_color"), homeform::singleton()->ftp->valueFontColor());
-            obj.setProperty(QStringLiteral("target_power_zone_color"), homeform::singleton()->target_zone->valueFontColor());
-            obj.setProperty(QStringLiteral("peloton_resistance"),
-                            (dep = ((bike *)device)->pelotonResistance()).value());
-            obj.setProperty(QStringLiteral("peloton_resistance_avg"), dep.average());
-            obj.setProperty(QStringLiteral("peloton_resistance_color"), homeform::singleton()->peloton_resistance->valueFontColor());
-            obj.setProperty(QStringLiteral("peloton_resistance_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("peloton_resistance_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("peloton_req_resistance"),
-                            (dep = ((bike *)device)->lastRequestedPelotonResistance()).value());
-            obj.setProperty(QStringLiteral("cadence"), (dep = ((bike *)device)->currentCadence()).value());
-            obj.setProperty(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
-            obj.setProperty(QStringLiteral("cadence_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cadence_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("cadence_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("resistance"), (dep = ((bike *)device)->currentResistance()).value());
-            obj.setProperty(QStringLiteral("resistance_avg"), dep.average());
-            obj.setProperty(QStringLiteral("resistance_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("resistance_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("cranks"), ((bike *)device)->currentCrankRevolutions());
-            obj.setProperty(QStringLiteral("cranktime"), ((bike *)device)->lastCrankEventTime());
-            obj.setProperty(QStringLiteral("req_power"), (dep = ((bike *)device)->lastRequestedPower()).value());
-            obj.setProperty(QStringLiteral("req_cadence"), (dep = ((bike *)device)->lastRequestedCadence()).value());
-            obj.setProperty(QStringLiteral("req_resistance"),
-                            (dep = ((bike *)device)->lastRequestedResistance()).value());
-            obj.setProperty(QStringLiteral("inclination"),
-                            (dep = ((bike *)device)->currentInclination()).value());
-            obj.setProperty(QStringLiteral("inclination_avg"), dep.average());
-        } else if (tp == bluetoothdevice::ROWING) {
-            obj.setProperty(QStringLiteral("gears"), ((rower *)device)->gears());
-            el = ((rower *)device)->lastRequestedPace();
-            obj.setProperty(QStringLiteral("target_speed"), ((rower *)device)->lastRequestedSpeed().value());
-            obj.setProperty(QStringLiteral("target_pace_s"), el.second());
-            obj.setProperty(QStringLiteral("target_pace_m"), el.minute());
-            obj.setProperty(QStringLiteral("target_pace_h"), el.hour());
-            obj.setProperty(QStringLiteral("peloton_resistance"),
-                            (dep = ((rower *)device)->pelotonResistance()).value());
-            obj.setProperty(QStringLiteral("peloton_resistance_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cadence"), (dep = ((rower *)device)->currentCadence()).value());
-            obj.setProperty(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
-            obj.setProperty(QStringLiteral("cadence_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cadence_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("cadence_lapmax"), dep.lapMax());
-
-            // use to preserve compatibility to dochart.js and floating.htm
-            obj.setProperty(QStringLiteral("req_cadence"), (dep = ((rower *)device)->lastRequestedCadence()).value());
-            obj.setProperty(QStringLiteral("target_cadence"), (dep = ((rower *)device)->lastRequestedCadence()).value());
-            
-            obj.setProperty(QStringLiteral("resistance"), (dep = ((rower *)device)->currentResistance()).value());
-            obj.setProperty(QStringLiteral("resistance_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cranks"), ((rower *)device)->currentCrankRevolutions());
-            obj.setProperty(QStringLiteral("cranktime"), ((rower *)device)->lastCrankEventTime());
-            obj.setProperty(QStringLiteral("strokescount"), ((rower *)device)->currentStrokesCount().value());
-            obj.setProperty(QStringLiteral("strokeslength"), ((rower *)device)->currentStrokesLength().value());
-        } else if (tp == bluetoothdevice::TREADMILL) {
-            obj.setProperty(QStringLiteral("target_speed"), ((treadmill *)device)->lastRequestedSpeed().value());
-            el = ((treadmill *)device)->lastRequestedPace();
-            obj.setProperty(QStringLiteral("target_pace_s"), el.second());
-            obj.setProperty(QStringLiteral("target_pace_m"), el.minute());
-            obj.setProperty(QStringLiteral("target_pace_h"), el.hour());
-            obj.setProperty(QStringLiteral("target_inclination"),
-                            ((treadmill *)device)->lastRequestedInclination().value());
-            obj.setProperty(QStringLiteral("cadence"), (dep = ((treadmill *)device)->currentCadence()).value());
-            obj.setProperty(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
-            obj.setProperty(QStringLiteral("cadence_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cadence_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("cadence_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("inclination"), (dep = ((treadmill *)device)->currentInclination()).value());
-            obj.setProperty(QStringLiteral("inclination_avg"), dep.average());
-            obj.setProperty(QStringLiteral("inclination_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("inclination_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("stridelength"),
-                            (dep = ((treadmill *)device)->currentStrideLength()).value());
-            obj.setProperty(QStringLiteral("groundcontact"),
-                            (dep = ((treadmill *)device)->currentGroundContact()).value());
-            obj.setProperty(QStringLiteral("verticaloscillation"),
-                            (dep = ((treadmill *)device)->currentVerticalOscillation()).value());
-        } else if (tp == bluetoothdevice::ELLIPTICAL) {
-            obj.setProperty(QStringLiteral("cadence"), (dep = ((elliptical *)device)->currentCadence()).value());
-            obj.setProperty(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
-            obj.setProperty(QStringLiteral("cadence_avg"), dep.average());
-            obj.setProperty(QStringLiteral("cadence_lapavg"), dep.lapAverage());
-            obj.setProperty(QStringLiteral("cadence_lapmax"), dep.lapMax());
-            obj.setProperty(QStringLiteral("inclination"),
-                            (dep = ((elliptical *)device)->currentInclination()).value());
-            obj.setProperty(QStringLiteral("inclination_avg"), dep.average());
-        }
-        if (!device->isPaused()) {
-            sessionArray.append(QJsonObject::fromVariantMap(obj.toVariant().toMap()));
-        }
+    set(QStringLiteral("deviceName"),
+        (name = device->bluetoothDevice.name()).isEmpty() ? QString(QStringLiteral("N/A")) : name);
+    set(QStringLiteral("deviceRSSI"), device->bluetoothDevice.rssi());
+    set(QStringLiteral("deviceType"), (int)device->deviceType());
+    set(QStringLiteral("deviceConnected"), (bool)device->connected());
+    set(QStringLiteral("devicePaused"), (bool)device->isPaused());
+    set(QStringLiteral("elapsed_s"), el.second());
+    set(QStringLiteral("elapsed_m"), el.minute());
+    set(QStringLiteral("elapsed_h"), el.hour());
+    set(QStringLiteral("lapelapsed_s"), elLap.second());
+    set(QStringLiteral("lapelapsed_m"), elLap.minute());
+    set(QStringLiteral("lapelapsed_h"), elLap.hour());
+    el = device->currentPace();
+    set(QStringLiteral("pace_s"), el.second());
+    set(QStringLiteral("pace_m"), el.minute());
+    set(QStringLiteral("pace_h"), el.hour());
+    set(QStringLiteral("pace_color"), homeform::singleton()->pace->valueFontColor());
+    el = device->averagePace();
+    set(QStringLiteral("avgpace_s"), el.second());
+    set(QStringLiteral("avgpace_m"), el.minute());
+    set(QStringLiteral("avgpace_h"), el.hour());
+    el = device->maxPace();
+    set(QStringLiteral("maxpace_s"), el.second());
+    set(QStringLiteral("maxpace_m"), el.minute());
+    set(QStringLiteral("maxpace_h"), el.hour());
+    el = device->movingTime();
+    set(QStringLiteral("moving_s"), el.second());
+    set(QStringLiteral("moving_m"), el.minute());
+    set(QStringLiteral("moving_h"), el.hour());
+    set(QStringLiteral("speed"), (dep = device->currentSpeed()).value());
+    set(QStringLiteral("speed_avg"), dep.average());
+    set(QStringLiteral("speed_color"), homeform::singleton()->speed->valueFontColor());
+    set(QStringLiteral("speed_lapavg"), dep.lapAverage());
+    set(QStringLiteral("speed_lapmax"), dep.lapMax());
+    set(QStringLiteral("calories"), device->calories().value());
+    set(QStringLiteral("distance"), device->odometer());
+    set(QStringLiteral("heart"), (dep = device->currentHeart()).value());
+    set(QStringLiteral("heart_color"), homeform::singleton()->heart->valueFontColor());
+    set(QStringLiteral("heart_avg"), dep.average());
+    set(QStringLiteral("heart_lapavg"), dep.lapAverage());
+    set(QStringLiteral("heart_max"), dep.max());
+    set(QStringLiteral("heart_lapmax"), dep.lapMax());
+    set(QStringLiteral("jouls"), device->jouls().value());
+    set(QStringLiteral("elevation"), device->elevationGain().value());
+    set(QStringLiteral("difficult"), device->difficult());
+    set(QStringLiteral("watts"), (dep = device->wattsMetric()).value());
+    set(QStringLiteral("watts_avg"), dep.average());
+    set(QStringLiteral("watts_color"), homeform::singleton()->watt->valueFontColor());
+    set(QStringLiteral("watts_lapavg"), dep.lapAverage());
+    set(QStringLiteral("watts_max"), dep.max());
+    set(QStringLiteral("watts_lapmax"), dep.lapMax());
+    set(QStringLiteral("kgwatts"), (dep = device->wattKg()).value());
+    set(QStringLiteral("kgwatts_avg"), dep.average());
+    set(QStringLiteral("kgwatts_max"), dep.max());
+    set(QStringLiteral("workoutName"), workoutName);
+    set(QStringLiteral("workoutStartDate"), workoutStartDate);
+    set(QStringLiteral("instructorName"), instructorName);
+    set(QStringLiteral("latitude"), device->currentCordinate().latitude());
+    set(QStringLiteral("longitude"), device->currentCordinate().longitude());
+    set(QStringLiteral("altitude"), device->currentCordinate().altitude());
+    set(QStringLiteral("peloton_offset"), pelotonOffset());
+    set(QStringLiteral("peloton_ask_start"), pelotonAskStart());
+    set(QStringLiteral("autoresistance"), homeform::singleton()->autoResistance());
+    if (homeform::singleton()->trainingProgram()) {
+        el = homeform::singleton()->trainingProgram()->currentRowRemainingTime();
+        set(QStringLiteral("row_remaining_time_s"), el.second());
+        set(QStringLiteral("row_remaining_time_m"), el.minute());
+        set(QStringLiteral("row_remaining_time_h"), el.hour());
+    } else {
+        set(QStringLiteral("row_remaining_time_s"), 0);
+        set(QStringLiteral("row_remaining_time_m"), 0);
+        set(QStringLiteral("row_remaining_time_h"), 0);
+    }
+    if (homeform::singleton()->trainingProgram()) {
+        el = homeform::singleton()->trainingProgram()->remainingTime();
+        set(QStringLiteral("remaining_time_s"), el.second());
+        set(QStringLiteral("remaining_time_m"), el.minute());
+        set(QStringLiteral("remaining_time_h"), el.hour());
+    } else {
+        set(QStringLiteral("remaining_time_s"), 0);
+        set(QStringLiteral("remaining_time_m"), 0);
+        set(QStringLiteral("remaining_time_h"), 0);
     }
+    // from the cache of the settings, this runs at every frame of the telemetry too
+    set(QStringLiteral("nickName"),
+        (nickName = settingsProxy->value(QZSettings::user_nickname).toString()).isEmpty()
+            ? QString(QStringLiteral("N/A"))
+            : nickName);
+    if (tp == bluetoothdevice::BIKE) {
+        set(QStringLiteral("gears"), ((bike *)device)->gears());
+        set(QStringLiteral("target_resistance"), ((bike *)device)->lastRequestedResistance().value());
+        set(QStringLiteral("target_peloton_resistance"), ((bike *)device)->lastRequestedPelotonResistance().value());
+        set(QStringLiteral("target_cadence"), ((bike *)device)->lastRequestedCadence().value());
+        set(QStringLiteral("target_power"), ((bike *)device)->lastRequestedPower().value());
+        set(QStringLiteral("power_zone"), ((bike *)device)->currentPowerZone().value());
+        set(QStringLiteral("power_zone_lapavg"), ((bike *)device)->currentPowerZone().lapAverage());
+        set(QStringLiteral("power_zone_lapmax"), ((bike *)device)->currentPowerZone().lapMax());
+        set(QStringLiteral("target_power_zone"), ((bike *)device)->targetPowerZone().value());
+        set(QStringLiteral("power_zone_color"), homeform::singleton()->ftp->valueFontColor());
+        set(QStringLiteral("target_power_zone_color"), homeform::singleton()->target_zone->valueFontColor());
+        set(QStringLiteral("peloton_resistance"), (dep = ((bike *)device)->pelotonResistance()).value());
+        set(QStringLiteral("peloton_resistance_avg"), dep.average());
+        set(QStringLiteral("peloton_resistance_color"), homeform::singleton()->peloton_resistance->valueFontColor());
+        set(QStringLiteral("peloton_resistance_lapavg"), dep.lapAverage());
+        set(QStringLiteral("peloton_resistance_lapmax"), dep.lapMax());
+        set(QStringLiteral("peloton_req_resistance"),
+            (dep = ((bike *)device)->lastRequestedPelotonResistance()).value());
+        set(QStringLiteral("cadence"), (dep = ((bike *)device)->currentCadence()).value());
+        set(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
+        set(QStringLiteral("cadence_avg"), dep.average());
+        set(QStringLiteral("cadence_lapavg"), dep.lapAverage());
+        set(QStringLiteral("cadence_lapmax"), dep.lapMax());
+        set(QStringLiteral("resistance"), (dep = ((bike *)device)->currentResistance()).value());
+        set(QStringLiteral("resistance_avg"), dep.average());
+        set(QStringLiteral("resistance_lapavg"), dep.lapAverage());
+        set(QStringLiteral("resistance_lapmax"), dep.lapMax());
+        set(QStringLiteral("cranks"), ((bike *)device)->currentCrankRevolutions());
+        set(QStringLiteral("cranktime"), ((bike *)device)->lastCrankEventTime());
+        set(QStringLiteral("req_power"), (dep = ((bike *)device)->lastRequestedPower()).value());
+        set(QStringLiteral("req_cadence"), (dep = ((bike *)device)->lastRequestedCadence()).value());
+        set(QStringLiteral("req_resistance"), (dep = ((bike *)device)->lastRequestedResistance()).value());
+        set(QStringLiteral("inclination"), (dep = ((bike *)device)->currentInclination()).value());
+        set(QStringLiteral("inclination_avg"), dep.average());
+    } else if (tp == bluetoothdevice::ROWING) {
+        set(QStringLiteral("gears"), ((rower *)device)->gears());
+        el = ((rower *)device)->lastRequestedPace();
+        set(QStringLiteral("target_speed"), ((rower *)device)->lastRequestedSpeed().value());
+        set(QStringLiteral("target_pace_s"), el.second());
+        set(QStringLiteral("target_pace_m"), el.minute());
+        set(QStringLiteral("target_pace_h"), el.hour());
+        set(QStringLiteral("peloton_resistance"), (dep = ((rower *)device)->pelotonResistance()).value());
+        set(QStringLiteral("peloton_resistance_avg"), dep.average());
+        set(QStringLiteral("cadence"), (dep = ((rower *)device)->currentCadence()).value());
+        set(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
+        set(QStringLiteral("cadence_avg"), dep.average());
+        set(QStringLiteral("cadence_lapavg"), dep.lapAverage());
+        set(QStringLiteral("cadence_lapmax"), dep.lapMax());
+
+        // use to preserve compatibility to dochart.js and floating.htm
+        set(QStringLiteral("req_cadence"), (dep = ((rower *)device)->lastRequestedCadence()).value());
+        set(QStringLiteral("target_cadence"), (dep = ((rower *)device)->lastRequestedCadence()).value());
+        
+        set(QStringLiteral("resistance"), (dep = ((rower *)device)->currentResistance()).value());
+        set(QStringLiteral("resistance_avg"), dep.average());
+        set(QStringLiteral("cranks"), ((rower *)device)->currentCrankRevolutions());
+        set(QStringLiteral("cranktime"), ((rower *)device)->lastCrankEventTime());
+        set(QStringLiteral("strokescount"), ((rower *)device)->currentStrokesCount().value());
+        set(QStringLiteral("strokeslength"), ((rower *)device)->currentStrokesLength().value());
+    } else if (tp == bluetoothdevice::TREADMILL) {
+        set(QStringLiteral("target_speed"), ((treadmill *)device)->lastRequestedSpeed().value());
+        el = ((treadmill *)device)->lastRequestedPace();
+        set(QStringLiteral("target_pace_s"), el.second());
+        set(QStringLiteral("target_pace_m"), el.minute());
+        set(QStringLiteral("target_pace_h"), el.hour());
+        set(QStringLiteral("target_inclination"), ((treadmill *)device)->lastRequestedInclination().value());
+        set(QStringLiteral("cadence"), (dep = ((treadmill *)device)->currentCadence()).value());
+        set(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
+        set(QStringLiteral("cadence_avg"), dep.average());
+        set(QStringLiteral("cadence_lapavg"), dep.lapAverage());
+        set(QStringLiteral("cadence_lapmax"), dep.lapMax());
+        set(QStringLiteral("inclination"), (dep = ((treadmill *)device)->currentInclination()).value());
+        set(QStringLiteral("inclination_avg"), dep.average());
+        set(QStringLiteral("inclination_lapavg"), dep.lapAverage());
+        set(QStringLiteral("inclination_lapmax"), dep.lapMax());
+        set(QStringLiteral("stridelength"), (dep = ((treadmill *)device)->currentStrideLength()).value());
+        set(QStringLiteral("groundcontact"), (dep = ((treadmill *)device)->currentGroundContact()).value());
+        set(QStringLiteral("verticaloscillation"), (dep = ((treadmill *)device)->currentVerticalOscillation()).value());
+    } else if (tp == bluetoothdevice::ELLIPTICAL) {
+        set(QStringLiteral("cadence"), (dep = ((elliptical *)device)->currentCadence()).value());
+        set(QStringLiteral("cadence_color"), homeform::singleton()->cadence->valueFontColor());
+        set(QStringLiteral("cadence_avg"), dep.average());
+        set(QStringLiteral("cadence_lapavg"), dep.lapAverage());
+        set(QStringLiteral("cadence_lapmax"), dep.lapMax());
+        set(QStringLiteral("inclination"), (dep = ((elliptical *)device)->currentInclination()).value());
+        set(QStringLiteral("inclination_avg"), dep.average());
+    }
+}
+
+QVector<double> TemplateInfoSenderBuilder::telemetryValues() {
+    QVector<double> values(telemetryschema::fields().count(), qQNaN());
+    if (device && homeform::singleton())
+        workoutValues([&values](const QString &name, const QJSValue &value) {
+            int i = telemetryschema::index(name);
+            if (i >= 0)
+                values[i] = value.toNumber();
+        });
+    return values;
 }
 
 void TemplateInfoSenderBuilder::workoutEventStateChanged(bluetoothdevice::WORKOUT_EVENT_STATE state) {
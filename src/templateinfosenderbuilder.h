@@ -1,11 +1,15 @@
 #ifndef TEMPLATEINFOSENDERBUILDER_H
 #define TEMPLATEINFOSENDERBUILDER_H
 #include "devices/bluetoothdevice.h"
+#include "settingsproxy.h"
 #include "templateinfosender.h"
+#include <QElapsedTimer>
 #include <QHash>
 #include <QJSEngine>
 #include <QJsonArray>
 #include <QSettings>
+#include <QVector>
+#include <functional>
 
 #define TEMPLATE_TYPE_TCPCLIENT QStringLiteral("TcpClient")
 #define TEMPLATE_TYPE_WEBSERVER QStringLiteral("WebServer")
@@ -42,6 +46,8 @@ class TemplateInfoSenderBuilder : public QObject {
   private:
     bool validFileTemplateType(const QString &tp) const;
     void buildContext(bool forceReinit = false);
+    // the fastest of the templates and of the telemetry clients
+    int tickInterval() const;
     QString activityDescription;
     void createTemplatesFromFolder(const QString &idInfo, const QString &folder, QStringList &dirTemplates);
     void clearSessionArray();
@@ -50,8 +56,27 @@ class TemplateInfoSenderBuilder : public QObject {
     QString masterId;
     QStringList foldersToLook;
     QJsonArray sessionArray;
+    // the session gets a sample a second, whatever the tick
+    QElapsedTimer sessionTimer;
+    // the periods of the templates are read again every second
+    QElapsedTimer intervalTimer;
+    bool secondElapsed(QElapsedTimer &timer) const;
+    // whether the next buildContext adds a sample to the session, without restarting the timer
+    bool sessionDue() const;
+    // the values of the workout, for the script context and for the telemetry frames
+    void workoutValues(const std::function<void(const QString &, const QJSValue &)> &set);
+    // the values of the telemetry fields, in the order of the schema
+    QVector<double> telemetryValues();
     QHash<QString, QVariant> context;
     QJSEngine *engine = nullptr;
+    settingsproxy *settingsProxy = nullptr;
+    // the keys each client wants to be notified about, all of them when the list is empty
+    QHash<TemplateInfoSender *, QStringList> settingsSubscribers;
+    QJsonObject pendingSettingsDelta;
+    // picks up the changes made outside the template server while somebody is subscribed
+    QTimer settingsTimer;
+    QJSValue settingsObject();
+    void flushSettingsDelta();
     TemplateInfoSenderBuilder(QObject *parent);
     void load(const QString &idInfo, const QStringList &folders);
     static QHash<QString, TemplateInfoSenderBuilder *> instanceMap;
@@ -60,6 +85,8 @@ class TemplateInfoSenderBuilder : public QObject {
     QHash<QString, QString> templateFilesList;
     void onSetSettings(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
     void onGetSettings(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
+    void onSubscribeSettings(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
+    void onUnsubscribeSettings(TemplateInfoSender *tempSender);
     void onSetResistance(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
     void onSetFanSpeed(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
     void onSetPower(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
@@ -82,6 +109,7 @@ class TemplateInfoSenderBuilder : public QObject {
     void onGetTrainingProgram(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
     void onAppendActivityDescription(const QJsonValue &msgContent, TemplateInfoSender *tempSender);
     void onGetSessionArray(TemplateInfoSender *tempSender);
+    void onGetLatency(TemplateInfoSender *tempSender);
     void onGetLatLon(TemplateInfoSender *tempSender);
     void onNextInclination300Meters(TemplateInfoSender *tempSender);
     void onGetGPXBase64(TemplateInfoSender *tempSender);
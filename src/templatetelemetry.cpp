@@ -0,0 +1,174 @@
+#include "templatetelemetry.h"
+#include <QtEndian>
+#include <QtNumeric>
+#include <cstring>
+
+const QList<telemetryschema::field> &telemetryschema::fields() {
+    static const QList<field> list = {
+        {"deviceType", FLOAT32},
+        {"deviceConnected", FLOAT32},
+        {"devicePaused", FLOAT32},
+        {"elapsed_h", FLOAT32},
+        {"elapsed_m", FLOAT32},
+        {"elapsed_s", FLOAT32},
+        {"lapelapsed_h", FLOAT32},
+        {"lapelapsed_m", FLOAT32},
+        {"lapelapsed_s", FLOAT32},
+        {"speed", FLOAT32},
+        {"speed_avg", FLOAT32},
+        {"distance", FLOAT64},
+        {"calories", FLOAT32},
+        {"heart", FLOAT32},
+        {"heart_avg", FLOAT32},
+        {"heart_max", FLOAT32},
+        {"jouls", FLOAT64},
+        {"elevation", FLOAT32},
+        {"difficult", FLOAT32},
+        {"watts", FLOAT32},
+        {"watts_avg", FLOAT32},
+        {"watts_max", FLOAT32},
+        {"kgwatts", FLOAT32},
+        {"latitude", FLOAT64},
+        {"longitude", FLOAT64},
+        {"altitude", FLOAT32},
+        {"peloton_offset", FLOAT32},
+        {"gears", FLOAT32},
+        {"target_resistance", FLOAT32},
+        {"target_peloton_resistance", FLOAT32},
+        {"target_cadence", FLOAT32},
+        {"target_power", FLOAT32},
+        {"power_zone", FLOAT32},
+        {"target_power_zone", FLOAT32},
+        {"peloton_resistance", FLOAT32},
+        {"peloton_req_resistance", FLOAT32},
+        {"cadence", FLOAT32},
+        {"cadence_avg", FLOAT32},
+        {"resistance", FLOAT32},
+        {"resistance_avg", FLOAT32},
+        {"cranks", FLOAT32},
+        {"cranktime", FLOAT32},
+        {"req_power", FLOAT32},
+        {"req_cadence", FLOAT32},
+        {"req_resistance", FLOAT32},
+        {"inclination", FLOAT32},
+        {"inclination_avg", FLOAT32},
+        {"target_speed", FLOAT32},
+        {"target_inclination", FLOAT32},
+        {"strokescount", FLOAT32},
+        {"strokeslength", FLOAT32},
+        {"stridelength", FLOAT32},
+        {"groundcontact", FLOAT32},
+        {"verticaloscillation", FLOAT32},
+        {"remaining_time_h", FLOAT32},
+        {"remaining_time_m", FLOAT32},
+        {"remaining_time_s", FLOAT32},
+        {"autoresistance", FLOAT32},
+    };
+    return list;
+}
+
+quint64 telemetryschema::mask(const QStringList &names) {
+    const QList<field> &f = fields();
+    quint64 m = 0;
+    for (int i = 0; i < f.count(); i++) {
+        if (names.isEmpty() || names.contains(QLatin1String(f.at(i).name)))
+            m |= (quint64(1) << i);
+    }
+    return m;
+}
+
+static void appendHeader(QByteArray &out, telemetryschema::FRAME_TYPE type) {
+    out.append('Q');
+    out.append('Z');
+    out.append(static_cast<char>(telemetryschema::version));
+    out.append(static_cast<char>(type));
+}
+
+template <typename T> static void appendLE(QByteArray &out, T value) {
+    char b[sizeof(T)];
+    qToLittleEndian(value, b);
+    out.append(b, sizeof(T));
+}
+
+QByteArray telemetryschema::schema(quint64 mask) {
+    const QList<field> &f = fields();
+    QByteArray out;
+    appendHeader(out, SCHEMA);
+    int count = 0;
+    for (int i = 0; i < f.count(); i++) {
+        if (mask & (quint64(1) << i))
+            count++;
+    }
+    out.append(static_cast<char>(count));
+    for (int i = 0; i < f.count(); i++) {
+        if (!(mask & (quint64(1) << i)))
+            continue;
+        QByteArray name(f.at(i).name);
+        out.append(static_cast<char>(i));
+        out.append(static_cast<char>(f.at(i).type));
+        out.append(static_cast<char>(name.length()));
+        out.append(name);
+    }
+    return out;
+}
+
+int telemetryschema::index(const QString &name) {
+    static const QHash<QString, int> indexes = [] {
+        QHash<QString, int> h;
+        const QList<field> &f = fields();
+        for (int i = 0; i < f.count(); i++)
+            h.insert(QLatin1String(f.at(i).name), i);
+        return h;
+    }();
+    return indexes.value(name, -1);
+}
+
+telemetryencoder::telemetryencoder(quint64 mask, int keyframeInterval)
+    : mask(mask), keyframeInterval(qMax(1, keyframeInterval)) {}
+
+// the values as they go out, so that a change under the precision of the field doesn't make a delta
+static bool same(telemetryschema::TYPE type, double a, double b) {
+    if (qIsNaN(a) || qIsNaN(b))
+        return qIsNaN(a) && qIsNaN(b);
+    if (type == telemetryschema::FLOAT32)
+        return static_cast<float>(a) == static_cast<float>(b);
+    return a == b;
+}
+
+QByteArray telemetryencoder::encode(const QVector<double> &values) {
+    const QList<telemetryschema::field> &f = telemetryschema::fields();
+    // the first frame and then one every keyframeInterval, so a late decoder has all the values
+    bool key = last.isEmpty() || (sequence % keyframeInterval) == 0;
+    if (last.isEmpty())
+        last.fill(qQNaN(), f.count());
+
+    quint64 present = 0;
+    QByteArray payload;
+    for (int i = 0; i < f.count(); i++) {
+        if (!(mask & (quint64(1) << i)))
+            continue;
+        double v = i < values.count() ? values.at(i) : qQNaN();
+        if (!key && same(f.at(i).type, v, last.at(i)))
+            continue;
+        present |= (quint64(1) << i);
+        last[i] = v;
+        if (f.at(i).type == telemetryschema::FLOAT64) {
+            quint64 bits;
+            std::memcpy(&bits, &v, sizeof(bits));
+            appendLE(payload, bits);
+        } else {
+            float fv = static_cast<float>(v);
+            quint32 bits;
+            std::memcpy(&bits, &fv, sizeof(bits));
+            appendLE(payload, bits);
+        }
+    }
+
+    QByteArray out;
+    out.reserve(16 + payload.size());
+    appendHeader(out, key ? telemetryschema::KEYFRAME : telemetryschema::DELTA);
+    appendLE(out, sequence++);
+    appendLE(out, present);
+    out.append(payload);
+    return out;
+}
@@ -0,0 +1,54 @@
+#ifndef TEMPLATETELEMETRY_H
+#define TEMPLATETELEMETRY_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+#include <QVector>
+
+/**
+ * @brief The binary telemetry of the web server clients, the compact version of the workout messages. Every frame
+ * starts with "QZ", the version and the type, the numbers are little endian:
+ * - schema (type 0): the count, then for each field its index, its type and its name (length and utf8);
+ * - key frame (type 1) and delta (type 2): the sequence (u32), the mask of the fields that follow (u64, bit = index
+ *   of the field), then their values by index, float32 or float64.
+ * A key frame has all the fields of the client, a delta only the ones that changed since the previous frame. The
+ * indexes of the fields never change in a version, new fields are appended.
+ */
+class telemetryschema {
+  public:
+    static const quint8 version = 1;
+    enum FRAME_TYPE : quint8 { SCHEMA = 0, KEYFRAME = 1, DELTA = 2 };
+    enum TYPE : quint8 { FLOAT32 = 0, FLOAT64 = 1 };
+
+    class field {
+      public:
+        const char *name;
+        TYPE type;
+    };
+
+    // the fields of the workout object of the templates, by index
+    static const QList<field> &fields();
+    // the mask of the fields with these names, all of them when the list is empty
+    static quint64 mask(const QStringList &names);
+    static QByteArray schema(quint64 mask);
+    // the index of the field with this name, -1 if it isn't one of the fields
+    static int index(const QString &name);
+};
+
+// the frames of a client, which remembers what it was sent last
+class telemetryencoder {
+  public:
+    explicit telemetryencoder(quint64 mask = 0, int keyframeInterval = 20);
+    QByteArray encode(const QVector<double> &values);
+    quint64 fieldMask() const { return mask; }
+
+  private:
+    quint64 mask;
+    int keyframeInterval;
+    quint32 sequence = 0;
+    QVector<double> last;
+};
+
+#endif // TEMPLATETELEMETRY_H
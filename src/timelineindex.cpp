@@ -0,0 +1,69 @@
+#include "timelineindex.h"
+#include <algorithm>
+
+static inline int lowbit(int i) { return i & -i; }
+
+void timelineindex::clear() {
+    m_seconds.clear();
+    m_tree.clear();
+    m_distanceRows.clear();
+}
+
+void timelineindex::append(quint32 seconds, bool isDistance) {
+    if (m_distanceRows.isEmpty())
+        m_distanceRows.append(0);
+    if (m_tree.isEmpty())
+        m_tree.append(0);
+
+    m_seconds.append(seconds);
+    m_distanceRows.append(m_distanceRows.last() + (isDistance ? 1 : 0));
+
+    // the new node covers the rows [i - lowbit(i), i): the ones before it are already in the tree
+    int i = m_seconds.count();
+    m_tree.append(seconds + secondsBefore(i - 1) - secondsBefore(i - lowbit(i)));
+}
+
+void timelineindex::setSeconds(int row, quint32 seconds) {
+    if (row < 0 || row >= count())
+        return;
+
+    quint32 old = m_seconds.at(row);
+    m_seconds[row] = seconds;
+    for (int i = row + 1; i < m_tree.count(); i += lowbit(i))
+        m_tree[i] = m_tree.at(i) - old + seconds;
+}
+
+quint64 timelineindex::secondsBefore(int row) const {
+    quint64 sum = 0;
+    for (int i = qMin(row, count()); i > 0; i -= lowbit(i))
+        sum += m_tree.at(i);
+    return sum;
+}
+
+int timelineindex::rowAt(quint64 elapsed) const {
+    // descend the tree to the longest prefix that ends at or before elapsed
+    int pos = 0;
+    int step = 1;
+    while (step * 2 <= count())
+        step *= 2;
+    for (; step > 0; step /= 2) {
+        if (pos + step <= count() && m_tree.at(pos + step) <= elapsed) {
+            pos += step;
+            elapsed -= m_tree.at(pos);
+        }
+    }
+    return pos;
+}
+
+int timelineindex::nextDistanceRow(int row) const {
+    if (row >= count())
+        return count();
+    row = qMax(row, 0);
+
+    // the first prefix that counts one more distance row than the rows before row
+    auto it = std::lower_bound(m_distanceRows.constBegin() + row + 1, m_distanceRows.constEnd(),
+                               m_distanceRows.at(row) + 1);
+    if (it == m_distanceRows.constEnd())
+        return count();
+    return (it - m_distanceRows.constBegin()) - 1;
+}
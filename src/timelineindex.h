@@ -0,0 +1,46 @@
+#ifndef TIMELINEINDEX_H
+#define TIMELINEINDEX_H
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The seconds of the rows of a train program, indexed so that finding the row of an elapsed time, and the
+ * time before a row, is O(log n) instead of a walk from the first row. The seconds live in a Fenwick tree, since the
+ * distance rows get their length only when they end; the distance rows are counted in a prefix array, so the next one
+ * is a binary search too.
+ */
+class timelineindex {
+  public:
+    void clear();
+    // Units: seconds of the row; isDistance for the rows that end on the distance
+    void append(quint32 seconds, bool isDistance);
+    int count() const { return m_seconds.count(); }
+
+    quint32 seconds(int row) const { return m_seconds.at(row); }
+    void setSeconds(int row, quint32 seconds);
+    // the seconds of the rows before row
+    quint64 secondsBefore(int row) const;
+    quint64 totalSeconds() const { return secondsBefore(count()); }
+
+    /**
+     * @brief rowAt The first row that ends after elapsed seconds.
+     * @return count() if the rows end before
+     */
+    int rowAt(quint64 elapsed) const;
+
+    /**
+     * @brief nextDistanceRow The first distance row from row on.
+     * @return count() if there are no more
+     */
+    int nextDistanceRow(int row) const;
+
+  private:
+    QVector<quint32> m_seconds;
+    // Fenwick tree, 1-based: m_tree[i] is the sum of the rows [i - lowbit(i), i)
+    QVector<quint64> m_tree;
+    // m_distanceRows[i] is the number of distance rows before i
+    QVector<qint32> m_distanceRows;
+};
+
+#endif // TIMELINEINDEX_H
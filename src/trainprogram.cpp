@@ -13,9 +13,6 @@
 #include "windows_zwift_incline_paddleocr_thread.h"
 #include "windows_zwift_workout_paddleocr_thread.h"
 #endif
-#ifdef Q_CC_MSVC
-#include "zwift-api/zwift_messages.pb.h"
-#endif
 #include "localipaddress.h"
 
 using namespace std::chrono_literals;
@@ -50,8 +47,6 @@ trainprogram::trainprogram(const QList<trainrow> &rows, bluetooth *b, QString *d
                  << rows.at(c).distance
                  << rows.at(c).inclination
                  << QTime(0, 0, 0).secsTo(rows.at(c).duration)
-                 << QTime(0, 0, 0).secsTo(rows.at(c).rampDuration)
-                 << QTime(0, 0, 0).secsTo(rows.at(c).rampElapsed)
                  << rows.at(c).speed;
     }
     */
@@ -70,33 +65,43 @@ trainprogram::trainprogram(const QList<trainrow> &rows, bluetooth *b, QString *d
     timer.start();
 }
 
+static const trainrowranges noRanges;
+
+const trainrowranges &trainrow::ranges() const { return m_ranges ? *m_ranges : noRanges; }
+
+trainrowranges &trainrow::editRanges() {
+    if (!m_ranges)
+        m_ranges = new trainrowranges();
+    return *m_ranges;
+}
+
 QString trainrow::toString() const {
     QString rv;
     rv += QStringLiteral("duration = %1").arg(duration.toString());
     rv += QStringLiteral(" distance = %1").arg(distance);
     rv += QStringLiteral(" speed = %1").arg(speed);
-    rv += QStringLiteral(" lower_speed = %1").arg(lower_speed);     // used for peloton
-    rv += QStringLiteral(" average_speed = %1").arg(average_speed); // used for peloton
-    rv += QStringLiteral(" upper_speed = %1").arg(upper_speed);     // used for peloton
+    rv += QStringLiteral(" lower_speed = %1").arg(ranges().lower_speed);     // used for peloton
+    rv += QStringLiteral(" average_speed = %1").arg(ranges().average_speed); // used for peloton
+    rv += QStringLiteral(" upper_speed = %1").arg(ranges().upper_speed);     // used for peloton
     rv += QStringLiteral(" fanspeed = %1").arg(fanspeed);
     rv += QStringLiteral(" inclination = %1").arg(inclination);
-    rv += QStringLiteral(" lower_inclination = %1").arg(lower_inclination);     // used for peloton
-    rv += QStringLiteral(" average_inclination = %1").arg(average_inclination); // used for peloton
-    rv += QStringLiteral(" upper_inclination = %1").arg(upper_inclination);     // used for peloton
+    rv += QStringLiteral(" lower_inclination = %1").arg(ranges().lower_inclination);     // used for peloton
+    rv += QStringLiteral(" average_inclination = %1").arg(ranges().average_inclination); // used for peloton
+    rv += QStringLiteral(" upper_inclination = %1").arg(ranges().upper_inclination);     // used for peloton
     rv += QStringLiteral(" resistance = %1").arg(resistance);
-    rv += QStringLiteral(" lower_resistance = %1").arg(lower_resistance);
-    rv += QStringLiteral(" average_resistance = %1").arg(average_resistance); // used for peloton
-    rv += QStringLiteral(" upper_resistance = %1").arg(upper_resistance);
+    rv += QStringLiteral(" lower_resistance = %1").arg(ranges().lower_resistance);
+    rv += QStringLiteral(" average_resistance = %1").arg(ranges().average_resistance); // used for peloton
+    rv += QStringLiteral(" upper_resistance = %1").arg(ranges().upper_resistance);
     rv += QStringLiteral(" requested_peloton_resistance = %1").arg(requested_peloton_resistance);
-    rv += QStringLiteral(" lower_requested_peloton_resistance = %1").arg(lower_requested_peloton_resistance);
+    rv += QStringLiteral(" lower_requested_peloton_resistance = %1").arg(ranges().lower_requested_peloton_resistance);
     rv += QStringLiteral(" average_requested_peloton_resistance = %1")
-              .arg(average_requested_peloton_resistance); // used for peloton
-    rv += QStringLiteral(" upper_requested_peloton_resistance = %1").arg(upper_requested_peloton_resistance);
-    rv += QStringLiteral(" pace_intensity = %1").arg(pace_intensity);
+              .arg(ranges().average_requested_peloton_resistance); // used for peloton
+    rv += QStringLiteral(" upper_requested_peloton_resistance = %1").arg(ranges().upper_requested_peloton_resistance);
+    rv += QStringLiteral(" pace_intensity = %1").arg(ranges().pace_intensity);
     rv += QStringLiteral(" cadence = %1").arg(cadence);
-    rv += QStringLiteral(" lower_cadence = %1").arg(lower_cadence);
-    rv += QStringLiteral(" average_cadence = %1").arg(average_cadence); // used for peloton
-    rv += QStringLiteral(" upper_cadence = %1").arg(upper_cadence);
+    rv += QStringLiteral(" lower_cadence = %1").arg(ranges().lower_cadence);
+    rv += QStringLiteral(" average_cadence = %1").arg(ranges().average_cadence); // used for peloton
+    rv += QStringLiteral(" upper_cadence = %1").arg(ranges().upper_cadence);
     rv += QStringLiteral(" forcespeed = %1").arg(forcespeed);
     rv += QStringLiteral(" loopTimeHR = %1").arg(loopTimeHR);
     rv += QStringLiteral(" zoneHR = %1").arg(zoneHR);
@@ -111,11 +116,41 @@ QString trainrow::toString() const {
     rv += QStringLiteral(" longitude = %1").arg(longitude);
     rv += QStringLiteral(" altitude = %1").arg(altitude);
     rv += QStringLiteral(" azimuth = %1").arg(azimuth);
-    rv += QStringLiteral(" rampElapsed = %1").arg(rampElapsed.toString());
-    rv += QStringLiteral(" rampDuration = %1").arg(rampDuration.toString());
+    if (isRamp()) {
+        rv += QStringLiteral(" powerTo = %1").arg(powerTo);
+        rv += QStringLiteral(" speedTo = %1").arg(speedTo);
+        rv += QStringLiteral(" inclinationTo = %1").arg(inclinationTo);
+        rv += QStringLiteral(" cadenceTo = %1").arg(cadenceTo);
+        rv += QStringLiteral(" resistanceTo = %1").arg(resistanceTo);
+    }
     return rv;
 }
 
+bool trainrow::isRamp() const {
+    return distance == -1 && QTime(0, 0, 0).secsTo(duration) > 0 &&
+           (powerTo != -1 || speedTo != -1 || inclinationTo != -200 || cadenceTo != -1 || resistanceTo != -1);
+}
+
+trainrow trainrow::at(double seconds) const {
+    trainrow r(*this);
+    if (!isRamp())
+        return r;
+
+    double f = qBound(0.0, seconds / (double)QTime(0, 0, 0).secsTo(duration), 1.0);
+    if (power != -1 && powerTo != -1)
+        r.power = qRound(power + ((powerTo - power) * f));
+    // the treadmills have a 0.1 resolution
+    if (speed != -1 && speedTo != -1)
+        r.speed = qRound((speed + ((speedTo - speed) * f)) * 10.0) / 10.0;
+    if (inclination != -200 && inclinationTo != -200)
+        r.inclination = qRound((inclination + ((inclinationTo - inclination) * f)) * 10.0) / 10.0;
+    if (cadence != -1 && cadenceTo != -1)
+        r.cadence = qRound(cadence + ((cadenceTo - cadence) * f));
+    if (resistance != -1 && resistanceTo != -1)
+        r.resistance = qRound(resistance + ((resistanceTo - resistance) * f));
+    return r;
+}
+
 void trainprogram::applySpeedFilter() {
     if (rows.length() == 0)
         return;
@@ -176,6 +211,8 @@ void trainprogram::applySpeedFilter() {
         newdistance.append(wma * ((double)(rowduration)));
         r++;
     }
+    m_videoSync.clear();
+    m_timeline.clear();
     for (r = 0; r < rows.length(); r++) {
         rows[r].distance = newdistance.at(r);
     }
@@ -189,8 +226,10 @@ uint32_t trainprogram::calculateTimeForRow(int32_t row) {
         return (rows.at(row).duration.second() + (rows.at(row).duration.minute() * 60) +
                 (rows.at(row).duration.hour() * 3600));
     else {
-        if(rows.at(row).started.isValid() && rows.at(row).ended.isValid())
-            return rows.at(row).started.secsTo(rows.at(row).ended);
+        QDateTime started = stepStarted.value(row);
+        QDateTime ended = stepEnded.value(row);
+        if(started.isValid() && ended.isValid())
+            return started.secsTo(ended);
     }
     return 0;
 }
@@ -265,30 +304,86 @@ QList<MetersByInclination> trainprogram::avgInclinationNext300Meters() {
     return next300;
 }
 
+void trainprogram::buildVideoSync() {
+    m_videoSync.clear();
+    for (const trainrow &r : qAsConst(rows))
+        m_videoSync.append(QTime(0, 0, 0).secsTo(r.gpxElapsed), r.distance);
+}
+
+const timelineindex &trainprogram::timeline() {
+    if (m_timeline.count() != rows.length()) {
+        m_timeline.clear();
+        for (int r = 0; r < rows.length(); r++)
+            m_timeline.append(calculateTimeForRow(r), calculateDistanceForRow(r) > 0);
+    }
+    return m_timeline;
+}
+
+// the distance rows get their length when they end
+void trainprogram::updateTimeline(int row) {
+    if (m_timeline.count() == rows.length())
+        m_timeline.setSeconds(row, calculateTimeForRow(row));
+}
+
+int trainprogram::currentRowTicks() { return ticks - (int)timeline().secondsBefore(currentStep); }
+
+// the ramps change their targets every second, the power is sent with the one of the other rows
+void trainprogram::rampTargets() {
+    const trainrow &row = rows.at(currentStep);
+    int elapsed = currentRowTicks();
+    trainrow now = row.at(elapsed);
+    trainrow before = row.at(elapsed - 1);
+
+    if (row.speedTo != -1 && now.forcespeed && now.speed != before.speed) {
+        qDebug() << QStringLiteral("trainprogram ramp change speed ") + QString::number(now.speed);
+        emit changeSpeed(now.speed);
+    }
+    if (row.inclinationTo != -200 && now.inclination != before.inclination) {
+        qDebug() << QStringLiteral("trainprogram ramp change inclination ") + QString::number(now.inclination);
+        // the same conversion of the steps
+        if (inclinationAsResistance())
+            applyInclinationAsResistance(now.inclination);
+        emit changeInclination(now.inclination, now.inclination);
+    }
+    if (row.cadenceTo != -1 && now.cadence != before.cadence) {
+        qDebug() << QStringLiteral("trainprogram ramp change cadence ") + QString::number(now.cadence);
+        emit changeCadence(now.cadence);
+    }
+    if (row.resistanceTo != -1 && now.resistance != before.resistance) {
+        qDebug() << QStringLiteral("trainprogram ramp change resistance ") + QString::number(now.resistance);
+        emit changeResistance(now.resistance);
+    }
+}
+
+bool trainprogram::inclinationAsResistance() {
+    bluetoothdevice *dev = bluetoothManager ? bluetoothManager->device() : nullptr;
+    if (!dev)
+        return false;
+    return dev->deviceType() == bluetoothdevice::BIKE ||
+           (dev->deviceType() == bluetoothdevice::ELLIPTICAL &&
+            !((elliptical *)dev)->inclinationAvailableByHardware());
+}
+
+void trainprogram::applyInclinationAsResistance(double inc) {
+    QSettings settings;
+    bluetoothdevice *dev = bluetoothManager->device();
+    // this should be converted in a signal as all the other signals...
+    double bikeResistanceOffset =
+        settings.value(QZSettings::bike_resistance_offset, QZSettings::default_bike_resistance_offset).toInt();
+    double bikeResistanceGain =
+        settings.value(QZSettings::bike_resistance_gain_f, QZSettings::default_bike_resistance_gain_f).toDouble();
+
+    dev->changeResistance((resistance_t)(round(inc * bikeResistanceGain)) + bikeResistanceOffset +
+                          1); // resistance start from 1)
+    if (dev->deviceType() == bluetoothdevice::BIKE && !((bike *)dev)->inclinationAvailableByHardware())
+        dev->setInclination(inc);
+}
+
 // speed in Km/h
 double trainprogram::avgSpeedFromGpxStep(int gpxStep, int seconds) {
-    int start = gpxStep;
-    if (gpxStep >= rows.length())
-        return 0.0;
-    double km = (rows.at(gpxStep).distance);
-    int timesum = 0;
-    if (gpxStep > 0)
-        timesum = (QTime(0, 0, 0).secsTo(rows.at(gpxStep).gpxElapsed) -
-                   QTime(0, 0, 0).secsTo(rows.at(gpxStep - 1).gpxElapsed));
-    else
-        timesum = QTime(0, 0, 0).secsTo(rows.at(gpxStep).gpxElapsed);
-    int c = gpxStep + 1;
-    while (1) {
-        if ((timesum >= seconds) || (c >= rows.length())) {
-            return (km / ((double)timesum) * 3600.0);
-        }
-        km += (rows.at(c).distance);
-        if (c > 0)
-            timesum = (timesum + QTime(0, 0, 0).secsTo(rows.at(c).gpxElapsed) -
-                       QTime(0, 0, 0).secsTo(rows.at(c - 1).gpxElapsed));
-        c++;
-    }
-    return (km / ((double)timesum) * 3600.0);
+    if (m_videoSync.count() != rows.length())
+        buildVideoSync();
+    return m_videoSync.avgSpeed(gpxStep, seconds);
 }
 
 int trainprogram::TotalGPXSecs() {
@@ -347,20 +442,13 @@ double trainprogram::TimeRateFromGPX(double gpxsecs, double videosecs, double cu
         qDebug() << "TimeRateFromGPX Gpxpos=lastPos" << lastGpxRateSet;
         return lastGpxRateSet;
     }
-    // Calculate the Factor between current Players Speed and the next average GPX Speed
-    double playedToGpxSpeedFactor = (currentspeed / avgNextSpeed);
-    // Calculate where the gpx would be in 1 Second
-    double gpxTarget = (gpxsecs + playedToGpxSpeedFactor);
-    // Get needed Rate for the next second
-    double rate = (gpxTarget - videosecs);
-
-    // If rate < 0 Video is highly before the gpx and Video would be rewinded. Wait with Video for gpx to reach it
-    if (rate < 0.0) {
-        rate = 0.1;
-    }
+    // Replay allows Factor 2 max: over it the video jumps
+    m_videoSync.maxRate = 2.0 * (double)recordingFactor;
+    // When the video is ahead of the gpx it slows down smoothly instead of dropping to a fixed rate
+    double rate = m_videoSync.rate(gpxsecs, videosecs, currentspeed, avgNextSpeed);
 
     qDebug() << qSetRealNumberPrecision(10) << "TimeRateFromGPX" << gpxsecs << videosecs << (gpxsecs - videosecs)
-             << currentspeed << avgNextSpeed << gpxTarget << lastGpxRateSetAt << lastGpxRateSet << rate;
+             << currentspeed << avgNextSpeed << lastGpxRateSetAt << lastGpxRateSet << rate;
 
     // Save the last Gpx Timestamp and the last Rate for later calls.
     lastGpxSpeedSet = avgNextSpeed;
@@ -519,6 +607,9 @@ double trainprogram::avgAzimuthNext300Meters() {
 void trainprogram::clearRows() {
     QMutexLocker(&this->schedulerMutex);
     rows.clear();
+    m_timeline.clear();
+    stepStarted.clear();
+    stepEnded.clear();
 }
 
 void trainprogram::pelotonOCRprocessPendingDatagrams() {
@@ -585,6 +676,7 @@ void trainprogram::pelotonOCRcomputeTime(QString t) {
 void trainprogram::scheduler() {
 
     QMutexLocker(&this->schedulerMutex);
+    controlarbiter::scope source(controlarbiter::PROGRAM);
     QSettings settings;
     // outside the if case about a valid train program because the information for the floating window url should be
     // sent anyway
@@ -612,12 +704,6 @@ void trainprogram::scheduler() {
                 qDebug() << "creating zwift api world";
             }
             else {
-#ifdef Q_OS_IOS
-#ifndef IO_UNDER_QT
-                if(!h)
-                    h = new lockscreen();
-#endif
-#endif
                 if(zwift_player_id == -1) {
                     QString id = zwift_world->player_id();
                     QJsonParseError parseError;
@@ -633,89 +719,13 @@ void trainprogram::scheduler() {
                         timeout = 5;
                     if(zwift_counter++ >= (timeout - 1)) {
                         zwift_counter = 0;
-                        QByteArray bb = zwift_world->playerStatus(zwift_player_id);
-                        qDebug() << " ZWIFT API PROTOBUF << " + bb.toHex(' ');
-#ifdef Q_OS_IOS
-#ifndef IO_UNDER_QT
-                        h->zwift_api_decodemessage_player(bb.data(), bb.length());
-                        float alt = h->zwift_api_getaltitude();
-                        float distance = h->zwift_api_getdistance();
-#else
-                        float alt = 0;
-                        float distance = 0;
-#endif
-#elif defined(Q_OS_ANDROID)
-                        QAndroidJniEnvironment env;
-                        jbyteArray d = env->NewByteArray(bb.length());
-                        jbyte *b = env->GetByteArrayElements(d, 0);
-                        for (int i = 0; i < bb.length(); i++)
-                            b[i] = bb[i];
-                        env->SetByteArrayRegion(d, 0, bb.length(), b);
-
-                        QAndroidJniObject::callStaticMethod<void>(
-                            "org/cagnulen/qdomyoszwift/ZwiftAPI", "zwift_api_decodemessage_player", "([B)V", d);
-                        env->DeleteLocalRef(d);
-
-                        float alt = QAndroidJniObject::callStaticMethod<float>("org/cagnulen/qdomyoszwift/ZwiftAPI", "getAltitude", "()F");
-                        float distance = QAndroidJniObject::callStaticMethod<float>("org/cagnulen/qdomyoszwift/ZwiftAPI", "getDistance", "()F");
-#elif defined Q_CC_MSVC
-                        PlayerState state;
-                        float alt = 0;
-                        float distance = 0;
-                        if (state.ParseFromArray(bb.constData(), bb.size())) {
-                            // Parsing riuscito, ora puoi accedere ai dati in `state`
-                            alt = state.altitude();
-                            distance = state.distance();
-                        } else {
-                            // Errore durante il parsing
-                            qDebug() << "Error parsing PlayerState";
-                        }
-#else
-                        float alt = 0;
-                        float distance = 0;
-#endif
-                        static float old_distance = 0;
-                        static float old_alt = 0;
-                        
-                        qDebug() << "zwift api incline1" << old_distance << old_alt << distance << alt;
-
-                        if(old_distance > 0) {
-                            float delta = distance - old_distance;
-                            float deltaA = alt - old_alt;
-                            float incline = (deltaA / delta);
-                            if(delta > 1) {
-                                bool zwift_negative_inclination_x2 =
-                                    settings.value(QZSettings::zwift_negative_inclination_x2, QZSettings::default_zwift_negative_inclination_x2)
-                                        .toBool();
-                                double offset =
-                                    settings.value(QZSettings::zwift_inclination_offset, QZSettings::default_zwift_inclination_offset).toDouble();
-                                double gain =
-                                    settings.value(QZSettings::zwift_inclination_gain, QZSettings::default_zwift_inclination_gain).toDouble();
-                                double grade = (incline * gain) + offset;  
-                                if (zwift_negative_inclination_x2 && incline < 0) {
-                                    grade = ((incline * 2.0) * gain) + offset;
-                                }                              
-                                bool zwift_api_autoinclination = settings.value(QZSettings::zwift_api_autoinclination, QZSettings::default_zwift_api_autoinclination).toBool();
-                                qDebug() << "zwift api incline" << incline << grade << delta << deltaA << zwift_api_autoinclination;
-                                if(zwift_api_autoinclination) {
-                                    if(bluetoothManager->device()->deviceType() == bluetoothdevice::TREADMILL || 
-                                        (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL && ((elliptical*)bluetoothManager->device())->inclinationAvailableByHardware())) {
-                                        bluetoothManager->device()->changeInclination(grade, grade);
-                                    }
-                                    if (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL &&
-                                            (!((elliptical*)bluetoothManager->device())->inclinationAvailableByHardware() ||
-                                             ((elliptical*)bluetoothManager->device())->inclinationSeparatedFromResistance())) {
-                                        QSettings settings;
-                                        double bikeResistanceOffset = settings.value(QZSettings::bike_resistance_offset, bikeResistanceOffset).toInt();
-                                        double bikeResistanceGain = settings.value(QZSettings::bike_resistance_gain_f, bikeResistanceGain).toDouble();
-
-                                        bluetoothManager->device()->changeResistance((resistance_t)(round(grade * bikeResistanceGain)) + bikeResistanceOffset + 1); // resistance start from 1
-                                    }
-                                }
-                            }
+                        if(!zwift_state) {
+                            zwift_state = new zwiftworldstate(this);
+                            connect(zwift_state, &zwiftworldstate::playerUpdated, this,
+                                    &trainprogram::zwiftPlayerUpdated, Qt::QueuedConnection);
                         }
-                        old_distance = distance;
-                        old_alt = alt;
+                        // the state comes back in zwiftPlayerUpdated
+                        zwift_state->poll(zwift_auth_token->getAccessToken(), zwift_player_id);
                     }
                 }
             }
@@ -837,7 +847,8 @@ void trainprogram::scheduler() {
 
     // entry point
     if (ticks == 1 && currentStep == 0) {
-        rows[currentStep].started = QDateTime::currentDateTime();
+        stepStarted.insert(currentStep, QDateTime::currentDateTime());
+        updateTimeline(currentStep);
         currentStepDistance = 0;
         lastOdometer = odometerFromTheDevice;
         if (bluetoothManager->device()->deviceType() == bluetoothdevice::TREADMILL) {
@@ -941,20 +952,10 @@ void trainprogram::scheduler() {
     qDebug() << QStringLiteral("trainprogram elapsed ") + QString::number(ticks) + QStringLiteral("current row len") +
                     QString::number(currentRowLen);
 
-    uint32_t calculatedLine;
-    uint32_t calculatedElapsedTime = 0;
-    for (calculatedLine = 0; calculatedLine < static_cast<uint32_t>(rows.length()); calculatedLine++) {
-
-        calculatedElapsedTime += calculateTimeForRow(calculatedLine);
-        
-        if (calculateDistanceForRow(calculatedLine) > 0 && calculatedLine >= currentStep) {
-            break;
-        }
-
-        if (calculatedElapsedTime > static_cast<uint32_t>(ticks) && calculatedLine >= currentStep) {
-            break;
-        }
-    }
+    // the first row from the current one that is a distance row, or that ends after the ticks
+    uint32_t calculatedLine = qMax(static_cast<uint32_t>(currentStep),
+                                   static_cast<uint32_t>(timeline().rowAt(static_cast<uint32_t>(ticks))));
+    calculatedLine = qMin(calculatedLine, static_cast<uint32_t>(m_timeline.nextDistanceRow(currentStep)));
 
     bool distanceEvaluation = false;
     int sameIteration = 0;
@@ -982,7 +983,8 @@ void trainprogram::scheduler() {
                 if(rows.at(currentStep).distance != -1)
                     lastOdometer -= (currentStepDistance - rows.at(currentStep).distance);
 
-                rows[currentStep].ended = QDateTime::currentDateTime();
+                stepEnded.insert(currentStep, QDateTime::currentDateTime());
+                updateTimeline(currentStep);
 
                 if (!distanceStep)
                     currentStep = calculatedLine;
@@ -997,7 +999,8 @@ void trainprogram::scheduler() {
 
                 calculatedLine = currentStep;
 
-                rows[currentStep].started = QDateTime::currentDateTime();
+                stepStarted.insert(currentStep, QDateTime::currentDateTime());
+                updateTimeline(currentStep);
 
                 currentStepDistance = 0;
                 if (bluetoothManager->device()->deviceType() == bluetoothdevice::TREADMILL) {
@@ -1080,25 +1083,9 @@ void trainprogram::scheduler() {
                         emit changeRequestedPelotonResistance(rows.at(currentStep).requested_peloton_resistance);
                     }
 
-                    if (rows.at(currentStep).inclination != -200 &&
-                        (bluetoothManager->device()->deviceType() == bluetoothdevice::BIKE || 
-                        (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL && !((elliptical*)bluetoothManager->device())->inclinationAvailableByHardware()))) {
-                        // this should be converted in a signal as all the other signals...
-                        double bikeResistanceOffset =
-                            settings
-                                .value(QZSettings::bike_resistance_offset, QZSettings::default_bike_resistance_offset)
-                                .toInt();
-                        double bikeResistanceGain =
-                            settings
-                                .value(QZSettings::bike_resistance_gain_f, QZSettings::default_bike_resistance_gain_f)
-                                .toDouble();
-
+                    if (rows.at(currentStep).inclination != -200 && inclinationAsResistance()) {
                         double inc = rows.at(currentStep).inclination;
-                        bluetoothManager->device()->changeResistance((resistance_t)(round(inc * bikeResistanceGain)) +
-                                                                     bikeResistanceOffset +
-                                                                     1); // resistance start from 1)
-                        if (bluetoothManager->device()->deviceType() == bluetoothdevice::BIKE && !((bike *)bluetoothManager->device())->inclinationAvailableByHardware())
-                            bluetoothManager->device()->setInclination(inc);
+                        applyInclinationAsResistance(inc);
                         qDebug() << QStringLiteral("trainprogram change inclination") + QString::number(inc);
                         emit changeInclination(inc, inc);
                         emit changeNextInclination300Meters(inclinationNext300Meters());
@@ -1143,10 +1130,13 @@ void trainprogram::scheduler() {
                 distanceEvaluation = false;
             }
         } else {
+            if (rows.length() > currentStep && rows.at(currentStep).isRamp())
+                rampTargets();
+
             if (rows.length() > currentStep && rows.at(currentStep).power != -1) {
-                qDebug() << QStringLiteral("trainprogram change power ") +
-                                QString::number(rows.at(currentStep).power);
-                emit changePower(rows.at(currentStep).power);
+                int power = currentRow().power;
+                qDebug() << QStringLiteral("trainprogram change power ") + QString::number(power);
+                emit changePower(power);
             }
 
             if (rows.at(currentStep).inclination != -200 &&
@@ -1207,6 +1197,57 @@ void trainprogram::scheduler() {
     } while (distanceEvaluation);
 }
 
+void trainprogram::zwiftPlayerUpdated(int playerId) {
+    zwiftplayerstate state;
+    if (playerId != zwift_player_id || !zwift_state || !zwift_state->player(playerId, &state) || !bluetoothManager ||
+        !bluetoothManager->device())
+        return;
+
+    QSettings settings;
+    float alt = state.altitude;
+    float distance = state.distance;
+
+    qDebug() << "zwift api incline1" << zwift_old_distance << zwift_old_alt << distance << alt;
+
+    if(zwift_old_distance > 0) {
+        float delta = distance - zwift_old_distance;
+        float deltaA = alt - zwift_old_alt;
+        float incline = (deltaA / delta);
+        if(delta > 1) {
+            bool zwift_negative_inclination_x2 =
+                settings.value(QZSettings::zwift_negative_inclination_x2, QZSettings::default_zwift_negative_inclination_x2)
+                    .toBool();
+            double offset =
+                settings.value(QZSettings::zwift_inclination_offset, QZSettings::default_zwift_inclination_offset).toDouble();
+            double gain =
+                settings.value(QZSettings::zwift_inclination_gain, QZSettings::default_zwift_inclination_gain).toDouble();
+            double grade = (incline * gain) + offset;  
+            if (zwift_negative_inclination_x2 && incline < 0) {
+                grade = ((incline * 2.0) * gain) + offset;
+            }                              
+            bool zwift_api_autoinclination = settings.value(QZSettings::zwift_api_autoinclination, QZSettings::default_zwift_api_autoinclination).toBool();
+            qDebug() << "zwift api incline" << incline << grade << delta << deltaA << zwift_api_autoinclination;
+            if(zwift_api_autoinclination) {
+                if(bluetoothManager->device()->deviceType() == bluetoothdevice::TREADMILL || 
+                    (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL && ((elliptical*)bluetoothManager->device())->inclinationAvailableByHardware())) {
+                    bluetoothManager->device()->changeInclination(grade, grade);
+                }
+                if (bluetoothManager->device()->deviceType() == bluetoothdevice::ELLIPTICAL &&
+                        (!((elliptical*)bluetoothManager->device())->inclinationAvailableByHardware() ||
+                         ((elliptical*)bluetoothManager->device())->inclinationSeparatedFromResistance())) {
+                    QSettings settings;
+                    double bikeResistanceOffset = settings.value(QZSettings::bike_resistance_offset, bikeResistanceOffset).toInt();
+                    double bikeResistanceGain = settings.value(QZSettings::bike_resistance_gain_f, bikeResistanceGain).toDouble();
+
+                    bluetoothManager->device()->changeResistance((resistance_t)(round(grade * bikeResistanceGain)) + bikeResistanceOffset + 1); // resistance start from 1
+                }
+            }
+        }
+    }
+    zwift_old_distance = distance;
+    zwift_old_alt = alt;
+}
+
 void trainprogram::end() {
     QSettings settings;
     qDebug() << QStringLiteral("trainprogram ends!");
@@ -1219,6 +1260,8 @@ void trainprogram::end() {
         restart();
     } else {
         started = false;
+        // the other sources can control the machine right away
+        bluetoothManager->device()->controlArbiter()->release(controlarbiter::PROGRAM);
         if (settings
                 .value(QZSettings::trainprogram_stop_at_end, QZSettings::default_trainprogram_stop_at_end)
                 .toBool())
@@ -1230,6 +1273,8 @@ bool trainprogram::overridePowerForCurrentRow(double power) {
     if (started && currentStep < rows.length() && currentRow().power != -1) {
         qDebug() << "overriding power from" << rows.at(currentStep).power << "to" << power;
         rows[currentStep].power = power;
+        // the rest of the ramp keeps the new power
+        rows[currentStep].powerTo = -1;
         return true;
     }
     return false;
@@ -1257,6 +1302,18 @@ void trainprogram::restart() {
     offset = 0;
     currentStep = 0;
     started = true;
+    m_videoSync.resetRate();
+}
+
+void trainprogram::resume(uint16_t step, int32_t elapsedTicks, int32_t elapsedOffset, double stepDistance) {
+
+    restart();
+    if (rows.isEmpty())
+        return;
+    currentStep = qMin((int)step, rows.count() - 1);
+    ticks = elapsedTicks;
+    offset = elapsedOffset;
+    currentStepDistance = stepDistance;
 }
 
 bool trainprogram::saveXML(const QString &filename, const QList<trainrow> &rows) {
@@ -1267,6 +1324,7 @@ bool trainprogram::saveXML(const QString &filename, const QList<trainrow> &rows)
         stream.writeStartDocument();
         stream.writeStartElement(QStringLiteral("rows"));
         for (const trainrow &row : qAsConst(rows)) {
+            const trainrowranges &ranges = row.ranges();
             stream.writeStartElement(QStringLiteral("row"));
             stream.writeAttribute(QStringLiteral("duration"), row.duration.toString());
             if (row.distance >= 0) {
@@ -1284,8 +1342,8 @@ bool trainprogram::saveXML(const QString &filename, const QList<trainrow> &rows)
             if (row.resistance >= 0) {
                 stream.writeAttribute(QStringLiteral("resistance"), QString::number(row.resistance));
             }
-            if (row.lower_resistance >= 0) {
-                stream.writeAttribute(QStringLiteral("lower_resistance"), QString::number(row.lower_resistance));
+            if (ranges.lower_resistance >= 0) {
+                stream.writeAttribute(QStringLiteral("lower_resistance"), QString::number(ranges.lower_resistance));
             }
             if (row.mets >= 0) {
                 stream.writeAttribute(QStringLiteral("mets"), QString::number(row.mets));
@@ -1302,36 +1360,82 @@ bool trainprogram::saveXML(const QString &filename, const QList<trainrow> &rows)
             if (!isnan(row.longitude)) {
                 stream.writeAttribute(QStringLiteral("longitude"), QString::number(row.longitude));
             }
-            if (row.upper_resistance >= 0) {
-                stream.writeAttribute(QStringLiteral("upper_resistance"), QString::number(row.upper_resistance));
+            if (ranges.upper_resistance >= 0) {
+                stream.writeAttribute(QStringLiteral("upper_resistance"), QString::number(ranges.upper_resistance));
             }
             if (row.requested_peloton_resistance >= 0) {
                 stream.writeAttribute(QStringLiteral("requested_peloton_resistance"),
                                       QString::number(row.requested_peloton_resistance));
             }
-            if (row.lower_requested_peloton_resistance >= 0) {
+            if (ranges.lower_requested_peloton_resistance >= 0) {
                 stream.writeAttribute(QStringLiteral("lower_requested_peloton_resistance"),
-                                      QString::number(row.lower_requested_peloton_resistance));
+                                      QString::number(ranges.lower_requested_peloton_resistance));
             }
-            if (row.upper_requested_peloton_resistance >= 0) {
+            if (ranges.upper_requested_peloton_resistance >= 0) {
                 stream.writeAttribute(QStringLiteral("upper_requested_peloton_resistance"),
-                                      QString::number(row.upper_requested_peloton_resistance));
+                                      QString::number(ranges.upper_requested_peloton_resistance));
+            }
+            if (ranges.pace_intensity >= 0) {
+                stream.writeAttribute(QStringLiteral("pace_intensity"), QString::number(ranges.pace_intensity));
+            }
+            if (ranges.average_requested_peloton_resistance >= 0) {
+                stream.writeAttribute(QStringLiteral("average_requested_peloton_resistance"),
+                                      QString::number(ranges.average_requested_peloton_resistance));
+            }
+            if (ranges.average_resistance >= 0) {
+                stream.writeAttribute(QStringLiteral("average_resistance"), QString::number(ranges.average_resistance));
             }
-            if (row.pace_intensity >= 0) {
-                stream.writeAttribute(QStringLiteral("pace_intensity"), QString::number(row.pace_intensity));
+            if (ranges.average_cadence >= 0) {
+                stream.writeAttribute(QStringLiteral("average_cadence"), QString::number(ranges.average_cadence));
+            }
+            if (ranges.lower_speed >= 0) {
+                stream.writeAttribute(QStringLiteral("lower_speed"), QString::number(ranges.lower_speed));
+            }
+            if (ranges.average_speed >= 0) {
+                stream.writeAttribute(QStringLiteral("average_speed"), QString::number(ranges.average_speed));
+            }
+            if (ranges.upper_speed >= 0) {
+                stream.writeAttribute(QStringLiteral("upper_speed"), QString::number(ranges.upper_speed));
+            }
+            if (ranges.lower_inclination >= -50) {
+                stream.writeAttribute(QStringLiteral("lower_inclination"), QString::number(ranges.lower_inclination));
+            }
+            if (ranges.average_inclination >= -50) {
+                stream.writeAttribute(QStringLiteral("average_inclination"),
+                                      QString::number(ranges.average_inclination));
+            }
+            if (ranges.upper_inclination >= -50) {
+                stream.writeAttribute(QStringLiteral("upper_inclination"), QString::number(ranges.upper_inclination));
             }
             if (row.cadence >= 0) {
                 stream.writeAttribute(QStringLiteral("cadence"), QString::number(row.cadence));
             }
-            if (row.lower_cadence >= 0) {
-                stream.writeAttribute(QStringLiteral("lower_cadence"), QString::number(row.lower_cadence));
+            if (ranges.lower_cadence >= 0) {
+                stream.writeAttribute(QStringLiteral("lower_cadence"), QString::number(ranges.lower_cadence));
             }
-            if (row.upper_cadence >= 0) {
-                stream.writeAttribute(QStringLiteral("upper_cadence"), QString::number(row.upper_cadence));
+            if (ranges.upper_cadence >= 0) {
+                stream.writeAttribute(QStringLiteral("upper_cadence"), QString::number(ranges.upper_cadence));
             }
             if (row.power >= 0) {
                 stream.writeAttribute(QStringLiteral("power"), QString::number(row.power));
             }
+            if (row.isRamp()) {
+                if (row.powerTo >= 0) {
+                    stream.writeAttribute(QStringLiteral("powerto"), QString::number(row.powerTo));
+                }
+                if (row.speedTo >= 0) {
+                    stream.writeAttribute(QStringLiteral("speedto"), QString::number(row.speedTo));
+                }
+                if (row.inclinationTo >= -50) {
+                    stream.writeAttribute(QStringLiteral("inclinationto"), QString::number(row.inclinationTo));
+                }
+                if (row.cadenceTo >= 0) {
+                    stream.writeAttribute(QStringLiteral("cadenceto"), QString::number(row.cadenceTo));
+                }
+                if (row.resistanceTo >= 0) {
+                    stream.writeAttribute(QStringLiteral("resistanceto"), QString::number(row.resistanceTo));
+                }
+            }
             stream.writeAttribute(QStringLiteral("forcespeed"),
                                   row.forcespeed ? QStringLiteral("1") : QStringLiteral("0"));
             if (row.fanspeed >= 0) {
@@ -1397,7 +1501,6 @@ QList<trainrow> trainprogram::loadXML(const QString &filename, bluetoothdevice::
         stream.readNext();
         trainrow row;
         QXmlStreamAttributes atts = stream.attributes();
-        bool ramp = false;
         if (!atts.isEmpty()) {
             if (atts.hasAttribute(QStringLiteral("duration"))) {
                 row.duration = QTime::fromString(atts.value(QStringLiteral("duration")).toString(), QStringLiteral("hh:mm:ss"));
@@ -1421,7 +1524,7 @@ QList<trainrow> trainprogram::loadXML(const QString &filename, bluetoothdevice::
                 row.resistance = atts.value(QStringLiteral("resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("lower_resistance"))) {
-                row.lower_resistance = atts.value(QStringLiteral("lower_resistance")).toInt();
+                row.editRanges().lower_resistance = atts.value(QStringLiteral("lower_resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("mets"))) {
                 row.mets = atts.value(QStringLiteral("mets")).toInt();
@@ -1439,30 +1542,58 @@ QList<trainrow> trainprogram::loadXML(const QString &filename, bluetoothdevice::
                 row.azimuth = atts.value(QStringLiteral("azimuth")).toDouble();
             }
             if (atts.hasAttribute(QStringLiteral("upper_resistance"))) {
-                row.upper_resistance = atts.value(QStringLiteral("upper_resistance")).toInt();
+                row.editRanges().upper_resistance = atts.value(QStringLiteral("upper_resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("requested_peloton_resistance"))) {
                 row.requested_peloton_resistance = atts.value(QStringLiteral("requested_peloton_resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("lower_requested_peloton_resistance"))) {
-                row.lower_requested_peloton_resistance =
+                row.editRanges().lower_requested_peloton_resistance =
                     atts.value(QStringLiteral("lower_requested_peloton_resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("upper_requested_peloton_resistance"))) {
-                row.upper_requested_peloton_resistance =
+                row.editRanges().upper_requested_peloton_resistance =
                     atts.value(QStringLiteral("upper_requested_peloton_resistance")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("pace_intensity"))) {
-                row.pace_intensity = atts.value(QStringLiteral("pace_intensity")).toInt();
+                row.editRanges().pace_intensity = atts.value(QStringLiteral("pace_intensity")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("average_requested_peloton_resistance"))) {
+                row.editRanges().average_requested_peloton_resistance =
+                    atts.value(QStringLiteral("average_requested_peloton_resistance")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("average_resistance"))) {
+                row.editRanges().average_resistance = atts.value(QStringLiteral("average_resistance")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("average_cadence"))) {
+                row.editRanges().average_cadence = atts.value(QStringLiteral("average_cadence")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("lower_speed"))) {
+                row.editRanges().lower_speed = atts.value(QStringLiteral("lower_speed")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("average_speed"))) {
+                row.editRanges().average_speed = atts.value(QStringLiteral("average_speed")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("upper_speed"))) {
+                row.editRanges().upper_speed = atts.value(QStringLiteral("upper_speed")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("lower_inclination"))) {
+                row.editRanges().lower_inclination = atts.value(QStringLiteral("lower_inclination")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("average_inclination"))) {
+                row.editRanges().average_inclination = atts.value(QStringLiteral("average_inclination")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("upper_inclination"))) {
+                row.editRanges().upper_inclination = atts.value(QStringLiteral("upper_inclination")).toDouble();
             }
             if (atts.hasAttribute(QStringLiteral("cadence"))) {
                 row.cadence = atts.value(QStringLiteral("cadence")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("lower_cadence"))) {
-                row.lower_cadence = atts.value(QStringLiteral("lower_cadence")).toInt();
+                row.editRanges().lower_cadence = atts.value(QStringLiteral("lower_cadence")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("upper_cadence"))) {
-                row.upper_cadence = atts.value(QStringLiteral("upper_cadence")).toInt();
+                row.editRanges().upper_cadence = atts.value(QStringLiteral("upper_cadence")).toInt();
             }
             if (atts.hasAttribute(QStringLiteral("power"))) {
                 row.power = atts.value(QStringLiteral("power")).toInt();
@@ -1496,110 +1627,41 @@ QList<trainrow> trainprogram::loadXML(const QString &filename, bluetoothdevice::
                     row.power = atts.value(QStringLiteral("powerzone")).toDouble() * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
                 }
             }
-            if (atts.hasAttribute(QStringLiteral("speedfrom")) && atts.hasAttribute(QStringLiteral("speedto")) && atts.hasAttribute(QStringLiteral("duration"))) {
-                double speedFrom = atts.value(QStringLiteral("speedfrom")).toDouble();
-                double speedTo = atts.value(QStringLiteral("speedto")).toDouble();
-                QTime duration = QTime::fromString(atts.value(QStringLiteral("duration")).toString(), QStringLiteral("hh:mm:ss"));
-                int durationS = duration.hour() * 3600 + duration.minute() * 60 + duration.second();
-                int speedDelta = (fabs(speedTo - speedFrom) / 0.1);    // 0.1 min step for speed
-                int durationStep;
-                double speedStep;
-                int spareSeconds;
-                if(speedDelta <= durationS) {
-                    durationStep = durationS / speedDelta;
-                    speedStep = 0.1;
-                    spareSeconds = durationS % speedDelta;
-                } else {
-                    durationStep = 1;
-                    speedStep = fabs(speedTo - speedFrom) / (durationS - 1);
-                    speedDelta = durationS - 1;
-                    spareSeconds = 0;
-                }
-                int spareSum = 0;
-                for (int i = 0; i <= speedDelta; i++) {
-                    trainrow rowI(row);
-                    int spare = 0;
-                    if (spareSeconds)
-                        spare = (i % spareSeconds == 0 && i > 0) ? 1 : 0;
-                    spareSum += spare;
-                    if (i == speedDelta && spareSum < spareSeconds) {
-                        spare += (spareSeconds - spareSum) - durationStep;
-                        spareSum = spareSeconds;
-                    }
-                    rowI.duration = QTime(0, 0, 0, 0).addSecs(durationStep + spare);
-                    rowI.rampElapsed = QTime(0, 0, 0, 0).addSecs((durationStep * i) + spareSum);
-                    rowI.rampDuration = QTime(0, 0, 0, 0).addSecs(durationS - (durationStep * i) - spareSum);
-                    rowI.forcespeed = 1;
-                    if (speedFrom < speedTo) {
-                        rowI.speed = speedFrom + (speedStep * i);
-                    } else {
-                        rowI.speed = speedFrom - (speedStep * i);
-                    }
-                    qDebug() << "TrainRow" << rowI.toString();
-                    list.append(rowI);
-                }
-                ramp = true;
+            // the ramps are a single row, their targets are interpolated while it runs
+            if (atts.hasAttribute(QStringLiteral("powerto"))) {
+                row.powerTo = atts.value(QStringLiteral("powerto")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("speedfrom"))) {
+                row.speed = atts.value(QStringLiteral("speedfrom")).toDouble();
+                row.forcespeed = true;
+            }
+            if (atts.hasAttribute(QStringLiteral("speedto"))) {
+                row.speedTo = atts.value(QStringLiteral("speedto")).toDouble();
             }
-            if (atts.hasAttribute(QStringLiteral("powerzonefrom")) && atts.hasAttribute(QStringLiteral("powerzoneto")) && atts.hasAttribute(QStringLiteral("duration"))) {
+            if (atts.hasAttribute(QStringLiteral("inclinationto"))) {
+                row.inclinationTo = atts.value(QStringLiteral("inclinationto")).toDouble();
+            }
+            if (atts.hasAttribute(QStringLiteral("cadenceto"))) {
+                row.cadenceTo = atts.value(QStringLiteral("cadenceto")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("resistanceto"))) {
+                row.resistanceTo = atts.value(QStringLiteral("resistanceto")).toInt();
+            }
+            if (atts.hasAttribute(QStringLiteral("powerzonefrom")) && atts.hasAttribute(QStringLiteral("powerzoneto"))) {
                 QSettings settings;
-                double speedFrom = atts.value(QStringLiteral("powerzonefrom")).toDouble();
-                double speedTo = atts.value(QStringLiteral("powerzoneto")).toDouble();
-                QTime duration = QTime::fromString(atts.value(QStringLiteral("duration")).toString(), QStringLiteral("hh:mm:ss"));
-                int durationS = duration.hour() * 3600 + duration.minute() * 60 + duration.second();
-                int speedDelta = (fabs(speedTo - speedFrom) / 0.01);    // 0.01 min step for speed
-                int durationStep;
-                double speedStep;
-                int spareSeconds;
-                if(speedDelta == 0)
-                    speedDelta = 1;
-                if(speedDelta <= durationS) {
-                    durationStep = durationS / speedDelta;
-                    speedStep = 0.01;
-                    spareSeconds = durationS % speedDelta;
+                double ftp;
+                if(device_type == bluetoothdevice::TREADMILL) {
+                    ftp = settings.value(QZSettings::ftp_run, QZSettings::default_ftp_run).toDouble();
                 } else {
-                    durationStep = 1;
-                    speedStep = fabs(speedTo - speedFrom) / (durationS - 1);
-                    speedDelta = durationS - 1;
-                    spareSeconds = 0;
+                    ftp = settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
                 }
-                int spareSum = 0;
-                for (int i = 0; i <= speedDelta; i++) {
-                    trainrow rowI(row);
-                    int spare = 0;
-                    if (spareSeconds)
-                        spare = (i % spareSeconds == 0 && i > 0) ? 1 : 0;
-                    spareSum += spare;
-                    if (i == speedDelta && spareSum < spareSeconds) {
-                        spare += (spareSeconds - spareSum) - durationStep;
-                        spareSum = spareSeconds;
-                    }
-                    rowI.duration = QTime(0, 0, 0, 0).addSecs(durationStep + spare);
-                    rowI.rampElapsed = QTime(0, 0, 0, 0).addSecs((durationStep * i) + spareSum);
-                    rowI.rampDuration = QTime(0, 0, 0, 0).addSecs(durationS - (durationStep * i) - spareSum);
-                    rowI.forcespeed = 1;
-                    if (speedFrom < speedTo) {
-                        if(device_type == bluetoothdevice::TREADMILL) {
-                            rowI.power = (speedFrom + (speedStep * i)) * settings.value(QZSettings::ftp_run, QZSettings::default_ftp_run).toDouble();
-                        } else {
-                            rowI.power = (speedFrom + (speedStep * i)) * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                        }
-                    } else {
-                        if(device_type == bluetoothdevice::TREADMILL) {
-                            rowI.power = (speedFrom - (speedStep * i)) * settings.value(QZSettings::ftp_run, QZSettings::default_ftp_run).toDouble();
-                        } else {
-                            rowI.power = (speedFrom - (speedStep * i)) * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
-                        }
-                    }
-                    qDebug() << "TrainRow" << rowI.toString();
-                    list.append(rowI);
-                }
-                ramp = true;
+                row.power = atts.value(QStringLiteral("powerzonefrom")).toDouble() * ftp;
+                row.powerTo = atts.value(QStringLiteral("powerzoneto")).toDouble() * ftp;
+                row.forcespeed = true;
             }
 
-            if(!ramp) {
-                list.append(row);
-                qDebug() << row.toString();
-            }
+            list.append(row);
+            qDebug() << row.toString();
         }
     }
     return list;
@@ -1607,19 +1669,25 @@ QList<trainrow> trainprogram::loadXML(const QString &filename, bluetoothdevice::
 
 QTime trainprogram::totalElapsedTime() { return QTime(0, 0, ticks); }
 
-trainrow trainprogram::currentRow() {
-    if (started && !rows.isEmpty()) {
+static const trainrow emptyRow;
 
-        return rows.at(currentStep);
+const trainrow &trainprogram::currentRow() {
+    if (started && !rows.isEmpty()) {
+        const trainrow &row = rows.at(currentStep);
+        if (row.isRamp()) {
+            m_rampRow = row.at(currentRowTicks());
+            return m_rampRow;
+        }
+        return row;
     }
-    return trainrow();
+    return emptyRow;
 }
 
-trainrow trainprogram::getRowFromCurrent(uint32_t offset) {
+const trainrow &trainprogram::getRowFromCurrent(uint32_t offset) {
     if (started && !rows.isEmpty() && (currentStep + offset) < (uint32_t)rows.length()) {
         return rows.at(currentStep + offset);
     }
-    return trainrow();
+    return emptyRow;
 }
 
 double trainprogram::currentTargetMets() {
@@ -1630,34 +1698,18 @@ double trainprogram::currentTargetMets() {
 }
 
 QTime trainprogram::currentRowElapsedTime() {
-    uint32_t calculatedLine;
-    uint32_t calculatedElapsedTime = 0;
-
     if (rows.length() == 0)
         return QTime(0, 0, 0);
 
-    for (calculatedLine = 0; calculatedLine < static_cast<uint32_t>(rows.length()); calculatedLine++) {
-
-        uint32_t currentLine = calculateTimeForRow(calculatedLine);
-        calculatedElapsedTime += currentLine;
-        uint32_t rampElapsed = 0;
-
-        if (calculatedElapsedTime > static_cast<uint32_t>(ticks)) {
-            if (rows.at(calculatedLine).rampElapsed != QTime(0, 0, 0)) {
-                rampElapsed = (rows.at(calculatedLine).rampElapsed.second() +
-                               (rows.at(calculatedLine).rampElapsed.minute() * 60) +
-                               (rows.at(calculatedLine).rampElapsed.hour() * 3600));
-            }
-            return QTime(0, 0, 0).addSecs(rampElapsed + ticks - (calculatedElapsedTime - currentLine));
-        }
+    int calculatedLine = timeline().rowAt(static_cast<uint32_t>(ticks));
+    if (calculatedLine < rows.length()) {
+        uint32_t calculatedElapsedTime = m_timeline.secondsBefore(calculatedLine);
+        return QTime(0, 0, 0).addSecs(ticks - calculatedElapsedTime);
     }
     return QTime(0, 0, 0);
 }
 
 QTime trainprogram::currentRowRemainingTime() {
-    uint32_t calculatedLine;
-    uint32_t calculatedElapsedTime = 0;
-
     if (rows.length() == 0)
         return QTime(0, 0, 0);
 
@@ -1670,37 +1722,22 @@ QTime trainprogram::currentRowRemainingTime() {
         int hours = seconds / 3600;
         return QTime(hours, (seconds / 60) - (hours * 60), seconds % 60);
     } else {
-        for (calculatedLine = 0; calculatedLine < static_cast<uint32_t>(rows.length()); calculatedLine++) {
-
-            uint32_t currentLine = calculateTimeForRow(calculatedLine);
-            calculatedElapsedTime += currentLine;
-
-            if (calculatedElapsedTime > static_cast<uint32_t>(ticks)) {
-                if (rows.at(calculatedLine).rampDuration != QTime(0, 0, 0)) {
-                    calculatedElapsedTime += ((rows.at(calculatedLine).rampDuration.second() +
-                                               (rows.at(calculatedLine).rampDuration.minute() * 60) +
-                                               (rows.at(calculatedLine).rampDuration.hour() * 3600))) -
-                                             1;
-                }
-                int seconds = calculatedElapsedTime - ticks;
-                int hours = seconds / 3600;
-                return QTime(hours, (seconds / 60) - (hours * 60), seconds % 60);
-            }
+        int calculatedLine = timeline().rowAt(static_cast<uint32_t>(ticks));
+        if (calculatedLine < rows.length()) {
+            uint32_t calculatedElapsedTime = m_timeline.secondsBefore(calculatedLine + 1);
+            int seconds = calculatedElapsedTime - ticks;
+            int hours = seconds / 3600;
+            return QTime(hours, (seconds / 60) - (hours * 60), seconds % 60);
         }
     }
     return QTime(0, 0, 0);
 }
 
 QTime trainprogram::remainingTime() {
-    uint32_t calculatedLine;
-    uint32_t calculatedTotalTime = 0;
-
     if (rows.length() == 0)
         return QTime(0, 0, 0);
 
-    for (calculatedLine = 0; calculatedLine < static_cast<uint32_t>(rows.length()); calculatedLine++) {
-        calculatedTotalTime += calculateTimeForRow(calculatedLine);
-    }
+    uint32_t calculatedTotalTime = timeline().totalSeconds();
     return QTime(0, 0, 0).addSecs(calculatedTotalTime - ticks);
 }
 
@@ -1,71 +1,88 @@
 #ifndef TRAINPROGRAM_H
 #define TRAINPROGRAM_H
 #include "bluetooth.h"
+#include "timelineindex.h"
+#include "videosync.h"
+#include "zwiftworldstate.h"
 #include <QGeoCoordinate>
+#include <QHash>
 #include <QMutex>
 #include <QObject>
 #include <QSet>
+#include <QSharedData>
 #include <QTime>
 #include <QTimer>
 
-#ifdef Q_OS_IOS
-#include "ios/lockscreen.h"
-#endif
-
 #include "zwift-api/PlayerStateWrapper.h"
 #include "zwift-api/zwift_client_auth.h"
 
-#ifdef Q_CC_MSVC
-#include "zwift-api/zwift_messages.pb.h"
-#endif
+/**
+ * @brief The target ranges of a Peloton class. Only the Peloton rows have them, so they live out of trainrow and are
+ * allocated only when one is set; the copies of a row share them.
+ */
+class trainrowranges : public QSharedData {
+  public:
+    double lower_speed = -1;
+    double average_speed = -1;
+    double upper_speed = -1;
+    double lower_inclination = -200;
+    double average_inclination = -200;
+    double upper_inclination = -200;
+    resistance_t lower_resistance = -1;
+    resistance_t average_resistance = -1;
+    resistance_t upper_resistance = -1;
+    int16_t lower_cadence = -1;
+    int16_t average_cadence = -1;
+    int16_t upper_cadence = -1;
+    int8_t lower_requested_peloton_resistance = -1;
+    int8_t average_requested_peloton_resistance = -1;
+    int8_t upper_requested_peloton_resistance = -1;
+    int8_t pace_intensity = -1;
+};
 
+// GPX routes have a row for each point, so the fields are ordered by size to avoid any padding. The time of the steps
+// is not here: it's written while the program runs, and it would detach the rows from loadedRows.
 class trainrow {
   public:
-    QTime duration = QTime(0, 0, 0, 0);
-    QDateTime started = QDateTime();
-    QDateTime ended = QDateTime();
     double distance = -1;
     double speed = -1;
-    double lower_speed = -1;   // used for peloton
-    double average_speed = -1; // used for peloton
-    double upper_speed = -1;   // used for peloton
     double fanspeed = -1;
     double inclination = -200;
-    double lower_inclination = -200;   // used for peloton
-    double average_inclination = -200; // used for peloton
-    double upper_inclination = -200;   // used for peloton
-    resistance_t resistance = -1;
-    resistance_t lower_resistance = -1;
-    resistance_t average_resistance = -1; // used for peloton
-    resistance_t upper_resistance = -1;
-    int8_t requested_peloton_resistance = -1;
-    int8_t lower_requested_peloton_resistance = -1;
-    int8_t average_requested_peloton_resistance = -1; // used for peloton
-    int8_t upper_requested_peloton_resistance = -1;
-    int8_t pace_intensity = -1; // used for peloton
-    int16_t cadence = -1;
-    int16_t lower_cadence = -1;
-    int16_t average_cadence = -1; // used for peloton
-    int16_t upper_cadence = -1;
-    bool forcespeed = false;
-    int8_t loopTimeHR = 10;
-    int8_t zoneHR = -1;
-    int16_t HRmin = -1;
-    int16_t HRmax = -1;
     double maxSpeed = -1;
     double minSpeed = -1;
-    int8_t maxResistance = -1;
-    int32_t power = -1;
-    int32_t mets = -1;
-    QTime rampDuration = QTime(0, 0, 0, 0); // QZ split the ramp in 1 second segments. This field will tell you how long
-                                            // is the ramp from this very moment
-    QTime rampElapsed = QTime(0, 0, 0, 0);
-    QTime gpxElapsed = QTime(0, 0, 0, 0);
     double latitude = NAN;
     double longitude = NAN;
     double altitude = NAN;
     double azimuth = NAN;
+    // a ramp goes from the targets of the row to these ones, over the duration
+    double speedTo = -1;
+    double inclinationTo = -200;
+    // through ranges() and editRanges()
+    QSharedDataPointer<trainrowranges> m_ranges;
+    int32_t power = -1;
+    int32_t powerTo = -1;
+    int32_t mets = -1;
+    QTime duration = QTime(0, 0, 0, 0);
+    QTime gpxElapsed = QTime(0, 0, 0, 0);
+    resistance_t resistance = -1;
+    resistance_t resistanceTo = -1;
+    int16_t cadence = -1;
+    int16_t cadenceTo = -1;
+    int16_t HRmin = -1;
+    int16_t HRmax = -1;
+    int8_t requested_peloton_resistance = -1;
+    int8_t loopTimeHR = 10;
+    int8_t zoneHR = -1;
+    int8_t maxResistance = -1;
+    bool forcespeed = false;
+    // the Peloton ranges, all unset when the row has none
+    const trainrowranges &ranges() const;
+    // allocates the ranges the first time, and detaches them from the copies of the row
+    trainrowranges &editRanges();
     QString toString() const;
+    bool isRamp() const;
+    // the row with the targets of the ramp after these seconds
+    trainrow at(double seconds) const;
 };
 
 class trainprogram : public QObject {
@@ -85,8 +102,9 @@ class trainprogram : public QObject {
     double currentTargetMets();
     QTime duration();
     double totalDistance();
-    trainrow currentRow();
-    trainrow getRowFromCurrent(uint32_t offset);
+    // the references are valid until the rows change; for a ramp, until the next call
+    const trainrow &currentRow();
+    const trainrow &getRowFromCurrent(uint32_t offset);
     void increaseElapsedTime(uint32_t i);
     void decreaseElapsedTime(uint32_t i);
     int32_t offsetElapsedTime() { return offset; }
@@ -98,7 +116,7 @@ class trainprogram : public QObject {
     double medianInclination(int step);
     bool overridePowerForCurrentRow(double power);
     bool powerzoneWorkout() {
-        foreach(trainrow r, rows) {
+        for (const trainrow &r : qAsConst(rows)) {
             if(r.power != -1) return true;
         }
         return false;
@@ -113,6 +131,11 @@ class trainprogram : public QObject {
     void setVideoAvailable(bool v) {videoAvailable = v;}
 
     void restart();
+    // restores the position in the program saved by the session journal
+    void resume(uint16_t step, int32_t elapsedTicks, int32_t elapsedOffset, double stepDistance);
+    uint16_t currentStepIndex() { return currentStep; }
+    int32_t elapsedTicks() { return ticks; }
+    double currentStepTraveled() { return currentStepDistance; }
     bool isStarted() { return started; }
     void scheduler(int tick);
 
@@ -124,6 +147,7 @@ class trainprogram : public QObject {
 
 private slots:
     void pelotonOCRprocessPendingDatagrams();
+    void zwiftPlayerUpdated(int playerId);
 
   signals:
     void start();
@@ -164,6 +188,23 @@ private slots:
     double lastGpxRateSetAt = 0.0;
     double lastGpxRateSet = 0.0;
     double lastGpxSpeedSet = 0.0;
+    // rebuilt when the rows change
+    videosync m_videoSync;
+    // when each step started and ended
+    QHash<int, QDateTime> stepStarted;
+    QHash<int, QDateTime> stepEnded;
+    void buildVideoSync();
+    // the seconds of the rows, rebuilt when the rows change
+    timelineindex m_timeline;
+    const timelineindex &timeline();
+    void updateTimeline(int row);
+    // the seconds elapsed in the current row
+    int currentRowTicks();
+    trainrow m_rampRow;
+    void rampTargets();
+    // bikes, and ellipticals without an inclination motor, get the slope of the rows as resistance
+    bool inclinationAsResistance();
+    void applyInclinationAsResistance(double inc);
     int lastStepTimestampChanged = 0;
     double lastCurrentStepDistance = 0.0;
     QTime lastCurrentStepTime = QTime(0, 0, 0);
@@ -174,10 +215,9 @@ private slots:
     AuthToken* zwift_auth_token = nullptr;
     World* zwift_world = nullptr;
     int zwift_player_id = -1;
-    
-#ifdef Q_OS_IOS
-    lockscreen *h = 0;
-#endif
+    zwiftworldstate *zwift_state = nullptr;
+    float zwift_old_distance = 0;
+    float zwift_old_alt = 0;
 
 };
 
@@ -0,0 +1,44 @@
+#include "videosync.h"
+#include <algorithm>
+
+void videosync::clear() {
+    m_elapsed.clear();
+    m_km.clear();
+    resetRate();
+}
+
+void videosync::append(int elapsedSecs, double km) {
+    if (m_km.isEmpty())
+        m_km.append(0);
+    // a gpx going back in time would break the binary search
+    if (!m_elapsed.isEmpty() && elapsedSecs < m_elapsed.last())
+        elapsedSecs = m_elapsed.last();
+    m_elapsed.append(elapsedSecs);
+    m_km.append(m_km.last() + km);
+}
+
+double videosync::avgSpeed(int step, int seconds) const {
+    if (step < 0 || step >= m_elapsed.count())
+        return 0.0;
+    qint32 start = step > 0 ? m_elapsed.at(step - 1) : 0;
+    // the first row reaching the window, or the last one
+    QVector<qint32>::const_iterator it = std::lower_bound(m_elapsed.constBegin() + step, m_elapsed.constEnd(),
+                                                          start + seconds);
+    int last = it == m_elapsed.constEnd() ? m_elapsed.count() - 1 : int(it - m_elapsed.constBegin());
+    qint32 time = m_elapsed.at(last) - start;
+    if (time <= 0)
+        return 0.0;
+    return (m_km.at(last + 1) - m_km.at(step)) / ((double)time) * 3600.0;
+}
+
+double videosync::rate(double gpxSecs, double videoSecs, double riderSpeed, double routeSpeed) {
+    if (routeSpeed <= 0)
+        return m_rate > 0 ? m_rate : 1.0;
+    double target = (riderSpeed / routeSpeed) + ((gpxSecs - videoSecs) / correctionTime);
+    target = qBound(minRate, target, maxRate);
+    if (m_rate < 0)
+        m_rate = target;
+    else
+        m_rate = qBound(m_rate - maxRateStep, target, m_rate + maxRateStep);
+    return m_rate;
+}
@@ -0,0 +1,47 @@
+#ifndef VIDEOSYNC_H
+#define VIDEOSYNC_H
+
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief Keeps the video of a route in sync with the position of the rider. The rows of the GPX are indexed once:
+ * the elapsed time, made monotone, and the prefix sums of the distance, so the average speed of the route over any
+ * window is a binary search and a subtraction instead of a walk on the rows.
+ */
+class videosync {
+  public:
+    void clear();
+    // Units: seconds since the start of the route, km of the row
+    void append(int elapsedSecs, double km);
+    int count() const { return m_elapsed.count(); }
+
+    /**
+     * @brief avgSpeed The average speed of the route from a step, over at least the given seconds or up to the end.
+     * Units: km/h, 0 when the rows have no duration
+     */
+    double avgSpeed(int step, int seconds) const;
+
+    /**
+     * @brief rate The playback rate for the next second: the speed of the rider against the speed the video was
+     * recorded at, plus the distance between the video and the rider closed in correctionTime. The changes are
+     * limited to maxRateStep for each call, so the video doesn't jump forward or stall.
+     * Units: seconds of video for each second
+     */
+    double rate(double gpxSecs, double videoSecs, double riderSpeed, double routeSpeed);
+    void resetRate() { m_rate = -1; }
+
+    // Units: seconds
+    double correctionTime = 5;
+    double minRate = 0.05;
+    double maxRate = 4;
+    double maxRateStep = 0.25;
+
+  private:
+    QVector<qint32> m_elapsed;
+    // m_km[i] is the distance of the rows before i
+    QVector<double> m_km;
+    double m_rate = -1;
+};
+
+#endif // VIDEOSYNC_H
@@ -1,5 +1,6 @@
 #include "virtualdevices/virtualbike.h"
 #include "devices/bike.h"
+#include "qztrace.h"
 #include <QThread>
 #include <QDataStream>
 #include <QMetaEnum>
@@ -471,7 +472,7 @@ void virtualbike::characteristicChanged(const QLowEnergyCharacteristic &characte
     if (normalizeWattage < 0)
         normalizeWattage = 0;
 
-    qDebug() << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
+    QZ_DEBUG << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
                     QStringLiteral(" ") + newValue.toHex(' ');
 
     if (!echelon && !ifit) {
@@ -978,7 +979,7 @@ int virtualbike::iFit_resistanceToIfit(int ifitResistance) {
 void virtualbike::writeCharacteristic(QLowEnergyService *service, const QLowEnergyCharacteristic &characteristic,
                                       const QByteArray &value) {
     try {
-        qDebug() << QStringLiteral("virtualbike::writeCharacteristic ") + service->serviceName() + QStringLiteral(" ") +
+        QZ_DEBUG << QStringLiteral("virtualbike::writeCharacteristic ") + service->serviceName() + QStringLiteral(" ") +
                         characteristic.name() + QStringLiteral(" ") + value.toHex(' ');
         service->writeCharacteristic(characteristic, value); // Potentially causes notification.
     } catch (...) {
@@ -1077,7 +1078,7 @@ void virtualbike::bikeProvider() {
             int ret = h->virtualbike_getLastFTMSMessage(ftms_message);
             if (ret > 0) {
                 lastFTMSFrameReceived = QDateTime::currentMSecsSinceEpoch();
-                qDebug() << "FTMS rcv << " << QByteArray::fromRawData((char *)ftms_message, ret).toHex(' ');
+                QZ_DEBUG << "FTMS rcv << " << QByteArray::fromRawData((char *)ftms_message, ret).toHex(' ');
                 emit ftmsCharacteristicChanged(QLowEnergyCharacteristic(),
                                                QByteArray::fromRawData((char *)ftms_message, ret));
             }
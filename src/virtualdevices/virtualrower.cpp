@@ -1,6 +1,7 @@
 #include "virtualdevices/virtualrower.h"
 #include "qsettings.h"
 #include "rower.h"
+#include "qztrace.h"
 
 #include <QDataStream>
 #include <QMetaEnum>
@@ -206,7 +207,7 @@ void virtualrower::characteristicChanged(const QLowEnergyCharacteristic &charact
     QByteArray reply;
     QSettings settings;
     bool erg_mode = settings.value(QZSettings::zwift_erg, QZSettings::default_zwift_erg).toBool();
-    qDebug() << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
+    QZ_DEBUG << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
                     QStringLiteral(" ") + newValue.toHex(' ');
 
     lastFTMSFrameReceived = QDateTime::currentMSecsSinceEpoch();
@@ -287,7 +288,7 @@ void virtualrower::characteristicChanged(const QLowEnergyCharacteristic &charact
 void virtualrower::writeCharacteristic(QLowEnergyService *service, const QLowEnergyCharacteristic &characteristic,
                                        const QByteArray &value) {
     try {
-        qDebug() << QStringLiteral("virtualrower::writeCharacteristic ") + service->serviceName() +
+        QZ_DEBUG << QStringLiteral("virtualrower::writeCharacteristic ") + service->serviceName() +
                         QStringLiteral(" ") + characteristic.name() + QStringLiteral(" ") + value.toHex(' ');
         service->writeCharacteristic(characteristic, value); // Potentially causes notification.
     } catch (...) {
@@ -354,7 +355,7 @@ void virtualrower::rowerProvider() {
             int ret = h->virtualrower_getLastFTMSMessage(ftms_message);
             if (ret > 0) {
                 lastFTMSFrameReceived = QDateTime::currentMSecsSinceEpoch();
-                qDebug() << "FTMS rcv << " << QByteArray::fromRawData((char *)ftms_message, ret).toHex(' ');
+                QZ_DEBUG << "FTMS rcv << " << QByteArray::fromRawData((char *)ftms_message, ret).toHex(' ');
                 emit ftmsCharacteristicChanged(QLowEnergyCharacteristic(),
                                                QByteArray::fromRawData((char *)ftms_message, ret));
             }
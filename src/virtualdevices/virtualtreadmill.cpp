@@ -1,4 +1,5 @@
 #include "virtualdevices/virtualtreadmill.h"
+#include "qztrace.h"
 #include <QThread>
 #include <QSettings>
 #include <QtMath>
@@ -280,7 +281,7 @@ virtualtreadmill::virtualtreadmill(bluetoothdevice *t, bool noHeartService) {
 
 void virtualtreadmill::characteristicChanged(const QLowEnergyCharacteristic &characteristic,
                                              const QByteArray &newValue) {
-    qDebug() << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
+    QZ_DEBUG << QStringLiteral("characteristicChanged ") + QString::number(characteristic.uuid().toUInt16()) +
                     QStringLiteral(" ") << newValue.toHex(' ');
     QByteArray reply;
 
@@ -297,7 +298,7 @@ void virtualtreadmill::characteristicChanged(const QLowEnergyCharacteristic &cha
                 return;
             }
             try {
-                qDebug() << QStringLiteral("virtualtreadmill::writeCharacteristic ") + serviceFTMS->serviceName() +
+                QZ_DEBUG << QStringLiteral("virtualtreadmill::writeCharacteristic ") + serviceFTMS->serviceName() +
                                 QStringLiteral(" ") + characteristic.name() + QStringLiteral(" ") + reply.toHex(' ');
                 serviceFTMS->writeCharacteristic(characteristic, reply); // Potentially causes notification.
             } catch (...) {
@@ -63,12 +63,22 @@ void WebServerInfoSender::innerStop() {
         httpServer->deleteLater();
         clients.clear();
         sendToClients.clear();
+        telemetryClients.clear();
         reply2Req.clear();
         innerTcpServer = 0;
         httpServer = 0;
     }
 }
 
+QByteArray WebServerInfoSender::requestHeader(const QHttpServerRequest &request, const QByteArray &name) {
+    const QVariantMap headers = request.headers();
+    for (auto i = headers.constBegin(); i != headers.constEnd(); ++i) {
+        if (!i.key().compare(QString::fromLatin1(name), Qt::CaseInsensitive))
+            return i.value().toByteArray();
+    }
+    return QByteArray();
+}
+
 bool WebServerInfoSender::init() {
     bool ok;
     folders = settings.value(QStringLiteral("template_") + templateId + QStringLiteral("_folders")).toStringList();
@@ -81,6 +91,7 @@ bool WebServerInfoSender::init() {
         if (!httpServer)
             httpServer = new QHttpServer(this);
         relative2Absolute.clear();
+        assets.clear();
         for (auto fld : folders) {
             idx = fld.lastIndexOf('/');
             qDebug() << QStringLiteral("Folder") << fld;
@@ -88,22 +99,21 @@ bool WebServerInfoSender::init() {
                 relative = fld.mid(idx + 1);
                 qDebug() << QStringLiteral("Relative") << relative;
                 relative2Absolute.insert(relative, fld);
+                assets.addFolder(relative, fld);
                 httpServer->route(QStringLiteral("/") + relative + QStringLiteral("/<arg>"),
                                   [this](const QUrl &url, const QHttpServerRequest &request) {
-                                      QUrl urlreq = request.url();
-                                      QString path = urlreq.path().mid(1);
-                                      int idxreq = path.indexOf('/');
-                                      QString reqId = idxreq < 0 ? path : path.mid(0, idxreq);
-                                      qDebug() << QStringLiteral("Path") << path << QStringLiteral("req") << reqId;
-                                      path = relative2Absolute.value(reqId);
-                                      if (path.isEmpty())
-                                          return QHttpServerResponse("text/plain", "Unautorized",
-                                                                     QHttpServerResponder::StatusCode::Forbidden);
-                                      else {
-                                          path += QStringLiteral("/%1").arg(url.path());
-                                          qDebug() << "File to look at:" << path;
-                                          return QHttpServerResponse::fromFile(path);
-                                      }
+                                      Q_UNUSED(url);
+                                      QString path = request.url().path();
+                                      qDebug() << QStringLiteral("Path") << path;
+                                      templateassets::response r = assets.respond(
+                                          path, requestHeader(request, "If-None-Match"),
+                                          requestHeader(request, "If-Modified-Since"),
+                                          requestHeader(request, "Accept-Encoding"));
+                                      QHttpServerResponse response(
+                                          r.mimeType, r.body, static_cast<QHttpServerResponder::StatusCode>(r.status));
+                                      for (const auto &h : qAsConst(r.headers))
+                                          response.addHeader(h.first, h.second);
+                                      return response;
                                   });
             }
         }
@@ -172,9 +182,66 @@ void WebServerInfoSender::processTextMessage(QString message) {
         pClient->sendTextMessage(message);
     }*/
     //qDebug() << QStringLiteral("Message received:") << message;
+    if (message.contains(QStringLiteral("\"telemetry\""))) {
+        QJsonObject json = QJsonDocument::fromJson(message.toUtf8()).object();
+        QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+        if (pClient && json[QStringLiteral("msg")].toString() == QStringLiteral("telemetry")) {
+            processTelemetryRequest(pClient, json[QStringLiteral("content")].toObject());
+            return;
+        }
+    }
     emit onDataReceived(message.toUtf8());
 }
 
+void WebServerInfoSender::processTelemetryRequest(QWebSocket *client, const QJsonObject &content) {
+    // {"rate": 4, "fields": ["watts", "cadence"]}: frames per second, from 1 to 10, 0 to stop; all the fields when
+    // the list is empty
+    double rate = content[QStringLiteral("rate")].toDouble();
+    QStringList fields;
+    for (const QJsonValue &v : content[QStringLiteral("fields")].toArray())
+        fields.append(v.toString());
+
+    QJsonObject reply, out;
+    out[QStringLiteral("version")] = telemetryschema::version;
+    if (rate > 0) {
+        rate = qBound(1.0, rate, 10.0);
+        telemetryclient c;
+        c.interval = qRound(1000.0 / rate);
+        // a key frame every 5 seconds
+        c.encoder = telemetryencoder(telemetryschema::mask(fields), qRound(rate * 5));
+        telemetryClients.insert(client, c);
+        client->sendBinaryMessage(telemetryschema::schema(c.encoder.fieldMask()));
+        out[QStringLiteral("rate")] = rate;
+    } else {
+        telemetryClients.remove(client);
+        out[QStringLiteral("rate")] = 0;
+    }
+    qDebug() << QStringLiteral("Telemetry") << client << QStringLiteral("rate") << rate << fields;
+    reply[QStringLiteral("msg")] = QStringLiteral("R_telemetry");
+    reply[QStringLiteral("content")] = out;
+    client->sendTextMessage(QJsonDocument(reply).toJson(QJsonDocument::Compact));
+    emit telemetryIntervalChanged();
+}
+
+int WebServerInfoSender::telemetryInterval() const {
+    int interval = 0;
+    for (const telemetryclient &c : telemetryClients) {
+        if (!interval || c.interval < interval)
+            interval = c.interval;
+    }
+    return interval;
+}
+
+void WebServerInfoSender::sendTelemetry(const QVector<double> &values, int tick) {
+    for (auto i = telemetryClients.begin(); i != telemetryClients.end(); ++i) {
+        telemetryclient &c = i.value();
+        if (c.last.isValid() && c.last.elapsed() + (tick / 2) < c.interval)
+            continue;
+        i.key()->sendBinaryMessage(c.encoder.encode(values));
+        c.last.start();
+    }
+}
+
 void WebServerInfoSender::processFetcherRequest(QString data) {
     processFetcher(qobject_cast<QWebSocket *>(sender()), data.toUtf8());
 }
@@ -241,6 +308,8 @@ void WebServerInfoSender::socketDisconnected() {
     qDebug() << QStringLiteral("socketDisconnected:") << pClient;
     if (pClient) {
         clients.removeAll(pClient);
+        if (telemetryClients.remove(pClient))
+            emit telemetryIntervalChanged();
         if (!sendToClients.removeAll(pClient)) {
             QMutableHashIterator<QNetworkReply *, QPair<QJsonObject, QWebSocket *>> i(reply2Req);
             while (i.hasNext()) {
@@ -1,6 +1,9 @@
 #ifndef WEBSERVERINFOSENDER_H
 #define WEBSERVERINFOSENDER_H
+#include "templateassets.h"
 #include "templateinfosender.h"
+#include "templatetelemetry.h"
+#include <QElapsedTimer>
 #include <QHttpServer>
 #include <QNetworkAccessManager>
 #include <QNetworkCookie>
@@ -23,12 +26,24 @@ class WebServerInfoSender : public TemplateInfoSender {
     virtual ~WebServerInfoSender();
     virtual bool isRunning() const;
     virtual bool send(const QString &data);
+    virtual int telemetryInterval() const;
+    virtual void sendTelemetry(const QVector<double> &values, int tick);
 
   private:
     QHttpServer *httpServer = 0;
     QStringList folders;
     bool listen();
+    static QByteArray requestHeader(const QHttpServerRequest &request, const QByteArray &name);
     void processFetcher(QWebSocket *sender, const QByteArray &data);
+    void processTelemetryRequest(QWebSocket *client, const QJsonObject &content);
+    class telemetryclient {
+      public:
+        telemetryencoder encoder;
+        int interval = 1000;
+        QElapsedTimer last;
+    };
+    // the clients that asked for the binary telemetry, with their rate and their fields
+    QHash<QWebSocket *, telemetryclient> telemetryClients;
     QTimer watchdogTimer;
 
   protected:
@@ -40,6 +55,7 @@ class WebServerInfoSender : public TemplateInfoSender {
     QNetworkAccessManager *fetcher = 0;
     QList<QWebSocket *> sendToClients;
     QHash<QString, QString> relative2Absolute;
+    templateassets assets;
     QHash<QNetworkReply *, QPair<QJsonObject, QWebSocket *>> reply2Req;
   private slots:
     void acceptError(QAbstractSocket::SocketError socketError);
@@ -1,5 +1,6 @@
 #include "windows_zwift_incline_paddleocr_thread.h"
 #include "devices/elliptical.h"
+#include "qztrace.h"
 #if __has_include("aiserver.h")
 #include "aiserver.h"
 #endif
@@ -19,7 +20,7 @@ using namespace std::chrono_literals;
 
 windows_zwift_incline_paddleocr_thread::windows_zwift_incline_paddleocr_thread(bluetoothdevice *device) {
     this->device = device;
-    emit debug("windows_zwift_incline_paddleocr_thread created!");
+    QZ_EMIT_DEBUG("windows_zwift_incline_paddleocr_thread created!");
 }
 
 void windows_zwift_incline_paddleocr_thread::run() {
@@ -31,7 +32,7 @@ void windows_zwift_incline_paddleocr_thread::run() {
         else
             ret = runPython("zwift-incline.py");
         if (!ret.toUpper().contains("NONE") && ret.length() > 0) {
-            emit debug("windows_zwift_incline_paddleocr_thread onInclination " + QString::number(ret.toFloat()));
+            QZ_EMIT_DEBUG("windows_zwift_incline_paddleocr_thread onInclination " + QString::number(ret.toFloat()));
             emit onInclination(ret.toFloat(), ret.toFloat());
         }
         msleep(100);
@@ -60,8 +61,8 @@ QString windows_zwift_incline_paddleocr_thread::runPython(QString command) {
     QString out = process.readAllStandardOutput();
     QString err = process.readAllStandardError();
 
-    emit debug("python << OUT " + out);
-    emit debug("python << ERR " + err);
+    QZ_EMIT_DEBUG("python << OUT " + out);
+    QZ_EMIT_DEBUG("python << ERR " + err);
 #else
     QString out;
 #endif
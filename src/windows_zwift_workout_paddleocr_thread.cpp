@@ -1,6 +1,7 @@
 #include "windows_zwift_workout_paddleocr_thread.h"
 #include "devices/elliptical.h"
 #include "devices/treadmill.h"
+#include "qztrace.h"
 #if __has_include("aiserver.h")
 #include "aiserver.h"
 #endif
@@ -19,7 +20,7 @@ using namespace std::chrono_literals;
 
 windows_zwift_workout_paddleocr_thread::windows_zwift_workout_paddleocr_thread(bluetoothdevice *device) {
     this->device = device;
-    emit debug("windows_zwift_workout_paddleocr_thread created!");
+    QZ_EMIT_DEBUG("windows_zwift_workout_paddleocr_thread created!");
 }
 
 void windows_zwift_workout_paddleocr_thread::run() {
@@ -30,8 +31,8 @@ void windows_zwift_workout_paddleocr_thread::run() {
         if (ret.length() > 0) {
             QStringList list = ret.split(";");
             if (list.length() >= 2) {
-                emit debug("windows_zwift_workout_paddleocr_thread onInclination " + list.at(1) + " onSpeed " +
-                           list.at(0).toFloat());
+                QZ_EMIT_DEBUG("windows_zwift_workout_paddleocr_thread onInclination " + list.at(1) + " onSpeed " +
+                              list.at(0).toFloat());
                 if (!list.at(1).toUpper().contains("NONE")) {
                     float inc = list.at(1).toFloat();
                     if (inc != lastInclination)
@@ -71,8 +72,8 @@ QString windows_zwift_workout_paddleocr_thread::runPython(QString command) {
     QString out = process.readAllStandardOutput();
     QString err = process.readAllStandardError();
 
-    emit debug("python << OUT " + out);
-    emit debug("python << ERR " + err);
+    QZ_EMIT_DEBUG("python << OUT " + out);
+    QZ_EMIT_DEBUG("python << ERR " + err);
 #else
     QString out;
 #endif
@@ -0,0 +1,188 @@
+#include "workoutfinalizer.h"
+#include "gpx.h"
+#include "metric.h"
+#include "qfit.h"
+#include "qzsettings.h"
+#include <QDebug>
+#include <QFile>
+#include <QMutexLocker>
+#include <QSettings>
+#include <QThread>
+
+static const int WorkoutSummaryTypeId = qRegisterMetaType<workoutsummary>();
+
+workoutsummary workoutsummary::compute(QList<SessionLine> *session) {
+    workoutsummary s;
+    s.peak5s = metric::powerPeak(session, 5);
+    s.peak1m = metric::powerPeak(session, 60);
+    s.peak5m = metric::powerPeak(session, 5 * 60);
+    s.peak20m = metric::powerPeak(session, 20 * 60);
+
+    // same formula as metric::calculateVO2Max, reusing the 5 minutes peak instead of scanning the session again
+    QSettings settings;
+    double weight = settings.value(QZSettings::weight, QZSettings::default_weight).toFloat();
+    s.vo2max = ((0.0108 * s.peak5m + 0.007 * weight) / weight) * 1000.0;
+    s.valid = true;
+    return s;
+}
+
+workoutfinalizer::workoutfinalizer(QObject *parent) : QObject(parent) {
+    // the stages are I/O bound or short scans: a couple of threads are enough and keep the UI thread free
+    pool.setMaxThreadCount(qMax(2, QThread::idealThreadCount() / 2));
+}
+
+workoutfinalizer::~workoutfinalizer() {
+    // the FIT files queued are always completed
+    pool.waitForDone();
+}
+
+void workoutfinalizer::start(const QSharedPointer<const workoutsnapshot> &snapshot) {
+    if (snapshot.isNull())
+        return;
+
+    if (!isRunning()) {
+        m_done = 0;
+        m_total = 0;
+    }
+    m_run++;
+    {
+        QMutexLocker locker(&summaryMutex);
+        m_summary = workoutsummary();
+    }
+
+    qDebug() << QStringLiteral("workoutfinalizer: starting with") << snapshot->session.count() << "samples"
+             << QStringLiteral("run") << m_run.load() << QStringLiteral("pending") << m_pending.load();
+
+    if (!snapshot->fitFilename.isEmpty()) {
+        // the user would lose the workout otherwise: the journal is removed only when the FIT file is written
+        runStage(
+            QStringLiteral("fit"),
+            [this, snapshot]() {
+                qfit::save(snapshot->fitFilename, snapshot->session, snapshot->deviceType, snapshot->processFlag,
+                           snapshot->workoutType, snapshot->workoutName, snapshot->deviceName);
+                emit fitSaved(snapshot->fitFilename);
+            },
+            false);
+    }
+
+    if (!snapshot->gpxFilename.isEmpty()) {
+        runStage(QStringLiteral("gpx"),
+                 [snapshot]() { gpx::save(snapshot->gpxFilename, snapshot->session, snapshot->deviceType); });
+    }
+
+    runStage(
+        QStringLiteral("summary"),
+        [this, snapshot]() {
+            QList<SessionLine> session = snapshot->session;
+            workoutsummary s = workoutsummary::compute(&session);
+            {
+                QMutexLocker locker(&summaryMutex);
+                m_summary = s;
+            }
+            emit summaryReady(s);
+        },
+        false);
+}
+
+bool workoutfinalizer::runStage(const QString &name, std::function<void()> stage, bool cancellable) {
+    if (cancellable && isCancelled()) {
+        qDebug() << QStringLiteral("workoutfinalizer: cancelled, skipping stage") << name;
+        return false;
+    }
+
+    m_pending++;
+    m_total++;
+    int run = m_run.load();
+    pool.start([this, name, stage, run, cancellable]() {
+        if (!cancellable || m_cancelledRun.load() != run) {
+            qDebug() << QStringLiteral("workoutfinalizer: stage") << name << QStringLiteral("started");
+            stage();
+        } else {
+            qDebug() << QStringLiteral("workoutfinalizer: stage") << name << QStringLiteral("cancelled");
+        }
+        stageDone(name);
+    });
+    return true;
+}
+
+void workoutfinalizer::stageDone(const QString &name) {
+    m_done++;
+    // signals emitted from the pool are queued to the receivers living on the UI thread
+    emit progressChanged(progress(), name);
+    if (--m_pending == 0) {
+        bool cancelled = isCancelled();
+        qDebug() << QStringLiteral("workoutfinalizer: finished, cancelled") << cancelled;
+        emit finished(cancelled);
+    }
+}
+
+void workoutfinalizer::cancel() {
+    qDebug() << QStringLiteral("workoutfinalizer: cancel requested");
+    // queued stages are not removed from the pool: they see the flag and skip, so finished() is always emitted
+    if (isRunning())
+        m_cancelledRun = m_run.load();
+}
+
+void workoutfinalizer::waitForDone() { pool.waitForDone(); }
+
+int workoutfinalizer::progress() const {
+    int total = m_total.load();
+    if (total == 0)
+        return 100;
+    return (m_done.load() * 100) / total;
+}
+
+workoutsummary workoutfinalizer::summary() {
+    QMutexLocker locker(&summaryMutex);
+    return m_summary;
+}
+
+QString workoutfinalizer::pendingUpload() {
+    QSettings settings;
+    QString f =
+        settings.value(QZSettings::strava_pending_upload, QZSettings::default_strava_pending_upload).toString();
+    if (!f.isEmpty() && !QFile::exists(f)) {
+        qDebug() << QStringLiteral("workoutfinalizer: pending upload file is gone") << f;
+        clearPendingUpload();
+        return QLatin1String("");
+    }
+    int attempts =
+        settings.value(QZSettings::strava_pending_upload_attempts, QZSettings::default_strava_pending_upload_attempts)
+            .toInt();
+    if (!f.isEmpty() && attempts >= maxUploadAttempts) {
+        qDebug() << QStringLiteral("workoutfinalizer: pending upload given up after") << attempts
+                 << QStringLiteral("attempts") << f;
+        clearPendingUpload();
+        return QLatin1String("");
+    }
+    return f;
+}
+
+void workoutfinalizer::setPendingUpload(const QString &filename) {
+    QSettings settings;
+    // the same file again is a retry
+    int attempts = 1;
+    if (settings.value(QZSettings::strava_pending_upload, QZSettings::default_strava_pending_upload).toString() ==
+        filename)
+        attempts += settings
+                        .value(QZSettings::strava_pending_upload_attempts,
+                               QZSettings::default_strava_pending_upload_attempts)
+                        .toInt();
+    settings.setValue(QZSettings::strava_pending_upload, filename);
+    settings.setValue(QZSettings::strava_pending_upload_attempts, attempts);
+}
+
+void workoutfinalizer::clearPendingUpload() {
+    QSettings settings;
+    settings.setValue(QZSettings::strava_pending_upload, QZSettings::default_strava_pending_upload);
+    settings.setValue(QZSettings::strava_pending_upload_attempts, QZSettings::default_strava_pending_upload_attempts);
+}
+
+int workoutfinalizer::pendingUploadDelay() {
+    QSettings settings;
+    int attempts =
+        settings.value(QZSettings::strava_pending_upload_attempts, QZSettings::default_strava_pending_upload_attempts)
+            .toInt();
+    // 10 seconds, then 20, 40, 80...
+    return 10000 << qBound(0, attempts - 1, maxUploadAttempts);
+}
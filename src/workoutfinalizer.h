@@ -0,0 +1,93 @@
+#ifndef WORKOUTFINALIZER_H
+#define WORKOUTFINALIZER_H
+
+#include "devices/bluetoothdevice.h"
+#include "fit_profile.hpp"
+#include "sessionline.h"
+#include <QMutex>
+#include <QObject>
+#include <QSharedPointer>
+#include <QThreadPool>
+#include <atomic>
+#include <functional>
+
+// immutable copy of everything the finalization stages need. It is built once on the UI thread when the workout
+// stops and then shared (read only) by every stage running on the worker pool.
+class workoutsnapshot {
+  public:
+    QList<SessionLine> session;
+    bluetoothdevice::BLUETOOTH_TYPE deviceType = bluetoothdevice::UNKNOWN;
+    uint32_t processFlag = 0;
+    FIT_SPORT workoutType = FIT_SPORT_INVALID;
+    QString workoutName;
+    QString deviceName;
+    QString fitFilename;
+    QString gpxFilename;
+};
+
+class workoutsummary {
+  public:
+    bool valid = false;
+    double vo2max = 0;
+    double peak5s = -1;
+    double peak1m = -1;
+    double peak5m = -1;
+    double peak20m = -1;
+
+    static workoutsummary compute(QList<SessionLine> *session);
+};
+
+Q_DECLARE_METATYPE(workoutsummary)
+
+class workoutfinalizer : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit workoutfinalizer(QObject *parent = nullptr);
+    ~workoutfinalizer();
+
+    // starts the FIT encode, the optional GPX encode and the summary stats in parallel on the worker pool. A run still
+    // in progress is not reset: its stages complete and the progress covers both runs.
+    void start(const QSharedPointer<const workoutsnapshot> &snapshot);
+    // queues an extra stage (for example the mail delivery) on the same pool. Returns false if cancelled. A stage that
+    // isn't cancellable always runs, even if queued after cancel().
+    bool runStage(const QString &name, std::function<void()> stage, bool cancellable = true);
+    // the cancellable stages not started yet of the current run are skipped, the FIT file and the summary are always
+    // completed. The next start() is not affected.
+    void cancel();
+    void waitForDone();
+
+    bool isRunning() const { return m_pending.load() > 0; }
+    bool isCancelled() const { return m_cancelledRun.load() == m_run.load(); }
+    int progress() const;
+    workoutsummary summary();
+
+    // upload state persisted across restarts so an interrupted Strava upload is retried at the next launch
+    static QString pendingUpload();
+    static void setPendingUpload(const QString &filename);
+    static void clearPendingUpload();
+    // the delay before the next try of the pending upload, it doubles at every failed try
+    static int pendingUploadDelay();
+    static const int maxUploadAttempts = 5;
+
+  signals:
+    void progressChanged(int percent, const QString &stage);
+    void fitSaved(const QString &filename);
+    void summaryReady(const workoutsummary &summary);
+    void finished(bool cancelled);
+
+  private:
+    void stageDone(const QString &name);
+
+    QThreadPool pool;
+    QMutex summaryMutex;
+    workoutsummary m_summary;
+    // every start() is a new run, cancel() marks the current one
+    std::atomic<int> m_run{0};
+    std::atomic<int> m_cancelledRun{-1};
+    std::atomic<int> m_pending{0};
+    std::atomic<int> m_total{0};
+    std::atomic<int> m_done{0};
+};
+
+#endif // WORKOUTFINALIZER_H
@@ -0,0 +1,330 @@
+#include "workoutlibrary.h"
+#include "qzsettings.h"
+#include "zwiftworkout.h"
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QSettings>
+#include <QThread>
+#include <cmath>
+
+workoutinfo workoutinfo::analyze(const QList<trainrow> &rows, double ftp) {
+    workoutinfo info;
+    info.ftp = ftp;
+    info.powerZones.fill(0, 7);
+    info.heartZones.fill(0, 5);
+
+    bool power = false, speed = false, resistance = false, heart = false;
+    QVector<double> watts;
+    for (const trainrow &r : rows) {
+        int seconds = (r.duration.hour() * 3600) + (r.duration.minute() * 60) + r.duration.second();
+        if (r.distance > 0)
+            info.distance += r.distance;
+        if (r.power >= 0)
+            power = true;
+        if (r.speed >= 0 || r.inclination >= -50)
+            speed = true;
+        if (r.resistance >= 0 || r.requested_peloton_resistance >= 0 || r.cadence >= 0)
+            resistance = true;
+        if (r.zoneHR > 0) {
+            heart = true;
+            info.heartZones[qMin<int>(r.zoneHR, 5) - 1] += seconds;
+        }
+        for (int i = 0; i < seconds; i++) {
+            watts.append(r.isRamp() ? r.at(i).power : r.power);
+        }
+    }
+    info.duration = watts.count();
+
+    if (power)
+        info.type = QStringLiteral("power");
+    else if (speed)
+        info.type = QStringLiteral("speed");
+    else if (resistance)
+        info.type = QStringLiteral("resistance");
+    else if (heart)
+        info.type = QStringLiteral("heart");
+
+    info.profile.reserve((watts.count() / profileStep) + 1);
+    for (int i = 0; i < watts.count(); i += profileStep) {
+        info.profile.append(watts.at(i));
+    }
+
+    if (!power || ftp <= 0)
+        return info;
+
+    // the coggan zones, in percent of the ftp
+    static const double zones[] = {0.55, 0.75, 0.90, 1.05, 1.20, 1.50};
+    for (double w : qAsConst(watts)) {
+        int z = 0;
+        while (z < 6 && w >= zones[z] * ftp)
+            z++;
+        info.powerZones[z]++;
+    }
+
+    // normalized power: the rolling 30 seconds average, to the fourth power
+    const int window = 30;
+    double sum = 0, fourth = 0;
+    int samples = 0;
+    for (int i = 0; i < watts.count(); i++) {
+        sum += qMax(0.0, watts.at(i));
+        if (i >= window)
+            sum -= qMax(0.0, watts.at(i - window));
+        if (i >= window - 1 || i == watts.count() - 1) {
+            double avg = sum / qMin(i + 1, window);
+            fourth += avg * avg * avg * avg;
+            samples++;
+        }
+    }
+    if (samples > 0) {
+        double np = std::pow(fourth / samples, 0.25);
+        info.intensityFactor = np / ftp;
+        info.tss = (info.duration * np * info.intensityFactor) / (ftp * 3600.0) * 100.0;
+    }
+    return info;
+}
+
+workoutinfo workoutinfo::analyze(const QString &fileName, const QString &extension, double ftp,
+                                 bluetoothdevice::BLUETOOTH_TYPE deviceType) {
+    QString description;
+    QString tags;
+    QList<trainrow> rows;
+    if (!extension.toUpper().compare(QStringLiteral("ZWO")))
+        rows = zwiftworkout::load(fileName, &description, &tags);
+    else
+        rows = trainprogram::loadXML(fileName, deviceType);
+
+    workoutinfo info = analyze(rows, ftp);
+    QFileInfo f(fileName);
+    info.fileName = fileName;
+    info.deviceType = deviceType;
+    info.size = f.size();
+    info.lastModified = f.lastModified();
+    info.description = description;
+    info.tags = tags;
+    return info;
+}
+
+QJsonObject workoutinfo::toJson() const {
+    QJsonObject json;
+    json[QStringLiteral("fileName")] = fileName;
+    json[QStringLiteral("size")] = size;
+    json[QStringLiteral("lastModified")] = lastModified.toMSecsSinceEpoch();
+    json[QStringLiteral("ftp")] = ftp;
+    json[QStringLiteral("deviceType")] = deviceType;
+    json[QStringLiteral("type")] = type;
+    json[QStringLiteral("duration")] = duration;
+    json[QStringLiteral("distance")] = distance;
+    json[QStringLiteral("description")] = description;
+    json[QStringLiteral("tags")] = tags;
+    json[QStringLiteral("if")] = intensityFactor;
+    json[QStringLiteral("tss")] = tss;
+    QJsonArray p, h, w;
+    for (int s : powerZones)
+        p.append(s);
+    for (int s : heartZones)
+        h.append(s);
+    for (double s : profile)
+        w.append(s);
+    json[QStringLiteral("powerZones")] = p;
+    json[QStringLiteral("heartZones")] = h;
+    json[QStringLiteral("profile")] = w;
+    return json;
+}
+
+workoutinfo workoutinfo::fromJson(const QJsonObject &json) {
+    workoutinfo info;
+    info.fileName = json[QStringLiteral("fileName")].toString();
+    info.size = static_cast<qint64>(json[QStringLiteral("size")].toDouble());
+    info.lastModified =
+        QDateTime::fromMSecsSinceEpoch(static_cast<qint64>(json[QStringLiteral("lastModified")].toDouble()));
+    info.ftp = json[QStringLiteral("ftp")].toDouble();
+    info.deviceType =
+        static_cast<bluetoothdevice::BLUETOOTH_TYPE>(json[QStringLiteral("deviceType")].toInt(bluetoothdevice::BIKE));
+    info.type = json[QStringLiteral("type")].toString();
+    info.duration = json[QStringLiteral("duration")].toInt();
+    info.distance = json[QStringLiteral("distance")].toDouble();
+    info.description = json[QStringLiteral("description")].toString();
+    info.tags = json[QStringLiteral("tags")].toString();
+    info.intensityFactor = json[QStringLiteral("if")].toDouble();
+    info.tss = json[QStringLiteral("tss")].toDouble();
+    for (const QJsonValue &v : json[QStringLiteral("powerZones")].toArray())
+        info.powerZones.append(v.toInt());
+    for (const QJsonValue &v : json[QStringLiteral("heartZones")].toArray())
+        info.heartZones.append(v.toInt());
+    for (const QJsonValue &v : json[QStringLiteral("profile")].toArray())
+        info.profile.append(v.toDouble());
+    return info;
+}
+
+workoutlibrary::workoutlibrary(const QString &indexFileName, QObject *parent)
+    : QObject(parent), indexFileName(indexFileName) {
+    // the programs are small files: a couple of threads index a folder without slowing the ui
+    pool.setMaxThreadCount(qMax(2, QThread::idealThreadCount() / 2));
+
+    saveTimer.setSingleShot(true);
+    saveTimer.setInterval(2000);
+    connect(&saveTimer, &QTimer::timeout, this, &workoutlibrary::save);
+    // emitted by the pool, queued here
+    connect(this, &workoutlibrary::indexed, &saveTimer, [this]() { saveTimer.start(); });
+    connect(&watcher, &QFileSystemWatcher::directoryChanged, this, &workoutlibrary::scan);
+
+    QFile input(indexFileName);
+    if (input.open(QIODevice::ReadOnly)) {
+        const QJsonArray entries = QJsonDocument::fromJson(input.readAll()).array();
+        for (const QJsonValue &v : entries) {
+            workoutinfo info = workoutinfo::fromJson(v.toObject());
+            if (info.isValid())
+                index.insert(info.fileName, info);
+        }
+        qDebug() << QStringLiteral("workoutlibrary: index loaded") << index.count();
+    }
+}
+
+workoutlibrary::~workoutlibrary() {
+    pool.clear();
+    pool.waitForDone();
+    if (saveTimer.isActive())
+        save();
+}
+
+double workoutlibrary::currentFtp() const {
+    QSettings settings;
+    return settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+}
+
+void workoutlibrary::addFolder(const QString &path) {
+    QDir().mkpath(path);
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+    QStringList folders = {path};
+    while (it.hasNext())
+        folders.append(it.next());
+    watcher.addPaths(folders);
+    for (const QString &folder : qAsConst(folders))
+        scan(folder);
+}
+
+void workoutlibrary::setDeviceType(bluetoothdevice::BLUETOOTH_TYPE type) {
+    {
+        QMutexLocker locker(&mutex);
+        if (deviceType == type)
+            return;
+        deviceType = type;
+    }
+    const QStringList folders = watcher.directories();
+    for (const QString &folder : folders)
+        scan(folder);
+}
+
+void workoutlibrary::scan(const QString &path) {
+    double ftp = currentFtp();
+    QDir dir(path);
+    const QFileInfoList files =
+        dir.entryInfoList({QStringLiteral("*.xml"), QStringLiteral("*.zwo")}, QDir::Files | QDir::Readable);
+    // a new subfolder is watched too
+    for (const QFileInfo &d : dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+        if (!watcher.directories().contains(d.absoluteFilePath()))
+            addFolder(d.absoluteFilePath());
+    }
+
+    QMutexLocker locker(&mutex);
+    // the programs removed from the folder
+    QString prefix = dir.absolutePath() + QStringLiteral("/");
+    bool removed = false;
+    for (auto i = index.begin(); i != index.end();) {
+        if (i.key().startsWith(prefix) && !i.key().mid(prefix.length()).contains(QLatin1Char('/')) &&
+            !QFile::exists(i.key())) {
+            i = index.erase(i);
+            removed = true;
+        } else {
+            ++i;
+        }
+    }
+    if (removed)
+        saveTimer.start();
+
+    for (const QFileInfo &f : files) {
+        QString fileName = f.absoluteFilePath();
+        auto i = index.constFind(fileName);
+        if (i != index.constEnd() && i->size == f.size() && i->lastModified == f.lastModified() && i->ftp == ftp &&
+            i->deviceType == deviceType)
+            continue;
+
+        enqueue(fileName, f.suffix(), ftp);
+    }
+}
+
+void workoutlibrary::enqueue(const QString &fileName, const QString &extension, double ftp) {
+    QString key = QFileInfo(fileName).absoluteFilePath();
+    if (pending.contains(key))
+        return;
+
+    pending.insert(key);
+    bluetoothdevice::BLUETOOTH_TYPE type = deviceType;
+    pool.start([this, fileName, key, extension, ftp, type]() {
+        workoutinfo info = workoutinfo::analyze(fileName, extension, ftp, type);
+        {
+            QMutexLocker locker(&mutex);
+            pending.remove(key);
+            index.insert(key, info);
+        }
+        emit indexed(key);
+    });
+}
+
+void workoutlibrary::request(const QString &fileName, const QString &extension) {
+    double ftp = currentFtp();
+    QMutexLocker locker(&mutex);
+    enqueue(fileName, extension, ftp);
+}
+
+workoutinfo workoutlibrary::info(const QString &fileName) const {
+    QMutexLocker locker(&mutex);
+    workoutinfo i = index.value(QFileInfo(fileName).absoluteFilePath());
+    if (i.isValid() && (i.ftp != currentFtp() || i.deviceType != deviceType))
+        return workoutinfo();
+    return i;
+}
+
+void workoutlibrary::insert(const workoutinfo &info) {
+    if (!info.isValid())
+        return;
+    {
+        QMutexLocker locker(&mutex);
+        index.insert(QFileInfo(info.fileName).absoluteFilePath(), info);
+    }
+    saveTimer.start();
+}
+
+QList<workoutinfo> workoutlibrary::search(const QString &text) const {
+    QList<workoutinfo> l;
+    QMutexLocker locker(&mutex);
+    for (const workoutinfo &i : index) {
+        if (text.isEmpty() || QFileInfo(i.fileName).completeBaseName().contains(text, Qt::CaseInsensitive) ||
+            i.description.contains(text, Qt::CaseInsensitive) || i.tags.contains(text, Qt::CaseInsensitive))
+            l.append(i);
+    }
+    return l;
+}
+
+void workoutlibrary::waitForDone() { pool.waitForDone(); }
+
+void workoutlibrary::save() {
+    QJsonArray entries;
+    {
+        QMutexLocker locker(&mutex);
+        for (const workoutinfo &i : qAsConst(index))
+            entries.append(i.toJson());
+    }
+    QDir().mkpath(QFileInfo(indexFileName).absolutePath());
+    QSaveFile output(indexFileName);
+    QByteArray data = QJsonDocument(entries).toJson(QJsonDocument::Compact);
+    if (!output.open(QIODevice::WriteOnly) || output.write(data) != data.size() || !output.commit())
+        qDebug() << QStringLiteral("workoutlibrary: unable to save the index") << indexFileName;
+}
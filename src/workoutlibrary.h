@@ -0,0 +1,96 @@
+#ifndef WORKOUTLIBRARY_H
+#define WORKOUTLIBRARY_H
+
+#include "trainprogram.h"
+#include <QDateTime>
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QJsonObject>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QThreadPool>
+#include <QTimer>
+#include <QVector>
+
+// what the library knows of a training program, so that the list and the preview don't need to load it
+class workoutinfo {
+  public:
+    QString fileName;
+    qint64 size = 0;
+    QDateTime lastModified;
+    double ftp = 0; // the ftp of the intensity and the zones
+    // the rows of a program are loaded for a device type
+    bluetoothdevice::BLUETOOTH_TYPE deviceType = bluetoothdevice::BIKE;
+
+    QString type; // power, speed, resistance, heart, or empty for a program without targets
+    int duration = 0;    // seconds
+    double distance = 0; // km
+    QString description;
+    QString tags;
+    double intensityFactor = 0;
+    double tss = 0;
+    QVector<int> powerZones; // seconds in the 7 power zones, from the ftp
+    QVector<int> heartZones; // seconds in the 5 heart rate zones of the rows
+    // the target watts every profileStep seconds, for the preview graph
+    QVector<double> profile;
+    static const int profileStep = 10;
+
+    bool isValid() const { return !fileName.isEmpty(); }
+
+    static workoutinfo analyze(const QList<trainrow> &rows, double ftp);
+    // loads the program; the extension is apart, since the Android content URIs don't have it
+    static workoutinfo analyze(const QString &fileName, const QString &extension, double ftp,
+                               bluetoothdevice::BLUETOOTH_TYPE deviceType);
+
+    QJsonObject toJson() const;
+    static workoutinfo fromJson(const QJsonObject &json);
+};
+
+/**
+ * @brief The training programs of the folders, indexed on a thread pool while the folders are watched. The index is
+ * saved on the disk, so the programs are loaded only when they are new or changed.
+ */
+class workoutlibrary : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit workoutlibrary(const QString &indexFileName, QObject *parent = nullptr);
+    ~workoutlibrary();
+
+    // indexes the programs of the folder and of its subfolders, and then the ones that change
+    void addFolder(const QString &path);
+    // the programs are indexed again for the device connected
+    void setDeviceType(bluetoothdevice::BLUETOOTH_TYPE type);
+    // invalid if the program is not indexed yet
+    workoutinfo info(const QString &fileName) const;
+    // indexes a program that is not in the folders; indexed() is emitted when it's done
+    void request(const QString &fileName, const QString &extension);
+    void insert(const workoutinfo &info);
+    // the indexed programs with the text in the name, in the description or in the tags
+    QList<workoutinfo> search(const QString &text) const;
+    void waitForDone();
+
+  signals:
+    void indexed(const QString &fileName);
+
+  private slots:
+    void scan(const QString &path);
+    void save();
+
+  private:
+    double currentFtp() const;
+    // with the mutex locked
+    void enqueue(const QString &fileName, const QString &extension, double ftp);
+    QString indexFileName;
+    QFileSystemWatcher watcher;
+    QThreadPool pool;
+    mutable QMutex mutex;
+    QHash<QString, workoutinfo> index;
+    QSet<QString> pending;
+    bluetoothdevice::BLUETOOTH_TYPE deviceType = bluetoothdevice::BIKE;
+    // the index is written once the programs of a scan are done
+    QTimer saveTimer;
+};
+
+#endif // WORKOUTLIBRARY_H
@@ -0,0 +1,119 @@
+#include "zwiftplayerstate.h"
+#include <cstring>
+
+namespace {
+
+enum wireType { VARINT = 0, FIXED64 = 1, LENGTH_DELIMITED = 2, FIXED32 = 5 };
+
+bool readVarint(const quint8 *&p, const quint8 *end, quint64 *value) {
+    quint64 v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p >= end)
+            return false;
+        quint8 b = *p++;
+        v |= (quint64)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            *value = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+float toFloat(quint32 bits) {
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+} // namespace
+
+bool zwiftplayerstate::decode(const char *data, int len, zwiftplayerstate *state) {
+    const quint8 *p = reinterpret_cast<const quint8 *>(data);
+    const quint8 *end = p + len;
+
+    while (p < end) {
+        quint64 key;
+        if (!readVarint(p, end, &key))
+            return false;
+        int field = key >> 3;
+        quint64 v = 0;
+
+        switch (key & 7) {
+        case VARINT:
+            if (!readVarint(p, end, &v))
+                return false;
+            break;
+        case FIXED64:
+            if (end - p < 8)
+                return false;
+            for (int i = 7; i >= 0; i--)
+                v = (v << 8) | p[i];
+            p += 8;
+            break;
+        case FIXED32:
+            if (end - p < 4)
+                return false;
+            v = (quint32)p[0] | ((quint32)p[1] << 8) | ((quint32)p[2] << 16) | ((quint32)p[3] << 24);
+            p += 4;
+            break;
+        case LENGTH_DELIMITED:
+            if (!readVarint(p, end, &v) || v > (quint64)(end - p))
+                return false;
+            // no message or string field is needed
+            p += v;
+            continue;
+        default:
+            return false;
+        }
+
+        // the int32 fields keep the sign in the low 32 bits of the varint
+        switch (field) {
+        case 1:
+            state->id = (qint32)v;
+            break;
+        case 2:
+            state->worldTime = (qint64)v;
+            break;
+        case 3:
+            state->distance = (qint32)v;
+            break;
+        case 6:
+            state->speed = (qint32)v;
+            break;
+        case 9:
+            state->cadenceUHz = (qint32)v;
+            break;
+        case 11:
+            state->heartrate = (qint32)v;
+            break;
+        case 12:
+            state->power = (qint32)v;
+            break;
+        case 13:
+            state->heading = (qint64)v;
+            break;
+        case 15:
+            state->climbing = (qint32)v;
+            break;
+        case 16:
+            state->time = (qint32)v;
+            break;
+        case 25:
+            state->x = toFloat((quint32)v);
+            break;
+        case 26:
+            state->altitude = toFloat((quint32)v);
+            break;
+        case 27:
+            state->y = toFloat((quint32)v);
+            break;
+        case 31:
+            state->sport = (qint64)v;
+            break;
+        default:
+            break;
+        }
+    }
+    return true;
+}
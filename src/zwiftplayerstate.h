@@ -0,0 +1,41 @@
+#ifndef ZWIFTPLAYERSTATE_H
+#define ZWIFTPLAYERSTATE_H
+
+#include <QByteArray>
+#include <QtGlobal>
+
+/**
+ * @brief The fields of the PlayerState message of zwift_messages.proto that QZ needs, decoded by hand from the
+ * protobuf wire format, so every platform shares the same code without the protobuf runtime. The other fields are
+ * skipped.
+ */
+class zwiftplayerstate {
+  public:
+    qint32 id = 0;
+    qint64 worldTime = 0;
+    // Units: meters
+    qint32 distance = 0;
+    // Units: mm/h
+    qint32 speed = 0;
+    qint32 cadenceUHz = 0;
+    qint32 heartrate = 0;
+    qint32 power = 0;
+    qint64 heading = 0;
+    qint32 climbing = 0;
+    qint32 time = 0;
+    float x = 0;
+    float altitude = 0;
+    float y = 0;
+    qint64 sport = 0;
+
+    /**
+     * @brief decode Parses a PlayerState message.
+     * @return false if the message is truncated or malformed, state is then partially filled.
+     */
+    static bool decode(const char *data, int len, zwiftplayerstate *state);
+    static bool decode(const QByteArray &buffer, zwiftplayerstate *state) {
+        return decode(buffer.constData(), buffer.size(), state);
+    }
+};
+
+#endif // ZWIFTPLAYERSTATE_H
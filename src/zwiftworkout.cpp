@@ -126,43 +126,30 @@ void zwiftworkout::convertTag(double thresholdSecPerKm, const QString &sportType
         Pace = va_arg(args, int);
         Cadence = va_arg(args, int);
         Incline = va_arg(args, double);
-        if (sportType.toLower().contains(QStringLiteral("run")) && !durationAsDistance(sportType, durationType)) {
-            double speed = speedFromPace(Pace);
-            int speedDelta = qAbs(qCeil((((60.0 / speed) * 60.0) * (PowerHigh - PowerLow)) * 10)) + 1;
-            int durationStep = Duration / speedDelta;
-            int spareSeconds = Duration - (durationStep * speedDelta);
-            int spareSum = 0;
-            for (int i = 0; i < speedDelta; i++) {
-                trainrow row;
-                int spare = 0;
-                if (spareSeconds)
-                    spare = (i % spareSeconds == 0 && i > 0) ? 1 : 0;
-                spareSum += spare;
-                row.duration = QTime(0, 0, 0, 0).addSecs(durationStep + spare);
-                row.rampElapsed = QTime(0, 0, 0, 0).addSecs((durationStep * i) + spareSum);
-                row.rampDuration = QTime(0, 0, 0, 0).addSecs(Duration - (durationStep * i) - spareSum);
+        if (!durationAsDistance(sportType, durationType)) {
+            // a single row, the targets are interpolated while it runs
+            trainrow row;
+            row.duration = QTime(0, 0, 0, 0).addSecs(Duration);
+            if (sportType.toLower().contains(QStringLiteral("run"))) {
+                double speed = speedFromPace(Pace);
                 row.forcespeed = 1;
-                if (!qstricmp(tag, "Ramp") || !qstricmp(tag, "Warmup")) {
-                    row.speed = (double)qFloor(((((60.0 / speed) * 60.0) * (PowerLow)) + (0.1 * i)) * 10.0) / 10.0;
-                } else {
-                    row.speed = (double)qFloor(((((60.0 / speed) * 60.0) * (PowerLow)) - (0.1 * i)) * 10.0) / 10.0;
-                }
-                if(Incline != -100)
-                    row.inclination = Incline * 100;
-                qDebug() << "TrainRow" << row.toString();
-                list.append(row);
+                row.speed = (double)qFloor((((60.0 / speed) * 60.0) * PowerLow) * 10.0) / 10.0;
+                row.speedTo = (double)qFloor((((60.0 / speed) * 60.0) * PowerHigh) * 10.0) / 10.0;
+            } else {
+                row.power = PowerLow * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
+                row.powerTo = PowerHigh * settings.value(QZSettings::ftp, QZSettings::default_ftp).toDouble();
             }
-
+            if(Cadence != -1)
+                row.cadence = Cadence;
+            if(Incline != -100)
+                row.inclination = Incline * 100;
+            qDebug() << "TrainRow" << row.toString();
+            list.append(row);
         } else {
+            // a row for each meter, the ramps are interpolated on the time only
             for (uint32_t i = 0; i < Duration; i++) {
                 trainrow row;
-                if (!durationAsDistance(sportType, durationType)) {
-                    row.duration = QTime(0, 0, 1, 0);
-                    row.rampDuration = QTime((Duration - i) / 3600, (Duration - i) / 60, (Duration - i) % 60, 0);
-                    row.rampElapsed = QTime(i / 3600, i / 60, i % 60, 0);
-                } else {
-                    row.distance = 0.001;
-                }
+                row.distance = 0.001;
                 if(Cadence != -1)
                     row.cadence = Cadence;
                 if (PowerHigh > PowerLow) {
@@ -0,0 +1,61 @@
+#include "zwiftworldstate.h"
+#include "zwift-api/PlayerStateWrapper.h"
+#include "qztrace.h"
+#include <QDebug>
+#include <QMutexLocker>
+
+zwiftworldstate::zwiftworldstate(QObject *parent) : QObject(parent) {
+    m_thread.setObjectName(QStringLiteral("zwiftworldstate"));
+    m_worker = new QObject();
+    m_worker->moveToThread(&m_thread);
+    m_thread.start();
+}
+
+zwiftworldstate::~zwiftworldstate() {
+    // the network objects must be deleted on their thread
+    QMetaObject::invokeMethod(m_worker, [this]() {
+        delete m_world;
+        m_world = nullptr;
+    }, Qt::BlockingQueuedConnection);
+    m_thread.quit();
+    m_thread.wait();
+    delete m_worker;
+}
+
+void zwiftworldstate::poll(const QString &accessToken, int playerId) {
+    if (m_busy.exchange(true))
+        return;
+
+    QMetaObject::invokeMethod(m_worker, [this, accessToken, playerId]() {
+        if (!m_world || m_token != accessToken) {
+            delete m_world;
+            m_world = new World(1, accessToken);
+            m_token = accessToken;
+        }
+        QByteArray bb = m_world->playerStatus(playerId);
+        QZ_DEBUG << " ZWIFT API PROTOBUF << " + bb.toHex(' ');
+        if (!bb.isEmpty() && update(playerId, bb))
+            emit playerUpdated(playerId);
+        m_busy = false;
+    });
+}
+
+bool zwiftworldstate::update(int playerId, const QByteArray &buffer) {
+    zwiftplayerstate state;
+    if (!zwiftplayerstate::decode(buffer, &state)) {
+        qDebug() << "Error parsing PlayerState";
+        return false;
+    }
+    QMutexLocker locker(&m_mutex);
+    m_players.insert(playerId, state);
+    return true;
+}
+
+bool zwiftworldstate::player(int playerId, zwiftplayerstate *state) const {
+    QMutexLocker locker(&m_mutex);
+    auto it = m_players.constFind(playerId);
+    if (it == m_players.constEnd())
+        return false;
+    *state = it.value();
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef ZWIFTWORLDSTATE_H
+#define ZWIFTWORLDSTATE_H
+
+#include "zwiftplayerstate.h"
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QThread>
+#include <atomic>
+
+class World;
+
+/**
+ * @brief The last state of the Zwift players, shared by everything that reads the Zwift API. The requests and the
+ * decoding run on a worker thread, so the UI thread doesn't wait for the network; playerUpdated is emitted from the
+ * worker thread when a new state is stored.
+ */
+class zwiftworldstate : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit zwiftworldstate(QObject *parent = nullptr);
+    ~zwiftworldstate();
+
+    // fetches the state of the player; ignored while the previous fetch is running
+    void poll(const QString &accessToken, int playerId);
+    bool busy() const { return m_busy.load(); }
+
+    // decodes a PlayerState message and stores it, thread safe
+    bool update(int playerId, const QByteArray &buffer);
+    bool player(int playerId, zwiftplayerstate *state) const;
+
+  signals:
+    void playerUpdated(int playerId);
+
+  private:
+    QThread m_thread;
+    QObject *m_worker = nullptr;
+    // created and used on the worker thread only
+    World *m_world = nullptr;
+    QString m_token;
+    std::atomic<bool> m_busy{false};
+
+    mutable QMutex m_mutex;
+    QHash<int, zwiftplayerstate> m_players;
+};
+
+#endif // ZWIFTWORLDSTATE_H
@@ -0,0 +1,59 @@
+#include "bridgemachinetestsuite.h"
+
+#include <QFile>
+
+#include "Tools/testsettings.h"
+#include "qzsettings.h"
+
+BridgeMachineTestSuite::BridgeMachineTestSuite() {}
+
+QString BridgeMachineTestSuite::writeMachines(const QByteArray &json) {
+    QString filename = dir.filePath(QStringLiteral("bridge.json"));
+    QFile output(filename);
+    EXPECT_TRUE(output.open(QIODevice::WriteOnly));
+    output.write(json);
+    return filename;
+}
+
+void BridgeMachineTestSuite::test_load() {
+    QList<bridgemachine> machines = bridgemachine::load(this->writeMachines(
+        "{\"machines\": [{\"device\": \"KICKR BIKE 1234\", \"dirconPort\": 40000, \"dirconId\": 7, "
+        "\"mac\": \"AA:BB:CC:DD:EE:01\", \"resistanceOffset\": 2, \"resistanceGain\": 1.5, \"pollDeviceTime\": 100, "
+        "\"noWriteResistance\": true, \"noHeartService\": false}]}"));
+
+    ASSERT_EQ(1, machines.count());
+    EXPECT_EQ(QStringLiteral("KICKR BIKE 1234"), machines.at(0).device);
+    EXPECT_EQ(40000, machines.at(0).dircon.basePort);
+    EXPECT_EQ(7, machines.at(0).dircon.id);
+    EXPECT_EQ(QStringLiteral("AA:BB:CC:DD:EE:01"), machines.at(0).dircon.mac);
+    EXPECT_EQ(2, machines.at(0).resistanceOffset);
+    EXPECT_DOUBLE_EQ(1.5, machines.at(0).resistanceGain);
+    EXPECT_EQ(100u, machines.at(0).pollDeviceTime);
+    EXPECT_TRUE(machines.at(0).noWriteResistance);
+    EXPECT_FALSE(machines.at(0).noHeartService);
+}
+
+void BridgeMachineTestSuite::test_defaults() {
+    QList<bridgemachine> machines = bridgemachine::load(this->writeMachines(
+        "{\"machines\": [{\"device\": \"KICKR BIKE 1234\"}, {\"dirconPort\": 40000}, {\"device\": \"T9 TREADMILL\"}]}"));
+
+    ASSERT_EQ(2, machines.count());
+    EXPECT_EQ(QStringLiteral("T9 TREADMILL"), machines.at(1).device);
+    // 4 ports for each machine, and none of them shared
+    EXPECT_GE(machines.at(1).dircon.basePort - machines.at(0).dircon.basePort, 4);
+    EXPECT_NE(machines.at(0).dircon.id, machines.at(1).dircon.id);
+    EXPECT_NE(machines.at(0).dircon.mac, machines.at(1).dircon.mac);
+}
+
+void BridgeMachineTestSuite::test_virtualDevice() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.setValue(QZSettings::virtual_device_enabled, true);
+
+    QList<bridgemachine> machines = bridgemachine::load(
+        this->writeMachines("{\"machines\": [{\"device\": \"KICKR BIKE 1\"}, {\"device\": \"KICKR BIKE 2\"}]}"));
+    ASSERT_EQ(2, machines.count());
+    devicebridge bridge(machines);
+    EXPECT_FALSE(bridge.start());
+    EXPECT_EQ(0, bridge.connectedCount());
+}
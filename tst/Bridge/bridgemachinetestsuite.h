@@ -0,0 +1,47 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "devicebridge.h"
+
+#include <QTemporaryDir>
+
+class BridgeMachineTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+
+    /**
+     * @brief Writes the json of the machines to a file of the temporary folder.
+     */
+    QString writeMachines(const QByteArray &json);
+public:
+    BridgeMachineTestSuite();
+
+    /**
+     * @brief Test that the settings of a machine are read as written.
+     */
+    void test_load();
+
+    /**
+     * @brief Test that the machines without ports, id and mac get their own ones, and that a machine without the
+     * device name is skipped.
+     */
+    void test_defaults();
+
+    /**
+     * @brief Test that the bridge doesn't start while the virtual device of the settings is enabled.
+     */
+    void test_virtualDevice();
+
+};
+
+TEST_F(BridgeMachineTestSuite, TestLoad) {
+    this->test_load();
+}
+
+TEST_F(BridgeMachineTestSuite, TestDefaults) {
+    this->test_defaults();
+}
+
+TEST_F(BridgeMachineTestSuite, TestVirtualDevice) {
+    this->test_virtualDevice();
+}
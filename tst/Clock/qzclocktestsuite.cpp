@@ -0,0 +1,66 @@
+#include "qzclocktestsuite.h"
+#include "devices/fakebike/fakebike.h"
+#include "telemetryprofile.h"
+#include "Tools/testsettings.h"
+
+#include <QMetaObject>
+
+QZClockTestSuite::QZClockTestSuite() {
+    qzclock::setManual(true, 1000000000LL);
+}
+
+QZClockTestSuite::~QZClockTestSuite() {
+    qzclock::setManual(false);
+}
+
+void QZClockTestSuite::test_manual() {
+    EXPECT_TRUE(qzclock::isManual());
+    qint64 start = qzclock::nowNs();
+    EXPECT_EQ(1000000000LL, start);
+    EXPECT_EQ(1000, qzclock::nowMs());
+
+    // nothing moves until advance()
+    EXPECT_EQ(start, qzclock::nowNs());
+    EXPECT_DOUBLE_EQ(0.0, qzclock::msecsSince(start));
+
+    qzclock::advance(250000000LL);
+    EXPECT_EQ(start + 250000000LL, qzclock::nowNs());
+    EXPECT_DOUBLE_EQ(250.0, qzclock::msecsSince(start));
+    EXPECT_DOUBLE_EQ(0.25, qzclock::secondsSince(start));
+    EXPECT_DOUBLE_EQ(250.0, qzclock::msecsBetween(start, qzclock::nowNs()));
+    EXPECT_DOUBLE_EQ(-250.0, qzclock::msecsBetween(qzclock::nowNs(), start));
+
+    // back to the steady clock, which never goes backwards
+    qzclock::setManual(false);
+    EXPECT_FALSE(qzclock::isManual());
+    qint64 a = qzclock::nowNs();
+    qint64 b = qzclock::nowNs();
+    EXPECT_LE(a, b);
+}
+
+void QZClockTestSuite::test_driverDistance() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+
+    telemetryprofile profile(telemetryprofile::STEADY, 1);
+    fakebike bike(true, true, true);
+    bike.simulate(&profile, 1000);
+
+    // the first refresh starts the ride, the clock doesn't move so no distance is added
+    QMetaObject::invokeMethod(&bike, "update", Qt::DirectConnection);
+    EXPECT_DOUBLE_EQ(0.0, bike.currentDistance().value());
+
+    double expected = 0;
+    for (int i = 0; i < 60; i++) {
+        qzclock::advance(1000000000LL);
+        QMetaObject::invokeMethod(&bike, "update", Qt::DirectConnection);
+        // one second at the speed of the refresh. Units: km
+        expected += bike.currentSpeed().value() / 3600.0;
+        EXPECT_NEAR(expected, bike.currentDistance().value(), 1e-9) << "tick " << i;
+    }
+    EXPECT_GT(expected, 0.0);
+
+    // a refresh without any time passing adds nothing, whatever the wall clock did meanwhile
+    QMetaObject::invokeMethod(&bike, "update", Qt::DirectConnection);
+    EXPECT_NEAR(expected, bike.currentDistance().value(), 1e-9);
+}
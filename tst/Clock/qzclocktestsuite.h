@@ -0,0 +1,29 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "qzclock.h"
+
+class QZClockTestSuite: public testing::Test {
+public:
+    QZClockTestSuite();
+    ~QZClockTestSuite();
+
+    /**
+     * @brief Test that the manual clock only moves with advance(), and the helpers that measure from it.
+     */
+    void test_manual();
+
+    /**
+     * @brief Test that a driver integrates the distance over the qzclock time between its refreshes.
+     */
+    void test_driverDistance();
+
+};
+
+TEST_F(QZClockTestSuite, TestManual) {
+    this->test_manual();
+}
+
+TEST_F(QZClockTestSuite, TestDriverDistance) {
+    this->test_driverDistance();
+}
@@ -0,0 +1,132 @@
+#include "controlarbitertestsuite.h"
+
+ControlArbiterTestSuite::ControlArbiterTestSuite() {}
+
+void ControlArbiterTestSuite::test_priority() {
+    controlarbiter a;
+    a.share(controlarbiter::INCLINATION, controlarbiter::RESISTANCE);
+    a.setHoldTime(controlarbiter::PROGRAM, 30000);
+    a.setMinInterval(controlarbiter::RESISTANCE, 0);
+    a.setMinInterval(controlarbiter::INCLINATION, 0);
+
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::INCLINATION, 2, 2, 0));
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 10, 0, 1000));
+    EXPECT_EQ(controlarbiter::PROGRAM, a.owner(controlarbiter::INCLINATION, 1000));
+
+    // Zwift keeps sending the slope while the program holds the brake
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::EXTERNAL, controlarbiter::INCLINATION, 3, 3, 2000));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::EXTERNAL, controlarbiter::INCLINATION, 3, 3, 30999));
+    EXPECT_EQ(2u, a.rejected());
+
+    // the user wins over the program
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 12, 0, 5000));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 10, 0, 6000));
+    EXPECT_FALSE(a.allowed(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 6000));
+    EXPECT_TRUE(a.allowed(controlarbiter::USER, controlarbiter::INCLINATION, 6000));
+    EXPECT_TRUE(a.allowed(controlarbiter::INTERNAL, controlarbiter::RESISTANCE, 6000));
+
+    // the internal requests are never filtered
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::INTERNAL, controlarbiter::RESISTANCE, 12, 0, 6000));
+
+    // hold expired
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::INCLINATION, 3, 3, 60000));
+    EXPECT_EQ(controlarbiter::EXTERNAL, a.owner(controlarbiter::RESISTANCE, 60000));
+
+    // released
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 8, 0, 61000));
+    a.release(controlarbiter::PROGRAM);
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::INCLINATION, 4, 4, 62000));
+}
+
+void ControlArbiterTestSuite::test_deduplication() {
+    controlarbiter a;
+    a.setRefreshTime(5000);
+    a.setTolerance(controlarbiter::POWER, 1);
+
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::POWER, 200, 0, 0));
+    for (int i = 1; i < 5; i++)
+        EXPECT_EQ(controlarbiter::DROP,
+                  a.submit(controlarbiter::EXTERNAL, controlarbiter::POWER, 200 + (i % 2) * 0.5, 0, i * 1000));
+    EXPECT_EQ(4u, a.dropped());
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::POWER, 200, 0, 5000));
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::EXTERNAL, controlarbiter::POWER, 210, 0, 6000));
+    EXPECT_EQ(3u, a.forwarded());
+}
+
+void ControlArbiterTestSuite::test_coalescing() {
+    controlarbiter a;
+    a.setMinInterval(controlarbiter::RESISTANCE, 500);
+    double value, extra;
+    controlarbiter::SOURCE source;
+
+    EXPECT_EQ(-1, a.nextDueMs());
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 10, 0, 0));
+    EXPECT_EQ(controlarbiter::DEFER, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 11, 0, 100));
+    EXPECT_EQ(controlarbiter::DEFER, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 12, 0, 200));
+    EXPECT_EQ(500, a.nextDueMs());
+    EXPECT_FALSE(a.takeDue(controlarbiter::RESISTANCE, 499, &value, &extra, &source));
+    EXPECT_TRUE(a.takeDue(controlarbiter::RESISTANCE, 500, &value, &extra, &source));
+    EXPECT_EQ(12, value);
+    EXPECT_EQ(controlarbiter::USER, source);
+    EXPECT_EQ(-1, a.nextDueMs());
+
+    // going back to the applied target cancels the pending one
+    EXPECT_EQ(controlarbiter::DEFER, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 13, 0, 600));
+    EXPECT_EQ(controlarbiter::DROP, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 12, 0, 700));
+    EXPECT_FALSE(a.takeDue(controlarbiter::RESISTANCE, 2000, &value, &extra, &source));
+    EXPECT_EQ(2u, a.forwarded());
+}
+
+void ControlArbiterTestSuite::test_rejectedPending() {
+    controlarbiter a;
+    a.setHoldTime(controlarbiter::USER, 10000);
+    a.setMinInterval(controlarbiter::RESISTANCE, 0);
+    double value, extra;
+    controlarbiter::SOURCE source;
+
+    // the user sets the resistance, then the program starts a new row
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 12, 0, 0));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 8, 0, 1000));
+    EXPECT_EQ(10000, a.nextDueMs());
+
+    // the user keeps changing it, so the program waits
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 13, 0, 5000));
+    EXPECT_EQ(15000, a.nextDueMs());
+    EXPECT_FALSE(a.takeDue(controlarbiter::RESISTANCE, 14999, &value, &extra, &source));
+
+    // the row target lands when the user's hold expires, and the program owns the target again
+    EXPECT_TRUE(a.takeDue(controlarbiter::RESISTANCE, 15000, &value, &extra, &source));
+    EXPECT_EQ(8, value);
+    EXPECT_EQ(controlarbiter::PROGRAM, source);
+    EXPECT_EQ(controlarbiter::PROGRAM, a.owner(controlarbiter::RESISTANCE, 15000));
+    EXPECT_EQ(-1, a.nextDueMs());
+
+    // Zwift repeating its target doesn't replace the one of the program
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 14, 0, 16000));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 9, 0, 17000));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::EXTERNAL, controlarbiter::RESISTANCE, 5, 0, 18000));
+    EXPECT_TRUE(a.takeDue(controlarbiter::RESISTANCE, 26000, &value, &extra, &source));
+    EXPECT_EQ(9, value);
+    EXPECT_EQ(controlarbiter::PROGRAM, source);
+
+    // the program ending forgets what it was waiting for
+    EXPECT_EQ(controlarbiter::FORWARD, a.submit(controlarbiter::USER, controlarbiter::RESISTANCE, 15, 0, 27000));
+    EXPECT_EQ(controlarbiter::REJECT, a.submit(controlarbiter::PROGRAM, controlarbiter::RESISTANCE, 10, 0, 28000));
+    a.release(controlarbiter::PROGRAM);
+    EXPECT_EQ(-1, a.nextDueMs());
+    EXPECT_FALSE(a.takeDue(controlarbiter::RESISTANCE, 40000, &value, &extra, &source));
+}
+
+void ControlArbiterTestSuite::test_scope() {
+    EXPECT_EQ(controlarbiter::EXTERNAL, controlarbiter::currentSource());
+    {
+        controlarbiter::scope program(controlarbiter::PROGRAM);
+        EXPECT_EQ(controlarbiter::PROGRAM, controlarbiter::currentSource());
+        {
+            controlarbiter::scope internal(controlarbiter::INTERNAL);
+            EXPECT_EQ(controlarbiter::INTERNAL, controlarbiter::currentSource());
+        }
+        EXPECT_EQ(controlarbiter::PROGRAM, controlarbiter::currentSource());
+    }
+    EXPECT_EQ(controlarbiter::EXTERNAL, controlarbiter::currentSource());
+}
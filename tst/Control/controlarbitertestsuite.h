@@ -0,0 +1,57 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "controlarbiter.h"
+
+class ControlArbiterTestSuite: public testing::Test {
+public:
+    ControlArbiterTestSuite();
+
+    /**
+     * @brief Test that a source with a lower priority can't change a target until the owner has been silent for its
+     * hold time, also on the targets sharing the owner.
+     */
+    void test_priority();
+
+    /**
+     * @brief Test that unchanged targets are dropped and sent again only after the refresh time.
+     */
+    void test_deduplication();
+
+    /**
+     * @brief Test that the requests arriving faster than the minimum interval are coalesced, the last one winning.
+     */
+    void test_coalescing();
+
+    /**
+     * @brief Test that a rejected request waits for the hold of the owner to expire, as the target of a new row of the
+     * training program while the user holds the resistance.
+     */
+    void test_rejectedPending();
+
+    /**
+     * @brief Test that the scope tags the requests and restores the previous source.
+     */
+    void test_scope();
+
+};
+
+TEST_F(ControlArbiterTestSuite, TestPriority) {
+    this->test_priority();
+}
+
+TEST_F(ControlArbiterTestSuite, TestDeduplication) {
+    this->test_deduplication();
+}
+
+TEST_F(ControlArbiterTestSuite, TestCoalescing) {
+    this->test_coalescing();
+}
+
+TEST_F(ControlArbiterTestSuite, TestRejectedPending) {
+    this->test_rejectedPending();
+}
+
+TEST_F(ControlArbiterTestSuite, TestScope) {
+    this->test_scope();
+}
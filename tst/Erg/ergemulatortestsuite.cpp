@@ -0,0 +1,71 @@
+#include "ergemulatortestsuite.h"
+
+ErgEmulatorTestSuite::ErgEmulatorTestSuite() {}
+
+void ErgEmulatorTestSuite::test_cadenceChange() {
+    ergemulator erg;
+    EXPECT_FALSE(erg.update(80, 150, 0));
+
+    erg.setTarget(200, 80, 0);
+    EXPECT_TRUE(erg.active());
+    EXPECT_FALSE(erg.update(81, 150, 100));
+    EXPECT_TRUE(erg.update(84, 150, 200));
+    EXPECT_FALSE(erg.update(85, 150, 300));
+    EXPECT_TRUE(erg.update(75, 150, 400));
+
+    // the trim is not touched by a cadence change
+    EXPECT_DOUBLE_EQ(200, erg.demand());
+
+    // stopped pedaling
+    EXPECT_FALSE(erg.update(10, 0, 500));
+
+    erg.setTarget(0, 80, 600);
+    EXPECT_FALSE(erg.active());
+}
+
+void ErgEmulatorTestSuite::test_settleAndDeadband() {
+    ergemulator erg;
+    erg.setTarget(200, 80, 0);
+
+    // still settling
+    EXPECT_FALSE(erg.update(80, 150, 1000));
+    EXPECT_DOUBLE_EQ(0, erg.trim());
+
+    // within 3% of the target
+    EXPECT_FALSE(erg.update(80, 195, 2000));
+    EXPECT_DOUBLE_EQ(0, erg.trim());
+
+    EXPECT_TRUE(erg.update(80, 180, 2000));
+    EXPECT_GT(erg.trim(), 0);
+    double trim = erg.trim();
+
+    // settling again after the new resistance
+    EXPECT_FALSE(erg.update(80, 180, 2500));
+    EXPECT_DOUBLE_EQ(trim, erg.trim());
+
+    // the trim follows a new target
+    erg.setTarget(100, 80, 3000);
+    EXPECT_DOUBLE_EQ(trim / 2, erg.trim());
+}
+
+void ErgEmulatorTestSuite::test_trimConvergence() {
+    ergemulator erg;
+    const double target = 200;
+    // the model of the bike overestimates its power by 25%
+    const double bias = 0.8;
+
+    erg.setTarget(target, 80, 0);
+    double applied = erg.demand();
+    int solves = 0;
+    for (qint64 now = 500; now <= 60000; now += 500) {
+        if (erg.update(80, applied * bias, now)) {
+            applied = erg.demand();
+            solves++;
+        }
+    }
+
+    EXPECT_NEAR(target, applied * bias, target * erg.deadband);
+    EXPECT_LE(erg.trim(), target * erg.maxTrim);
+    // it stops hunting once the power is within the deadband
+    EXPECT_LT(solves, 10);
+}
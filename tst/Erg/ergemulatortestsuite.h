@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "ergemulator.h"
+
+class ErgEmulatorTestSuite: public testing::Test {
+public:
+    ErgEmulatorTestSuite();
+
+    /**
+     * @brief Test that a cadence change solves the resistance again right away, also while the power is settling.
+     */
+    void test_cadenceChange();
+
+    /**
+     * @brief Test that the trim is frozen while the power settles and within the deadband.
+     */
+    void test_settleAndDeadband();
+
+    /**
+     * @brief Test that the trim brings the power of a bike with a wrong model to the target.
+     */
+    void test_trimConvergence();
+
+};
+
+TEST_F(ErgEmulatorTestSuite, TestCadenceChange) {
+    this->test_cadenceChange();
+}
+
+TEST_F(ErgEmulatorTestSuite, TestSettleAndDeadband) {
+    this->test_settleAndDeadband();
+}
+
+TEST_F(ErgEmulatorTestSuite, TestTrimConvergence) {
+    this->test_trimConvergence();
+}
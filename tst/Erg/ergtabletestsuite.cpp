@@ -588,3 +588,38 @@ void ErgTableTestSuite::test_dynamicErgTable() {
     this->test_wattageEstimation(inputs, expected);
 
 }
+
+void ErgTableTestSuite::test_resistanceEstimation() {
+
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.remove("ergDataPoints");
+
+    ergTable erg;
+    double resistance = -1;
+
+    // nothing learned yet
+    EXPECT_FALSE(erg.estimateResistance(75, 200, &resistance));
+
+    // the power grows with the cadence and the resistance: W = C * R / 2
+    for (uint16_t r = 4; r <= 10; r++) {
+        for (uint16_t c = 60; c <= 90; c += 10)
+            erg.collectData(c, c * r / 2, r, true);
+    }
+
+    // learned points
+    EXPECT_TRUE(erg.estimateResistance(80, 240, &resistance));
+    EXPECT_NEAR(6, resistance, 0.01);
+
+    // between two cadences and two levels
+    EXPECT_TRUE(erg.estimateResistance(75, 281.25, &resistance));
+    EXPECT_NEAR(7.5, resistance, 0.01);
+
+    // a bit over the hardest level
+    EXPECT_TRUE(erg.estimateResistance(80, 440, &resistance));
+    EXPECT_NEAR(11, resistance, 0.01);
+
+    // too far from the learned range
+    EXPECT_FALSE(erg.estimateResistance(80, 1000, &resistance));
+    EXPECT_FALSE(erg.estimateResistance(30, 60, &resistance));
+}
@@ -22,6 +22,11 @@ public:
      */
     void test_dynamicErgTable();
 
+    /**
+     * @brief Test the resistance estimated from a cadence and a wattage, inverting the table
+     */
+    void test_resistanceEstimation();
+
 };
 
 TEST_F(ErgTableTestSuite, TestDynamicErgTable) {
@@ -29,3 +34,7 @@ TEST_F(ErgTableTestSuite, TestDynamicErgTable) {
 }
 
 
+
+TEST_F(ErgTableTestSuite, TestResistanceEstimation) {
+    this->test_resistanceEstimation();
+}
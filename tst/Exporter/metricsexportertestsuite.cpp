@@ -0,0 +1,83 @@
+#include "metricsexportertestsuite.h"
+
+#include <QtNumeric>
+
+MetricsExporterTestSuite::MetricsExporterTestSuite() {}
+
+static SessionLine sample(double speed, const QGeoCoordinate &coordinate = QGeoCoordinate()) {
+    return SessionLine(speed, 2, 1.25, 200, 10, 30, 140, 0, 90, 50.5, 12, 600, false, 0, 0, 0, 0, coordinate, 0, 0, 0,
+                       0, QDateTime::fromMSecsSinceEpoch(1700000000000LL, Qt::UTC));
+}
+
+void MetricsExporterTestSuite::test_lineProtocol() {
+    QByteArray line = metricsexporter::lineProtocol(QStringLiteral("qz"),
+                                                    metricsexporter::tags(QStringLiteral("Bike"), bluetoothdevice::BIKE),
+                                                    sample(25.5));
+    EXPECT_EQ(QByteArray("qz,device=Bike,type=bike speed=25.5,inclination=2,distance=1.25,watts=200,resistance=10,"
+                         "peloton_resistance=30,heart=140,cadence=90,calories=50.5,elevation=12,elapsed=600 "
+                         "1700000000000000000\n"),
+              line);
+    EXPECT_EQ(1, line.count('\n'));
+}
+
+void MetricsExporterTestSuite::test_missingFields() {
+    QByteArray tags = metricsexporter::tags(QString(), bluetoothdevice::TREADMILL);
+    EXPECT_EQ(QByteArray(",type=treadmill"), tags);
+
+    QByteArray line = metricsexporter::lineProtocol(QStringLiteral("qz"), tags, sample(qQNaN()));
+    EXPECT_FALSE(line.contains("speed="));
+    EXPECT_TRUE(line.startsWith("qz,type=treadmill inclination=2,"));
+    EXPECT_FALSE(line.contains("latitude="));
+
+    line = metricsexporter::lineProtocol(QStringLiteral("qz"), tags, sample(10, QGeoCoordinate(45.5, 9.25)));
+    EXPECT_TRUE(line.contains(",latitude=45.5,longitude=9.25 "));
+}
+
+void MetricsExporterTestSuite::test_escaping() {
+    EXPECT_EQ(QByteArray(",device=Domyos\\ Bike\\,1\\=2,type=bike"),
+              metricsexporter::tags(QStringLiteral("Domyos Bike,1=2"), bluetoothdevice::BIKE));
+    EXPECT_EQ(QByteArray("device=\"a\\\"b\\\\c\",type=\"rowing\""),
+              metricsexporter::labels(QStringLiteral("a\"b\\c"), bluetoothdevice::ROWING));
+
+    QByteArray line = metricsexporter::lineProtocol(QStringLiteral("my metrics"), QByteArray(), sample(1));
+    EXPECT_TRUE(line.startsWith("my\\ metrics speed=1,"));
+}
+
+void MetricsExporterTestSuite::test_prometheus() {
+    QByteArray labels = metricsexporter::labels(QStringLiteral("Bike"), bluetoothdevice::BIKE);
+    QByteArray out = metricsexporter::prometheus(QStringLiteral("qz"), labels, sample(25.5));
+    EXPECT_TRUE(out.contains("# TYPE qz_watts gauge\nqz_watts{device=\"Bike\",type=\"bike\"} 200\n"));
+    EXPECT_TRUE(out.contains("qz_speed{device=\"Bike\",type=\"bike\"} 25.5\n"));
+    // one type line and one value per field, no timestamp: the scraper takes the time of the scrape
+    EXPECT_EQ(22, out.count('\n'));
+}
+
+void MetricsExporterTestSuite::test_spool() {
+    metricsspool spool(dir.filePath(QStringLiteral("spool.txt")), 20);
+    EXPECT_TRUE(spool.isEmpty());
+    EXPECT_TRUE(spool.append("a 1\n"));
+    EXPECT_TRUE(spool.append("b 2\n"));
+    EXPECT_EQ(8, spool.size());
+    EXPECT_EQ(QByteArray("a 1\nb 2\n"), spool.take());
+    EXPECT_TRUE(spool.isEmpty());
+    EXPECT_TRUE(spool.take().isEmpty());
+
+    // past the limit the oldest lines make room, down to three quarters of it
+    int dropped = -1;
+    EXPECT_TRUE(spool.append("a 1\nb 2\nc 3\nd 4\n", &dropped));
+    EXPECT_EQ(0, dropped);
+    EXPECT_TRUE(spool.append("e 5\nf 6\n", &dropped));
+    EXPECT_EQ(3, dropped);
+    EXPECT_EQ(QByteArray("d 4\ne 5\nf 6\n"), spool.take());
+
+    // the newest lines are kept even when they alone are over three quarters
+    EXPECT_TRUE(spool.append("a 1\nb 2\n"));
+    EXPECT_TRUE(spool.append("c 3333333333333\n", &dropped));
+    EXPECT_EQ(2, dropped);
+    EXPECT_EQ(QByteArray("c 3333333333333\n"), spool.take());
+
+    // without a file nothing is kept
+    metricsspool none(QString(), 20);
+    EXPECT_FALSE(none.append("a 1\n"));
+    EXPECT_TRUE(none.isEmpty());
+}
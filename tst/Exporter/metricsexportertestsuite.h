@@ -0,0 +1,59 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "metricsexporter.h"
+
+#include <QTemporaryDir>
+
+class MetricsExporterTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+public:
+    MetricsExporterTestSuite();
+
+    /**
+     * @brief Test that a sample becomes one line of the line protocol, with the tags and the timestamp in nanoseconds.
+     */
+    void test_lineProtocol();
+
+    /**
+     * @brief Test that the fields the device doesn't have are left out of the line.
+     */
+    void test_missingFields();
+
+    /**
+     * @brief Test that the device name is escaped in the tags and in the labels.
+     */
+    void test_escaping();
+
+    /**
+     * @brief Test that a sample becomes one gauge per field in the Prometheus text format.
+     */
+    void test_prometheus();
+
+    /**
+     * @brief Test that the spool gives back the lines in order, and drops the oldest ones past its limit.
+     */
+    void test_spool();
+
+};
+
+TEST_F(MetricsExporterTestSuite, TestLineProtocol) {
+    this->test_lineProtocol();
+}
+
+TEST_F(MetricsExporterTestSuite, TestMissingFields) {
+    this->test_missingFields();
+}
+
+TEST_F(MetricsExporterTestSuite, TestEscaping) {
+    this->test_escaping();
+}
+
+TEST_F(MetricsExporterTestSuite, TestPrometheus) {
+    this->test_prometheus();
+}
+
+TEST_F(MetricsExporterTestSuite, TestSpool) {
+    this->test_spool();
+}
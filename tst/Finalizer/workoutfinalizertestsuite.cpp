@@ -0,0 +1,115 @@
+#include "workoutfinalizertestsuite.h"
+#include "Tools/testsettings.h"
+
+#include <QThread>
+#include <atomic>
+
+WorkoutFinalizerTestSuite::WorkoutFinalizerTestSuite() {}
+
+void WorkoutFinalizerTestSuite::hold(workoutfinalizer &finalizer) {
+    // the pool has at most this many threads
+    holders = qMax(2, QThread::idealThreadCount());
+    for (int i = 0; i < holders; i++)
+        finalizer.runStage(QStringLiteral("hold"), [this]() { gate.acquire(); }, false);
+}
+
+void WorkoutFinalizerTestSuite::release() { gate.release(holders); }
+
+void WorkoutFinalizerTestSuite::test_run() {
+    workoutfinalizer finalizer;
+    std::atomic<int> runs{0};
+    std::atomic<int> finished{0};
+    std::atomic<bool> cancelled{true};
+    QObject::connect(&finalizer, &workoutfinalizer::finished, [&](bool c) {
+        finished++;
+        cancelled = c;
+    });
+
+    hold(finalizer);
+    for (int i = 0; i < 3; i++)
+        EXPECT_TRUE(finalizer.runStage(QStringLiteral("stage"), [&runs]() { runs++; }));
+    EXPECT_TRUE(finalizer.isRunning());
+    EXPECT_EQ(0, finished.load());
+    release();
+    finalizer.waitForDone();
+
+    EXPECT_EQ(3, runs.load());
+    EXPECT_EQ(1, finished.load());
+    EXPECT_FALSE(cancelled.load());
+    EXPECT_FALSE(finalizer.isRunning());
+    EXPECT_FALSE(finalizer.isCancelled());
+}
+
+void WorkoutFinalizerTestSuite::test_cancel() {
+    workoutfinalizer finalizer;
+    std::atomic<bool> gpx{false};
+    std::atomic<bool> fit{false};
+    std::atomic<int> finished{0};
+    std::atomic<bool> cancelled{false};
+    QObject::connect(&finalizer, &workoutfinalizer::finished, [&](bool c) {
+        finished++;
+        cancelled = c;
+    });
+
+    hold(finalizer);
+    EXPECT_TRUE(finalizer.runStage(QStringLiteral("gpx"), [&gpx]() { gpx = true; }));
+    EXPECT_TRUE(finalizer.runStage(QStringLiteral("fit"), [&fit]() { fit = true; }, false));
+    finalizer.cancel();
+    EXPECT_TRUE(finalizer.isCancelled());
+
+    // queued after the cancel: only the stages that can't be cancelled are taken
+    std::atomic<bool> mail{false};
+    std::atomic<bool> summary{false};
+    EXPECT_FALSE(finalizer.runStage(QStringLiteral("mail"), [&mail]() { mail = true; }));
+    EXPECT_TRUE(finalizer.runStage(QStringLiteral("summary"), [&summary]() { summary = true; }, false));
+    release();
+    finalizer.waitForDone();
+
+    EXPECT_FALSE(gpx.load());
+    EXPECT_TRUE(fit.load());
+    EXPECT_FALSE(mail.load());
+    EXPECT_TRUE(summary.load());
+    EXPECT_EQ(1, finished.load());
+    EXPECT_TRUE(cancelled.load());
+}
+
+void WorkoutFinalizerTestSuite::test_progress() {
+    workoutfinalizer finalizer;
+    std::atomic<int> notified{0};
+    QObject::connect(&finalizer, &workoutfinalizer::progressChanged, [&](int, const QString &) { notified++; });
+    EXPECT_EQ(100, finalizer.progress());
+
+    hold(finalizer);
+    finalizer.runStage(QStringLiteral("gpx"), []() {});
+    finalizer.runStage(QStringLiteral("trace"), []() {});
+    EXPECT_EQ(0, finalizer.progress());
+    finalizer.cancel();
+    release();
+    finalizer.waitForDone();
+
+    // the skipped stages count as done, once each
+    EXPECT_EQ(100, finalizer.progress());
+    EXPECT_EQ(holders + 2, notified.load());
+}
+
+void WorkoutFinalizerTestSuite::test_nextRun() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+
+    workoutfinalizer finalizer;
+    hold(finalizer);
+    finalizer.cancel();
+    EXPECT_TRUE(finalizer.isCancelled());
+
+    // no files: only the summary
+    std::atomic<int> summaries{0};
+    QObject::connect(&finalizer, &workoutfinalizer::summaryReady, [&](const workoutsummary &) { summaries++; });
+    finalizer.start(QSharedPointer<const workoutsnapshot>(new workoutsnapshot()));
+    EXPECT_FALSE(finalizer.isCancelled());
+    release();
+    finalizer.waitForDone();
+
+    EXPECT_EQ(1, summaries.load());
+    EXPECT_TRUE(finalizer.summary().valid);
+    EXPECT_EQ(100, finalizer.progress());
+}
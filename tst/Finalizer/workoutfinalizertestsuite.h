@@ -0,0 +1,61 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "workoutfinalizer.h"
+
+#include <QSemaphore>
+
+class WorkoutFinalizerTestSuite: public testing::Test {
+protected:
+    QSemaphore gate;
+    int holders = 0;
+
+    /**
+     * @brief Keeps every thread of the pool of the finalizer busy until release(), so the stages queued meanwhile wait.
+     */
+    void hold(workoutfinalizer &finalizer);
+
+    /**
+     * @brief Lets the stages of hold() end.
+     */
+    void release();
+public:
+    WorkoutFinalizerTestSuite();
+
+    /**
+     * @brief Test that every stage runs, and finished is emitted once when the last one is done.
+     */
+    void test_run();
+
+    /**
+     * @brief Test that cancel skips the cancellable stages not started yet, and never the ones that aren't.
+     */
+    void test_cancel();
+
+    /**
+     * @brief Test that the progress counts the stages done, the skipped ones too, over the stages queued.
+     */
+    void test_progress();
+
+    /**
+     * @brief Test that a cancelled run doesn't skip the stages of the next one.
+     */
+    void test_nextRun();
+
+};
+
+TEST_F(WorkoutFinalizerTestSuite, TestRun) {
+    this->test_run();
+}
+
+TEST_F(WorkoutFinalizerTestSuite, TestCancel) {
+    this->test_cancel();
+}
+
+TEST_F(WorkoutFinalizerTestSuite, TestProgress) {
+    this->test_progress();
+}
+
+TEST_F(WorkoutFinalizerTestSuite, TestNextRun) {
+    this->test_nextRun();
+}
@@ -0,0 +1,150 @@
+#include "heartratecontrollertestsuite.h"
+
+#include <QList>
+#include <math.h>
+
+#include "Tools/testsettings.h"
+#include "qzsettings.h"
+
+/**
+ * @brief Minimal runner model: the steady state heart rate grows linearly with the speed, the heart reaches it
+ * with a 40 seconds time constant and starts reacting 10 seconds after the speed change.
+ */
+class simulatedRunner {
+  public:
+    explicit simulatedRunner(double speed) : hr(steadyState(speed)) {
+        for (int i = 0; i < 10; i++)
+            delayed.append(speed);
+    }
+
+    double step(double speed) {
+        delayed.append(speed);
+        double effective = delayed.takeFirst();
+        hr += (steadyState(effective) - hr) / 40.0;
+        return hr;
+    }
+
+    static double steadyState(double speed) { return 70 + (9 * speed); }
+
+  private:
+    double hr;
+    QList<double> delayed;
+};
+
+HeartRateControllerTestSuite::HeartRateControllerTestSuite()
+{
+
+}
+
+void HeartRateControllerTestSuite::test_treadmillSpeedConvergence(double startSpeed, double hrMin, double hrMax) {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.setValue(QZSettings::heart_rate_controller_gain, 1.0);
+
+    hrpid pid;
+    hrpidparameters p = heartratecontroller::defaultParameters(heartratecontroller::SPEED);
+    p.outputMin = 1;
+    p.outputMax = 20;
+    pid.setParameters(p);
+
+    double speed = startSpeed;
+    pid.reset(speed);
+    simulatedRunner runner(speed);
+
+    bool entered = false;
+    for (int t = 0; t < 20 * 60; t++) {
+        double hr = runner.step(speed);
+        // the belts report integer bpm
+        double out = pid.update(hrMin, hrMax, floor(hr), 1.0);
+        double rounded = round(out / p.resolution) * p.resolution;
+        if (fabs(rounded - speed) >= p.resolution)
+            speed = rounded;
+
+        if (hr >= hrMin && hr <= hrMax)
+            entered = true;
+
+        if (entered) {
+            EXPECT_GE(hr, hrMin - 3) << "undershoot at second " << t;
+            EXPECT_LE(hr, hrMax + 3) << "overshoot at second " << t;
+        }
+    }
+
+    EXPECT_TRUE(entered);
+}
+
+void HeartRateControllerTestSuite::test_convergenceFromBelow() {
+    this->test_treadmillSpeedConvergence(5, 140, 150);
+}
+
+void HeartRateControllerTestSuite::test_convergenceFromAbove() {
+    this->test_treadmillSpeedConvergence(12, 120, 130);
+}
+
+void HeartRateControllerTestSuite::test_antiWindup() {
+    hrpid pid;
+    hrpidparameters p;
+    p.kp = 0.04;
+    p.ki = 0.002;
+    p.kd = 0.2;
+    p.outputMin = 1;
+    p.outputMax = 6; // the runner can't reach the band with this limit
+    p.maxRatePerSecond = 0.1;
+    p.resolution = 0.1;
+    pid.setParameters(p);
+
+    double speed = 5;
+    pid.reset(speed);
+    simulatedRunner runner(speed);
+
+    for (int t = 0; t < 10 * 60; t++) {
+        speed = pid.update(140, 150, runner.step(speed), 1.0);
+    }
+    EXPECT_NEAR(6, speed, 0.1);
+
+    // once the limit is lifted, a wound up integral would push the speed far above the 7.8 km/h needed
+    p.outputMax = 20;
+    pid.setParameters(p);
+    double maxHr = 0;
+    for (int t = 0; t < 15 * 60; t++) {
+        double hr = runner.step(speed);
+        maxHr = qMax(maxHr, hr);
+        speed = pid.update(140, 150, hr, 1.0);
+    }
+    EXPECT_LE(maxHr, 153);
+}
+
+void HeartRateControllerTestSuite::test_rateLimit() {
+    hrpid pid;
+    hrpidparameters p;
+    p.kp = 10;
+    p.ki = 1;
+    p.kd = 0;
+    p.outputMin = 0;
+    p.outputMax = 1000;
+    p.maxRatePerSecond = 3;
+    pid.setParameters(p);
+    pid.reset(100);
+
+    double last = 100;
+    for (int t = 0; t < 30; t++) {
+        double out = pid.update(160, 170, 100, 0.5);
+        EXPECT_LE(out - last, 1.5 + 1e-9);
+        last = out;
+    }
+}
+
+void HeartRateControllerTestSuite::test_resolutionSteps() {
+    // round(8) * 0.1 - round(7) * 0.1 is a bit less than 0.1
+    EXPECT_LT(round(0.8 / 0.1) * 0.1 - round(0.7 / 0.1) * 0.1, 0.1);
+    EXPECT_EQ(1, heartratecontroller::steps(0.8, 0.1) - heartratecontroller::steps(0.7, 0.1));
+
+    for (double resolution : {0.1, 0.5, 1.0}) {
+        for (int i = 0; i < 200; i++) {
+            double value = i * resolution;
+            EXPECT_EQ(i, heartratecontroller::steps(value, resolution));
+            // half a step away still is the same step
+            EXPECT_EQ(i, heartratecontroller::steps(value + (resolution * 0.49), resolution));
+            EXPECT_EQ(i + 1, heartratecontroller::steps(value + resolution, resolution));
+        }
+    }
+}
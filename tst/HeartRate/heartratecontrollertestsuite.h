@@ -0,0 +1,66 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "heartratecontroller.h"
+
+
+class HeartRateControllerTestSuite: public testing::Test {
+protected:
+
+    /**
+     * @brief Simulates a treadmill runner with a first order heart rate response (with transport delay)
+     * driven by the speed PID, and checks it settles in the band without overshooting it.
+     * @param startSpeed Initial speed. Units: km/h
+     * @param hrMin Lower bound of the target band. Units: bpm
+     * @param hrMax Upper bound of the target band. Units: bpm
+     */
+    void test_treadmillSpeedConvergence(double startSpeed, double hrMin, double hrMax);
+public:
+    HeartRateControllerTestSuite();
+
+    /**
+     * @brief Test that the speed loop reaches a higher heart rate band.
+     */
+    void test_convergenceFromBelow();
+
+    /**
+     * @brief Test that the speed loop reaches a lower heart rate band.
+     */
+    void test_convergenceFromAbove();
+
+    /**
+     * @brief Test that the integral doesn't wind up while the actuator is saturated.
+     */
+    void test_antiWindup();
+
+    /**
+     * @brief Test that the actuator never changes faster than the configured rate.
+     */
+    void test_rateLimit();
+
+    /**
+     * @brief Test that a change of a single step of the resolution is never lost to the floating point error.
+     */
+    void test_resolutionSteps();
+
+};
+
+TEST_F(HeartRateControllerTestSuite, TestConvergenceFromBelow) {
+    this->test_convergenceFromBelow();
+}
+
+TEST_F(HeartRateControllerTestSuite, TestConvergenceFromAbove) {
+    this->test_convergenceFromAbove();
+}
+
+TEST_F(HeartRateControllerTestSuite, TestAntiWindup) {
+    this->test_antiWindup();
+}
+
+TEST_F(HeartRateControllerTestSuite, TestRateLimit) {
+    this->test_rateLimit();
+}
+
+TEST_F(HeartRateControllerTestSuite, TestResolutionSteps) {
+    this->test_resolutionSteps();
+}
@@ -0,0 +1,88 @@
+#include "sessionjournaltestsuite.h"
+
+#include <QFile>
+
+SessionJournalTestSuite::SessionJournalTestSuite() {}
+
+static SessionLine sample(int i) {
+    return SessionLine(10 + (i * 0.1), 1, i * 0.003, 150 + i, 10, 0, 120 + (i % 10), 6, 80, i * 0.2, i * 0.1, i,
+                       (i % 60) == 0, 0, 0, 0, 0, QGeoCoordinate(45.0 + (i * 0.0001), 9.0), 0, 0, 0, 0);
+}
+
+QString SessionJournalTestSuite::writeJournal(int samples) {
+    QString filename = dir.filePath(QStringLiteral("journal.bin"));
+    {
+        sessionjournal journal;
+        EXPECT_TRUE(journal.begin(filename, 2));
+        for (int i = 1; i <= samples; i++) {
+            journalstate state;
+            state.elapsed = i;
+            state.moving = i - (i / 10);
+            state.odometer = i * 0.003;
+            state.programStep = i / 60;
+            state.programTicks = i;
+            journal.appendSample(sample(i));
+            journal.appendState(state);
+        }
+        journal.sync();
+        // the destructor stops the writer leaving the journal on disk, as a killed app would do
+    }
+    return filename;
+}
+
+void SessionJournalTestSuite::test_roundTrip() {
+    QString filename = this->writeJournal(300);
+
+    journalrecovery r = sessionjournal::recover(filename);
+    EXPECT_TRUE(r.valid);
+    EXPECT_FALSE(r.finished);
+    EXPECT_EQ(2, r.deviceType);
+    ASSERT_EQ(300, r.session.count());
+    EXPECT_DOUBLE_EQ(sample(300).speed, r.session.last().speed);
+    EXPECT_EQ(sample(300).watt, r.session.last().watt);
+    EXPECT_EQ(300u, r.session.last().elapsedTime);
+    EXPECT_TRUE(r.session.at(59).lapTrigger);
+    EXPECT_DOUBLE_EQ(sample(300).coordinate.latitude(), r.session.last().coordinate.latitude());
+    EXPECT_DOUBLE_EQ(300, r.state.elapsed);
+    EXPECT_DOUBLE_EQ(270, r.state.moving);
+    EXPECT_EQ(5, r.state.programStep);
+    EXPECT_EQ(300, r.state.programTicks);
+}
+
+void SessionJournalTestSuite::test_truncatedTail() {
+    QString filename = this->writeJournal(100);
+
+    QFile f(filename);
+    qint64 size = f.size();
+    // cuts the last state record in half
+    ASSERT_TRUE(f.resize(size - 20));
+
+    journalrecovery r = sessionjournal::recover(filename);
+    EXPECT_TRUE(r.valid);
+    EXPECT_EQ(100, r.session.count());
+    EXPECT_DOUBLE_EQ(99, r.state.elapsed);
+
+    // a corrupted byte in the middle stops the recovery at the damaged record
+    ASSERT_TRUE(f.open(QIODevice::ReadWrite));
+    f.seek(size / 2);
+    char c;
+    f.getChar(&c);
+    f.seek(size / 2);
+    f.putChar(c ^ 0x55);
+    f.close();
+
+    r = sessionjournal::recover(filename);
+    EXPECT_TRUE(r.valid);
+    EXPECT_GT(r.session.count(), 40);
+    EXPECT_LT(r.session.count(), 60);
+}
+
+void SessionJournalTestSuite::test_finish() {
+    QString filename = dir.filePath(QStringLiteral("finished.bin"));
+    sessionjournal journal;
+    EXPECT_TRUE(journal.begin(filename, 1));
+    journal.appendSample(sample(1));
+    journal.finish();
+    EXPECT_FALSE(journal.isOpen());
+    EXPECT_FALSE(QFile::exists(filename));
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "sessionjournal.h"
+
+#include <QTemporaryDir>
+
+class SessionJournalTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+
+    /**
+     * @brief Writes a journal with the specified number of samples, leaving it unfinished as after a crash.
+     */
+    QString writeJournal(int samples);
+public:
+    SessionJournalTestSuite();
+
+    /**
+     * @brief Test that the samples and the last state are read back as written.
+     */
+    void test_roundTrip();
+
+    /**
+     * @brief Test that a torn record at the end of the file is dropped and the previous ones are kept.
+     */
+    void test_truncatedTail();
+
+    /**
+     * @brief Test that a finished journal is removed from the disk.
+     */
+    void test_finish();
+
+};
+
+TEST_F(SessionJournalTestSuite, TestRoundTrip) {
+    this->test_roundTrip();
+}
+
+TEST_F(SessionJournalTestSuite, TestTruncatedTail) {
+    this->test_truncatedTail();
+}
+
+TEST_F(SessionJournalTestSuite, TestFinish) {
+    this->test_finish();
+}
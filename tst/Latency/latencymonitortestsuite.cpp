@@ -0,0 +1,91 @@
+#include "latencymonitortestsuite.h"
+#include "qzclock.h"
+
+#include <limits>
+
+LatencyMonitorTestSuite::LatencyMonitorTestSuite() {
+    qzclock::setManual(true, 1000000000LL);
+    latencymonitor::reset();
+}
+
+LatencyMonitorTestSuite::~LatencyMonitorTestSuite() {
+    latencymonitor::reset();
+    qzclock::setManual(false);
+}
+
+void LatencyMonitorTestSuite::test_bucketPrecision() {
+    int last = -1;
+    for (qint64 v = 0; v < 5000000; v = v < 100 ? v + 1 : v + (v / 37)) {
+        int b = latencyhistogram::bucketOf(v);
+        qint64 lower = latencyhistogram::bucketLowerBound(b);
+        EXPECT_GE(b, last) << "buckets must follow the values";
+        EXPECT_LE(lower, v);
+        EXPECT_LE(v - lower, qMax((qint64)0, v / latencyhistogram::subBuckets)) << "value " << v;
+        EXPECT_EQ(b, latencyhistogram::bucketOf(lower));
+        last = b;
+    }
+    // out of range values go to the last bucket
+    EXPECT_EQ(latencyhistogram::buckets - 1, latencyhistogram::bucketOf(std::numeric_limits<qint64>::max()));
+    EXPECT_EQ(0, latencyhistogram::bucketOf(-5));
+}
+
+void LatencyMonitorTestSuite::test_percentiles() {
+    latencyhistogram h;
+    EXPECT_EQ(0, h.percentile(50));
+
+    for (int i = 1; i <= 1000; i++)
+        h.record(i * 100);
+
+    EXPECT_EQ(1000u, h.count());
+    EXPECT_EQ(100000, h.max());
+    EXPECT_DOUBLE_EQ(50050.0, h.mean());
+    EXPECT_NEAR(50000, h.percentile(50), 50000 / latencyhistogram::subBuckets);
+    EXPECT_NEAR(99000, h.percentile(99), 99000 / latencyhistogram::subBuckets);
+    EXPECT_EQ(100000, h.percentile(100));
+
+    h.reset();
+    EXPECT_EQ(0u, h.count());
+    EXPECT_EQ(0, h.max());
+}
+
+void LatencyMonitorTestSuite::test_merge() {
+    latencyhistogram all, odd, even;
+    for (int i = 1; i <= 1000; i++) {
+        all.record(i * 100);
+        (i % 2 ? odd : even).record(i * 100);
+    }
+    odd.merge(even);
+
+    EXPECT_EQ(all.count(), odd.count());
+    EXPECT_EQ(all.max(), odd.max());
+    EXPECT_DOUBLE_EQ(all.mean(), odd.mean());
+    EXPECT_EQ(all.percentile(50), odd.percentile(50));
+    EXPECT_EQ(all.percentile(99), odd.percentile(99));
+
+    QJsonObject o = odd.toJson(1000.0);
+    EXPECT_DOUBLE_EQ(100.0, o[QStringLiteral("max")].toDouble());
+    EXPECT_DOUBLE_EQ(1000.0, o[QStringLiteral("count")].toDouble());
+}
+
+void LatencyMonitorTestSuite::test_stageDedup() {
+    const latencyhistogram &ui = latencymonitor::histogram(latencymonitor::UI);
+
+    latencymonitor::record(latencymonitor::UI, 0);
+    EXPECT_EQ(0u, ui.count());
+
+    qint64 ingress = qzclock::nowNs();
+    latencymonitor::ingress();
+    qzclock::advance(3000000);
+    latencymonitor::record(latencymonitor::UI, ingress);
+    qzclock::advance(3000000);
+    latencymonitor::record(latencymonitor::UI, ingress);
+    EXPECT_EQ(1u, ui.count());
+    EXPECT_EQ(3000, ui.max());
+
+    latencymonitor::ingress();
+    latencymonitor::record(latencymonitor::UI, qzclock::nowNs() - 8000000);
+    EXPECT_EQ(2u, ui.count());
+    EXPECT_EQ(8000, ui.max());
+    EXPECT_EQ(0u, latencymonitor::histogram(latencymonitor::SESSION).count());
+    EXPECT_EQ(2u, latencymonitor::ingressCount());
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "latencymonitor.h"
+
+class LatencyMonitorTestSuite: public testing::Test {
+public:
+    LatencyMonitorTestSuite();
+    ~LatencyMonitorTestSuite();
+
+    /**
+     * @brief Test that every value falls in a bucket whose lower bound is within the histogram precision.
+     */
+    void test_bucketPrecision();
+
+    /**
+     * @brief Test the percentiles, the mean and the maximum of a known distribution.
+     */
+    void test_percentiles();
+
+    /**
+     * @brief Test that merging two histograms gives the same summary as recording every value in one.
+     */
+    void test_merge();
+
+    /**
+     * @brief Test that a stage records a packet only once, and ignores the packets without an ingress stamp.
+     */
+    void test_stageDedup();
+
+};
+
+TEST_F(LatencyMonitorTestSuite, TestBucketPrecision) {
+    this->test_bucketPrecision();
+}
+
+TEST_F(LatencyMonitorTestSuite, TestPercentiles) {
+    this->test_percentiles();
+}
+
+TEST_F(LatencyMonitorTestSuite, TestMerge) {
+    this->test_merge();
+}
+
+TEST_F(LatencyMonitorTestSuite, TestStageDedup) {
+    this->test_stageDedup();
+}
@@ -0,0 +1,114 @@
+#include "pelotoncachetestsuite.h"
+
+#include <QDateTime>
+#include <QFile>
+
+PelotonCacheTestSuite::PelotonCacheTestSuite() {}
+
+void PelotonCacheTestSuite::test_json() {
+    pelotoncache cache(dir.path());
+    QByteArray ride("{\"ride\":{\"id\":\"a1b2\"}}");
+    QByteArray instructor("{\"name\":\"Instructor\"}");
+    QByteArray image("\x89PNG", 4);
+    QString url = QStringLiteral("https://s3.amazonaws.com/peloton-ride-images/a1b2/img.png");
+
+    EXPECT_TRUE(cache.ride(QStringLiteral("a1b2")).isEmpty());
+    cache.setRide(QStringLiteral("a1b2"), ride);
+    cache.setPerformance(QStringLiteral("a1b2"), instructor);
+    cache.setInstructor(QStringLiteral("c3d4"), instructor);
+    cache.setImage(url, image);
+
+    // a new cache on the same folder is the app started again
+    pelotoncache other(dir.path());
+    EXPECT_EQ(ride, other.ride(QStringLiteral("a1b2")));
+    EXPECT_EQ(instructor, other.performance(QStringLiteral("a1b2")));
+    EXPECT_EQ(instructor, other.instructor(QStringLiteral("c3d4")));
+    EXPECT_EQ(image, other.image(url));
+    EXPECT_TRUE(other.instructor(QStringLiteral("a1b2")).isEmpty());
+    EXPECT_TRUE(other.image(url + QStringLiteral("?")).isEmpty());
+}
+
+void PelotonCacheTestSuite::test_invalidId() {
+    pelotoncache cache(dir.path());
+    cache.setRide(QStringLiteral("../a1b2"), QByteArray("{}"));
+    EXPECT_TRUE(cache.ride(QStringLiteral("../a1b2")).isEmpty());
+    EXPECT_TRUE(cache.ride(QString()).isEmpty());
+    EXPECT_FALSE(QFile::exists(dir.filePath(QStringLiteral("a1b2.json"))));
+}
+
+void PelotonCacheTestSuite::test_rows() {
+    pelotoncache cache(dir.path());
+    QList<trainrow> rows;
+    trainrow r;
+    r.duration = QTime(0, 1, 30);
+    trainrowranges &rRanges = r.editRanges();
+    rRanges.lower_resistance = 30;
+    rRanges.average_resistance = 35;
+    rRanges.upper_resistance = 40;
+    rRanges.lower_cadence = 80;
+    rRanges.average_cadence = 85;
+    rRanges.upper_cadence = 90;
+    r.requested_peloton_resistance = 35;
+    rRanges.average_requested_peloton_resistance = 35;
+    rows.append(r);
+    trainrow t;
+    t.duration = QTime(0, 2, 0);
+    trainrowranges &tRanges = t.editRanges();
+    tRanges.pace_intensity = 3;
+    tRanges.lower_speed = 8.5;
+    tRanges.average_speed = 9;
+    tRanges.upper_speed = 9.5;
+    tRanges.lower_inclination = 1;
+    tRanges.average_inclination = 1.5;
+    tRanges.upper_inclination = 2;
+    rows.append(t);
+
+    cache.setRows(QStringLiteral("a1b2"), QStringLiteral("bike;50"), rows);
+
+    QList<trainrow> read;
+    EXPECT_FALSE(cache.rows(QStringLiteral("a1b2"), QStringLiteral("bike;60"), bluetoothdevice::BIKE, &read));
+    EXPECT_FALSE(cache.rows(QStringLiteral("e5f6"), QStringLiteral("bike;50"), bluetoothdevice::BIKE, &read));
+    ASSERT_TRUE(cache.rows(QStringLiteral("a1b2"), QStringLiteral("bike;50"), bluetoothdevice::BIKE, &read));
+    ASSERT_EQ(2, read.count());
+
+    EXPECT_EQ(r.duration, read.at(0).duration);
+    EXPECT_EQ(30, read.at(0).ranges().lower_resistance);
+    EXPECT_EQ(35, read.at(0).ranges().average_resistance);
+    EXPECT_EQ(40, read.at(0).ranges().upper_resistance);
+    EXPECT_EQ(85, read.at(0).ranges().average_cadence);
+    EXPECT_EQ(35, read.at(0).ranges().average_requested_peloton_resistance);
+    EXPECT_EQ(3, read.at(1).ranges().pace_intensity);
+    EXPECT_DOUBLE_EQ(8.5, read.at(1).ranges().lower_speed);
+    EXPECT_DOUBLE_EQ(9, read.at(1).ranges().average_speed);
+    EXPECT_DOUBLE_EQ(9.5, read.at(1).ranges().upper_speed);
+    EXPECT_DOUBLE_EQ(1, read.at(1).ranges().lower_inclination);
+    EXPECT_DOUBLE_EQ(1.5, read.at(1).ranges().average_inclination);
+    EXPECT_DOUBLE_EQ(2, read.at(1).ranges().upper_inclination);
+}
+
+static void age(const QString &fileName, int days) {
+    QFile file(fileName);
+    ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+    file.setFileTime(QDateTime::currentDateTimeUtc().addDays(-days), QFileDevice::FileModificationTime);
+}
+
+void PelotonCacheTestSuite::test_prune() {
+    pelotoncache cache(dir.path(), 10, 30);
+    cache.setRide(QStringLiteral("a1"), QByteArray("{\"a\":1}"));
+    cache.setRide(QStringLiteral("b2"), QByteArray("{\"b\":2}"));
+    cache.setRide(QStringLiteral("c3"), QByteArray("{\"c\":3}"));
+    cache.setInstructor(QStringLiteral("d4"), QByteArray("{}"));
+    age(dir.filePath(QStringLiteral("rides/a1.json")), 5);
+    age(dir.filePath(QStringLiteral("rides/b2.json")), 3);
+    age(dir.filePath(QStringLiteral("rides/c3.json")), 1);
+    age(dir.filePath(QStringLiteral("instructors/d4.json")), 60);
+
+    // reading a ride makes it the most recently used
+    EXPECT_FALSE(cache.ride(QStringLiteral("a1")).isEmpty());
+    cache.prune();
+
+    EXPECT_TRUE(cache.instructor(QStringLiteral("d4")).isEmpty());
+    EXPECT_TRUE(cache.ride(QStringLiteral("b2")).isEmpty());
+    EXPECT_TRUE(cache.ride(QStringLiteral("c3")).isEmpty());
+    EXPECT_EQ(QByteArray("{\"a\":1}"), cache.ride(QStringLiteral("a1")));
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "pelotoncache.h"
+
+#include <QTemporaryDir>
+
+class PelotonCacheTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+public:
+    PelotonCacheTestSuite();
+
+    /**
+     * @brief Test that the json of the rides, the instructors and the images is read back as written.
+     */
+    void test_json();
+
+    /**
+     * @brief Test that an id that is not a peloton id is not written nor read.
+     */
+    void test_invalidId();
+
+    /**
+     * @brief Test that the rows are read back with the peloton targets, and only with the same signature.
+     */
+    void test_rows();
+
+    /**
+     * @brief Test that the files not used for too long go first, and then the least recently used past the size limit.
+     */
+    void test_prune();
+
+};
+
+TEST_F(PelotonCacheTestSuite, TestJson) {
+    this->test_json();
+}
+
+TEST_F(PelotonCacheTestSuite, TestInvalidId) {
+    this->test_invalidId();
+}
+
+TEST_F(PelotonCacheTestSuite, TestRows) {
+    this->test_rows();
+}
+
+TEST_F(PelotonCacheTestSuite, TestPrune) {
+    this->test_prune();
+}
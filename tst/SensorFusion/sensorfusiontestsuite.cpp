@@ -0,0 +1,58 @@
+#include "sensorfusiontestsuite.h"
+
+SensorFusionTestSuite::SensorFusionTestSuite() {}
+
+void SensorFusionTestSuite::test_interpolation() {
+    sensorfusion fusion;
+    EXPECT_FALSE(fusion.hasData(sensorfusion::POWER));
+    EXPECT_EQ(0, fusion.valueAt(sensorfusion::POWER, 1000));
+
+    fusion.push(sensorfusion::POWER, 100, 1000);
+    fusion.push(sensorfusion::POWER, 200, 2000);
+    fusion.push(sensorfusion::POWER, 200, 2000); // same timestamp, ignored
+    fusion.push(sensorfusion::POWER, 150, 2500);
+
+    EXPECT_TRUE(fusion.hasData(sensorfusion::POWER));
+    EXPECT_DOUBLE_EQ(100, fusion.valueAt(sensorfusion::POWER, 500));
+    EXPECT_DOUBLE_EQ(150, fusion.valueAt(sensorfusion::POWER, 1500));
+    EXPECT_DOUBLE_EQ(175, fusion.valueAt(sensorfusion::POWER, 2250));
+    EXPECT_DOUBLE_EQ(150, fusion.valueAt(sensorfusion::POWER, 4000));
+
+    // the other channels are independent
+    EXPECT_FALSE(fusion.hasData(sensorfusion::HEART));
+
+    // old samples are dropped
+    fusion.push(sensorfusion::POWER, 300, 1000 + sensorfusion::historyMs + 500);
+    EXPECT_DOUBLE_EQ(200, fusion.valueAt(sensorfusion::POWER, 500));
+}
+
+void SensorFusionTestSuite::test_jitter() {
+    sensorfusion fusion(1000);
+    QList<qint64> all;
+    // a 1s timer with +-300ms of jitter and a completely missed tick at 5s
+    const qint64 calls[] = {10020, 11310, 11990, 13250, 13700, 15980, 16001, 17299};
+    for (qint64 now : calls)
+        all.append(fusion.dueTicks(now));
+
+    QList<qint64> expected = {10000, 11000, 12000, 13000, 14000, 15000, 16000, 17000};
+    EXPECT_EQ(expected, all);
+}
+
+void SensorFusionTestSuite::test_longGap() {
+    sensorfusion fusion(1000);
+    fusion.dueTicks(10000);
+    QList<qint64> ticks = fusion.dueTicks(10000 + ((sensorfusion::maxFill + 2) * 1000));
+    ASSERT_EQ(1, ticks.count());
+    EXPECT_EQ(17000, ticks.first());
+
+    fusion.restartGrid();
+    ticks = fusion.dueTicks(17500);
+    ASSERT_EQ(1, ticks.count());
+    EXPECT_EQ(17000, ticks.first());
+
+    // 4Hz grid
+    fusion.setPeriod(250);
+    fusion.dueTicks(20000);
+    ticks = fusion.dueTicks(20600);
+    EXPECT_EQ((QList<qint64>{20250, 20500}), ticks);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "sensorfusion.h"
+
+class SensorFusionTestSuite: public testing::Test {
+public:
+    SensorFusionTestSuite();
+
+    /**
+     * @brief Test that the values between two samples are interpolated and the ones outside are held.
+     */
+    void test_interpolation();
+
+    /**
+     * @brief Test that a late or early consumer gets exactly one instant per period.
+     */
+    void test_jitter();
+
+    /**
+     * @brief Test that a long gap restarts the grid instead of filling it.
+     */
+    void test_longGap();
+
+};
+
+TEST_F(SensorFusionTestSuite, TestInterpolation) {
+    this->test_interpolation();
+}
+
+TEST_F(SensorFusionTestSuite, TestJitter) {
+    this->test_jitter();
+}
+
+TEST_F(SensorFusionTestSuite, TestLongGap) {
+    this->test_longGap();
+}
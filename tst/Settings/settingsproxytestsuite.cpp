@@ -0,0 +1,84 @@
+#include "settingsproxytestsuite.h"
+#include "Tools/testsettings.h"
+
+SettingsProxyTestSuite::SettingsProxyTestSuite() {}
+
+void SettingsProxyTestSuite::test_cache() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.clear();
+    testSettings.qsettings.setValue("ftp", 250.0);
+
+    settingsproxy proxy;
+    EXPECT_EQ(250.0, proxy.value("ftp").toDouble());
+    EXPECT_EQ(250.0, proxy.value("ftp").toDouble());
+    EXPECT_FALSE(proxy.value("missing").isValid());
+    EXPECT_FALSE(proxy.contains("missing"));
+    EXPECT_EQ(2u, proxy.misses());
+    EXPECT_EQ(2u, proxy.hits());
+    EXPECT_TRUE(proxy.keys().contains("ftp"));
+}
+
+void SettingsProxyTestSuite::test_setValue() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.clear();
+    testSettings.qsettings.setValue("weight", 75.0);
+
+    settingsproxy proxy;
+    QStringList changed;
+    QObject::connect(&proxy, &settingsproxy::changed,
+                     [&changed](const QString &key, const QVariant &) { changed.append(key); });
+
+    EXPECT_TRUE(proxy.keys().contains("weight"));
+    EXPECT_FALSE(proxy.setValue("weight", 75.0));
+    EXPECT_TRUE(proxy.setValue("weight", 80.0));
+    EXPECT_TRUE(proxy.setValue("age", 40));
+    EXPECT_EQ(QStringList({"weight", "age"}), changed);
+
+    EXPECT_EQ(80.0, proxy.value("weight").toDouble());
+    EXPECT_TRUE(proxy.keys().contains("age"));
+    EXPECT_EQ(80.0, testSettings.qsettings.value("weight").toDouble());
+}
+
+void SettingsProxyTestSuite::test_invalidate() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.clear();
+    testSettings.qsettings.setValue("miles_unit", false);
+
+    settingsproxy proxy;
+    EXPECT_FALSE(proxy.value("miles_unit").toBool());
+
+    testSettings.qsettings.setValue("miles_unit", true);
+    EXPECT_FALSE(proxy.value("miles_unit").toBool());
+
+    proxy.invalidate();
+    EXPECT_TRUE(proxy.value("miles_unit").toBool());
+}
+
+void SettingsProxyTestSuite::test_refresh() {
+    TestSettings testSettings("Roberto Viola", "QDomyos-Zwift Testing");
+    testSettings.activate();
+    testSettings.qsettings.clear();
+    testSettings.qsettings.setValue("ftp", 200.0);
+    testSettings.qsettings.setValue("weight", 75.0);
+
+    settingsproxy proxy;
+    QStringList changed;
+    QObject::connect(&proxy, &settingsproxy::changed,
+                     [&changed](const QString &key, const QVariant &) { changed.append(key); });
+    EXPECT_EQ(200.0, proxy.value("ftp").toDouble());
+    EXPECT_EQ(75.0, proxy.value("weight").toDouble());
+    EXPECT_EQ(2, proxy.keys().count());
+    EXPECT_EQ(0, proxy.refresh());
+
+    // as the settings page does, through its own QSettings
+    testSettings.qsettings.setValue("ftp", 220.0);
+    testSettings.qsettings.setValue("age", 40);
+    EXPECT_EQ(2, proxy.refresh());
+    EXPECT_EQ(QStringList({"ftp", "age"}), changed);
+    EXPECT_EQ(220.0, proxy.value("ftp").toDouble());
+    EXPECT_TRUE(proxy.keys().contains("age"));
+    EXPECT_EQ(0, proxy.refresh());
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "settingsproxy.h"
+
+class SettingsProxyTestSuite: public testing::Test {
+public:
+    SettingsProxyTestSuite();
+
+    /**
+     * @brief Test that a value is read from the settings once, also when the key is missing.
+     */
+    void test_cache();
+
+    /**
+     * @brief Test that setValue writes through, updates the cache and notifies only the real changes.
+     */
+    void test_setValue();
+
+    /**
+     * @brief Test that the changes made without the proxy are seen after an invalidate.
+     */
+    void test_invalidate();
+
+    /**
+     * @brief Test that refresh notifies the values and the keys changed without the proxy, and only those.
+     */
+    void test_refresh();
+
+};
+
+TEST_F(SettingsProxyTestSuite, TestCache) {
+    this->test_cache();
+}
+
+TEST_F(SettingsProxyTestSuite, TestSetValue) {
+    this->test_setValue();
+}
+
+TEST_F(SettingsProxyTestSuite, TestInvalidate) {
+    this->test_invalidate();
+}
+
+TEST_F(SettingsProxyTestSuite, TestRefresh) {
+    this->test_refresh();
+}
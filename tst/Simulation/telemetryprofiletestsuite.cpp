@@ -0,0 +1,82 @@
+#include "telemetryprofiletestsuite.h"
+
+TelemetryProfileTestSuite::TelemetryProfileTestSuite() {}
+
+void TelemetryProfileTestSuite::test_deterministic() {
+    telemetryprofile a(telemetryprofile::SPRINTS, 42), b(telemetryprofile::SPRINTS, 42), c(telemetryprofile::SPRINTS, 43);
+    a.setDropoutRate(2);
+    b.setDropoutRate(2);
+    c.setDropoutRate(2);
+
+    bool different = false;
+    for (double t = 0; t < 600; t += 0.2) {
+        telemetrysample sa = a.sampleAt(t), sb = b.sampleAt(t), sc = c.sampleAt(t);
+        ASSERT_EQ(sa.dropout, sb.dropout);
+        EXPECT_DOUBLE_EQ(sa.watt, sb.watt);
+        EXPECT_DOUBLE_EQ(sa.heart, sb.heart);
+        if (sa.watt != sc.watt)
+            different = true;
+    }
+    EXPECT_TRUE(different);
+    EXPECT_EQ(a.samples(), b.samples());
+}
+
+void TelemetryProfileTestSuite::test_heartRateResponse() {
+    telemetryprofile p(telemetryprofile::STEADY, 1);
+    p.setFtp(200);
+
+    telemetrysample first = p.sampleAt(0);
+    telemetrysample early = first;
+    for (double t = 0; t <= 10; t += 1)
+        early = p.sampleAt(t);
+    // after 10 seconds the heart rate is still far from the steady state
+    EXPECT_LT(early.heart, 120);
+
+    telemetrysample settled = early, later = early;
+    for (double t = 11; t <= 3600; t += 1) {
+        telemetrysample s = p.sampleAt(t);
+        if (t == 600)
+            settled = s;
+        later = s;
+    }
+    EXPECT_GT(settled.heart, 125);
+    EXPECT_LT(settled.heart, 140);
+    // cardiac drift: +0.15 bpm per minute at the same effort
+    EXPECT_NEAR(later.heart - settled.heart, 0.15 * 50, 3);
+    EXPECT_NEAR(later.watt, 140, 20);
+}
+
+void TelemetryProfileTestSuite::test_dropouts() {
+    telemetryprofile p(telemetryprofile::STEADY, 7);
+    p.setDropoutRate(1);
+
+    int starts = 0;
+    bool previous = false;
+    for (double t = 0; t < 3600; t += 0.2) {
+        telemetrysample s = p.sampleAt(t);
+        if (s.dropout && !previous)
+            starts++;
+        if (s.dropout)
+            EXPECT_DOUBLE_EQ(0, s.watt);
+        previous = s.dropout;
+    }
+    EXPECT_GT(starts, 30);
+    EXPECT_LT(starts, 90);
+    // 1 to 5 seconds each
+    EXPECT_GT(p.dropouts(), (quint64)(starts * 5));
+    EXPECT_LT(p.dropouts(), (quint64)(starts * 26));
+
+    telemetryprofile none(telemetryprofile::STEADY, 7);
+    for (double t = 0; t < 600; t += 0.2)
+        EXPECT_FALSE(none.sampleAt(t).dropout);
+}
+
+void TelemetryProfileTestSuite::test_intervals() {
+    telemetryprofile p(telemetryprofile::INTERVALS, 1);
+    EXPECT_DOUBLE_EQ(0.55, p.intensity(100));
+    EXPECT_DOUBLE_EQ(1.05, p.intensity(300 + 60));
+    EXPECT_DOUBLE_EQ(0.55, p.intensity(300 + 300));
+    EXPECT_DOUBLE_EQ(1.05, p.intensity(300 + 420 + 10));
+    EXPECT_EQ(telemetryprofile::INTERVALS, telemetryprofile::fromName(QStringLiteral("Intervals")));
+    EXPECT_EQ(telemetryprofile::STEADY, telemetryprofile::fromName(QStringLiteral("unknown")));
+}
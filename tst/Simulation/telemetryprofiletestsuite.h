@@ -0,0 +1,46 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "telemetryprofile.h"
+
+class TelemetryProfileTestSuite: public testing::Test {
+public:
+    TelemetryProfileTestSuite();
+
+    /**
+     * @brief Test that the same seed gives the same ride.
+     */
+    void test_deterministic();
+
+    /**
+     * @brief Test that the heart rate follows the effort with a lag and keeps drifting up at a constant effort.
+     */
+    void test_heartRateResponse();
+
+    /**
+     * @brief Test that the dropouts happen at about the configured rate and last a few seconds.
+     */
+    void test_dropouts();
+
+    /**
+     * @brief Test the work and recovery phases of the intervals profile.
+     */
+    void test_intervals();
+
+};
+
+TEST_F(TelemetryProfileTestSuite, TestDeterministic) {
+    this->test_deterministic();
+}
+
+TEST_F(TelemetryProfileTestSuite, TestHeartRateResponse) {
+    this->test_heartRateResponse();
+}
+
+TEST_F(TelemetryProfileTestSuite, TestDropouts) {
+    this->test_dropouts();
+}
+
+TEST_F(TelemetryProfileTestSuite, TestIntervals) {
+    this->test_intervals();
+}
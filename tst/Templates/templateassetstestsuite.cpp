@@ -0,0 +1,104 @@
+#include "templateassetstestsuite.h"
+
+#include <QDir>
+#include <QFile>
+
+TemplateAssetsTestSuite::TemplateAssetsTestSuite() {
+    QDir().mkpath(dir.filePath(QStringLiteral("chartjs")));
+    assets.addFolder(QStringLiteral("chartjs"), dir.filePath(QStringLiteral("chartjs")));
+}
+
+void TemplateAssetsTestSuite::writeFile(const QString &name, const QByteArray &data) {
+    QFile output(dir.filePath(QStringLiteral("chartjs/") + name));
+    EXPECT_TRUE(output.open(QIODevice::WriteOnly));
+    output.write(data);
+}
+
+QByteArray TemplateAssetsTestSuite::header(const templateassets::response &r, const QByteArray &name) {
+    for (const auto &h : r.headers) {
+        if (h.first == name)
+            return h.second;
+    }
+    return QByteArray();
+}
+
+void TemplateAssetsTestSuite::test_gzip() {
+    EXPECT_EQ(0x3610A686u, templateassets::crc32("hello"));
+
+    QByteArray gz = templateassets::gzip("hello hello hello hello");
+    ASSERT_GT(gz.size(), 18);
+    EXPECT_EQ(QByteArray("\x1f\x8b\x08", 3), gz.left(3));
+    // the trailer: the crc and the size of the data, little endian
+    QByteArray trailer = gz.right(8);
+    quint32 crc = templateassets::crc32("hello hello hello hello");
+    for (int i = 0; i < 4; i++)
+        EXPECT_EQ(static_cast<char>((crc >> (i * 8)) & 0xFF), trailer.at(i));
+    EXPECT_EQ(23, trailer.at(4));
+    EXPECT_EQ(0, trailer.at(5));
+}
+
+void TemplateAssetsTestSuite::test_notModified() {
+    this->writeFile(QStringLiteral("chart.html"), "<html></html>");
+
+    templateassets::response r = assets.respond(QStringLiteral("/chartjs/chart.html"), "", "", "");
+    EXPECT_EQ(200, r.status);
+    EXPECT_EQ(QByteArray("text/html"), r.mimeType);
+    EXPECT_EQ(QByteArray("<html></html>"), r.body);
+    QByteArray etag = header(r, "ETag");
+    QByteArray lastModified = header(r, "Last-Modified");
+    ASSERT_FALSE(etag.isEmpty());
+    ASSERT_FALSE(lastModified.isEmpty());
+
+    r = assets.respond(QStringLiteral("/chartjs/chart.html"), etag, "", "");
+    EXPECT_EQ(304, r.status);
+    EXPECT_TRUE(r.body.isEmpty());
+
+    r = assets.respond(QStringLiteral("/chartjs/chart.html"), "", lastModified, "");
+    EXPECT_EQ(304, r.status);
+
+    r = assets.respond(QStringLiteral("/chartjs/chart.html"), "\"other\"", "", "");
+    EXPECT_EQ(200, r.status);
+}
+
+void TemplateAssetsTestSuite::test_encoding() {
+    QByteArray js;
+    for (int i = 0; i < 100; i++)
+        js += "var x = 1;\n";
+    this->writeFile(QStringLiteral("chart.js"), js);
+
+    templateassets::response r = assets.respond(QStringLiteral("/chartjs/chart.js"), "", "", "gzip, deflate");
+    EXPECT_EQ(200, r.status);
+    EXPECT_EQ(QByteArray("gzip"), header(r, "Content-Encoding"));
+    EXPECT_EQ(QByteArray("Accept-Encoding"), header(r, "Vary"));
+    EXPECT_LT(r.body.size(), js.size());
+    QByteArray gzipTag = header(r, "ETag");
+
+    r = assets.respond(QStringLiteral("/chartjs/chart.js"), "", "", "gzip;q=0");
+    EXPECT_TRUE(header(r, "Content-Encoding").isEmpty());
+    EXPECT_EQ(js, r.body);
+    EXPECT_NE(gzipTag, header(r, "ETag"));
+
+    r = assets.respond(QStringLiteral("/chartjs/chart.js"), gzipTag, "", "gzip");
+    EXPECT_EQ(304, r.status);
+    // the client has the gzip, not the plain file
+    r = assets.respond(QStringLiteral("/chartjs/chart.js"), gzipTag, "", "");
+    EXPECT_EQ(200, r.status);
+    EXPECT_EQ(js, r.body);
+
+    this->writeFile(QStringLiteral("map.js"), js);
+    this->writeFile(QStringLiteral("map.js.br"), "brotli");
+    r = assets.respond(QStringLiteral("/chartjs/map.js"), "", "", "gzip, br");
+    EXPECT_EQ(QByteArray("br"), header(r, "Content-Encoding"));
+    EXPECT_EQ(QByteArray("brotli"), r.body);
+}
+
+void TemplateAssetsTestSuite::test_outOfFolder() {
+    QFile output(dir.filePath(QStringLiteral("secret.txt")));
+    EXPECT_TRUE(output.open(QIODevice::WriteOnly));
+    output.write("secret");
+    output.close();
+
+    EXPECT_EQ(403, assets.respond(QStringLiteral("/chartjs/../secret.txt"), "", "", "").status);
+    EXPECT_EQ(403, assets.respond(QStringLiteral("/other/secret.txt"), "", "", "").status);
+    EXPECT_EQ(404, assets.respond(QStringLiteral("/chartjs/missing.js"), "", "", "").status);
+}
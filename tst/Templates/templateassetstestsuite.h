@@ -0,0 +1,62 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "templateassets.h"
+
+#include <QTemporaryDir>
+
+class TemplateAssetsTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+    templateassets assets;
+
+    /**
+     * @brief Writes a file in the template folder of the temporary folder.
+     */
+    void writeFile(const QString &name, const QByteArray &data);
+
+    /**
+     * @brief The value of a header of the response, empty if it isn't there.
+     */
+    static QByteArray header(const templateassets::response &r, const QByteArray &name);
+public:
+    TemplateAssetsTestSuite();
+
+    /**
+     * @brief Test that the crc32 and the gzip format are the standard ones.
+     */
+    void test_gzip();
+
+    /**
+     * @brief Test that a file is served with ETag and Last-Modified, and with a 304 when the client has it already.
+     */
+    void test_notModified();
+
+    /**
+     * @brief Test that the compressed variants are served to the clients that accept them, the .br next to the file
+     * first, each with its own tag for the 304.
+     */
+    void test_encoding();
+
+    /**
+     * @brief Test that nothing out of the template folders is served.
+     */
+    void test_outOfFolder();
+
+};
+
+TEST_F(TemplateAssetsTestSuite, TestGzip) {
+    this->test_gzip();
+}
+
+TEST_F(TemplateAssetsTestSuite, TestNotModified) {
+    this->test_notModified();
+}
+
+TEST_F(TemplateAssetsTestSuite, TestEncoding) {
+    this->test_encoding();
+}
+
+TEST_F(TemplateAssetsTestSuite, TestOutOfFolder) {
+    this->test_outOfFolder();
+}
@@ -0,0 +1,113 @@
+#include "templatescripttestsuite.h"
+
+#include <QStringList>
+
+namespace {
+// keeps what the update sends
+class RecordingSender : public TemplateInfoSender {
+  public:
+    RecordingSender() : TemplateInfoSender(QStringLiteral("test")) {}
+    bool isRunning() const override { return true; }
+    bool send(const QString &data) override {
+        sent.append(data);
+        return true;
+    }
+    QStringList sent;
+
+  protected:
+    bool init() override { return true; }
+};
+} // namespace
+
+TemplateScriptTestSuite::TemplateScriptTestSuite() {
+    QJSValue workout = engine.newObject();
+    workout.setProperty(QStringLiteral("watts"), 150);
+    workout.setProperty(QStringLiteral("deviceName"), QStringLiteral("bike"));
+    engine.globalObject().setProperty(QStringLiteral("workout"), workout);
+}
+
+QJSValue TemplateScriptTestSuite::call(const QJSValue &f) {
+    QJSValue glob = engine.globalObject();
+    return f.callWithInstance(glob, {glob.property(QStringLiteral("workout"))});
+}
+
+void TemplateScriptTestSuite::test_lastStatement() {
+    QJSValue f = TemplateInfoSender::compile(
+        &engine, QStringLiteral("let pad = function(num, size) {\n"
+                                "    num = num.toString();\n"
+                                "    while (num.length < size) num = \"0\" + num;\n"
+                                "    return num;\n"
+                                "};\n"
+                                "let getstring = function(workout) {\n"
+                                "    return workout.deviceName + \";\" + pad(workout.watts, 4);\n"
+                                "};\n"
+                                "getstring(this.workout)\n"));
+    ASSERT_TRUE(f.isCallable());
+    EXPECT_EQ(QStringLiteral("bike;0150"), this->call(f).toString());
+    // the helpers are declared again at every call, not on the global object
+    EXPECT_EQ(QStringLiteral("bike;0150"), this->call(f).toString());
+    EXPECT_FALSE(engine.globalObject().hasOwnProperty(QStringLiteral("pad")));
+}
+
+void TemplateScriptTestSuite::test_expression() {
+    QJSValue f = TemplateInfoSender::compile(
+        &engine, QStringLiteral("JSON.stringify({msg: \"workout\", content: this.workout})"));
+    ASSERT_TRUE(f.isCallable());
+    EXPECT_EQ(QStringLiteral("{\"msg\":\"workout\",\"content\":{\"watts\":150,\"deviceName\":\"bike\"}}"),
+              this->call(f).toString());
+
+    f = TemplateInfoSender::compile(&engine, QStringLiteral("workout.watts * 2; // the double"));
+    ASSERT_TRUE(f.isCallable());
+    EXPECT_EQ(300, this->call(f).toInt());
+}
+
+void TemplateScriptTestSuite::test_function() {
+    QJSValue f = TemplateInfoSender::compile(
+        &engine, QStringLiteral("(function(workout) { return {watts: workout.watts}; })"));
+    ASSERT_TRUE(f.isCallable());
+    QJSValue inner = this->call(f);
+    ASSERT_TRUE(inner.isCallable());
+    EXPECT_EQ(150, this->call(inner).property(QStringLiteral("watts")).toInt());
+}
+
+void TemplateScriptTestSuite::test_notCompiled() {
+    EXPECT_FALSE(TemplateInfoSender::compile(&engine, QStringLiteral("let x = workout.watts;")).isCallable());
+    EXPECT_FALSE(TemplateInfoSender::compile(&engine, QStringLiteral("if (workout.watts) { x = 1; }")).isCallable());
+    EXPECT_FALSE(TemplateInfoSender::compile(&engine, QStringLiteral("workout.watts + (")).isCallable());
+    EXPECT_FALSE(TemplateInfoSender::compile(&engine, QString()).isCallable());
+}
+
+void TemplateScriptTestSuite::test_state() {
+    QJSValue f = TemplateInfoSender::compile(
+        &engine, QStringLiteral("var local = (typeof local === 'undefined') ? 1 : local + 1;\n"
+                                "this.updates = (this.updates || 0) + 1;\n"
+                                "local + \";\" + updates\n"));
+    ASSERT_TRUE(f.isCallable());
+    EXPECT_EQ(QStringLiteral("1;1"), this->call(f).toString());
+    EXPECT_EQ(QStringLiteral("1;2"), this->call(f).toString());
+    EXPECT_EQ(2, engine.globalObject().property(QStringLiteral("updates")).toInt());
+    EXPECT_FALSE(engine.globalObject().hasOwnProperty(QStringLiteral("local")));
+}
+
+void TemplateScriptTestSuite::test_updateRunsOnce() {
+    RecordingSender sender;
+    sender.init(QStringLiteral("this.runs = (this.runs || 0) + 1;\n"
+                               "runs\n"));
+    for (int i = 1; i <= 3; i++) {
+        EXPECT_TRUE(sender.update(&engine));
+        EXPECT_EQ(i, engine.globalObject().property(QStringLiteral("runs")).toInt()) << "update " << i;
+    }
+    EXPECT_EQ(QStringList({QStringLiteral("1"), QStringLiteral("2"), QStringLiteral("3")}), sender.sent);
+    EXPECT_EQ(3, sender.stats().value(QStringLiteral("updates")).toInt());
+}
+
+void TemplateScriptTestSuite::test_updateFactory() {
+    RecordingSender sender;
+    sender.init(QStringLiteral("this.made = (this.made || 0) + 1;\n"
+                               "(function(workout) { this.runs = (this.runs || 0) + 1; return runs; })\n"));
+    for (int i = 1; i <= 3; i++)
+        EXPECT_TRUE(sender.update(&engine));
+    EXPECT_EQ(1, engine.globalObject().property(QStringLiteral("made")).toInt());
+    EXPECT_EQ(3, engine.globalObject().property(QStringLiteral("runs")).toInt());
+    EXPECT_EQ(QStringList({QStringLiteral("1"), QStringLiteral("2"), QStringLiteral("3")}), sender.sent);
+}
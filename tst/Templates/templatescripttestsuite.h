@@ -0,0 +1,84 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "templateinfosender.h"
+
+#include <QJSEngine>
+
+class TemplateScriptTestSuite: public testing::Test {
+protected:
+    QJSEngine engine;
+
+    /**
+     * @brief Calls the compiled script as the update does, with the workout as the argument and as this.workout.
+     */
+    QJSValue call(const QJSValue &f);
+public:
+    TemplateScriptTestSuite();
+
+    /**
+     * @brief Test that a script with helpers returns the value of its last statement, as evaluate did.
+     */
+    void test_lastStatement();
+
+    /**
+     * @brief Test that a single expression, also with a comment at its end, is returned.
+     */
+    void test_expression();
+
+    /**
+     * @brief Test that a script whose value is a function returns it, for the update to call it.
+     */
+    void test_function();
+
+    /**
+     * @brief Test that the scripts without a value to return are not compiled, so they are evaluated as before.
+     */
+    void test_notCompiled();
+
+    /**
+     * @brief Test that the declarations of a compiled script start again at every update, and that a state kept on
+     * the global object lasts.
+     */
+    void test_state();
+
+    /**
+     * @brief Test that update() runs the script once per update, the first one included.
+     */
+    void test_updateRunsOnce();
+
+    /**
+     * @brief Test that update() calls the factory of a script whose value is a function once, and then its function
+     * at every update.
+     */
+    void test_updateFactory();
+
+};
+
+TEST_F(TemplateScriptTestSuite, TestLastStatement) {
+    this->test_lastStatement();
+}
+
+TEST_F(TemplateScriptTestSuite, TestExpression) {
+    this->test_expression();
+}
+
+TEST_F(TemplateScriptTestSuite, TestFunction) {
+    this->test_function();
+}
+
+TEST_F(TemplateScriptTestSuite, TestNotCompiled) {
+    this->test_notCompiled();
+}
+
+TEST_F(TemplateScriptTestSuite, TestState) {
+    this->test_state();
+}
+
+TEST_F(TemplateScriptTestSuite, TestUpdateRunsOnce) {
+    this->test_updateRunsOnce();
+}
+
+TEST_F(TemplateScriptTestSuite, TestUpdateFactory) {
+    this->test_updateFactory();
+}
@@ -0,0 +1,96 @@
+#include "templatetelemetrytestsuite.h"
+
+#include <QtEndian>
+#include <QtNumeric>
+#include <cstring>
+
+TemplateTelemetryTestSuite::TemplateTelemetryTestSuite() {}
+
+int TemplateTelemetryTestSuite::index(const char *name) {
+    const QList<telemetryschema::field> &f = telemetryschema::fields();
+    for (int i = 0; i < f.count(); i++) {
+        if (!qstrcmp(f.at(i).name, name))
+            return i;
+    }
+    return -1;
+}
+
+void TemplateTelemetryTestSuite::test_schema() {
+    ASSERT_LE(telemetryschema::fields().count(), 64);
+    quint64 mask = telemetryschema::mask({QStringLiteral("watts"), QStringLiteral("latitude")});
+    EXPECT_EQ((quint64(1) << index("watts")) | (quint64(1) << index("latitude")), mask);
+
+    QByteArray schema = telemetryschema::schema(mask);
+    EXPECT_EQ(QByteArray("QZ"), schema.left(2));
+    EXPECT_EQ(telemetryschema::version, static_cast<quint8>(schema.at(2)));
+    EXPECT_EQ(telemetryschema::SCHEMA, static_cast<quint8>(schema.at(3)));
+    EXPECT_EQ(2, schema.at(4));
+    // by index: watts before latitude
+    EXPECT_EQ(index("watts"), schema.at(5));
+    EXPECT_EQ(telemetryschema::FLOAT32, static_cast<quint8>(schema.at(6)));
+    EXPECT_EQ(5, schema.at(7));
+    EXPECT_EQ(QByteArray("watts"), schema.mid(8, 5));
+    EXPECT_EQ(index("latitude"), schema.at(13));
+    EXPECT_EQ(telemetryschema::FLOAT64, static_cast<quint8>(schema.at(14)));
+    EXPECT_EQ(5 + 3 + 5 + 3 + 8, schema.size());
+
+    EXPECT_EQ(telemetryschema::fields().count(), telemetryschema::schema(telemetryschema::mask({})).at(4));
+}
+
+void TemplateTelemetryTestSuite::test_delta() {
+    quint64 mask = telemetryschema::mask({QStringLiteral("watts"), QStringLiteral("cadence"),
+                                          QStringLiteral("latitude")});
+    telemetryencoder encoder(mask, 100);
+    QVector<double> values(telemetryschema::fields().count(), qQNaN());
+    values[index("watts")] = 150;
+    values[index("cadence")] = 90;
+    values[index("latitude")] = 45.123456789;
+    values[index("heart")] = 120; // not in the mask
+
+    QByteArray frame = encoder.encode(values);
+    EXPECT_EQ(telemetryschema::KEYFRAME, static_cast<quint8>(frame.at(3)));
+    EXPECT_EQ(0u, qFromLittleEndian<quint32>(frame.constData() + 4));
+    EXPECT_EQ(mask, qFromLittleEndian<quint64>(frame.constData() + 8));
+    EXPECT_EQ(16 + 4 + 4 + 8, frame.size());
+    // by index: watts, latitude as a double, then cadence
+    float watts;
+    quint32 bits = qFromLittleEndian<quint32>(frame.constData() + 16);
+    std::memcpy(&watts, &bits, 4);
+    EXPECT_FLOAT_EQ(150, watts);
+    double latitude;
+    quint64 bits64 = qFromLittleEndian<quint64>(frame.constData() + 20);
+    std::memcpy(&latitude, &bits64, 8);
+    EXPECT_DOUBLE_EQ(45.123456789, latitude);
+
+    values[index("cadence")] = 91;
+    frame = encoder.encode(values);
+    EXPECT_EQ(telemetryschema::DELTA, static_cast<quint8>(frame.at(3)));
+    EXPECT_EQ(1u, qFromLittleEndian<quint32>(frame.constData() + 4));
+    EXPECT_EQ(quint64(1) << index("cadence"), qFromLittleEndian<quint64>(frame.constData() + 8));
+    EXPECT_EQ(16 + 4, frame.size());
+
+    frame = encoder.encode(values);
+    EXPECT_EQ(0u, qFromLittleEndian<quint64>(frame.constData() + 8));
+    EXPECT_EQ(16, frame.size());
+}
+
+void TemplateTelemetryTestSuite::test_keyframe() {
+    quint64 mask = telemetryschema::mask({QStringLiteral("watts")});
+    telemetryencoder encoder(mask, 3);
+    QVector<double> values(telemetryschema::fields().count(), 100);
+    for (int i = 0; i < 7; i++) {
+        QByteArray frame = encoder.encode(values);
+        EXPECT_EQ((i % 3) == 0 ? telemetryschema::KEYFRAME : telemetryschema::DELTA, static_cast<quint8>(frame.at(3)));
+        EXPECT_EQ((i % 3) == 0 ? mask : 0, qFromLittleEndian<quint64>(frame.constData() + 8));
+    }
+}
+
+void TemplateTelemetryTestSuite::test_index() {
+    const QList<telemetryschema::field> &f = telemetryschema::fields();
+    for (int i = 0; i < f.count(); i++)
+        EXPECT_EQ(i, telemetryschema::index(QLatin1String(f.at(i).name)));
+    EXPECT_EQ(index("watts"), telemetryschema::index(QStringLiteral("watts")));
+    // the values of the workout that aren't numbers
+    EXPECT_EQ(-1, telemetryschema::index(QStringLiteral("deviceName")));
+    EXPECT_EQ(-1, telemetryschema::index(QStringLiteral("watts_color")));
+}
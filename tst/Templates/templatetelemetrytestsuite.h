@@ -0,0 +1,52 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "templatetelemetry.h"
+
+class TemplateTelemetryTestSuite: public testing::Test {
+protected:
+    /**
+     * @brief The index of a field of the schema, -1 if it isn't there.
+     */
+    static int index(const char *name);
+public:
+    TemplateTelemetryTestSuite();
+
+    /**
+     * @brief Test that the schema frame describes the fields of the mask only.
+     */
+    void test_schema();
+
+    /**
+     * @brief Test that the first frame is a key frame with all the fields of the mask, and that the next ones have
+     * only the fields that changed.
+     */
+    void test_delta();
+
+    /**
+     * @brief Test that a key frame comes back at its interval.
+     */
+    void test_keyframe();
+
+    /**
+     * @brief Test that the fields are found by their name, and the other values of the workout are not.
+     */
+    void test_index();
+
+};
+
+TEST_F(TemplateTelemetryTestSuite, TestSchema) {
+    this->test_schema();
+}
+
+TEST_F(TemplateTelemetryTestSuite, TestDelta) {
+    this->test_delta();
+}
+
+TEST_F(TemplateTelemetryTestSuite, TestKeyframe) {
+    this->test_keyframe();
+}
+
+TEST_F(TemplateTelemetryTestSuite, TestIndex) {
+    this->test_index();
+}
@@ -0,0 +1,88 @@
+#include "timelineindextestsuite.h"
+#include <QList>
+
+TimelineIndexTestSuite::TimelineIndexTestSuite() {}
+
+// the walk on the rows done by trainprogram before the index
+static int walkRowAt(const QList<quint32> &seconds, quint64 ticks) {
+    quint64 elapsed = 0;
+    for (int i = 0; i < seconds.count(); i++) {
+        elapsed += seconds.at(i);
+        if (elapsed > ticks)
+            return i;
+    }
+    return seconds.count();
+}
+
+static quint64 walkSecondsBefore(const QList<quint32> &seconds, int row) {
+    quint64 elapsed = 0;
+    for (int i = 0; i < row; i++)
+        elapsed += seconds.at(i);
+    return elapsed;
+}
+
+void TimelineIndexTestSuite::test_rowAt() {
+    timelineindex index;
+    EXPECT_EQ(0, index.rowAt(0));
+    EXPECT_EQ(0u, index.totalSeconds());
+
+    QList<quint32> seconds;
+    for (int i = 0; i < 137; i++) {
+        // some rows are empty, like the distance rows that didn't end yet
+        seconds.append((i % 5 == 3) ? 0 : 1 + (i * 7) % 30);
+        index.append(seconds.last(), false);
+    }
+    EXPECT_EQ(137, index.count());
+    EXPECT_EQ(walkSecondsBefore(seconds, 137), index.totalSeconds());
+
+    for (quint64 ticks = 0; ticks <= index.totalSeconds() + 2; ticks++)
+        EXPECT_EQ(walkRowAt(seconds, ticks), index.rowAt(ticks));
+    for (int row = 0; row <= 137; row++)
+        EXPECT_EQ(walkSecondsBefore(seconds, row), index.secondsBefore(row));
+}
+
+void TimelineIndexTestSuite::test_setSeconds() {
+    timelineindex index;
+    QList<quint32> seconds;
+    for (int i = 0; i < 50; i++) {
+        seconds.append((i % 2) ? 0 : 60);
+        index.append(seconds.last(), i % 2);
+    }
+
+    for (int i = 1; i < 50; i += 2) {
+        seconds[i] = 10 + i;
+        index.setSeconds(i, seconds.at(i));
+        EXPECT_EQ(walkSecondsBefore(seconds, 50), index.totalSeconds());
+        EXPECT_EQ(seconds.at(i), index.seconds(i));
+    }
+    // a step run again gets a new length
+    seconds[7] = 3;
+    index.setSeconds(7, 3);
+    for (quint64 ticks = 0; ticks <= index.totalSeconds(); ticks += 7)
+        EXPECT_EQ(walkRowAt(seconds, ticks), index.rowAt(ticks));
+
+    // out of range, ignored
+    index.setSeconds(50, 1000);
+    EXPECT_EQ(walkSecondsBefore(seconds, 50), index.totalSeconds());
+
+    index.clear();
+    EXPECT_EQ(0, index.count());
+    EXPECT_EQ(0u, index.totalSeconds());
+}
+
+void TimelineIndexTestSuite::test_nextDistanceRow() {
+    timelineindex index;
+    EXPECT_EQ(0, index.nextDistanceRow(0));
+
+    // distance rows at 2, 3 and 9
+    for (int i = 0; i < 12; i++)
+        index.append(30, i == 2 || i == 3 || i == 9);
+
+    EXPECT_EQ(2, index.nextDistanceRow(0));
+    EXPECT_EQ(2, index.nextDistanceRow(2));
+    EXPECT_EQ(3, index.nextDistanceRow(3));
+    EXPECT_EQ(9, index.nextDistanceRow(4));
+    EXPECT_EQ(9, index.nextDistanceRow(9));
+    EXPECT_EQ(12, index.nextDistanceRow(10));
+    EXPECT_EQ(12, index.nextDistanceRow(12));
+}
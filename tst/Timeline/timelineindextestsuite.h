@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "timelineindex.h"
+
+class TimelineIndexTestSuite: public testing::Test {
+public:
+    TimelineIndexTestSuite();
+
+    /**
+     * @brief Test that the row of the ticks and the seconds before it match the walk on the rows, with empty rows.
+     */
+    void test_rowAt();
+
+    /**
+     * @brief Test that the index follows the seconds of the distance rows set when they end.
+     */
+    void test_setSeconds();
+
+    /**
+     * @brief Test the search of the next distance row.
+     */
+    void test_nextDistanceRow();
+
+};
+
+TEST_F(TimelineIndexTestSuite, TestRowAt) {
+    this->test_rowAt();
+}
+
+TEST_F(TimelineIndexTestSuite, TestSetSeconds) {
+    this->test_setSeconds();
+}
+
+TEST_F(TimelineIndexTestSuite, TestNextDistanceRow) {
+    this->test_nextDistanceRow();
+}
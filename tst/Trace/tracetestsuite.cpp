@@ -0,0 +1,108 @@
+#include "tracetestsuite.h"
+
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+TraceTestSuite::TraceTestSuite() {
+    qztrace::setCategories(0);
+    qztrace::clear();
+}
+
+TraceTestSuite::~TraceTestSuite() {
+    qztrace::setCategories(0);
+    qztrace::clear();
+}
+
+static QJsonArray exportEvents(const QString &filename) {
+    EXPECT_TRUE(qztrace::exportChromeTrace(filename));
+    QFile f(filename);
+    f.open(QIODevice::ReadOnly);
+    return QJsonDocument::fromJson(f.readAll()).object()[QStringLiteral("traceEvents")].toArray();
+}
+
+void TraceTestSuite::test_disabledCategory() {
+    int evaluated = 0;
+    auto value = [&evaluated]() { return ++evaluated; };
+
+    qztrace::setCategories(qztrace::UI);
+    QZ_TRACE(qztrace::CONTROL, "control", "value", value());
+    EXPECT_EQ(0, evaluated);
+    EXPECT_EQ(0, qztrace::count());
+
+    QZ_TRACE(qztrace::UI, "ui", "value", value());
+    EXPECT_EQ(1, evaluated);
+    EXPECT_EQ(1, qztrace::count());
+}
+
+void TraceTestSuite::test_exportChromeTrace() {
+    qztrace::setCategories(qztrace::ALL);
+    {
+        QZ_TRACE_SCOPE(qztrace::UI, "update");
+        QZ_TRACE(qztrace::CONTROL, "changePower", "power", 250, "grade", 1.5, "source", "test");
+    }
+    QZ_TRACE_PACKET(qztrace::BLE_RX, "notify", QByteArray::fromHex("0102ff"));
+
+    QJsonArray events = exportEvents(dir.filePath(QStringLiteral("trace.json")));
+    ASSERT_EQ(4, events.count());
+
+    EXPECT_EQ(QStringLiteral("B"), events[0].toObject()[QStringLiteral("ph")].toString());
+    EXPECT_EQ(QStringLiteral("update"), events[0].toObject()[QStringLiteral("name")].toString());
+
+    QJsonObject power = events[1].toObject();
+    EXPECT_EQ(QStringLiteral("control"), power[QStringLiteral("cat")].toString());
+    QJsonObject args = power[QStringLiteral("args")].toObject();
+    EXPECT_EQ(250, args[QStringLiteral("power")].toInt());
+    EXPECT_DOUBLE_EQ(1.5, args[QStringLiteral("grade")].toDouble());
+    EXPECT_EQ(QStringLiteral("test"), args[QStringLiteral("source")].toString());
+
+    EXPECT_EQ(QStringLiteral("E"), events[2].toObject()[QStringLiteral("ph")].toString());
+
+    QJsonObject packet = events[3].toObject()[QStringLiteral("args")].toObject();
+    EXPECT_EQ(3, packet[QStringLiteral("length")].toInt());
+    EXPECT_EQ(QStringLiteral("01 02 ff"), packet[QStringLiteral("data")].toString());
+
+    // the timestamps are monotonic and in microseconds
+    EXPECT_LE(events[0].toObject()[QStringLiteral("ts")].toDouble(), events[3].toObject()[QStringLiteral("ts")].toDouble());
+}
+
+void TraceTestSuite::test_ringOverwrite() {
+    qztrace::setCategories(qztrace::ALL);
+    for (int i = 0; i < 20000; i++)
+        QZ_TRACE(qztrace::DEVICE, "sample", "i", i);
+
+    QJsonArray events = exportEvents(dir.filePath(QStringLiteral("ring.json")));
+    EXPECT_EQ(16384, events.count());
+    EXPECT_EQ(16384, qztrace::count());
+    EXPECT_EQ(20000 - 16384, events.first().toObject()[QStringLiteral("args")].toObject()[QStringLiteral("i")].toInt());
+    EXPECT_EQ(19999, events.last().toObject()[QStringLiteral("args")].toObject()[QStringLiteral("i")].toInt());
+}
+
+void TraceTestSuite::test_lazyDebug() {
+    int evaluated = 0;
+    auto packet = [&evaluated]() {
+        ++evaluated;
+        return QByteArray("\x01\x02", 2);
+    };
+    bool logEnabled = qztrace::logEnabled();
+
+    qztrace::setLogEnabled(false);
+    QZ_DEBUG << "packet" << packet().toHex(' ');
+    EXPECT_EQ(0, evaluated);
+
+    qztrace::setLogEnabled(true);
+    QZ_DEBUG << "packet" << packet().toHex(' ');
+    EXPECT_EQ(1, evaluated);
+
+    // the else of the caller goes to its own if
+    bool elseTaken = false;
+    if (evaluated == 0)
+        QZ_DEBUG << "packet" << packet().toHex(' ');
+    else
+        elseTaken = true;
+    EXPECT_TRUE(elseTaken);
+    EXPECT_EQ(1, evaluated);
+
+    qztrace::setLogEnabled(logEnabled);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "qztrace.h"
+
+#include <QTemporaryDir>
+
+class TraceTestSuite: public testing::Test {
+protected:
+    QTemporaryDir dir;
+public:
+    TraceTestSuite();
+    ~TraceTestSuite();
+
+    /**
+     * @brief Test that nothing is recorded, and the arguments are not evaluated, while the category is disabled.
+     */
+    void test_disabledCategory();
+
+    /**
+     * @brief Test that the events, their arguments and the packets are exported as Chrome trace JSON.
+     */
+    void test_exportChromeTrace();
+
+    /**
+     * @brief Test that the ring keeps only the most recent events when it's full.
+     */
+    void test_ringOverwrite();
+
+    /**
+     * @brief Test that the arguments of QZ_DEBUG are evaluated only while the debug log is on, and that it stays a
+     * single statement under an if without braces.
+     */
+    void test_lazyDebug();
+
+};
+
+TEST_F(TraceTestSuite, TestDisabledCategory) {
+    this->test_disabledCategory();
+}
+
+TEST_F(TraceTestSuite, TestExportChromeTrace) {
+    this->test_exportChromeTrace();
+}
+
+TEST_F(TraceTestSuite, TestRingOverwrite) {
+    this->test_ringOverwrite();
+}
+
+TEST_F(TraceTestSuite, TestLazyDebug) {
+    this->test_lazyDebug();
+}
@@ -0,0 +1,102 @@
+#include "trainrowtestsuite.h"
+#include <QFile>
+#include <QTemporaryDir>
+
+TrainRowTestSuite::TrainRowTestSuite() {}
+
+void TrainRowTestSuite::test_rampTargets() {
+    trainrow row;
+    row.duration = QTime(0, 10, 0);
+    row.power = 100;
+    EXPECT_FALSE(row.isRamp());
+    EXPECT_EQ(100, row.at(300).power);
+
+    row.powerTo = 200;
+    row.speed = 8;
+    row.speedTo = 10;
+    row.cadence = 80;
+    EXPECT_TRUE(row.isRamp());
+
+    EXPECT_EQ(100, row.at(0).power);
+    EXPECT_EQ(150, row.at(300).power);
+    EXPECT_EQ(200, row.at(600).power);
+    EXPECT_DOUBLE_EQ(9.0, row.at(300).speed);
+    // 0.1 km/h steps
+    EXPECT_DOUBLE_EQ(8.3, row.at(91).speed);
+    // without an end target the value stays
+    EXPECT_EQ(80, row.at(300).cadence);
+    // out of the row the targets are the ones at the edges
+    EXPECT_EQ(100, row.at(-5).power);
+    EXPECT_EQ(200, row.at(700).power);
+
+    // the distance rows can't be interpolated on the time
+    row.distance = 1;
+    EXPECT_FALSE(row.isRamp());
+    EXPECT_EQ(100, row.at(300).power);
+}
+
+void TrainRowTestSuite::test_rampXml() {
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    QString fileName = dir.filePath("ramp.xml");
+
+    QList<trainrow> rows;
+    trainrow ramp;
+    ramp.duration = QTime(0, 20, 0);
+    ramp.power = 120;
+    ramp.powerTo = 240;
+    rows.append(ramp);
+    trainrow steady;
+    steady.duration = QTime(0, 5, 0);
+    steady.power = 240;
+    rows.append(steady);
+    EXPECT_TRUE(trainprogram::saveXML(fileName, rows));
+
+    QList<trainrow> loaded = trainprogram::loadXML(fileName, bluetoothdevice::BIKE);
+    ASSERT_EQ(2, loaded.count());
+    EXPECT_TRUE(loaded.at(0).isRamp());
+    EXPECT_EQ(120, loaded.at(0).power);
+    EXPECT_EQ(240, loaded.at(0).powerTo);
+    EXPECT_EQ(QTime(0, 20, 0), loaded.at(0).duration);
+    EXPECT_FALSE(loaded.at(1).isRamp());
+
+    QFile file(dir.filePath("speed.xml"));
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("<rows><row duration=\"00:30:00\" speedfrom=\"6\" speedto=\"12\"/></rows>");
+    file.close();
+    loaded = trainprogram::loadXML(file.fileName(), bluetoothdevice::TREADMILL);
+    ASSERT_EQ(1, loaded.count());
+    EXPECT_TRUE(loaded.at(0).forcespeed);
+    EXPECT_DOUBLE_EQ(6.0, loaded.at(0).speed);
+    EXPECT_DOUBLE_EQ(9.0, loaded.at(0).at(900).speed);
+}
+
+void TrainRowTestSuite::test_ranges() {
+    trainrow row;
+    EXPECT_EQ(-1, row.ranges().lower_cadence);
+    EXPECT_EQ(-200, row.ranges().upper_inclination);
+    // a row without ranges points to the shared defaults
+    EXPECT_EQ(&trainrow().ranges(), &row.ranges());
+
+    row.editRanges().lower_cadence = 80;
+    row.editRanges().upper_cadence = 90;
+    trainrow copy = row;
+    EXPECT_EQ(&row.ranges(), &copy.ranges());
+    copy.editRanges().upper_cadence = 100;
+    EXPECT_EQ(90, row.ranges().upper_cadence);
+    EXPECT_EQ(100, copy.ranges().upper_cadence);
+    EXPECT_EQ(80, copy.ranges().lower_cadence);
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    QString fileName = dir.filePath("ranges.xml");
+    row.duration = QTime(0, 1, 0);
+    trainrow plain;
+    plain.duration = QTime(0, 1, 0);
+    EXPECT_TRUE(trainprogram::saveXML(fileName, QList<trainrow>({row, plain})));
+    QList<trainrow> loaded = trainprogram::loadXML(fileName, bluetoothdevice::BIKE);
+    ASSERT_EQ(2, loaded.count());
+    EXPECT_EQ(80, loaded.at(0).ranges().lower_cadence);
+    EXPECT_EQ(90, loaded.at(0).ranges().upper_cadence);
+    EXPECT_EQ(&plain.ranges(), &loaded.at(1).ranges());
+}
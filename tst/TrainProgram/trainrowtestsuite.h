@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "trainprogram.h"
+
+class TrainRowTestSuite: public testing::Test {
+public:
+    TrainRowTestSuite();
+
+    /**
+     * @brief Test that the targets of a ramp are interpolated on the seconds, and that the other rows are untouched.
+     */
+    void test_rampTargets();
+
+    /**
+     * @brief Test that a ramp is saved and loaded as a single row, and that the old speedfrom/speedto rows load as one.
+     */
+    void test_rampXml();
+
+    /**
+     * @brief Test that the Peloton ranges are allocated only when set, shared by the copies and detached on write.
+     */
+    void test_ranges();
+
+};
+
+TEST_F(TrainRowTestSuite, TestRampTargets) {
+    this->test_rampTargets();
+}
+
+TEST_F(TrainRowTestSuite, TestRampXml) {
+    this->test_rampXml();
+}
+
+TEST_F(TrainRowTestSuite, TestRanges) {
+    this->test_ranges();
+}
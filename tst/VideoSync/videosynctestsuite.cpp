@@ -0,0 +1,76 @@
+#include "videosynctestsuite.h"
+#include <QList>
+
+VideoSyncTestSuite::VideoSyncTestSuite() {}
+
+// the walk on the rows done by trainprogram before the index
+static double walkAvgSpeed(const QList<int> &elapsed, const QList<double> &km, int step, int seconds) {
+    if (step >= elapsed.count())
+        return 0.0;
+    double sum = km.at(step);
+    int timesum = step > 0 ? elapsed.at(step) - elapsed.at(step - 1) : elapsed.at(step);
+    int c = step + 1;
+    while (timesum < seconds && c < elapsed.count()) {
+        sum += km.at(c);
+        timesum += elapsed.at(c) - elapsed.at(c - 1);
+        c++;
+    }
+    return timesum > 0 ? sum / ((double)timesum) * 3600.0 : 0.0;
+}
+
+void VideoSyncTestSuite::test_avgSpeed() {
+    videosync sync;
+    QList<int> elapsed;
+    QList<double> km;
+    int t = 0;
+    for (int i = 0; i < 200; i++) {
+        // 1 to 4 seconds between the points, 20 to 40 km/h
+        int dt = 1 + (i * 7) % 4;
+        double speed = 20 + (i * 13) % 21;
+        t += dt;
+        elapsed.append(t);
+        km.append(speed * dt / 3600.0);
+        sync.append(t, km.last());
+    }
+    EXPECT_EQ(200, sync.count());
+
+    for (int step = 0; step < 200; step += 3) {
+        for (int seconds : {1, 5, 60}) {
+            EXPECT_NEAR(walkAvgSpeed(elapsed, km, step, seconds), sync.avgSpeed(step, seconds), 1e-9);
+        }
+    }
+    EXPECT_EQ(0.0, sync.avgSpeed(200, 5));
+
+    // a timestamp going back is held, not trusted
+    videosync back;
+    back.append(10, 0.1);
+    back.append(5, 0.1);
+    EXPECT_NEAR(36.0, back.avgSpeed(0, 5), 1e-9);
+    EXPECT_EQ(0.0, back.avgSpeed(1, 5));
+}
+
+void VideoSyncTestSuite::test_rate() {
+    videosync sync;
+    sync.maxRate = 2;
+
+    // in sync, same speed of the recording
+    EXPECT_DOUBLE_EQ(1.0, sync.rate(100, 100, 30, 30));
+
+    // the rider is faster, the video catches up a step at a time
+    EXPECT_DOUBLE_EQ(1.25, sync.rate(101, 101, 60, 30));
+    EXPECT_DOUBLE_EQ(1.5, sync.rate(102, 102, 60, 30));
+    EXPECT_DOUBLE_EQ(1.75, sync.rate(103, 103, 60, 30));
+    EXPECT_DOUBLE_EQ(2.0, sync.rate(104, 104, 60, 30));
+    EXPECT_DOUBLE_EQ(2.0, sync.rate(105, 104, 60, 30));
+
+    // the video is far ahead: it slows down to the minimum, it doesn't stop
+    sync.resetRate();
+    EXPECT_DOUBLE_EQ(sync.minRate, sync.rate(100, 120, 20, 30));
+
+    // behind the gpx with the same speed: faster until it's back
+    sync.resetRate();
+    EXPECT_DOUBLE_EQ(1.5, sync.rate(102.5, 100, 30, 30));
+
+    // no speed in the route: the last rate is kept
+    EXPECT_DOUBLE_EQ(1.5, sync.rate(103, 101, 30, 0));
+}
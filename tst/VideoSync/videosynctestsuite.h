@@ -0,0 +1,28 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "videosync.h"
+
+class VideoSyncTestSuite: public testing::Test {
+public:
+    VideoSyncTestSuite();
+
+    /**
+     * @brief Test that the indexed average speed matches the walk on the rows, with irregular steps and windows.
+     */
+    void test_avgSpeed();
+
+    /**
+     * @brief Test that the rate follows the rider, closes the distance from the gpx and never jumps or stalls.
+     */
+    void test_rate();
+
+};
+
+TEST_F(VideoSyncTestSuite, TestAvgSpeed) {
+    this->test_avgSpeed();
+}
+
+TEST_F(VideoSyncTestSuite, TestRate) {
+    this->test_rate();
+}
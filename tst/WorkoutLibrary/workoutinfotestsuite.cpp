@@ -0,0 +1,73 @@
+#include "workoutinfotestsuite.h"
+
+WorkoutInfoTestSuite::WorkoutInfoTestSuite() {}
+
+static trainrow row(int seconds, int32_t power) {
+    trainrow r;
+    r.duration = QTime(0, 0, 0).addSecs(seconds);
+    r.power = power;
+    return r;
+}
+
+void WorkoutInfoTestSuite::test_tss() {
+    workoutinfo info = workoutinfo::analyze(QList<trainrow>({row(3600, 200)}), 200);
+    EXPECT_EQ(3600, info.duration);
+    EXPECT_NEAR(1.0, info.intensityFactor, 0.0001);
+    EXPECT_NEAR(100.0, info.tss, 0.01);
+
+    // without the ftp there is no intensity
+    info = workoutinfo::analyze(QList<trainrow>({row(3600, 200)}), 0);
+    EXPECT_EQ(0, info.tss);
+}
+
+void WorkoutInfoTestSuite::test_zonesAndProfile() {
+    workoutinfo info = workoutinfo::analyze(QList<trainrow>({row(600, 100), row(600, 200)}), 200);
+    EXPECT_EQ(QStringLiteral("power"), info.type);
+    EXPECT_EQ(1200, info.duration);
+    ASSERT_EQ(7, info.powerZones.count());
+    EXPECT_EQ(600, info.powerZones.at(0));
+    EXPECT_EQ(600, info.powerZones.at(3));
+    EXPECT_EQ(0, info.powerZones.at(6));
+    EXPECT_GT(info.tss, 0);
+    EXPECT_LT(info.intensityFactor, 1.0);
+
+    ASSERT_EQ(1200 / workoutinfo::profileStep, info.profile.count());
+    EXPECT_DOUBLE_EQ(100, info.profile.first());
+    EXPECT_DOUBLE_EQ(200, info.profile.last());
+
+    trainrow hr;
+    hr.duration = QTime(0, 5, 0);
+    hr.zoneHR = 2;
+    info = workoutinfo::analyze(QList<trainrow>({hr}), 200);
+    EXPECT_EQ(QStringLiteral("heart"), info.type);
+    ASSERT_EQ(5, info.heartZones.count());
+    EXPECT_EQ(300, info.heartZones.at(1));
+    EXPECT_EQ(0, info.tss);
+}
+
+void WorkoutInfoTestSuite::test_json() {
+    workoutinfo info = workoutinfo::analyze(QList<trainrow>({row(600, 100), row(600, 250)}), 200);
+    info.fileName = QStringLiteral("/training/sweet spot.zwo");
+    info.size = 1234;
+    info.lastModified = QDateTime::fromMSecsSinceEpoch(1700000000000);
+    info.description = QStringLiteral("Sweet spot");
+    info.tags = QStringLiteral("ftp");
+    info.deviceType = bluetoothdevice::ELLIPTICAL;
+
+    workoutinfo read = workoutinfo::fromJson(info.toJson());
+    EXPECT_TRUE(read.isValid());
+    EXPECT_EQ(info.fileName, read.fileName);
+    EXPECT_EQ(info.size, read.size);
+    EXPECT_EQ(info.lastModified, read.lastModified);
+    EXPECT_EQ(info.ftp, read.ftp);
+    EXPECT_EQ(bluetoothdevice::ELLIPTICAL, read.deviceType);
+    EXPECT_EQ(info.type, read.type);
+    EXPECT_EQ(info.duration, read.duration);
+    EXPECT_EQ(info.description, read.description);
+    EXPECT_EQ(info.tags, read.tags);
+    EXPECT_DOUBLE_EQ(info.tss, read.tss);
+    EXPECT_DOUBLE_EQ(info.intensityFactor, read.intensityFactor);
+    EXPECT_EQ(info.powerZones, read.powerZones);
+    EXPECT_EQ(info.heartZones, read.heartZones);
+    EXPECT_EQ(info.profile, read.profile);
+}
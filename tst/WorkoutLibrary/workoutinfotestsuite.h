@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "workoutlibrary.h"
+
+class WorkoutInfoTestSuite: public testing::Test {
+public:
+    WorkoutInfoTestSuite();
+
+    /**
+     * @brief Test that an hour at the ftp is an intensity factor of 1 and 100 TSS.
+     */
+    void test_tss();
+
+    /**
+     * @brief Test the seconds in the power and heart rate zones, the type and the profile of the preview.
+     */
+    void test_zonesAndProfile();
+
+    /**
+     * @brief Test that the info is read back from the json of the index as written.
+     */
+    void test_json();
+
+};
+
+TEST_F(WorkoutInfoTestSuite, TestTss) {
+    this->test_tss();
+}
+
+TEST_F(WorkoutInfoTestSuite, TestZonesAndProfile) {
+    this->test_zonesAndProfile();
+}
+
+TEST_F(WorkoutInfoTestSuite, TestJson) {
+    this->test_json();
+}
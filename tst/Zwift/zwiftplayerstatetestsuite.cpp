@@ -0,0 +1,87 @@
+#include "zwiftplayerstatetestsuite.h"
+#include <cstring>
+
+ZwiftPlayerStateTestSuite::ZwiftPlayerStateTestSuite() {}
+
+// a minimal protobuf encoder, enough to build the messages of the tests
+static void appendVarint(QByteArray &out, quint64 v) {
+    while (v >= 0x80) {
+        out.append((char)((v & 0x7F) | 0x80));
+        v >>= 7;
+    }
+    out.append((char)v);
+}
+
+static void appendKey(QByteArray &out, int field, int wireType) { appendVarint(out, ((quint64)field << 3) | wireType); }
+
+static void appendFloat(QByteArray &out, int field, float f) {
+    quint32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    appendKey(out, field, 5);
+    for (int i = 0; i < 4; i++)
+        out.append((char)((bits >> (8 * i)) & 0xFF));
+}
+
+void ZwiftPlayerStateTestSuite::test_decode() {
+    QByteArray message;
+    appendKey(message, 1, 0);
+    appendVarint(message, 123456);
+    appendKey(message, 2, 0);
+    appendVarint(message, 5000000000ULL);
+    appendKey(message, 3, 0);
+    appendVarint(message, 15234);
+    appendKey(message, 12, 0);
+    appendVarint(message, 250);
+    // the negative int32 are encoded on 10 bytes
+    appendKey(message, 15, 0);
+    appendVarint(message, (quint64)(qint64)-42);
+    // unknown fields of every type
+    appendKey(message, 40, 2);
+    appendVarint(message, 3);
+    message.append("abc");
+    appendKey(message, 41, 1);
+    message.append(QByteArray(8, '\x01'));
+    appendKey(message, 42, 0);
+    appendVarint(message, 7);
+    appendFloat(message, 25, -1250.5f);
+    appendFloat(message, 26, 9123.25f);
+    appendFloat(message, 27, 3.75f);
+
+    zwiftplayerstate state;
+    EXPECT_TRUE(zwiftplayerstate::decode(message, &state));
+    EXPECT_EQ(123456, state.id);
+    EXPECT_EQ(5000000000LL, state.worldTime);
+    EXPECT_EQ(15234, state.distance);
+    EXPECT_EQ(250, state.power);
+    EXPECT_EQ(-42, state.climbing);
+    EXPECT_FLOAT_EQ(-1250.5f, state.x);
+    EXPECT_FLOAT_EQ(9123.25f, state.altitude);
+    EXPECT_FLOAT_EQ(3.75f, state.y);
+    // not in the message
+    EXPECT_EQ(0, state.heartrate);
+
+    zwiftplayerstate empty;
+    EXPECT_TRUE(zwiftplayerstate::decode(QByteArray(), &empty));
+    EXPECT_EQ(0, empty.distance);
+}
+
+void ZwiftPlayerStateTestSuite::test_truncated() {
+    QByteArray message;
+    appendKey(message, 3, 0);
+    appendVarint(message, 15234);
+    appendFloat(message, 26, 12.5f);
+
+    zwiftplayerstate state;
+    for (int len = 1; len < message.size(); len++) {
+        // a cut in the middle of a field
+        if (len == 3)
+            continue;
+        EXPECT_FALSE(zwiftplayerstate::decode(message.constData(), len, &state));
+    }
+
+    QByteArray string;
+    appendKey(string, 40, 2);
+    appendVarint(string, 10);
+    string.append("abc");
+    EXPECT_FALSE(zwiftplayerstate::decode(string, &state));
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "gtest/gtest.h"
+#include "zwiftplayerstate.h"
+
+class ZwiftPlayerStateTestSuite: public testing::Test {
+public:
+    ZwiftPlayerStateTestSuite();
+
+    /**
+     * @brief Test the decoding of the varint, fixed32 and negative int32 fields, skipping the unknown ones.
+     */
+    void test_decode();
+
+    /**
+     * @brief Test that truncated messages are rejected.
+     */
+    void test_truncated();
+
+};
+
+TEST_F(ZwiftPlayerStateTestSuite, TestDecode) {
+    this->test_decode();
+}
+
+TEST_F(ZwiftPlayerStateTestSuite, TestTruncated) {
+    this->test_truncated();
+}
@@ -23,7 +23,29 @@ SOURCES += \
         Devices/bluetoothdevicetestsuite.cpp \
         Devices/bluetoothsignalreceiver.cpp \
         Devices/devicediscoveryinfo.cpp \
+        Bridge/bridgemachinetestsuite.cpp \
+        Clock/qzclocktestsuite.cpp \
+        Control/controlarbitertestsuite.cpp \
+        Erg/ergemulatortestsuite.cpp \
         Erg/ergtabletestsuite.cpp \
+        Exporter/metricsexportertestsuite.cpp \
+        Finalizer/workoutfinalizertestsuite.cpp \
+        HeartRate/heartratecontrollertestsuite.cpp \
+        Journal/sessionjournaltestsuite.cpp \
+        Peloton/pelotoncachetestsuite.cpp \
+        Latency/latencymonitortestsuite.cpp \
+        SensorFusion/sensorfusiontestsuite.cpp \
+        Settings/settingsproxytestsuite.cpp \
+        Templates/templateassetstestsuite.cpp \
+        Templates/templatescripttestsuite.cpp \
+        Templates/templatetelemetrytestsuite.cpp \
+        TrainProgram/trainrowtestsuite.cpp \
+        Simulation/telemetryprofiletestsuite.cpp \
+        Timeline/timelineindextestsuite.cpp \
+        Trace/tracetestsuite.cpp \
+        VideoSync/videosynctestsuite.cpp \
+        WorkoutLibrary/workoutinfotestsuite.cpp \
+        Zwift/zwiftplayerstatetestsuite.cpp \
         ToolTests/testsettingstestsuite.cpp \
         Tools/testsettings.cpp \
         main.cpp
@@ -140,6 +162,28 @@ HEADERS += \
     Devices/iConceptElliptical/iconceptellipticaltestdata.h \
     Devices/YpooElliptical/ypooellipticaltestdata.h \
     Devices/TrxAppGateUsbElliptical/trxappgateusbellipticaltestdata.h \
+    Bridge/bridgemachinetestsuite.h \
+    Clock/qzclocktestsuite.h \
+    Control/controlarbitertestsuite.h \
+    Erg/ergemulatortestsuite.h \
     Erg/ergtabletestsuite.h \
+    Exporter/metricsexportertestsuite.h \
+    Finalizer/workoutfinalizertestsuite.h \
+    HeartRate/heartratecontrollertestsuite.h \
+    Journal/sessionjournaltestsuite.h \
+    Peloton/pelotoncachetestsuite.h \
+    Latency/latencymonitortestsuite.h \
+    SensorFusion/sensorfusiontestsuite.h \
+    Settings/settingsproxytestsuite.h \
+    Templates/templateassetstestsuite.h \
+    Templates/templatescripttestsuite.h \
+    Templates/templatetelemetrytestsuite.h \
+    TrainProgram/trainrowtestsuite.h \
+    Simulation/telemetryprofiletestsuite.h \
+    Timeline/timelineindextestsuite.h \
+    Trace/tracetestsuite.h \
+    VideoSync/videosynctestsuite.h \
+    WorkoutLibrary/workoutinfotestsuite.h \
+    Zwift/zwiftplayerstatetestsuite.h \
     ToolTests/testsettingstestsuite.h \
     Tools/testsettings.h